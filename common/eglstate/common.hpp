@@ -25,7 +25,10 @@
 // For example, GL_POINTS and GL_NONE have same value. In glDrawArrays
 // or glDrawElements, it means GL_POINTS. In glDrawBuffer and glGetError,
 // it means GL_NONE.
-const char * EnumString(unsigned int e, const std::string &funName = std::string());
+// Returns NULL for unknown enums. The lookup does not allocate, and only reads
+// constant tables, so it is safe to call from several threads at once.
+const char * EnumString(unsigned int e, const char *funName = NULL);
+const char * EnumString(unsigned int e, const std::string &funName);
 
 struct Cube2D
 {
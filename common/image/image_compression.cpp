@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "image_compression.hpp"
 #include "image.hpp"
 
@@ -7,6 +12,7 @@ namespace
 const char * COMPRESSION_OPTION_LIST[] = {
     "UNCOMPRESSED",
     "ETC1",
+    "ETC1_FAST",
     "ETC2_A1",
     "ETC2_A8",
     "ASTC4x4",
@@ -32,6 +38,11 @@ const std::string PREFIX_ETC1 = "ETC1";
 const std::string PREFIX_ETC2 = "ETC2";
 const std::string PREFIX_ASTC = "ASTC";
 
+std::atomic<UInt32> compressionThreads(0);
+
+// Blocks per band, so that small textures are not worth a thread
+const UInt32 BLOCKS_PER_BAND = 1024;
+
 }
 
 namespace pat
@@ -56,7 +67,11 @@ bool IsValidCompressionOption(const std::string &option)
 
 bool CheckCompressionOptionSupport(const std::string &option)
 {
-    if (option.compare(0, PREFIX_ETC.size(), PREFIX_ETC) == 0)
+    if (option == "ETC1_FAST")
+    {
+        return true;
+    }
+    else if (option.compare(0, PREFIX_ETC.size(), PREFIX_ETC) == 0)
     {
         if (SupportETC1Compression())
         {
@@ -88,7 +103,7 @@ bool CanCompressAs(UInt32 format, UInt32 type, const std::string &option)
     if (IsValidCompressionOption(option) == false)
         return false;
 
-    if (option == "ETC1")
+    if (option == "ETC1" || option == "ETC1_FAST")
     {
         return CanCompressAsETC1(format, type);
     }
@@ -148,6 +163,13 @@ bool Compress(const Image &input, Image &output, const std::string &option)
             return CompressAsETC1(input, output);
         }
     }
+    else if (option == "ETC1_FAST")
+    {
+        if (CanCompressAsETC1(format, type))
+        {
+            return CompressAsETC1Fast(input, output);
+        }
+    }
     else if (option.compare(0, PREFIX_ETC2.size(), PREFIX_ETC2) == 0)
     {
         if (CanCompressAsETC2(format, type))
@@ -174,6 +196,49 @@ bool Compress(const Image &input, Image &output, const std::string &option)
     return false;
 }
 
+void SetCompressionThreads(UInt32 threads)
+{
+    compressionThreads = threads;
+}
+
+UInt32 GetCompressionThreads()
+{
+    const UInt32 threads = compressionThreads;
+    return threads ? threads : std::max(1u, std::thread::hardware_concurrency());
+}
+
+void ForEachBlockRows(UInt32 blockRows, UInt32 blocksPerRow, const std::function<void(UInt32, UInt32)> &func)
+{
+    const UInt32 bandRows = std::max<UInt32>(1, BLOCKS_PER_BAND / std::max<UInt32>(1, blocksPerRow));
+    const UInt32 bands = (blockRows + bandRows - 1) / bandRows;
+    const UInt32 threads = std::min(GetCompressionThreads(), bands);
+    if (threads <= 1)
+    {
+        if (blockRows)
+            func(0, blockRows);
+        return;
+    }
+
+    std::atomic<UInt32> next(0);
+    auto work = [&]()
+    {
+        for (UInt32 band = next++; band < bands; band = next++)
+        {
+            func(band * bandRows, std::min(blockRows, (band + 1) * bandRows));
+        }
+    };
+    std::vector<std::thread> pool;
+    for (UInt32 i = 1; i < threads; ++i)
+    {
+        pool.emplace_back(work);
+    }
+    work();
+    for (std::thread &thread : pool)
+    {
+        thread.join();
+    }
+}
+
 bool ImageCompressionFormat::CompressUncompress(const Image &input, Image &output) const
 {
     Image temp;
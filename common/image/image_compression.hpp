@@ -1,6 +1,8 @@
 #ifndef _INCLUDE_TEXTURE_COMPRESSION_HPP_
 #define _INCLUDE_TEXTURE_COMPRESSION_HPP_
 
+#include <functional>
+
 #include "base/base.hpp"
 
 namespace pat
@@ -44,6 +46,14 @@ bool CanCompressAs(UInt32 format, UInt32 type, const std::string &option);
 bool Uncompress(const Image &input, Image &output);
 bool Compress(const Image &input, Image &output, const std::string &option);
 
+// The block codecs share the rows of blocks of an image out between threads.
+// 0, the default, is one thread per core.
+void SetCompressionThreads(UInt32 threads);
+UInt32 GetCompressionThreads();
+// Call func(first, last) on bands of block rows covering [0, blockRows). The
+// bands run concurrently, so func must only write to its own rows.
+void ForEachBlockRows(UInt32 blockRows, UInt32 blocksPerRow, const std::function<void(UInt32, UInt32)> &func);
+
 ///////////////////////////////////////////////////////////////
 // ETC compression
 ///////////////////////////////////////////////////////////////
@@ -63,6 +73,9 @@ bool CanCompressAsETC1(UInt32 format, UInt32 type);
 bool CanCompressAsETC2(UInt32 format, UInt32 type);
 
 bool CompressAsETC1(const Image &input, Image &output);
+// Built-in encoder, for the "ETC1_FAST" option. Much faster than etcpack
+// and needs no external tool, at some cost in quality.
+bool CompressAsETC1Fast(const Image &input, Image &output);
 // Uncompress to GL_RGB & GL_UNSIGNED_BYTE
 bool UncompressFromETC1(const Image &input, Image &output);
 
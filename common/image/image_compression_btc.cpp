@@ -37,8 +37,8 @@ bool BTCCompressionFormat::Compress(const Image &input, Image &output) const
     if (!CanCompress(format, type))
         return false;
 
-    const UInt8 wblock = width / BLOCK_WIDTH;
-    const UInt8 hblock = height / BLOCK_HEIGHT;
+    const UInt32 wblock = width / BLOCK_WIDTH;
+    const UInt32 hblock = height / BLOCK_HEIGHT;
     const UInt8 *input_data = input.Data();
     if (!input_data) return false;
     const UInt32 output_data_size = wblock * hblock * COMPRESSED_BLOCK_SIZE;
@@ -47,51 +47,54 @@ bool BTCCompressionFormat::Compress(const Image &input, Image &output) const
     if (!output_data) return false;
 
     const UInt32 pixelsPerBlock = BLOCK_WIDTH * BLOCK_HEIGHT;
-    for (UInt32 by = 0; by < hblock; ++by)
+    ForEachBlockRows(hblock, wblock, [&](UInt32 first, UInt32 last)
     {
-        for (UInt32 bx = 0; bx < wblock; ++bx)
+        for (UInt32 by = first; by < last; ++by)
         {
-            Float32 sum = 0;
-            Float32 squareSum = 0;
-            for (UInt32 y = 0; y < BLOCK_HEIGHT; ++y)
+            for (UInt32 bx = 0; bx < wblock; ++bx)
             {
-                for (UInt32 x = 0; x < BLOCK_WIDTH; ++x)
+                Float32 sum = 0;
+                Float32 squareSum = 0;
+                for (UInt32 y = 0; y < BLOCK_HEIGHT; ++y)
                 {
-                    const UInt8 g = input_data[(by * BLOCK_HEIGHT + y) * width + (bx * BLOCK_WIDTH + x)];
-                    sum += g;
-                    squareSum += g * g;
+                    for (UInt32 x = 0; x < BLOCK_WIDTH; ++x)
+                    {
+                        const UInt8 g = input_data[(by * BLOCK_HEIGHT + y) * width + (bx * BLOCK_WIDTH + x)];
+                        sum += g;
+                        squareSum += g * g;
+                    }
                 }
-            }
-            const Float32 mean = sum / pixelsPerBlock;
-            const Float32 standardDeviation = std::sqrt(squareSum / pixelsPerBlock - mean * mean);
+                const Float32 mean = sum / pixelsPerBlock;
+                const Float32 standardDeviation = std::sqrt(squareSum / pixelsPerBlock - mean * mean);
 
-            UInt8 *p = output_data + COMPRESSED_BLOCK_SIZE * (wblock * by + bx);
-            p[0] = static_cast<UInt8>(mean);
-            p[1] = static_cast<UInt8>(standardDeviation);
-            p[2] = p[3] = 0;
+                UInt8 *p = output_data + COMPRESSED_BLOCK_SIZE * (wblock * by + bx);
+                p[0] = static_cast<UInt8>(mean);
+                p[1] = static_cast<UInt8>(standardDeviation);
+                p[2] = p[3] = 0;
 
-            for (UInt32 y = 0; y < BLOCK_HEIGHT/2; ++y)
-            {
-                for (UInt32 x = 0; x < BLOCK_WIDTH; ++x)
+                for (UInt32 y = 0; y < BLOCK_HEIGHT/2; ++y)
                 {
-                    const UInt32 i = y * BLOCK_WIDTH + x;
-                    const UInt8 g = input_data[(by * BLOCK_HEIGHT + y) * width + (bx * BLOCK_WIDTH + x)];
-                    if (g >= mean)
-                        p[2] |= 1 << (7 - i);
+                    for (UInt32 x = 0; x < BLOCK_WIDTH; ++x)
+                    {
+                        const UInt32 i = y * BLOCK_WIDTH + x;
+                        const UInt8 g = input_data[(by * BLOCK_HEIGHT + y) * width + (bx * BLOCK_WIDTH + x)];
+                        if (g >= mean)
+                            p[2] |= 1 << (7 - i);
+                    }
                 }
-            }
-            for (UInt32 y = BLOCK_HEIGHT/2; y < BLOCK_HEIGHT; ++y)
-            {
-                for (UInt32 x = 0; x < BLOCK_WIDTH; ++x)
+                for (UInt32 y = BLOCK_HEIGHT/2; y < BLOCK_HEIGHT; ++y)
                 {
-                    const UInt32 i = (y - BLOCK_HEIGHT/2) * BLOCK_WIDTH + x;
-                    const UInt8 g = input_data[(by * BLOCK_HEIGHT + y) * width + (bx * BLOCK_WIDTH + x)];
-                    if (g >= mean)
-                        p[3] |= 1 << (7 - i);
+                    for (UInt32 x = 0; x < BLOCK_WIDTH; ++x)
+                    {
+                        const UInt32 i = (y - BLOCK_HEIGHT/2) * BLOCK_WIDTH + x;
+                        const UInt8 g = input_data[(by * BLOCK_HEIGHT + y) * width + (bx * BLOCK_WIDTH + x)];
+                        if (g >= mean)
+                            p[3] |= 1 << (7 - i);
+                    }
                 }
             }
         }
-    }
+    });
     output.Set(width, height, GL_BTC_LUMINANCE_PAT, GL_NONE, output_data_size, output_data, false, true);
 
     return true;
@@ -108,8 +111,8 @@ bool BTCCompressionFormat::Uncompress(const Image &input, Image &output) const
     if (!IsCompressed(format))
         return false;
 
-    const UInt8 wblock = width / BLOCK_WIDTH;
-    const UInt8 hblock = height / BLOCK_HEIGHT;
+    const UInt32 wblock = width / BLOCK_WIDTH;
+    const UInt32 hblock = height / BLOCK_HEIGHT;
     const UInt8 *input_data = input.Data();
     if (!input_data)
         return false;
@@ -120,45 +123,48 @@ bool BTCCompressionFormat::Uncompress(const Image &input, Image &output) const
         return false;
 
     const UInt32 pixelsPerBlock = BLOCK_WIDTH * BLOCK_HEIGHT;
-    for (UInt32 by = 0; by < hblock; ++by)
+    ForEachBlockRows(hblock, wblock, [&](UInt32 first, UInt32 last)
     {
-        for (UInt32 bx = 0; bx < wblock; ++bx)
+        for (UInt32 by = first; by < last; ++by)
         {
-            const UInt8 *ip = input_data + COMPRESSED_BLOCK_SIZE * (by * wblock + bx);
-            UInt8 *op = output_data + pixelsPerBlock * (by * wblock + bx);
-            const Float32 mean = ip[0];
-            const Float32 standardDeviation = ip[1];
-            Float32 bigThanMean = 0;
-            for (SInt32 i = 7; i >= 0; --i)
+            for (UInt32 bx = 0; bx < wblock; ++bx)
             {
-                if (ip[2] & (1 << i))
-                    bigThanMean += 1;
-            }
-            for (SInt32 i = 7; i >= 0; --i)
-            {
-                if (ip[3] & (1 << i))
-                    bigThanMean += 1;
-            }
+                const UInt8 *ip = input_data + COMPRESSED_BLOCK_SIZE * (by * wblock + bx);
+                UInt8 *op = output_data + pixelsPerBlock * (by * wblock + bx);
+                const Float32 mean = ip[0];
+                const Float32 standardDeviation = ip[1];
+                Float32 bigThanMean = 0;
+                for (SInt32 i = 7; i >= 0; --i)
+                {
+                    if (ip[2] & (1 << i))
+                        bigThanMean += 1;
+                }
+                for (SInt32 i = 7; i >= 0; --i)
+                {
+                    if (ip[3] & (1 << i))
+                        bigThanMean += 1;
+                }
 
-            const UInt8 a = static_cast<UInt8>(mean - standardDeviation * std::sqrt(bigThanMean / (pixelsPerBlock - bigThanMean)));
-            const UInt8 b = static_cast<UInt8>(mean + standardDeviation * std::sqrt((pixelsPerBlock - bigThanMean) / bigThanMean));
+                const UInt8 a = static_cast<UInt8>(mean - standardDeviation * std::sqrt(bigThanMean / (pixelsPerBlock - bigThanMean)));
+                const UInt8 b = static_cast<UInt8>(mean + standardDeviation * std::sqrt((pixelsPerBlock - bigThanMean) / bigThanMean));
 
-            for (SInt32 i = 7; i >= 0; --i)
-            {
-                if (ip[2] & (1 << i))
-                    *(op++) = b;
-                else
-                    *(op++) = a;
-            }
-            for (SInt32 i = 7; i >= 0; --i)
-            {
-                if (ip[3] & (1 << i))
-                    *(op++) = b;
-                else
-                    *(op++) = a;
+                for (SInt32 i = 7; i >= 0; --i)
+                {
+                    if (ip[2] & (1 << i))
+                        *(op++) = b;
+                    else
+                        *(op++) = a;
+                }
+                for (SInt32 i = 7; i >= 0; --i)
+                {
+                    if (ip[3] & (1 << i))
+                        *(op++) = b;
+                    else
+                        *(op++) = a;
+                }
             }
         }
-    }
+    });
     output.Set(width, height, GL_LUMINANCE, GL_UNSIGNED_BYTE, output_data_size, output_data, false, true);
 
     return true;
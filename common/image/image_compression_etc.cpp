@@ -1,4 +1,12 @@
+#include <algorithm>
+#include <atomic>
+#include <climits>
 #include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
 #include <GLES2/gl2.h>
 #include <GLES2/gl2ext.h>
 
@@ -25,18 +33,9 @@ const unsigned char ModifierIndexTable[] = {
     2, 3, 1, 0,
 };
 
-const unsigned char PixelXOffset[] = {
-    0, 0, 0, 0,
-    1, 1, 1, 1,
-    2, 2, 2, 2,
-    3, 3, 3, 3,
-};
-
-const unsigned char PixelYOffset[] = {
-    0, 1, 2, 3,
-    0, 1, 2, 3,
-    0, 1, 2, 3,
-    0, 1, 2, 3,
+// Inverse of ModifierIndexTable
+const unsigned char PixelIndexTable[] = {
+    3, 2, 0, 1,
 };
 
 const unsigned char FlipTable1[] = {
@@ -83,17 +82,6 @@ unsigned char Clamp(unsigned char a, int b)
         return static_cast<unsigned char>(c);
 }
 
-void SetPixel(unsigned char *dest, unsigned char r, unsigned char g, unsigned char b, int modifier, int x, int y, int width, int height)
-{
-    if (x >= width || y >= height)
-        return;
-
-    dest += (width * y + x) * 3;
-    dest[0] = Clamp(r, modifier);
-    dest[1] = Clamp(g, modifier);
-    dest[2] = Clamp(b, modifier);
-}
-
 void DecodeBlock(const unsigned char *src, unsigned char *dest, int x, int y, int width, int height)
 {
     unsigned char buffer[8];
@@ -137,39 +125,214 @@ void DecodeBlock(const unsigned char *src, unsigned char *dest, int x, int y, in
         B[1] = Extend4to8Bits(_B2);       
     }
 
-    unsigned char codeWord1 = buffer[3] >> 5;
-    unsigned char codeWord2 = (buffer[3] & 0x1C) >> 2;
-    const int *modifierTable1 = ModifierTable + 4 * codeWord1;
-    const int *modifierTable2 = ModifierTable + 4 * codeWord2;
+    // Each pixel picks one of 4 colors of its subblock, so the 8 colors are
+    // worked out once and the pixels just copied from them.
+    const unsigned char codeWord[2] = { static_cast<unsigned char>(buffer[3] >> 5),
+                                        static_cast<unsigned char>((buffer[3] & 0x1C) >> 2) };
+    unsigned char colors[2][4][3];
+    for (int part = 0; part < 2; ++part)
+    {
+        for (int index = 0; index < 4; ++index)
+        {
+            const int modifier = ModifierTable[4 * codeWord[part] + ModifierIndexTable[index]];
+            colors[part][index][0] = Clamp(R[part], modifier);
+            colors[part][index][1] = Clamp(G[part], modifier);
+            colors[part][index][2] = Clamp(B[part], modifier);
+        }
+    }
+
+    // Bit i of these is for the pixel at (i / 4, i % 4)
+    const unsigned int msb = (buffer[4] << 8) | buffer[5];
+    const unsigned int lsb = (buffer[6] << 8) | buffer[7];
+    const unsigned char *partTable = (!flipbit) ? FlipTable1 : FlipTable2;
 
     x = x << 2;
     y = y << 2;
+    const int columns = std::min(4, width - x);
+    const int rows = std::min(4, height - y);
+    for (int py = 0; py < rows; ++py)
+    {
+        unsigned char *row = dest + (width * (y + py) + x) * 3;
+        for (int px = 0; px < columns; ++px)
+        {
+            const int i = px * 4 + py;
+            const unsigned int index = (((msb >> i) & 0x01) << 1) | ((lsb >> i) & 0x01);
+            memcpy(row + px * 3, colors[partTable[i]][index], 3);
+        }
+    }
+}
+
+// Squared error of the count pixels listed in members when each takes the
+// color of its subblock closest to it, and the index of that color in
+// indices. Without clamping the closest color is the one whose modifier is
+// closest to a third of the summed channel differences from the base color,
+// which is good enough to choose it by.
+int FitSubblock(const int pixels[16][3], const int *members, int count, const int base[3], int codeWord, unsigned char indices[16])
+{
+    const int *modifiers = ModifierTable + 4 * codeWord;
+    int colors[4][3];
+    for (int k = 0; k < 4; ++k)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            colors[k][c] = std::min(255, std::max(0, base[c] + modifiers[k]));
+        }
+    }
+    // Thresholds between the modifiers, times 6 to stay in integers
+    const int low = 3 * (modifiers[0] + modifiers[1]);
+    const int high = 3 * (modifiers[2] + modifiers[3]);
 
+    int error = 0;
+    for (int j = 0; j < count; ++j)
+    {
+        const int *pixel = pixels[members[j]];
+        const int offset = 2 * (pixel[0] + pixel[1] + pixel[2] - base[0] - base[1] - base[2]);
+        const int k = (offset < 0) ? (offset < low ? 0 : 1) : (offset < high ? 2 : 3);
+        const int dr = colors[k][0] - pixel[0];
+        const int dg = colors[k][1] - pixel[1];
+        const int db = colors[k][2] - pixel[2];
+        indices[members[j]] = PixelIndexTable[k];
+        error += dr * dr + dg * dg + db * db;
+    }
+    return error;
+}
+
+// Encode the block at (bx, by) in blocks, trying both flips with the
+// subblock averages as base colors. The individual mode is only tried when
+// the averages are too far apart for the differential mode. Pixels outside
+// the image are left out.
+void EncodeBlockFast(const unsigned char *src, int bx, int by, int width, int height, unsigned char *dest)
+{
+    int pixels[16][3];
+    bool valid[16];
     for (int i = 0; i < 16; ++i)
     {
-        unsigned char index = 0;
-        if (i < 8)
+        const int x = bx * 4 + i / 4;
+        const int y = by * 4 + i % 4;
+        valid[i] = x < width && y < height;
+        for (int c = 0; c < 3; ++c)
         {
-            index = ((buffer[5] >> i) & 0x01) << 1;
-            index += ((buffer[7] >> i) & 0x01);
+            pixels[i][c] = valid[i] ? src[(width * y + x) * 3 + c] : 0;
         }
-        else
+    }
+
+    int bestError = INT_MAX;
+    for (int flip = 0; flip < 2; ++flip)
+    {
+        const unsigned char *partTable = flip ? FlipTable2 : FlipTable1;
+        int members[2][8];
+        int count[2] = { 0, 0 };
+        int average[2][3];
+        for (int part = 0; part < 2; ++part)
+        {
+            int sum[3] = { 0, 0, 0 };
+            for (int i = 0; i < 16; ++i)
+            {
+                if (valid[i] && partTable[i] == part)
+                {
+                    members[part][count[part]++] = i;
+                    for (int c = 0; c < 3; ++c)
+                        sum[c] += pixels[i][c];
+                }
+            }
+            for (int c = 0; c < 3; ++c)
+            {
+                average[part][c] = count[part] ? (sum[c] + count[part] / 2) / count[part] : 0;
+            }
+        }
+        if (count[1] == 0)
         {
-            index = ((buffer[4] >> (i - 8)) & 0x01) << 1;
-            index += ((buffer[6] >> (i - 8)) & 0x01);
+            // Only happens on the edge of the image, so use the colors of
+            // the other subblock and the differential mode can always fit
+            memcpy(average[1], average[0], sizeof(average[0]));
         }
 
-        index = ModifierIndexTable[index];
-        const unsigned char partIndex = (!flipbit) ? FlipTable1[i] : FlipTable2[i];
-        const int modifier = (partIndex == 0) ? modifierTable1[index] :
-            modifierTable2[index];
+        bool diffFits = true;
+        for (int diff = 1; diff >= 0; --diff)
+        {
+            if (!diff && diffFits)
+                break;
+
+            int code[2][3], base[2][3];
+            for (int c = 0; c < 3; ++c)
+            {
+                if (diff)
+                {
+                    code[0][c] = (average[0][c] * 31 + 127) / 255;
+                    code[1][c] = (average[1][c] * 31 + 127) / 255;
+                    const int delta = code[1][c] - code[0][c];
+                    if (delta < -4 || delta > 3)
+                    {
+                        diffFits = false;
+                        code[1][c] = code[0][c] + std::min(3, std::max(-4, delta));
+                    }
+                    base[0][c] = Extend5to8Bits(code[0][c]);
+                    base[1][c] = Extend5to8Bits(code[1][c]);
+                }
+                else
+                {
+                    code[0][c] = (average[0][c] * 15 + 127) / 255;
+                    code[1][c] = (average[1][c] * 15 + 127) / 255;
+                    base[0][c] = Extend4to8Bits(code[0][c]);
+                    base[1][c] = Extend4to8Bits(code[1][c]);
+                }
+            }
+
+            int error = 0;
+            int codeWord[2] = { 0, 0 };
+            unsigned char indices[16] = {};
+            for (int part = 0; part < 2; ++part)
+            {
+                int partError = INT_MAX;
+                for (int cw = 0; cw < 8 && partError > 0; ++cw)
+                {
+                    unsigned char partIndices[16];
+                    const int e = FitSubblock(pixels, members[part], count[part], base[part], cw, partIndices);
+                    if (e < partError)
+                    {
+                        partError = e;
+                        codeWord[part] = cw;
+                        for (int j = 0; j < count[part]; ++j)
+                            indices[members[part][j]] = partIndices[members[part][j]];
+                    }
+                }
+                error += partError;
+            }
 
-        SetPixel(dest, R[partIndex], G[partIndex], B[partIndex],
-                 modifier, x + PixelXOffset[i],
-                 y + PixelYOffset[i], width, height);
+            if (error < bestError)
+            {
+                bestError = error;
+                for (int c = 0; c < 3; ++c)
+                {
+                    dest[c] = diff ? (code[0][c] << 3) | ((code[1][c] - code[0][c]) & 0x07)
+                                   : (code[0][c] << 4) | code[1][c];
+                }
+                dest[3] = (codeWord[0] << 5) | (codeWord[1] << 2) | (diff << 1) | flip;
+                unsigned int msb = 0, lsb = 0;
+                for (int i = 0; i < 16; ++i)
+                {
+                    msb |= (indices[i] >> 1) << i;
+                    lsb |= (indices[i] & 0x01) << i;
+                }
+                dest[4] = msb >> 8;
+                dest[5] = msb & 0xFF;
+                dest[6] = lsb >> 8;
+                dest[7] = lsb & 0xFF;
+            }
+        }
     }
 }
 
+// Unique names for the files passed to and from the compression tool, so
+// that several textures can be compressed at the same time
+std::string TemporaryTextureName()
+{
+    static std::atomic<unsigned int> counter(0);
+    char buffer[64];
+    sprintf(buffer, "texture_%d_%u", (int)getpid(), counter++);
+    return buffer;
+}
+
 } // unnamed namespace
 
 namespace pat
@@ -236,14 +399,16 @@ bool UncompressFromETC1(const Image &input, Image &output)
     {
         destSize = width * height * 3;
         destData = new unsigned char[destSize];
-        for (int j = 0; j < blockCountY; ++j)
+        ForEachBlockRows(blockCountY, blockCountX, [&](UInt32 first, UInt32 last)
         {
-            for (int i = 0; i < blockCountX; ++i)
+            for (int j = first; j < (int)last; ++j)
             {
-                DecodeBlock(srcData, destData, i, j, width, height); 
-                srcData += 8;
+                for (int i = 0; i < blockCountX; ++i)
+                {
+                    DecodeBlock(srcData + 8 * (j * blockCountX + i), destData, i, j, width, height);
+                }
             }
-        }
+        });
     }
     output.Set(width, height, GL_RGB, GL_UNSIGNED_BYTE, destSize, destData, false, true); 
     return true;
@@ -268,9 +433,12 @@ bool CompressAsETC1(const Image &input, Image &output)
         return true;
     }
 
-    const char *DEFAULT_PPM_FILENAME = "/tmp/texture.ppm";
+    const std::string name = TemporaryTextureName();
+    const std::string ppmFilename = "/tmp/" + name + ".ppm";
+    const std::string ktxFilename = "/tmp/" + name + ".ktx";
+    const char *DEFAULT_PPM_FILENAME = ppmFilename.c_str();
     const char *DEFAULT_KTX_DIRNAME = "/tmp";
-    const char *DEFAULT_KTX_FILENAME = "/tmp/texture.ktx";
+    const char *DEFAULT_KTX_FILENAME = ktxFilename.c_str();
 
     if (WritePNM(input, DEFAULT_PPM_FILENAME, false) == false)
     {
@@ -286,7 +454,10 @@ bool CompressAsETC1(const Image &input, Image &output)
         return false;
     }
 
-    if (ReadKTX(output, DEFAULT_KTX_FILENAME) == false)
+    const bool read = ReadKTX(output, DEFAULT_KTX_FILENAME);
+    unlink(DEFAULT_PPM_FILENAME);
+    unlink(DEFAULT_KTX_FILENAME);
+    if (read == false)
     {
         PAT_DEBUG_LOG("Failed to read from file : %s\n", DEFAULT_KTX_FILENAME);
         return false;
@@ -295,6 +466,143 @@ bool CompressAsETC1(const Image &input, Image &output)
     return true;
 }
 
+bool CompressAsETC1Fast(const Image &input, Image &output)
+{
+    const UInt32 format = input.Format();
+    const UInt32 type = input.Type();
+    const UInt32 width = input.Width();
+    const UInt32 height = input.Height();
+
+    if (CanCompressAsETC1(format, type) == false)
+    {
+        PAT_DEBUG_LOG("Unexpected format for ETC1 compress : %d %d\n", format, type);
+        return false;
+    }
+
+    const unsigned char *srcData = input.Data();
+    if (srcData == NULL)
+    {
+        output.Set(width, height, GL_ETC1_RGB8_OES, GL_NONE, 0, NULL, false, false);
+        return true;
+    }
+
+    const int blockCountX = (width + 3) / 4;
+    const int blockCountY = (height + 3) / 4;
+    const unsigned int destSize = blockCountX * blockCountY * 8;
+    unsigned char *destData = new unsigned char[destSize];
+    ForEachBlockRows(blockCountY, blockCountX, [&](UInt32 first, UInt32 last)
+    {
+        for (int j = first; j < (int)last; ++j)
+        {
+            for (int i = 0; i < blockCountX; ++i)
+            {
+                EncodeBlockFast(srcData, i, j, width, height, destData + 8 * (j * blockCountX + i));
+            }
+        }
+    });
+    output.Set(width, height, GL_ETC1_RGB8_OES, GL_NONE, destSize, destData, false, true);
+    return true;
+}
+
+namespace
+{
+
+// etcpack runs on a single core, so textures of more than MIN_TOOL_BAND_BLOCKS
+// blocks are cut into bands of block rows, and the bands are compressed by
+// one etcpack process each, all at the same time. The blocks of a band are a
+// contiguous part of the blocks of the texture, so the compressed bands are
+// put one after the other.
+const UInt32 MIN_TOOL_BAND_BLOCKS = 16 * 1024;
+
+bool CompressInBands(const Image &input, Image &output, UInt32 outputFormat, UInt32 blockSize,
+                     const std::function<bool(const Image &, Image &)> &compressBand)
+{
+    const UInt32 width = input.Width();
+    const UInt32 height = input.Height();
+    const UInt32 blockCountX = (width + 3) / 4;
+    const UInt32 blockCountY = (height + 3) / 4;
+    const UInt32 threads = GetCompressionThreads();
+    const UInt32 minBandRows = std::max<UInt32>(1, MIN_TOOL_BAND_BLOCKS / std::max<UInt32>(1, blockCountX));
+    const UInt32 bandRows = std::max(minBandRows, (blockCountY + threads - 1) / threads);
+    const UInt32 bands = (blockCountY + bandRows - 1) / bandRows;
+    if (bands <= 1)
+        return compressBand(input, output);
+
+    const UInt32 pixelSize = GetImagePixelSize(input.Format(), input.Type());
+    const UInt32 destSize = blockCountX * blockCountY * blockSize;
+    UInt8 *destData = new UInt8[destSize];
+    std::atomic<bool> ok(true);
+    std::vector<std::thread> pool;
+    for (UInt32 band = 0; band < bands; ++band)
+    {
+        pool.emplace_back([&, band]()
+        {
+            const UInt32 firstRow = band * bandRows * 4;
+            const UInt32 rows = std::min(height, firstRow + bandRows * 4) - firstRow;
+            Image bandInput(width, rows, input.Format(), input.Type(), width * rows * pixelSize,
+                            const_cast<UInt8 *>(input.Data()) + firstRow * width * pixelSize, false, false);
+            Image bandOutput;
+            const UInt32 bandSize = (rows + 3) / 4 * blockCountX * blockSize;
+            if (compressBand(bandInput, bandOutput) == false || bandOutput.DataSize() != bandSize)
+            {
+                ok = false;
+                return;
+            }
+            memcpy(destData + band * bandRows * blockCountX * blockSize, bandOutput.Data(), bandSize);
+        });
+    }
+    for (std::thread &thread : pool)
+    {
+        thread.join();
+    }
+
+    if (ok == false)
+    {
+        delete [] destData;
+        PAT_DEBUG_LOG("Failed to compress the image in bands, compressing it as a whole\n");
+        return compressBand(input, output);
+    }
+    output.Set(width, height, outputFormat, GL_NONE, destSize, destData, false, true);
+    return true;
+}
+
+bool CompressAsETC2WithTool(const Image &input, Image &output, const char *formatOption)
+{
+    const std::string name = TemporaryTextureName();
+    const std::string pngFilename = "/tmp/" + name + ".png";
+    const std::string ktxFilename = "/tmp/" + name + ".ktx";
+    const char *DEFAULT_PNG_FILENAME = pngFilename.c_str();
+    const char *DEFAULT_KTX_DIRNAME = "/tmp";
+    const char *DEFAULT_KTX_FILENAME = ktxFilename.c_str();
+
+    if (WritePNG(input, DEFAULT_PNG_FILENAME, false) == false)
+    {
+        PAT_DEBUG_LOG("Failed to write to file : %s\n", DEFAULT_PNG_FILENAME);
+        return false;
+    }
+
+    char buffer[512];
+    sprintf(buffer, "%s %s %s -c etc2 -ktx -quiet -f %s", ETC_COMPRESSION_TOOL, DEFAULT_PNG_FILENAME, DEFAULT_KTX_DIRNAME, formatOption);
+    if (system(buffer) == -1)
+    {
+        PAT_DEBUG_LOG("Failed to convert image. Is the ASTC Evaluation Codec (astcenc) under your $PATH? If not, please download it from www.malideveloper.com.\n");
+        return false;
+    }
+
+    const bool read = ReadKTX(output, DEFAULT_KTX_FILENAME);
+    unlink(DEFAULT_PNG_FILENAME);
+    unlink(DEFAULT_KTX_FILENAME);
+    if (read == false)
+    {
+        PAT_DEBUG_LOG("Failed to read from file : %s\n", DEFAULT_KTX_FILENAME);
+        return false;
+    }
+
+    return true;
+}
+
+} // unnamed namespace
+
 bool CompressAsETC2(const Image &input, Image &output, UInt32 alphaDepth)
 {
     const UInt32 PUNCHTHROUGH_ALPHA_DEPTH = 1;
@@ -315,6 +623,7 @@ bool CompressAsETC2(const Image &input, Image &output, UInt32 alphaDepth)
 
     const char *formatOption = NULL;
     UInt32 output_format = GL_NONE;
+    UInt32 blockSize = 8;
     if (format == GL_RGB)
     {
         formatOption = "RGB";
@@ -331,6 +640,7 @@ bool CompressAsETC2(const Image &input, Image &output, UInt32 alphaDepth)
         {
             formatOption = "RGBA8";
             output_format = GL_COMPRESSED_RGBA8_ETC2_EAC;
+            blockSize = 16;
         }
     }
 
@@ -340,31 +650,10 @@ bool CompressAsETC2(const Image &input, Image &output, UInt32 alphaDepth)
         return true;
     }
 
-    const char *DEFAULT_PNG_FILENAME = "/tmp/texture.png";
-    const char *DEFAULT_KTX_DIRNAME = "/tmp";
-    const char *DEFAULT_KTX_FILENAME = "/tmp/texture.ktx";
-
-    if (WritePNG(input, DEFAULT_PNG_FILENAME, false) == false)
+    return CompressInBands(input, output, output_format, blockSize, [formatOption](const Image &band, Image &bandOutput)
     {
-        PAT_DEBUG_LOG("Failed to write to file : %s\n", DEFAULT_PNG_FILENAME);
-        return false;
-    }
-
-    char buffer[512];
-    sprintf(buffer, "%s %s %s -c etc2 -ktx -quiet -f %s", ETC_COMPRESSION_TOOL, DEFAULT_PNG_FILENAME, DEFAULT_KTX_DIRNAME, formatOption);
-    if (system(buffer) == -1)
-    {
-        PAT_DEBUG_LOG("Failed to convert image. Is the ASTC Evaluation Codec (astcenc) under your $PATH? If not, please download it from www.malideveloper.com.\n");
-        return false;
-    }
-
-    if (ReadKTX(output, DEFAULT_KTX_FILENAME) == false)
-    {
-        PAT_DEBUG_LOG("Failed to read from file : %s\n", DEFAULT_KTX_FILENAME);
-        return false;
-    }
-
-    return true;
+        return CompressAsETC2WithTool(band, bandOutput, formatOption);
+    });
 }
 
 }
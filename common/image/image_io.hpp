@@ -16,6 +16,8 @@ bool CanWriteAsPNM(UInt32 format, UInt32 type);
 bool WritePNM(const Image &image, const char *filepath, bool flip);
 bool ReadPNM(Image &image, const char *filepath);
 
+// Written with libpng on the calling thread. This library does not depend on
+// patrace, so it does not use the multi-threaded image::encodePNG there.
 bool CanWriteAsPNG(UInt32 format, UInt32 type);
 bool WritePNG(const Image &image, const char *filepath, bool flip);
 bool ReadPNG(Image &image, const char *filepath);
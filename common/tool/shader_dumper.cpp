@@ -30,6 +30,8 @@ int main(int argc, char **argv)
     const char *trace_filename = argv[1];
 
     std::shared_ptr<InputFileInterface> inputFile(GenerateInputFile());
+    // Only the shader objects are looked at, so all other calls are skipped undecoded
+    inputFile->select_calls({ "glCreateShader", "glShaderSource" });
     if (!inputFile->open(trace_filename))
     {
         PAT_DEBUG_LOG("Error : failed to open %s\n", trace_filename);
@@ -106,6 +106,7 @@ void printHelp()
         "     INPUT         Only compress the textures already compressed in the input trace\n"
         "     NOALPHA       Compress as much textures as possible, but ignore the ones with alpha channels\n"
         "     COMPLETE      Compress as much textures as possible\n"
+        "  -j THREADS    number of threads to compress and uncompress each texture on, default is one per core\n"
         "  -com FORMAT   compress as specific texture compression format\n"
         "    Supported formats:\n";
     const char **optionList = NULL;
@@ -156,6 +157,10 @@ int main(int argc, char **argv)
         {
             encode_format = argv[++argIndex];
         }
+        else if (!strcmp(arg, "-j"))
+        {
+            pat::SetCompressionThreads(atoi(argv[++argIndex]));
+        }
         else
         {
             printf("Error: Unknow option %s\n", arg);
@@ -430,7 +435,7 @@ int main(int argc, char **argv)
         Json::Reader reader;
         if (reader.parse(json_header, jsonHeader))
         {
-            if (encode_format == "ETC1")
+            if (encode_format == "ETC1" || encode_format == "ETC1_FAST")
                 jsonHeader["texCompress"] = GL_ETC1_RGB8_OES;
             else if (encode_format == "ASTC4x4")
                 jsonHeader["texCompress"] = GL_COMPRESSED_RGBA_ASTC_4x4_KHR;
@@ -52,6 +52,9 @@ public:
     virtual bool close() = 0;
     virtual bool reset() = 0;
     virtual CallInterface * next_call() const = 0;
+    // Only the named calls need to be returned by next_call(), set before open().
+    // Formats that cannot step over calls cheaply may still return all of them.
+    virtual void select_calls(const std::vector<std::string> &names) {}
 
     virtual unsigned int header_version() const { return 0; }
     // For JSON header, which is introduced just for
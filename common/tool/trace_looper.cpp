@@ -1,6 +1,10 @@
 #include "tool/trace_looper.hpp"
 
 
+// Large enough for any call, calls are serialized here to be written or buffered
+static char serialize_buffer[100 * 1024 * 1024];
+
+
 void TraceLooper::print_args_info() {
     ILOG(
         "Creates a new trace from a source trace that loops a selected frame or call range a given number of times.\n"
@@ -36,19 +40,18 @@ TraceLooper::TraceLooper(int argc, char* argv[]) {
 
 
 TraceLooper::~TraceLooper() {
-    for (auto call_ptr : calls) {
-        if (call_ptr) {
-            delete call_ptr;
-        }
-    }
+    trace_file.Close();
 }
 
 
 void TraceLooper::load() {
     ILOG("Loading trace: " + str_args["trace_file"]);
-    common::TraceFileTM trace_file(str_args["trace_file"].c_str(), false);
 
-    frame_ranges.push_back(std::pair<int, int>(0, 0));
+    // Only scans the trace for where the frames are, no calls are kept
+    if (!trace_file.Open(str_args["trace_file"].c_str(), false)) {
+        ELOG("Failed to open trace: " + str_args["trace_file"]);
+        exit(1);
+    }
 
     header = trace_file.mpInFileRA->getJSONHeaderAsString();
 
@@ -63,61 +66,40 @@ void TraceLooper::load() {
 
     ILOG("Main thread ID set to: " + std::to_string(main_thread_ID));
 
-    common::CallTM* current_call = trace_file.NextCall();
-    int call_index = 0;
-
-    while (current_call) {
-        add_call(current_call);
-
-        if (call_is_swap(current_call) && ((long)current_call->mTid == main_thread_ID)) {
-            frame_ranges[frame_ranges.size() - 1].second = call_index;
-            frame_ranges.push_back(std::pair<int, int>(call_index + 1, 0));
-        }
+    // Every frame ends with a swap of the main thread, but the last one
+    num_calls = 0;
 
-        current_call = trace_file.NextCall();
-        call_index += 1;
+    for (const common::FrameTM* frame : trace_file.mFrames) {
+        const int first_call_index = frame->mFirstCallOfThisFrame;
+        frame_ranges.push_back(std::pair<int, int>(first_call_index, first_call_index + frame->GetCallCount() - 1));
+        num_calls = first_call_index + frame->GetCallCount();
     }
 
-    frame_ranges[frame_ranges.size() - 1].second = call_index;
-
-    trace_file.Close();
-
     ILOG("Num frames in trace: " + std::to_string(frame_ranges.size()));
 
-    ILOG("Num calls in trace: " + std::to_string(calls.size()));
+    ILOG("Num calls in trace: " + std::to_string(num_calls));
 }
 
 
 void TraceLooper::process() {
     ILOG("Processing trace: " + str_args["trace_file"]);
 
-    if (bool_args["reset_loop_state"]) {
-        extract_pre_frame_state_calls();
-    }
-
-    if (bool_args["loop_frame_selected"]) {
-        add_frame_loop_calls(
-            int_args["target_frame"],
-            int_args["num_loops"],
-            bool_args["reset_loop_state"]);
+    if (bool_args["loop_frame_selected"] && int_args["target_frame"] >= static_cast<int>(frame_ranges.size())) {
+        ELOG("Target frame " + std::to_string(int_args["target_frame"]) + " is past the last frame of the trace");
+        exit(1);
     }
 
-    if (bool_args["loop_range_selected"]) {
-        add_range_loop_calls(
-            int_args["start_call_index"],
-            int_args["end_call_index"],
-            int_args["num_loops"]);
+    if (bool_args["loop_range_selected"] && int_args["end_call_index"] >= num_calls) {
+        ELOG("Range loop end " + std::to_string(int_args["end_call_index"]) + " is past the last call of the trace");
+        exit(1);
     }
-
-    print_trace_info();
 }
 
 
-void TraceLooper::get_frame_loop_header(std::string& out_string, const std::string& md5_string) {
-    common::TraceFileTM trace_file(str_args["trace_file"].c_str(), false);
+void TraceLooper::get_frame_loop_header(std::string& out_string, const std::string& md5_string, unsigned int call_count) {
     Json::Value json_header = trace_file.mpInFileRA->getJSONHeader();
 
-    json_header["callCnt"] = static_cast<unsigned int>(frame_loop_call_writelist.size());
+    json_header["callCnt"] = call_count;
     json_header["frameCnt"] = int_args["num_loops"];
 
     if (!(json_header.isMember("conversions") && json_header["conversions"].isArray())) {
@@ -149,11 +131,10 @@ void TraceLooper::get_frame_loop_header(std::string& out_string, const std::stri
 }
 
 
-void TraceLooper::get_range_loop_header(std::string& out_string, const std::string& md5_string) {
-    common::TraceFileTM trace_file(str_args["trace_file"].c_str(), false);
+void TraceLooper::get_range_loop_header(std::string& out_string, const std::string& md5_string, unsigned int call_count) {
     Json::Value json_header = trace_file.mpInFileRA->getJSONHeader();
 
-    json_header["callCnt"] = static_cast<unsigned int>(range_loop_call_writelist.size());
+    json_header["callCnt"] = call_count;
     json_header["frameCnt"] = 0;
 
     if (!(json_header.isMember("conversions") && json_header["conversions"].isArray())) {
@@ -181,7 +162,6 @@ void TraceLooper::get_range_loop_header(std::string& out_string, const std::stri
 
     json_header["conversions"].append(new_conversion);
 
-    trace_file.Close();
 
     Json::FastWriter writer;
     out_string = writer.write(json_header);
@@ -189,14 +169,13 @@ void TraceLooper::get_range_loop_header(std::string& out_string, const std::stri
 
 
 std::string TraceLooper::calc_trace_md5() {
-    std::ifstream infile(str_args["trace_file"].c_str(), std::ios::binary | std::ios::ate);
-    std::streamsize size = infile.tellg();
-    infile.seekg(0, std::ios::beg);
-
-    std::vector<char> data(size);
-    if (infile.read(data.data(), size)) {
-        common::MD5Digest trace_mdh = common::MD5Digest(reinterpret_cast<void*>(data.data()), data.size());
-        return trace_mdh.text_lower();
+    std::ifstream infile(str_args["trace_file"].c_str(), std::ios::binary);
+
+    if (infile) {
+        common::MD5Digest trace_mdh = common::MD5Digest(infile);
+        if (infile.eof()) {
+            return trace_mdh.text_lower();
+        }
     }
 
     return "(failed to generate MD5)";
@@ -206,55 +185,45 @@ std::string TraceLooper::calc_trace_md5() {
 void TraceLooper::save() {
     std::string trace_md5 = calc_trace_md5();
 
-    if (frame_loop_call_writelist.size() > 0) {
+    if (bool_args["loop_frame_selected"]) {
         build_output_file_path();
 
         ILOG("Saving output frame looping trace as: " + str_args["output_filepath"]);
 
         common::OutFile outfile(str_args["output_filepath"].c_str());
 
+        const unsigned int call_count = write_frame_loop_trace(outfile);
+
         std::string string_header;
-        get_frame_loop_header(string_header, trace_md5);
+        get_frame_loop_header(string_header, trace_md5, call_count);
 
         outfile.WriteHeader(string_header.c_str(), string_header.size());
 
-        for (auto call : frame_loop_call_writelist) {
-            const unsigned int WRITE_BUF_LEN = 100 * 1024 * 1024;
-            static char buffer[WRITE_BUF_LEN];
-            char *dest = buffer;
-            dest = call->Serialize(dest);
-            outfile.Write(buffer, dest - buffer);
-        }
-
         outfile.Close();
 
         OKLOG("Frame looping trace saved as: " + str_args["output_filepath"]);
     }
 
-    if (range_loop_call_writelist.size() > 0) {
+    if (bool_args["loop_range_selected"]) {
         build_output_file_path_range_trace();
 
         ILOG("Saving output range looping trace as: " + str_args["output_filepath_range_trace"]);
 
         common::OutFile range_outfile(str_args["output_filepath_range_trace"].c_str());
 
+        const unsigned int call_count = write_range_loop_trace(range_outfile);
+
         std::string string_header;
-        get_range_loop_header(string_header, trace_md5);
+        get_range_loop_header(string_header, trace_md5, call_count);
 
         range_outfile.WriteHeader(string_header.c_str(), string_header.size());
 
-        for (auto call : range_loop_call_writelist) {
-            const unsigned int WRITE_BUF_LEN = 100 * 1024 * 1024;
-            static char buffer[WRITE_BUF_LEN];
-            char *dest = buffer;
-            dest = call->Serialize(dest);
-            range_outfile.Write(buffer, dest - buffer);
-        }
-
         range_outfile.Close();
 
         OKLOG("Range looping trace saved as: " + str_args["output_filepath_range_trace"]);
     }
+
+    print_trace_info();
 }
 
 
@@ -283,27 +252,51 @@ void TraceLooper::print_trace_info() {
 }
 
 
-void TraceLooper::add_call(const common::CallTM* incall) {
-    common::CallTM* outcall = new common::CallTM(incall->mCallName.c_str());
+void TraceLooper::CallBuffer::add(common::CallTM* call) {
+    const char* end = call->Serialize(serialize_buffer);
+    data.insert(data.end(), static_cast<const char*>(serialize_buffer), end);
+    offsets.push_back(data.size());
+    names.push_back(call->Name());
+}
 
-    outcall->mReadPos = incall->mReadPos;
-    outcall->mCallNo = incall->mCallNo;
-    outcall->mTid = incall->mTid;
-    outcall->mCallId = incall->mCallId;
-    outcall->mCallErrNo = incall->mCallErrNo;
-    outcall->mRet = incall->mRet;
-    outcall->mBkColor = incall->mBkColor;
-    outcall->mTxtColor = incall->mTxtColor;
 
-    int num_args = incall->mArgs.size();
-    outcall->mArgs.resize(num_args);
+void TraceLooper::CallBuffer::write(common::OutFile& outfile, size_t index) const {
+    outfile.Write(data.data() + offsets[index], offsets[index + 1] - offsets[index]);
+}
+
+
+void TraceLooper::for_each_call(
+    int first_call,
+    int last_call,
+    const std::function<void(common::CallTM*)>& func
+) {
+    for (common::FrameTM* frame : trace_file.mFrames) {
+        const int frame_first_call = frame->mFirstCallOfThisFrame;
+        const int frame_last_call = frame_first_call + frame->GetCallCount() - 1;
 
-    for (int i = 0; i < num_args; ++i) {
-        outcall->mArgs[i] = new common::ValueTM;
-        *(outcall->mArgs[i]) = *(incall->mArgs[i]);
+        if (frame_last_call < first_call) {
+            continue;
+        } else if (frame_first_call > last_call) {
+            break;
+        }
+
+        frame->LoadCalls(trace_file.mpInFileRA);
+
+        for (common::CallTM* call : frame->mCalls) {
+            const int call_index = call->mCallNo;
+            if (call_index >= first_call && call_index <= last_call) {
+                func(call);
+            }
+        }
+
+        frame->UnloadCalls();
     }
+}
+
 
-    calls.push_back(outcall);
+void TraceLooper::write_call(common::OutFile& outfile, common::CallTM* call) {
+    const char* end = call->Serialize(serialize_buffer);
+    outfile.Write(serialize_buffer, end - serialize_buffer);
 }
 
 
@@ -326,7 +319,7 @@ void TraceLooper::build_output_file_path() {
         trace_tokens.push_back("rstate");
     }
 
-    if (bool_args["clean_trace"]) {
+    if (bool_args["clean_calls"]) {
         trace_tokens.push_back("clean");
     }
 
@@ -375,209 +368,187 @@ bool TraceLooper::call_is_swap(const common::CallTM* call) {
 }
 
 
-void TraceLooper::extract_pre_frame_state_calls() {
+void TraceLooper::get_pre_frame_state_calls(
+    const CallBuffer& frame_calls,
+    const std::unordered_set<std::string>& pre_frame_state_names,
+    std::vector<size_t>* state_calls
+) {
     ILOG("Extracting preframe state...");
 
-    int frame_start_index = frame_ranges[int_args["target_frame"]].first;
-    int frame_end_index = frame_ranges[int_args["target_frame"]].second;
-
-    int curr_index = frame_start_index;
+    size_t curr_index = frame_calls.size();
 
-    for (int i = frame_start_index; i <= frame_end_index; ++i) {
-        if (call_is_draw(calls[i])) {
+    for (size_t i = 0; i < frame_calls.size(); ++i) {
+        if (GL_DRAW_CALL_NAMES.count(frame_calls.names[i]) > 0) {
             curr_index = i + 1;
             break;
         }
     }
 
-    if (curr_index == frame_end_index) {
+    if (curr_index == frame_calls.size()) {
         WLOG("Selected frame has no draw calls");
         return;
     }
 
-    bool found_pre_frame_call = false;
+    // Names of the calls in the frame before the one looked at
+    std::unordered_set<std::string> frame_names(
+        frame_calls.names.begin(),
+        frame_calls.names.begin() + curr_index);
 
-    for (int i = curr_index; i <= frame_end_index; ++i) {
-        if (!call_is_state_changer(calls[i])) {
-            continue;
-        }
+    for (size_t i = curr_index; i < frame_calls.size(); ++i) {
+        const std::string& name = frame_calls.names[i];
 
-        for (int y = i - 1; y > 0; --y) {
-            if (!call_is_state_changer(calls[i])) {
-                continue;
-            } else if (calls[i]->Name() == calls[y]->Name()) {
-                if (y >= frame_start_index) {
-                    found_pre_frame_call = true;
-                    break;
-                } else {
-                    prestate_calls.push_back(calls[i]);
-                    pre_state_calls.push_back(calls[i]->Name());
-                    found_pre_frame_call = true;
-                    break;
-                }
+        if (EXCLUDED_PRE_FRAME_CALLS.count(name) > 0 && frame_names.count(name) == 0) {
+            if (pre_frame_state_names.count(name) > 0) {
+                state_calls->push_back(i);
+                pre_state_calls.push_back(name);
+            } else {
+                WLOG("Failed to find pre frame setup for state call: " + name \
+                    + ", trace possibly relies on default state." \
+                    + " Update the trace_looper to reflect this case!");
             }
         }
 
-        if (!found_pre_frame_call) {
-            WLOG("Failed to find pre frame setup for state call: " + calls[i]->Name() \
-                + ", trace possibly relies on default state." \
-                + " Update the trace_looper to reflect this case!");
-        } else {
-            found_pre_frame_call = false;
-        }
+        frame_names.insert(name);
     }
 
-    ILOG("Extracted: " + std::to_string(prestate_calls.size()) + " pre state calls");
+    ILOG("Extracted: " + std::to_string(state_calls->size()) + " pre state calls");
 }
 
 
-void TraceLooper::add_frame_loop_calls(int target_frame, int num_loops, bool reset_loop_state) {
-    ILOG("Adding frame loop calls...");
+unsigned int TraceLooper::write_frame_loop_trace(common::OutFile& outfile) {
+    ILOG("Writing frame loop calls...");
 
-    int start_call_index = frame_ranges[target_frame].first;
-    int end_call_index = frame_ranges[target_frame].second;
+    const int target_frame = int_args["target_frame"];
+    const int num_loops = int_args["num_loops"];
+    const bool reset_loop_state = bool_args["reset_loop_state"];
+    const int start_call_index = frame_ranges[target_frame].first;
+    const int end_call_index = frame_ranges[target_frame].second;
 
     ILOG("Looping call range: " + std::to_string(start_call_index) + "-" + std::to_string(end_call_index) + " (frame number " + std::to_string(target_frame) + ")");
 
-    std::vector<common::CallTM*> pre_frame_calls;
-
-    if (target_frame > 0) {
-        pre_frame_calls.reserve(frame_ranges[target_frame - 1].second);
+    unsigned int call_count = 0;
+    std::unordered_set<std::string> pre_frame_state_names;
+    CallBuffer frame_calls;
 
-        for (int i = 0; i < frame_ranges[target_frame - 1].second; ++i) {
-            if (!call_is_swap(calls[i])) {
-                pre_frame_calls.push_back(calls[i]);
-            }
+    // The calls before the frame go straight to the output, the frame is kept to be looped
+    for_each_call(0, end_call_index, [&](common::CallTM* call) {
+        if (static_cast<int>(call->mCallNo) >= start_call_index) {
+            frame_calls.add(call);
+            return;
         }
-    }
 
-    ILOG("Number of pre frame calls: " + std::to_string(pre_frame_calls.size()));
+        if (!call_is_swap(call)) {
+            write_call(outfile, call);
+            call_count += 1;
+        }
 
-    std::vector<common::CallTM*> frame_calls;
-    frame_calls.reserve(end_call_index - start_call_index + 1);
+        if (reset_loop_state && call_is_state_changer(call)) {
+            pre_frame_state_names.insert(call->Name());
+        }
+    });
 
-    for (int i = start_call_index; i <= end_call_index; ++i) {
-        frame_calls.push_back(calls[i]);
-    }
+    ILOG("Number of pre frame calls: " + std::to_string(call_count));
 
     ILOG("Number of target frame calls: " + std::to_string(frame_calls.size()));
 
-    std::vector<common::CallTM*> cleaned_frame_calls;
+    std::vector<size_t> cleaned_frame_calls;
 
-    if (bool_args["clean_trace"]) {
-        clean_loop_frame_calls(&frame_calls, &cleaned_frame_calls);
+    if (bool_args["clean_calls"]) {
+        get_clean_loop_frame_calls(frame_calls, &cleaned_frame_calls);
     } else {
-        cleaned_frame_calls = frame_calls;
+        for (size_t i = 0; i < frame_calls.size(); ++i) {
+            cleaned_frame_calls.push_back(i);
+        }
     }
 
-    int total_calls = pre_frame_calls.size() + cleaned_frame_calls.size() * num_loops + frame_calls.size();
+    std::vector<size_t> prestate_calls;
 
-    frame_loop_call_writelist.reserve(total_calls);
-
-    frame_loop_call_writelist.insert(
-        frame_loop_call_writelist.end(),
-        pre_frame_calls.begin(),
-        pre_frame_calls.end());
+    if (reset_loop_state) {
+        get_pre_frame_state_calls(frame_calls, pre_frame_state_names, &prestate_calls);
+    }
 
-    for (int i = 0; i < num_loops; ++i) {
-        if (bool_args["reset_loop_state"]) {
-            frame_loop_call_writelist.insert(
-                frame_loop_call_writelist.end(),
-                prestate_calls.begin(),
-                prestate_calls.end());
+    for (int i = 0; i <= num_loops; ++i) {
+        for (size_t index : prestate_calls) {
+            frame_calls.write(outfile, index);
         }
 
-        frame_loop_call_writelist.insert(
-            frame_loop_call_writelist.end(),
-            cleaned_frame_calls.begin(),
-            cleaned_frame_calls.end());
-    }
+        // The last time round is the whole frame
+        const bool last_loop = (i == num_loops);
+        const size_t loop_size = last_loop ? frame_calls.size() : cleaned_frame_calls.size();
 
-    if (bool_args["reset_loop_state"]) {
-        frame_loop_call_writelist.insert(
-            frame_loop_call_writelist.end(),
-            prestate_calls.begin(),
-            prestate_calls.end());
-    }
+        for (size_t j = 0; j < loop_size; ++j) {
+            frame_calls.write(outfile, last_loop ? j : cleaned_frame_calls[j]);
+        }
 
-    frame_loop_call_writelist.insert(
-        frame_loop_call_writelist.end(),
-        frame_calls.begin(),
-        frame_calls.end());
+        call_count += prestate_calls.size() + loop_size;
+    }
 
     if (bool_args["include_tail"]) {
         ILOG("Adding trace tail...");
 
-        for (size_t i = end_call_index + 1; i < calls.size(); ++i) {
-            frame_loop_call_writelist.push_back(calls[i]);
-        }
+        for_each_call(end_call_index + 1, num_calls - 1, [&](common::CallTM* call) {
+            write_call(outfile, call);
+            call_count += 1;
+        });
 
-        ILOG("Tail calls added: " + std::to_string(frame_loop_call_writelist.size()));
+        ILOG("Tail calls added: " + std::to_string(num_calls - 1 - end_call_index));
     }
 
-    ILOG("Total number of calls in frame looping trace queued for writeout: " + std::to_string(frame_loop_call_writelist.size()));
+    ILOG("Total number of calls written to frame looping trace: " + std::to_string(call_count));
+
+    return call_count;
 }
 
 
-void TraceLooper::add_range_loop_calls(int start_call_index, int end_call_index, int num_loops) {
-    ILOG("Adding range loop calls...");
-    ILOG("Looping call range: " + std::to_string(start_call_index) + "-" + std::to_string(end_call_index));
+unsigned int TraceLooper::write_range_loop_trace(common::OutFile& outfile) {
+    ILOG("Writing range loop calls...");
 
-    std::vector<common::CallTM*> pre_range_calls;
+    const int start_call_index = int_args["start_call_index"];
+    const int end_call_index = int_args["end_call_index"];
+    const int num_loops = int_args["num_loops"];
 
-    if (start_call_index > 0) {
-        pre_range_calls.reserve(start_call_index);
+    ILOG("Looping call range: " + std::to_string(start_call_index) + "-" + std::to_string(end_call_index));
 
-        for (int i = 0; i < start_call_index - 1; ++i) {
-            if (!call_is_swap(calls[i])) {
-                pre_range_calls.push_back(calls[i]);
-            }
-        }
-    }
+    unsigned int call_count = 0;
+    CallBuffer range_calls;
 
-    ILOG("Number of pre range calls: " + std::to_string(pre_range_calls.size()));
+    for_each_call(0, end_call_index, [&](common::CallTM* call) {
+        const int call_index = call->mCallNo;
 
-    std::vector<common::CallTM*> range_calls;
-    range_calls.reserve(end_call_index - start_call_index + 1);
+        if (call_index >= start_call_index) {
+            range_calls.add(call);
+        } else if (call_index < start_call_index - 1 && !call_is_swap(call)) {
+            write_call(outfile, call);
+            call_count += 1;
+        }
+    });
 
-    for (int i = start_call_index; i <= end_call_index; ++i) {
-        range_calls.push_back(calls[i]);
-    }
+    ILOG("Number of pre range calls: " + std::to_string(call_count));
 
     ILOG("Number of target range calls: " + std::to_string(range_calls.size()));
 
-    int total_calls = pre_range_calls.size() + range_calls.size() * num_loops + range_calls.size();
-
-    range_loop_call_writelist.reserve(total_calls);
-
-    range_loop_call_writelist.insert(
-        range_loop_call_writelist.end(),
-        pre_range_calls.begin(),
-        pre_range_calls.end());
+    for (int i = 0; i <= num_loops; ++i) {
+        for (size_t j = 0; j < range_calls.size(); ++j) {
+            range_calls.write(outfile, j);
+        }
 
-    for (int i = 0; i < num_loops; ++i) {
-        range_loop_call_writelist.insert(
-            range_loop_call_writelist.end(),
-            range_calls.begin(),
-            range_calls.end());
+        call_count += range_calls.size();
     }
 
-    range_loop_call_writelist.insert(
-        range_loop_call_writelist.end(),
-        range_calls.begin(),
-        range_calls.end());
-
     if (bool_args["include_tail"]) {
         ILOG("Adding trace tail...");
 
-        for (size_t i = end_call_index + 1; i < calls.size(); ++i) {
-            range_loop_call_writelist.push_back(calls[i]);
-        }
+        for_each_call(end_call_index + 1, num_calls - 1, [&](common::CallTM* call) {
+            write_call(outfile, call);
+            call_count += 1;
+        });
 
-        ILOG("Tail calls added: " + std::to_string(range_loop_call_writelist.size()));
+        ILOG("Tail calls added: " + std::to_string(num_calls - 1 - end_call_index));
     }
 
-    ILOG("Total number of calls in range looping trace queued for writeout: " + std::to_string(range_loop_call_writelist.size()));
+    ILOG("Total number of calls written to range looping trace: " + std::to_string(call_count));
+
+    return call_count;
 }
 
 
@@ -586,42 +557,43 @@ bool TraceLooper::call_is_draw(const common::CallTM* call) {
 }
 
 
-void TraceLooper::clean_loop_frame_calls(
-    std::vector<common::CallTM*>* raw_calls,
-    std::vector<common::CallTM*>* clean_calls
+void TraceLooper::get_clean_loop_frame_calls(
+    const CallBuffer& frame_calls,
+    std::vector<size_t>* clean_calls
 ) {
     int last_draw_index = -1;
-    int curr_index = 0;
 
-    ILOG("Num calls pre clean: " + std::to_string(raw_calls->size()));
+    ILOG("Num calls pre clean: " + std::to_string(frame_calls.size()));
 
-    for (auto raw_call : *raw_calls) {
-        if (call_is_draw(raw_call)) {
-            last_draw_index = curr_index;
+    for (size_t i = 0; i < frame_calls.size(); ++i) {
+        if (GL_DRAW_CALL_NAMES.count(frame_calls.names[i]) > 0) {
+            last_draw_index = i;
         }
-
-        curr_index += 1;
     }
 
     if (last_draw_index == -1) {
         ELOG("No draws in frame, not cleaning");
-        clean_calls = raw_calls;
+
+        for (size_t i = 0; i < frame_calls.size(); ++i) {
+            clean_calls->push_back(i);
+        }
+
         return;
     }
 
-    clean_calls->reserve(last_draw_index + 1);
+    clean_calls->reserve(last_draw_index + 2);
 
     for (int i = 0; i <= last_draw_index; ++i) {
-        clean_calls->push_back((*raw_calls)[i]);
+        clean_calls->push_back(i);
     }
 
-    for (size_t i = last_draw_index + 1; i < raw_calls->size() - 1; ++i) {
-        cleaned_calls.push_back((*raw_calls)[i]->Name());
+    for (size_t i = last_draw_index + 1; i < frame_calls.size() - 1; ++i) {
+        cleaned_calls.push_back(frame_calls.names[i]);
     }
 
-    ILOG("Num calls after clean: " + std::to_string(clean_calls->size()));
+    clean_calls->push_back(frame_calls.size() - 1);
 
-    clean_calls->push_back(raw_calls->back());
+    ILOG("Num calls after clean: " + std::to_string(clean_calls->size()));
 }
 
 
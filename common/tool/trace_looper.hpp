@@ -3,6 +3,7 @@
 #define TRACE_LOOPER_HPP
 
 #include <ctime>
+#include <functional>
 #include <vector>
 #include <string>
 #include <utility>
@@ -51,10 +52,6 @@ class TraceLooper {
     void process();
     void save();
 
-    void add_call(const common::CallTM* incall);
-    void add_frame_loop_calls(int target_frame, int num_loops, bool reset_loop_state);
-    void add_range_loop_calls(int start_call, int end_call, int num_loops);
-
     void print_trace_info();
 
     static bool call_is_state_changer(const common::CallTM* call);
@@ -77,24 +74,44 @@ class TraceLooper {
     std::unordered_map<std::string, std::string> str_args;
     std::unordered_map<std::string, bool> bool_args;
 
+    // Calls of the looped frame or range, serialized back to back, so that
+    // they can be written any number of times without keeping the parsed calls
+    struct CallBuffer {
+        std::vector<char> data;
+        std::vector<size_t> offsets; // where each call starts, then the end of the last one
+        std::vector<std::string> names;
+
+        CallBuffer() : offsets(1, 0) {}
+        size_t size() const { return names.size(); }
+        void add(common::CallTM* call);
+        void write(common::OutFile& outfile, size_t index) const;
+    };
+
+    // The trace is only scanned when loaded, the calls are parsed again a
+    // frame at a time when writing each output trace
+    common::TraceFileTM trace_file;
+    int num_calls;
+
     std::vector<std::pair<int, int>> frame_ranges;
-    std::vector<common::CallTM*> calls;
-    std::vector<common::CallTM*> prestate_calls;
-    std::vector<common::CallTM*> frame_loop_call_writelist;
-    std::vector<common::CallTM*> range_loop_call_writelist;
 
     std::vector<std::string> cleaned_calls;
     std::vector<std::string> pre_state_calls;
 
     std::string header;
 
-    void clean_loop_frame_calls(
-        std::vector<common::CallTM*>* calls,
-        std::vector<common::CallTM*>* clean_calls);
+    void for_each_call(int first_call, int last_call, const std::function<void(common::CallTM*)>& func);
+    static void write_call(common::OutFile& outfile, common::CallTM* call);
+
+    unsigned int write_frame_loop_trace(common::OutFile& outfile);
+    unsigned int write_range_loop_trace(common::OutFile& outfile);
+    void get_clean_loop_frame_calls(const CallBuffer& frame_calls, std::vector<size_t>* clean_calls);
+    void get_pre_frame_state_calls(
+        const CallBuffer& frame_calls,
+        const std::unordered_set<std::string>& pre_frame_state_names,
+        std::vector<size_t>* state_calls);
 
     void build_output_file_path();
     void build_output_file_path_range_trace();
-    void extract_pre_frame_state_calls();
 
     static void print_args_info();
     void set_arg_defaults();
@@ -104,8 +121,8 @@ class TraceLooper {
     bool args_are_valid();
 
     std::string calc_trace_md5();
-    void get_range_loop_header(std::string& out_string, const std::string& md5_string);
-    void get_frame_loop_header(std::string& out_string, const std::string& md5_string);
+    void get_range_loop_header(std::string& out_string, const std::string& md5_string, unsigned int call_count);
+    void get_frame_loop_header(std::string& out_string, const std::string& md5_string, unsigned int call_count);
 };
 
 
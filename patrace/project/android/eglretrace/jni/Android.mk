@@ -159,6 +159,8 @@ LOCAL_SRC_FILES     := \
     common/os_thread_linux.cpp \
     common/api_info_auto.cpp \
     common/api_info.cpp \
+    common/blob_table.cpp \
+    common/chunk_codec.cpp \
     common/in_file_mt.cpp \
     common/in_file_ra.cpp \
     common/in_file.cpp \
@@ -108,6 +108,8 @@ LOCAL_SRC_FILES     := \
     common/os_posix.cpp \
     common/api_info_auto.cpp \
     common/api_info.cpp \
+    common/blob_table.cpp \
+    common/chunk_codec.cpp \
     common/in_file_mt.cpp \
     common/in_file_ra.cpp \
     common/out_file.cpp \
@@ -12,14 +12,19 @@ set(SRC_COMMON
     ${SRC_ROOT}/common/trace_callset.cpp
     ${SRC_ROOT}/common/api_info_auto.cpp
     ${SRC_ROOT}/common/api_info.cpp
+    ${SRC_ROOT}/common/blob_table.cpp
+    ${SRC_ROOT}/common/chunk_codec.cpp
     ${SRC_ROOT}/common/in_file.cpp
     ${SRC_ROOT}/common/in_file_mt.cpp
     ${SRC_ROOT}/common/in_file_ra.cpp
     ${SRC_ROOT}/common/out_file.cpp
+    ${SRC_ROOT}/common/trace_patcher.cpp
     ${SRC_ROOT}/common/image.cpp
+    ${SRC_ROOT}/common/image_compare.cpp
     ${SRC_ROOT}/common/image_png.cpp
     ${SRC_ROOT}/common/image_bmp.cpp
     ${SRC_ROOT}/common/image_pnm.cpp
+    ${SRC_ROOT}/common/yuv_convert.cpp
     ${SRC_ROOT}/common/base64.cpp
     ${SRC_ROOT}/common/library.cpp
     ${SRC_ROOT}/common/gl_extension_supported.cpp
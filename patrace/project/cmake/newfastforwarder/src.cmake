@@ -20,6 +20,7 @@ set(SRC_NEWFASTFORWARDER
     ${SRC_ROOT}/newfastforwarder/parse_main.cpp
     ${SRC_ROOT}/newfastforwarder/cutter.cpp
     ${SRC_ROOT}/newfastforwarder/framestore.cpp
+    ${SRC_ROOT}/newfastforwarder/callnoset.cpp
 )
 
 set_source_files_properties (
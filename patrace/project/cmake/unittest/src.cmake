@@ -8,4 +8,16 @@ set(SRC_UNITTEST
     ${SRC_UNITTEST_DIR}/context_test.cpp
     ${SRC_UNITTEST_DIR}/system_test.cpp
     ${SRC_UNITTEST_DIR}/image_test.cpp
+    ${SRC_UNITTEST_DIR}/yuv_test.cpp
+    ${SRC_UNITTEST_DIR}/chunk_codec_test.cpp
+    ${SRC_UNITTEST_DIR}/callnoset_test.cpp
+    ${SRC_UNITTEST_DIR}/trace_patcher_test.cpp
+    ${SRC_UNITTEST_DIR}/index_buffer_stats_test.cpp
+    ${SRC_UNITTEST_DIR}/blob_table_test.cpp
+    ${SRC_UNITTEST_DIR}/upload_tracker_test.cpp
+    ${SRC_UNITTEST_DIR}/trace_test_util.cpp
+
+    ${SRC_ROOT}/newfastforwarder/callnoset.cpp
+    ${SRC_ROOT}/tool/index_buffer_stats.cpp
+    ${SRC_ROOT}/tool/upload_tracker.cpp
 )
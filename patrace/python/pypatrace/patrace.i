@@ -7,10 +7,29 @@
 #include <common/trace_model.hpp>
 #include <common/parse_api.hpp>
 #include <common/out_file.hpp>
+#include <common/call_table.hpp>
 
 // disable specific warnings for SWIG-generated codes
 #pragma GCC diagnostic ignored "-Wuninitialized"
 #pragma GCC diagnostic ignored "-Wunused-but-set-variable"
+
+// Read-only buffer over memory owned by C++, without copying it
+static PyObject *ReadOnlyBuffer(const void *data, size_t size)
+{
+    static char empty;
+    char *p = size ? (char *)data : &empty;
+#if PY_MAJOR_VERSION >= 3
+    return PyMemoryView_FromMemory(p, size, PyBUF_READ);
+#else
+    return PyBuffer_FromMemory(p, size);
+#endif
+}
+
+template<typename T>
+static PyObject *ReadOnlyBuffer(const std::vector<T> &column)
+{
+    return ReadOnlyBuffer(column.data(), column.size() * sizeof(T));
+}
 %}
 
 %template(ValueVector) std::vector<common::ValueTM*>;
@@ -537,6 +556,72 @@ public:
     %}
 };
 
+class CallTable
+{
+public:
+    CallTable();
+    ~CallTable();
+
+    bool Load(TraceFileTM &trace, unsigned int beginFrame, unsigned int endFrame, unsigned int argCount);
+    void Clear();
+
+    size_t Rows() const;
+    unsigned int ArgCount() const;
+};
+
+%extend CallTable {
+
+    PyObject *_column(const std::string &name, unsigned int arg)
+    {
+        if (name == "call_no")
+            return ReadOnlyBuffer($self->mCallNo);
+        else if (name == "tid")
+            return ReadOnlyBuffer($self->mTid);
+        else if (name == "func_id")
+            return ReadOnlyBuffer($self->mFuncId);
+        else if (name == "frame")
+            return ReadOnlyBuffer($self->mFrame);
+        else if (name == "bytes")
+            return ReadOnlyBuffer($self->mBytes);
+        else if (name == "error")
+            return ReadOnlyBuffer($self->mErrNo);
+        else if (arg < $self->ArgCount() && name == "arg_type")
+            return ReadOnlyBuffer($self->mArgType[arg]);
+        else if (arg < $self->ArgCount() && name == "arg_int")
+            return ReadOnlyBuffer($self->mArgInt[arg]);
+        else if (arg < $self->ArgCount() && name == "arg_float")
+            return ReadOnlyBuffer($self->mArgFloat[arg]);
+        PyErr_SetString(PyExc_KeyError, name.c_str());
+        return NULL;
+    }
+
+    const char *FuncName(unsigned int funcId) const
+    {
+        if (funcId == 0 || funcId > common::ApiInfo::MaxSigId || !common::ApiInfo::IdToNameArr[funcId])
+            return "";
+        return common::ApiInfo::IdToNameArr[funcId];
+    }
+
+    %pythoncode %{
+        # struct module format of the items of each column
+        COLUMN_FORMATS = {
+            'call_no': 'I', 'tid': 'I', 'func_id': 'I', 'frame': 'I', 'bytes': 'I', 'error': 'I',
+            'arg_type': 'B', 'arg_int': 'q', 'arg_float': 'd',
+        }
+
+        def __len__(self):
+            return self.Rows()
+
+        def Column(self, name, arg=0):
+            """A column as a read-only buffer, for instance for
+            numpy.frombuffer(table.Column('bytes'), dtype=numpy.uint32).
+            The arg_type, arg_int and arg_float columns are per argument.
+            The buffer points into the table, so it must not be used after
+            the table is loaded again or deleted."""
+            return self._column(name, arg)
+    %}
+};
+
 %rename(OutputFile) OutFile;
 class OutFile
 {
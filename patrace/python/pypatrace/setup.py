@@ -67,10 +67,13 @@ patrace_extension = setuptools.Extension(
         'patrace_wrap.cpp',
 
         'src/common/call_parser.cpp',
+        'src/common/call_table.cpp',
         'src/common/trace_model.cpp',
 
         'src/common/api_info_auto.cpp',
         'src/common/api_info.cpp',
+        'src/common/blob_table.cpp',
+        'src/common/chunk_codec.cpp',
         'src/common/in_file.cpp',
         'src/common/in_file_ra.cpp',
         'src/common/out_file.cpp',
@@ -88,7 +91,11 @@ patrace_extension = setuptools.Extension(
         'thirdparty/snappy/snappy-sinksource.cc',
         'thirdparty/snappy/snappy-stubs-internal.cc',
         'thirdparty/snappy/snappy-c.cc',
+
+        # md5
+        'thirdparty/md5/md5.c',
     ],
+    libraries=['z'],
     define_macros=[('PLATFORM_64BIT', None)] if on_64bit_platform else [],
 )
 
@@ -0,0 +1,117 @@
+#include <common/blob_table.hpp>
+
+namespace common {
+
+BlobTable gBlobTable;
+
+bool BlobTable::Define(const MD5Digest &digest, const char *data, unsigned int len)
+{
+    std::lock_guard<std::mutex> guard(mMutex);
+    if (mBlobs.count(digest))
+        return false;
+
+    mBlobs[digest].assign(data, data + len);
+    mOrder.push_back(digest);
+    mBytes += len;
+    return true;
+}
+
+const char *BlobTable::Lookup(const MD5Digest &digest, unsigned int &len) const
+{
+    std::lock_guard<std::mutex> guard(mMutex);
+    auto it = mBlobs.find(digest);
+    if (it == mBlobs.end())
+    {
+        len = 0;
+        return NULL;
+    }
+    len = it->second.size();
+    return it->second.data();
+}
+
+bool BlobTable::Contains(const MD5Digest &digest) const
+{
+    std::lock_guard<std::mutex> guard(mMutex);
+    return mBlobs.count(digest) > 0;
+}
+
+void BlobTable::ReadDefinitionContent(const char *content)
+{
+    char *src = const_cast<char*>(content);
+    MD5Digest digest;
+    memcpy((unsigned char*)digest, src, BLOB_DIGEST_LEN);
+    src += BLOB_DIGEST_LEN;
+
+    Array<char> data;
+    src = Read1DArray(src, data);
+    Define(digest, data.v, data.cnt);
+}
+
+size_t BlobTable::Count() const
+{
+    std::lock_guard<std::mutex> guard(mMutex);
+    return mOrder.size();
+}
+
+void BlobTable::Clear()
+{
+    std::lock_guard<std::mutex> guard(mMutex);
+    mBlobs.clear();
+    mOrder.clear();
+    mBytes = 0;
+}
+
+void BlobTable::OpenFile()
+{
+    std::lock_guard<std::mutex> guard(mMutex);
+    if (mOpenFiles++ == 0)
+    {
+        mBlobs.clear();
+        mOrder.clear();
+        mBytes = 0;
+    }
+}
+
+void BlobTable::CloseFile()
+{
+    std::lock_guard<std::mutex> guard(mMutex);
+    if (mOpenFiles > 0)
+        mOpenFiles--;
+}
+
+const char *ResolveBlobReference(const char *digestBytes, unsigned int &len)
+{
+    MD5Digest digest;
+    memcpy((unsigned char*)digest, digestBytes, BLOB_DIGEST_LEN);
+    const char *blob = gBlobTable.Lookup(digest, len);
+    if (blob == NULL)
+    {
+        DBG_LOG("Reference to unknown blob %s, the blob definition is missing from the trace!\n", digest.text().c_str());
+        os::abort();
+    }
+    return blob;
+}
+
+char *WriteBlobDefinition(char *dest, const MD5Digest &digest, const char *data, unsigned int len)
+{
+    BCall_vlen *pCall = (BCall_vlen*)dest;
+    pCall->funcId = BLOB_DEFINITION_FUNC_ID;
+    pCall->tid = 0;
+    pCall->errNo = 0;
+    pCall->reserved = 0;
+    dest += sizeof(BCall_vlen);
+    memcpy(dest, (const unsigned char*)digest, BLOB_DIGEST_LEN);
+    dest += BLOB_DIGEST_LEN;
+    dest = Write1DArray<char>(dest, len, data);
+    pCall->toNext = dest - (char*)pCall;
+    return dest;
+}
+
+char *WriteBlobReference(char *dest, const MD5Digest &digest)
+{
+    dest = WriteFixed<unsigned int>(dest, BLOB_REFERENCE_FLAG);
+    memcpy(dest, (const unsigned char*)digest, BLOB_DIGEST_LEN);
+    return dest + BLOB_DIGEST_LEN;
+}
+
+}
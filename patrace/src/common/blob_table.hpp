@@ -0,0 +1,88 @@
+#ifndef _COMMON_BLOB_TABLE_HPP_
+#define _COMMON_BLOB_TABLE_HPP_
+
+#include <common/file_format.hpp>
+#include <common/memory.hpp>
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace common {
+
+struct MD5DigestHash
+{
+    size_t operator()(const MD5Digest &digest) const
+    {
+        // The digest is already uniformly distributed, any part of it is a good hash
+        size_t h;
+        memcpy(&h, (const unsigned char*)digest, sizeof(h));
+        return h;
+    }
+};
+
+// Blobs read from blob definitions (see file_format.hpp), keyed by their content digest.
+// Definitions are copied into the table once, references resolve to
+// the stored data without copying.
+class BlobTable
+{
+public:
+    BlobTable() : mBytes(0), mOpenFiles(0) {}
+
+    // Store the blob of a definition block. Returns false if the blob was already known.
+    bool Define(const MD5Digest &digest, const char *data, unsigned int len);
+    // Returns NULL if no definition for the digest has been read yet.
+    const char *Lookup(const MD5Digest &digest, unsigned int &len) const;
+    bool Contains(const MD5Digest &digest) const;
+
+    // Parse a blob definition block starting at its BCall_vlen header
+    void ReadDefinition(const char *block) { ReadDefinitionContent(block + sizeof(BCall_vlen)); }
+    // Parse a blob definition block starting right after its BCall_vlen header
+    void ReadDefinitionContent(const char *content);
+
+    size_t Count() const;
+    size_t Bytes() const { return mBytes; }
+    void Clear();
+
+    // Trace files register while they are open. The first file to open when
+    // no other one is open starts with an empty table, so that the blobs of
+    // files processed before are neither kept in memory nor resolved by mistake.
+    void OpenFile();
+    void CloseFile();
+
+    // Iterate over all definitions in the order they were read
+    template <class Visitor>
+    void ForEach(size_t from, Visitor visit) const
+    {
+        std::lock_guard<std::mutex> guard(mMutex);
+        for (size_t i = from; i < mOrder.size(); ++i)
+        {
+            const std::vector<char> &blob = mBlobs.at(mOrder[i]);
+            visit(mOrder[i], blob.data(), (unsigned int)blob.size());
+        }
+    }
+
+private:
+    BlobTable(const BlobTable &);
+    BlobTable &operator =(const BlobTable &);
+
+    mutable std::mutex mMutex;
+    std::unordered_map<MD5Digest, std::vector<char>, MD5DigestHash> mBlobs;
+    std::vector<MD5Digest> mOrder;
+    size_t mBytes;
+    unsigned int mOpenFiles;
+};
+
+// Since blobs are addressed by their content, a single table can be shared
+// by all trace files that are open in the process.
+extern BlobTable gBlobTable;
+
+// Serialize a blob definition block into dest, returns the end of the block
+char *WriteBlobDefinition(char *dest, const MD5Digest &digest, const char *data, unsigned int len);
+
+// Serialize a blob reference in place of a 1D array, returns the end of the reference
+char *WriteBlobReference(char *dest, const MD5Digest &digest);
+
+}
+
+#endif
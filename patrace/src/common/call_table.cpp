@@ -0,0 +1,140 @@
+#include <common/call_table.hpp>
+#include <common/parse_api.hpp>
+
+namespace common {
+
+void CallTable::Clear()
+{
+    mCallNo.clear();
+    mTid.clear();
+    mFuncId.clear();
+    mFrame.clear();
+    mBytes.clear();
+    mErrNo.clear();
+    mArgType.clear();
+    mArgInt.clear();
+    mArgFloat.clear();
+    mArgCount = 0;
+}
+
+bool CallTable::Load(TraceFileTM& trace, unsigned int beginFrame, unsigned int endFrame, unsigned int argCount)
+{
+    Clear();
+    mArgCount = argCount;
+    mArgType.resize(argCount);
+    mArgInt.resize(argCount);
+    mArgFloat.resize(argCount);
+
+    if (endFrame == 0 || endFrame > trace.mFrames.size())
+    {
+        endFrame = trace.mFrames.size();
+    }
+    if (beginFrame >= endFrame)
+    {
+        return true;
+    }
+
+    size_t rows = 0;
+    for (unsigned int f = beginFrame; f < endFrame; ++f)
+    {
+        rows += trace.mFrames[f]->GetCallCount();
+    }
+    mCallNo.reserve(rows);
+    mTid.reserve(rows);
+    mFuncId.reserve(rows);
+    mFrame.reserve(rows);
+    mBytes.reserve(rows);
+    mErrNo.reserve(rows);
+    for (unsigned int j = 0; j < argCount; ++j)
+    {
+        mArgType[j].reserve(rows);
+        mArgInt[j].reserve(rows);
+        mArgFloat[j].reserve(rows);
+    }
+
+    // The ids of the trace file depend on its sigbook, look them up once
+    InFileRA& file = *trace.mpInFileRA;
+    std::vector<unsigned short> apiIds(file.GetMaxSigId() + 1, 0);
+    for (unsigned short id = 1; id <= file.GetMaxSigId(); ++id)
+    {
+        apiIds[id] = gApiInfo.NameToId(file.ExIdToName(id));
+    }
+
+    file.SetReadPos(trace.mFrames[beginFrame]->mReadPos);
+    for (unsigned int f = beginFrame; f < endFrame; ++f)
+    {
+        const FrameTM& frame = *trace.mFrames[f];
+        for (unsigned int i = 0; i < frame.GetCallCount(); ++i)
+        {
+            void* fptr = NULL;
+            BCall header;
+            char* src = NULL;
+            const std::streamoff pos = file.GetReadPos();
+            if (!file.GetNextCall(fptr, header, src))
+            {
+                DBG_LOG("File inconsistent!\n");
+                return false;
+            }
+
+            mCallNo.push_back(frame.mFirstCallOfThisFrame + i);
+            mTid.push_back(header.tid);
+            mFuncId.push_back(apiIds[header.funcId]);
+            mFrame.push_back(f);
+            // blob definitions stored in front of the call are counted with it
+            mBytes.push_back(file.GetReadPos() - pos);
+            mErrNo.push_back(header.errNo);
+
+            if (argCount > 0)
+            {
+                CallTM call;
+                if (fptr)
+                {
+                    (*(ParseFunc)fptr)(src, call, file);
+                }
+                AddArgs(call);
+            }
+        }
+    }
+    return true;
+}
+
+void CallTable::AddArgs(const CallTM& call)
+{
+    for (unsigned int j = 0; j < mArgCount; ++j)
+    {
+        unsigned char type = 0;
+        long long intValue = 0;
+        double floatValue = 0.0;
+        if (j < call.mArgs.size())
+        {
+            const ValueTM& arg = *call.mArgs[j];
+            type = arg.mType;
+            switch (arg.mType)
+            {
+            case Int8_Type: intValue = arg.mInt8; break;
+            case Uint8_Type: intValue = arg.mUint8; break;
+            case Int16_Type: intValue = arg.mInt16; break;
+            case Uint16_Type: intValue = arg.mUint16; break;
+            case Int_Type: intValue = arg.mInt; break;
+            case Enum_Type: intValue = arg.mEnum; break;
+            case Uint_Type: intValue = arg.mUint; break;
+            case Int64_Type: intValue = arg.mInt64; break;
+            case Uint64_Type: intValue = static_cast<long long>(arg.mUint64); break;
+            case Float_Type: floatValue = arg.mFloat; break;
+            case Opaque_Type:
+                if (arg.mOpaqueType == BufferObjectReferenceType && arg.mOpaqueIns)
+                {
+                    intValue = arg.mOpaqueIns->mUint;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+        mArgType[j].push_back(type);
+        mArgInt[j].push_back(intValue);
+        mArgFloat[j].push_back(floatValue);
+    }
+}
+
+}
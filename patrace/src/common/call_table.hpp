@@ -0,0 +1,53 @@
+#ifndef _COMMON_CALL_TABLE_HPP_
+#define _COMMON_CALL_TABLE_HPP_
+
+#include <common/trace_model.hpp>
+
+#include <vector>
+
+namespace common {
+
+// The calls of a range of frames laid out as columns, one row per call, so
+// that whole traces can be summarized without going through a CallTM per
+// call. The columns are contiguous arrays that the Python binding hands out
+// as buffers.
+//
+// Argument j of a call is described by mArgType[j] (its Value_Type_TM, or 0
+// if the call has fewer arguments), and its value is in mArgInt[j] for
+// integers, enums and buffer offsets, or in mArgFloat[j] for floats. Other
+// types only have their type filled in.
+class CallTable
+{
+public:
+    CallTable() : mArgCount(0) {}
+
+    // Reads the calls of frames [beginFrame, endFrame) of an opened trace,
+    // keeping the first argCount arguments of each. An endFrame of 0 or past
+    // the last frame reads to the end. Calls are only decoded when
+    // argCount is not 0.
+    bool Load(TraceFileTM& trace, unsigned int beginFrame, unsigned int endFrame, unsigned int argCount);
+    void Clear();
+
+    size_t Rows() const { return mCallNo.size(); }
+    unsigned int ArgCount() const { return mArgCount; }
+
+    std::vector<unsigned int>   mCallNo;
+    std::vector<unsigned int>   mTid;
+    std::vector<unsigned int>   mFuncId; // id in api_info.hpp, the same for every trace
+    std::vector<unsigned int>   mFrame;
+    std::vector<unsigned int>   mBytes; // serialized size, including the call header
+    std::vector<unsigned int>   mErrNo; // CALL_ERROR_NO
+
+    std::vector<std::vector<unsigned char> >    mArgType;
+    std::vector<std::vector<long long> >        mArgInt;
+    std::vector<std::vector<double> >           mArgFloat;
+
+private:
+    void AddArgs(const CallTM& call);
+
+    unsigned int mArgCount;
+};
+
+}
+
+#endif
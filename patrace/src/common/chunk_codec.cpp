@@ -0,0 +1,448 @@
+#include <common/chunk_codec.hpp>
+
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include <snappy.h>
+#include <zlib.h>
+
+namespace common {
+
+namespace {
+
+// Writers of the snappy format that spend the time to find the longest
+// match at every position, for chunks that must come out small rather
+// than fast. Any snappy decoder reads the result.
+class SnappyTightWriter
+{
+public:
+    SnappyTightWriter(char* dest) : mDest((unsigned char*)dest), mOut((unsigned char*)dest) {}
+
+    size_t Compress(const char* src, size_t len)
+    {
+        const unsigned char* in = (const unsigned char*)src;
+        for (size_t n = len; ; n >>= 7)
+        {
+            *mOut++ = (unsigned char)((n & 0x7f) | (n >= 0x80 ? 0x80 : 0));
+            if (n < 0x80)
+                break;
+        }
+
+        const int HASH_BITS = 16;
+        const int MAX_CHAIN = 64;
+        std::vector<int> head(1 << HASH_BITS, -1);
+        std::vector<int> prev(len, -1);
+        size_t literal = 0;
+        size_t pos = 0;
+        while (pos + 4 <= len)
+        {
+            size_t best = 0;
+            size_t bestOffset = 0;
+            const unsigned int hash = Hash(in + pos, HASH_BITS);
+            int candidate = head[hash];
+            for (int chain = 0; chain < MAX_CHAIN && candidate >= 0; ++chain, candidate = prev[candidate])
+            {
+                size_t length = 0;
+                while (pos + length < len && in[candidate + length] == in[pos + length])
+                    ++length;
+                if (length > best)
+                {
+                    best = length;
+                    bestOffset = pos - candidate;
+                }
+            }
+            if (best < 4 || CopyCost(best, bestOffset) >= best)
+            {
+                prev[pos] = head[hash];
+                head[hash] = pos;
+                ++pos;
+                continue;
+            }
+
+            EmitLiteral(in + literal, pos - literal);
+            EmitCopy(best, bestOffset);
+            for (size_t end = pos + best; pos < end; ++pos)
+            {
+                if (pos + 4 <= len)
+                {
+                    const unsigned int h = Hash(in + pos, HASH_BITS);
+                    prev[pos] = head[h];
+                    head[h] = pos;
+                }
+            }
+            literal = pos;
+        }
+        EmitLiteral(in + literal, len - literal);
+        return mOut - mDest;
+    }
+
+private:
+    static unsigned int Hash(const unsigned char* p, int bits)
+    {
+        const unsigned int word = p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+        return (word * 0x1e35a7bd) >> (32 - bits);
+    }
+
+    // Copies are at most 64 bytes long, longer matches take several
+    static size_t CopyCost(size_t length, size_t offset)
+    {
+        size_t cost = 0;
+        for (; length > 68; length -= 64)
+            cost += offset < 65536 ? 3 : 5;
+        if (length > 64)
+        {
+            cost += offset < 65536 ? 3 : 5;
+            length -= 60;
+        }
+        if (length <= 11 && offset < 2048)
+            return cost + 2;
+        return cost + (offset < 65536 ? 3 : 5);
+    }
+
+    void EmitLiteral(const unsigned char* src, size_t length)
+    {
+        if (length == 0)
+            return;
+        const size_t n = length - 1;
+        if (n < 60)
+        {
+            *mOut++ = (unsigned char)(n << 2);
+        }
+        else
+        {
+            unsigned char* tag = mOut++;
+            size_t bytes = 0;
+            for (size_t rest = n; rest > 0; rest >>= 8, ++bytes)
+                *mOut++ = (unsigned char)(rest & 0xff);
+            *tag = (unsigned char)((59 + bytes) << 2);
+        }
+        memcpy(mOut, src, length);
+        mOut += length;
+    }
+
+    void EmitCopy(size_t length, size_t offset)
+    {
+        // Leave at least 4 bytes for the last copy, the shortest a 2 byte copy can be
+        for (; length > 68; length -= 64)
+            EmitCopyUpTo64(64, offset);
+        if (length > 64)
+        {
+            EmitCopyUpTo64(60, offset);
+            length -= 60;
+        }
+        EmitCopyUpTo64(length, offset);
+    }
+
+    void EmitCopyUpTo64(size_t length, size_t offset)
+    {
+        if (length >= 4 && length <= 11 && offset < 2048)
+        {
+            *mOut++ = (unsigned char)(1 | ((length - 4) << 2) | ((offset >> 8) << 5));
+            *mOut++ = (unsigned char)(offset & 0xff);
+        }
+        else if (offset < 65536)
+        {
+            *mOut++ = (unsigned char)(2 | ((length - 1) << 2));
+            *mOut++ = (unsigned char)(offset & 0xff);
+            *mOut++ = (unsigned char)(offset >> 8);
+        }
+        else
+        {
+            *mOut++ = (unsigned char)(3 | ((length - 1) << 2));
+            for (int i = 0; i < 4; ++i)
+                *mOut++ = (unsigned char)((offset >> (8 * i)) & 0xff);
+        }
+    }
+
+    unsigned char* mDest;
+    unsigned char* mOut;
+};
+
+class SnappyCodec : public ChunkCodec
+{
+public:
+    virtual ChunkCodecId Id() const { return CHUNK_CODEC_SNAPPY; }
+    virtual const char* Name() const { return "snappy"; }
+
+    virtual size_t MaxCompressedLength(size_t len) const
+    {
+        return ::snappy::MaxCompressedLength(len);
+    }
+
+    virtual bool Compress(const char* src, size_t len, char* dest, size_t* destLen) const
+    {
+        ::snappy::RawCompress(src, len, dest, destLen);
+        return true;
+    }
+
+    virtual bool CompressTight(const char* src, size_t len, char* dest, size_t* destLen) const
+    {
+        *destLen = SnappyTightWriter(dest).Compress(src, len);
+        return true;
+    }
+
+    virtual bool GetUncompressedLength(const char* src, size_t len, size_t* result) const
+    {
+        return ::snappy::GetUncompressedLength(src, len, result);
+    }
+
+    virtual bool Uncompress(const char* src, size_t len, char* dest) const
+    {
+        return ::snappy::RawUncompress(src, len, dest);
+    }
+
+    // The decoder does not require the shortest encoding of an element, so the
+    // stream grows by widening the length field of literals and the offset
+    // field of copies, front to back, until it has the requested length.
+    virtual bool Stretch(const char* src, size_t len, char* dest, size_t destLen) const
+    {
+        if (destLen < len)
+            return false;
+        size_t gap = destLen - len;
+        const unsigned char* p = (const unsigned char*)src;
+        const unsigned char* end = p + len;
+        unsigned char* q = (unsigned char*)dest;
+
+        // The uncompressed length varint
+        while (p < end && (*p & 0x80))
+            *q++ = *p++;
+        if (p == end)
+            return false;
+        *q++ = *p++;
+
+        while (p < end)
+        {
+            const unsigned char tag = *p++;
+            size_t extra = 0;
+            switch (tag & 3)
+            {
+            case 0: // literal
+            {
+                size_t length = (tag >> 2) + 1;
+                if (length > 60)
+                {
+                    extra = length - 60;
+                    if ((size_t)(end - p) < extra)
+                        return false;
+                    length = 0;
+                    for (size_t i = 0; i < extra; ++i)
+                        length |= (size_t)p[i] << (8 * i);
+                    length += 1;
+                }
+                if ((size_t)(end - p) < extra + length)
+                    return false;
+                const size_t wider = std::min<size_t>(4, extra + gap);
+                if (wider > extra)
+                {
+                    gap -= wider - extra;
+                    *q++ = (unsigned char)((59 + wider) << 2);
+                    for (size_t i = 0; i < wider; ++i)
+                        *q++ = (unsigned char)(((length - 1) >> (8 * i)) & 0xff);
+                }
+                else
+                {
+                    *q++ = tag;
+                    memcpy(q, p, extra);
+                    q += extra;
+                }
+                memcpy(q, p + extra, length);
+                q += length;
+                p += extra + length;
+                break;
+            }
+            default: // copy
+            {
+                extra = (tag & 3) == 3 ? 4 : (tag & 3);
+                if ((size_t)(end - p) < extra)
+                    return false;
+                size_t length = (tag >> 2) + 1;
+                size_t offset = 0;
+                if ((tag & 3) == 1)
+                {
+                    length = 4 + ((tag >> 2) & 7);
+                    offset = ((size_t)(tag >> 5) << 8) | p[0];
+                }
+                else
+                {
+                    for (size_t i = 0; i < extra; ++i)
+                        offset |= (size_t)p[i] << (8 * i);
+                }
+                size_t wider = extra;
+                if (gap >= 4 - extra)
+                    wider = 4;
+                else if (extra == 1 && gap >= 1 && offset < 65536)
+                    wider = 2;
+                if (wider > extra)
+                {
+                    gap -= wider - extra;
+                    *q++ = (unsigned char)(((length - 1) << 2) | (wider == 4 ? 3 : 2));
+                    for (size_t i = 0; i < wider; ++i)
+                        *q++ = (unsigned char)((offset >> (8 * i)) & 0xff);
+                }
+                else
+                {
+                    *q++ = tag;
+                    memcpy(q, p, extra);
+                    q += extra;
+                }
+                p += extra;
+                break;
+            }
+            }
+        }
+        return gap == 0;
+    }
+};
+
+class StoreCodec : public ChunkCodec
+{
+public:
+    virtual ChunkCodecId Id() const { return CHUNK_CODEC_STORE; }
+    virtual const char* Name() const { return "store"; }
+
+    virtual size_t MaxCompressedLength(size_t len) const
+    {
+        return len;
+    }
+
+    virtual bool Compress(const char* src, size_t len, char* dest, size_t* destLen) const
+    {
+        memcpy(dest, src, len);
+        *destLen = len;
+        return true;
+    }
+
+    virtual bool GetUncompressedLength(const char* src, size_t len, size_t* result) const
+    {
+        *result = len;
+        return true;
+    }
+
+    virtual bool Uncompress(const char* src, size_t len, char* dest) const
+    {
+        memcpy(dest, src, len);
+        return true;
+    }
+};
+
+// zlib streams do not record their uncompressed size, so it is
+// stored in front of the stream as a 4 byte little endian word.
+class ZlibCodec : public ChunkCodec
+{
+public:
+    virtual ChunkCodecId Id() const { return CHUNK_CODEC_ZLIB; }
+    virtual const char* Name() const { return "zlib"; }
+
+    virtual size_t MaxCompressedLength(size_t len) const
+    {
+        return 4 + compressBound(len);
+    }
+
+    virtual bool Compress(const char* src, size_t len, char* dest, size_t* destLen) const
+    {
+        unsigned char* p = (unsigned char*)dest;
+        p[0] = len & 0xff;
+        p[1] = (len >> 8) & 0xff;
+        p[2] = (len >> 16) & 0xff;
+        p[3] = (len >> 24) & 0xff;
+
+        uLongf zlen = compressBound(len);
+        if (compress2(p + 4, &zlen, (const Bytef*)src, len, Z_BEST_COMPRESSION) != Z_OK)
+            return false;
+        *destLen = 4 + zlen;
+        return true;
+    }
+
+    // Tries the other strategies and the largest hash table, and keeps the
+    // smallest stream
+    virtual bool CompressTight(const char* src, size_t len, char* dest, size_t* destLen) const
+    {
+        if (!Compress(src, len, dest, destLen))
+            return false;
+        const int strategies[] = { Z_DEFAULT_STRATEGY, Z_FILTERED };
+        std::vector<Bytef> buf(compressBound(len));
+        for (int strategy : strategies)
+        {
+            z_stream stream;
+            memset(&stream, 0, sizeof(stream));
+            if (deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, MAX_WBITS, MAX_MEM_LEVEL, strategy) != Z_OK)
+                return false;
+            stream.next_in = (Bytef*)src;
+            stream.avail_in = len;
+            stream.next_out = buf.data();
+            stream.avail_out = buf.size();
+            const bool done = deflate(&stream, Z_FINISH) == Z_STREAM_END;
+            const size_t zlen = stream.total_out;
+            deflateEnd(&stream);
+            if (done && 4 + zlen < *destLen)
+            {
+                memcpy(dest + 4, buf.data(), zlen);
+                *destLen = 4 + zlen;
+            }
+        }
+        return true;
+    }
+
+    virtual bool GetUncompressedLength(const char* src, size_t len, size_t* result) const
+    {
+        if (len < 4)
+            return false;
+        const unsigned char* p = (const unsigned char*)src;
+        *result = (size_t)p[0] | ((size_t)p[1] << 8) | ((size_t)p[2] << 16) | ((size_t)p[3] << 24);
+        return true;
+    }
+
+    virtual bool Uncompress(const char* src, size_t len, char* dest) const
+    {
+        size_t expected = 0;
+        if (!GetUncompressedLength(src, len, &expected))
+            return false;
+        uLongf dlen = expected;
+        if (uncompress((Bytef*)dest, &dlen, (const Bytef*)src + 4, len - 4) != Z_OK)
+            return false;
+        return dlen == expected;
+    }
+
+    // uncompress() stops at the end of the zlib stream
+    virtual bool IgnoresTrailingBytes() const { return true; }
+};
+
+const SnappyCodec sSnappyCodec;
+const StoreCodec sStoreCodec;
+const ZlibCodec sZlibCodec;
+
+const ChunkCodec* const sCodecs[CHUNK_CODEC_COUNT] = {
+    &sSnappyCodec,
+    &sStoreCodec,
+    &sZlibCodec,
+};
+
+}
+
+bool ChunkCodec::Stretch(const char* src, size_t len, char* dest, size_t destLen) const
+{
+    if (destLen < len || (destLen > len && !IgnoresTrailingBytes()))
+        return false;
+    memcpy(dest, src, len);
+    memset(dest + len, 0, destLen - len);
+    return true;
+}
+
+const ChunkCodec* GetChunkCodec(unsigned int id)
+{
+    if (id >= CHUNK_CODEC_COUNT)
+        return NULL;
+    return sCodecs[id];
+}
+
+const ChunkCodec* GetChunkCodec(const char* name)
+{
+    for (unsigned int id = 0; id < CHUNK_CODEC_COUNT; ++id)
+    {
+        if (strcmp(sCodecs[id]->Name(), name) == 0)
+            return sCodecs[id];
+    }
+    return NULL;
+}
+
+}
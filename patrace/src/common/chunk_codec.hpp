@@ -0,0 +1,101 @@
+#ifndef _COMMON_CHUNK_CODEC_HPP_
+#define _COMMON_CHUNK_CODEC_HPP_
+
+#include <stddef.h>
+
+#include <common/file_format.hpp>
+
+namespace common {
+
+///////////////////////////////////////////////////////////////////////
+// Chunk codecs
+//
+// The calls of a .pat file are stored in chunks, each prefixed by a
+// 4 byte little endian length word:
+//
+//     [codec id : 4 bits][compressed length : 28 bits][compressed data]
+//
+// A chunk of CHUNK_LENGTH_MASK bytes or more has all 28 length bits set,
+// and the full 32 bit length follows in a second word.
+//
+// Files older than HEADER_VERSION_6 have no codec id, all 32 bits of the
+// length word are the length of a snappy chunk. Readers look up the codec
+// of every chunk, so a file may mix chunks of different codecs.
+
+enum ChunkCodecId
+{
+    CHUNK_CODEC_SNAPPY = 0, // default, fast
+    CHUNK_CODEC_STORE = 1,  // uncompressed, for local caches
+    CHUNK_CODEC_ZLIB = 2,   // slower, better ratio, for archival
+    CHUNK_CODEC_COUNT
+};
+
+const unsigned int CHUNK_CODEC_SHIFT = 28;
+const unsigned int CHUNK_LENGTH_MASK = (1u << CHUNK_CODEC_SHIFT) - 1;
+
+inline unsigned int ChunkLengthWord(ChunkCodecId codec, unsigned int compressedLength)
+{
+    if (compressedLength > CHUNK_LENGTH_MASK)
+        compressedLength = CHUNK_LENGTH_MASK;
+    return ((unsigned int)codec << CHUNK_CODEC_SHIFT) | compressedLength;
+}
+
+inline ChunkCodecId ChunkLengthWordCodec(unsigned int word, HeaderVersion version)
+{
+    if (version < HEADER_VERSION_6)
+        return CHUNK_CODEC_SNAPPY;
+    return (ChunkCodecId)(word >> CHUNK_CODEC_SHIFT);
+}
+
+inline unsigned int ChunkLengthWordLength(unsigned int word, HeaderVersion version)
+{
+    if (version < HEADER_VERSION_6)
+        return word;
+    return word & CHUNK_LENGTH_MASK;
+}
+
+// Whether the full length follows the length word
+inline bool ChunkLengthWordIsLong(unsigned int word, HeaderVersion version)
+{
+    return version >= HEADER_VERSION_6 && (word & CHUNK_LENGTH_MASK) == CHUNK_LENGTH_MASK;
+}
+
+class ChunkCodec
+{
+public:
+    virtual ~ChunkCodec() {}
+
+    virtual ChunkCodecId Id() const = 0;
+    virtual const char* Name() const = 0;
+
+    // Upper bound of the compressed size of len bytes
+    virtual size_t MaxCompressedLength(size_t len) const = 0;
+    // Returns false if the data could not be compressed
+    virtual bool Compress(const char* src, size_t len, char* dest, size_t* destLen) const = 0;
+    // Like Compress(), but spends more time to make the output smaller
+    virtual bool CompressTight(const char* src, size_t len, char* dest, size_t* destLen) const
+    {
+        return Compress(src, len, dest, destLen);
+    }
+
+    // Returns false if the chunk is corrupt
+    virtual bool GetUncompressedLength(const char* src, size_t len, size_t* result) const = 0;
+    // dest must hold GetUncompressedLength() bytes. Returns false if the chunk is corrupt.
+    virtual bool Uncompress(const char* src, size_t len, char* dest) const = 0;
+    // Whether bytes after the compressed data are ignored, so that a chunk can
+    // be padded to a given size
+    virtual bool IgnoresTrailingBytes() const { return false; }
+    // Writes compressed data of len bytes as exactly destLen bytes that
+    // uncompress to the same data. Returns false if the codec cannot make it
+    // that long. By default only codecs that ignore trailing bytes can.
+    virtual bool Stretch(const char* src, size_t len, char* dest, size_t destLen) const;
+};
+
+// Returns NULL for unknown codec ids
+const ChunkCodec* GetChunkCodec(unsigned int id);
+// Look up a codec by its name ("snappy", "store", "zlib"). Returns NULL for unknown names.
+const ChunkCodec* GetChunkCodec(const char* name);
+
+}
+
+#endif
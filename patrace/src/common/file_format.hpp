@@ -74,7 +74,9 @@ enum HeaderVersion {
     HEADER_VERSION_1 = 3,
     HEADER_VERSION_2,
     HEADER_VERSION_3,
-    HEADER_VERSION_4
+    HEADER_VERSION_4,
+    HEADER_VERSION_5, // HEADER_VERSION_4 + blob table
+    HEADER_VERSION_6  // HEADER_VERSION_5 + per chunk codec id, see chunk_codec.hpp
 };
 
 class BHeader {
@@ -190,6 +192,34 @@ struct BCall_vlen : BCall { // variable length
 
 #pragma pack(pop)
 
+///////////////////////////////////////////////////////////////////////
+// Blob table (HEADER_VERSION_5 and later)
+//
+// Large blobs that are uploaded many times (texture mips, vertex buffers,
+// shader sources, ...) can be stored once in a *blob definition* block, and
+// the calls that use them then only store a *blob reference*.
+//
+// A blob definition is a block with the BCall_vlen layout and the funcId
+// BLOB_DEFINITION_FUNC_ID, which is never used by a sigbook entry:
+//
+//     [BCall_vlen][MD5 digest of the content][1D array of char]
+//
+// A blob reference replaces the 1D array written by Write1DArray inside a
+// call. Its length word has BLOB_REFERENCE_FLAG set:
+//
+//     [BLOB_REFERENCE_FLAG][MD5 digest of the content]
+//
+// A definition is always written before the first call that references it,
+// so the file can still be read sequentially. See blob_table.hpp.
+
+const unsigned short BLOB_DEFINITION_FUNC_ID = 0;
+const unsigned int   BLOB_REFERENCE_FLAG = 0x80000000u;
+const unsigned int   BLOB_DIGEST_LEN = 16;
+const unsigned int   BLOB_REFERENCE_LEN = sizeof(unsigned int) + BLOB_DIGEST_LEN;
+
+// Implemented in blob_table.cpp
+const char* ResolveBlobReference(const char* digest, unsigned int& len);
+
 ///////////////////////////////////////////////////////////////////////
 // Write functions
 
@@ -328,6 +358,13 @@ inline char* Read1DArray(char* src, Array<T>& arr) {
 #endif
     unsigned int byLen;
     src = ReadFixed(src, byLen);
+    if (unlikely(byLen & BLOB_REFERENCE_FLAG)) {
+        // The data lives in the blob table, point directly into it
+        const char* blob = ResolveBlobReference(src, byLen);
+        arr.cnt = byLen/sizeof(T);
+        arr.v = (byLen > 0) ? (T*)blob : NULL;
+        return src + BLOB_DIGEST_LEN;
+    }
     arr.cnt = byLen/sizeof(T);
     arr.v = (byLen > 0) ? (T*)src : NULL;
     return PTR_PADDING(src+byLen, 4);
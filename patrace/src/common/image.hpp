@@ -32,6 +32,7 @@
 
 
 #include <fstream>
+#include <vector>
 
 
 namespace image {
@@ -106,6 +107,16 @@ public:
     double compare(Image &ref);
 };
 
+// Encode pixels as a PNG file in png. The rows are filtered and deflated
+// in bands on several threads, see setPNGCompression().
+bool encodePNG(const unsigned char *pixels, unsigned width, unsigned height, unsigned channels,
+               bool flipped, std::vector<unsigned char> &png);
+
+// Set the zlib level (0 to 9) and the number of threads of every PNG
+// written from now on. With 0 threads, one per core is used, up to 8.
+// The default is the fastest level.
+void setPNGCompression(int level, unsigned threads = 0);
+
 bool writePixelsToBuffer(unsigned char *pixels,
                          unsigned w, unsigned h, unsigned numChannels,
                          bool flipped,
@@ -0,0 +1,231 @@
+#include "image_compare.hpp"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace image {
+
+namespace {
+
+struct Accumulator
+{
+    unsigned long long sumSquaredError[ImageDiff::MAX_CHANNELS] = {};
+    unsigned long long sumAbsDiff[ImageDiff::MAX_CHANNELS] = {};
+    unsigned maxAbsDiff[ImageDiff::MAX_CHANNELS] = {};
+    unsigned long long differingPixels = 0;
+};
+
+// Compare the first channels of width pixels, for any number of channels per pixel
+void compareRow(const unsigned char *src, unsigned srcChannels, const unsigned char *ref, unsigned refChannels,
+                unsigned channels, unsigned width, Accumulator &acc)
+{
+    for (unsigned x = 0; x < width; ++x)
+    {
+        bool differs = false;
+        for (unsigned c = 0; c < channels; ++c)
+        {
+            const unsigned d = abs(src[x * srcChannels + c] - ref[x * refChannels + c]);
+            acc.sumSquaredError[c] += d * d;
+            acc.sumAbsDiff[c] += d;
+            acc.maxAbsDiff[c] = std::max(acc.maxAbsDiff[c], d);
+            differs |= d != 0;
+        }
+        acc.differingPixels += differs;
+    }
+}
+
+#if defined(__SSE2__)
+// Compare two RGBA rows 4 pixels at a time. Every 32 bit lane of the sums
+// belongs to one channel. Returns the number of pixels compared, the rest
+// is left for compareRow().
+unsigned compareRowRGBA(const unsigned char *src, const unsigned char *ref, unsigned width, Accumulator &acc)
+{
+    enum { FLUSH_PIXELS = 8192 }; // 32 bit sums of squares cannot overflow before this
+
+    const __m128i zero = _mm_setzero_si128();
+    const unsigned simdWidth = width & ~3u;
+    __m128i maxDiff = zero;
+    unsigned x = 0;
+    while (x < simdWidth)
+    {
+        const unsigned end = std::min(simdWidth, x + FLUSH_PIXELS);
+        __m128i sumSquares = zero;
+        __m128i sumDiffs = zero;
+        for (; x < end; x += 4)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x * 4));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ref + x * 4));
+            const __m128i d = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+            maxDiff = _mm_max_epu8(maxDiff, d);
+
+            const __m128i lo = _mm_unpacklo_epi8(d, zero); // pixels 0 and 1
+            const __m128i hi = _mm_unpackhi_epi8(d, zero); // pixels 2 and 3
+            const __m128i diffs = _mm_add_epi16(lo, hi);
+            sumDiffs = _mm_add_epi32(sumDiffs, _mm_add_epi32(_mm_unpacklo_epi16(diffs, zero), _mm_unpackhi_epi16(diffs, zero)));
+            const __m128i loSquares = _mm_mullo_epi16(lo, lo);
+            const __m128i hiSquares = _mm_mullo_epi16(hi, hi);
+            sumSquares = _mm_add_epi32(sumSquares, _mm_add_epi32(_mm_add_epi32(_mm_unpacklo_epi16(loSquares, zero), _mm_unpackhi_epi16(loSquares, zero)),
+                                                                 _mm_add_epi32(_mm_unpacklo_epi16(hiSquares, zero), _mm_unpackhi_epi16(hiSquares, zero))));
+
+            const int equalPixels = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(d, zero)));
+            acc.differingPixels += 4 - __builtin_popcount(equalPixels);
+        }
+
+        unsigned squares[4], diffs[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(squares), sumSquares);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(diffs), sumDiffs);
+        for (unsigned c = 0; c < 4; ++c)
+        {
+            acc.sumSquaredError[c] += squares[c];
+            acc.sumAbsDiff[c] += diffs[c];
+        }
+    }
+
+    unsigned char maxima[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(maxima), maxDiff);
+    for (unsigned i = 0; i < 16; ++i)
+    {
+        acc.maxAbsDiff[i & 3] = std::max<unsigned>(acc.maxAbsDiff[i & 3], maxima[i]);
+    }
+    return x;
+}
+#endif
+
+// Mean SSIM of the color channels over tiles of tile x tile pixels
+double tiledSSIM(const Image &image, const Image &ref, unsigned channels, unsigned tile)
+{
+    const double c1 = (0.01 * 255) * (0.01 * 255);
+    const double c2 = (0.03 * 255) * (0.03 * 255);
+    channels = std::min(channels, 3u);
+
+    double sum = 0.0;
+    unsigned long long count = 0;
+    for (unsigned ty = 0; ty < image.height; ty += tile)
+    {
+        const unsigned rows = std::min(tile, image.height - ty);
+        for (unsigned tx = 0; tx < image.width; tx += tile)
+        {
+            const unsigned columns = std::min(tile, image.width - tx);
+            for (unsigned c = 0; c < channels; ++c)
+            {
+                unsigned long long sx = 0, sy = 0, sxx = 0, syy = 0, sxy = 0;
+                for (unsigned y = ty; y < ty + rows; ++y)
+                {
+                    const unsigned char *pSrc = image.start() + (long)y * image.stride() + c;
+                    const unsigned char *pRef = ref.start() + (long)y * ref.stride() + c;
+                    for (unsigned x = tx; x < tx + columns; ++x)
+                    {
+                        const unsigned a = pSrc[x * image.channels];
+                        const unsigned b = pRef[x * ref.channels];
+                        sx += a;
+                        sy += b;
+                        sxx += a * a;
+                        syy += b * b;
+                        sxy += a * b;
+                    }
+                }
+                const double n = rows * columns;
+                const double mx = sx / n, my = sy / n;
+                const double vx = sxx / n - mx * mx, vy = syy / n - my * my;
+                const double cov = sxy / n - mx * my;
+                sum += ((2 * mx * my + c1) * (2 * cov + c2)) / ((mx * mx + my * my + c1) * (vx + vy + c2));
+                count++;
+            }
+        }
+    }
+    return count ? sum / count : 1.0;
+}
+
+bool comparable(const Image &image, const Image &ref)
+{
+    return image.width == ref.width && image.height == ref.height && image.channels >= 3 && ref.channels >= 3;
+}
+
+}
+
+bool compareImages(const Image &image, const Image &ref, ImageDiff &diff, unsigned ssimTile)
+{
+    diff = ImageDiff();
+    if (!comparable(image, ref))
+    {
+        return false;
+    }
+
+    const unsigned channels = std::min(std::min(image.channels, ref.channels), (unsigned)ImageDiff::MAX_CHANNELS);
+    Accumulator acc;
+    const unsigned char *pSrc = image.start();
+    const unsigned char *pRef = ref.start();
+    for (unsigned y = 0; y < image.height; ++y)
+    {
+        unsigned x = 0;
+#if defined(__SSE2__)
+        if (image.channels == 4 && ref.channels == 4)
+        {
+            x = compareRowRGBA(pSrc, pRef, image.width, acc);
+        }
+#endif
+        compareRow(pSrc + x * image.channels, image.channels, pRef + x * ref.channels, ref.channels, channels, image.width - x, acc);
+        pSrc += image.stride();
+        pRef += ref.stride();
+    }
+
+    diff.channels = channels;
+    diff.pixels = (unsigned long long)image.width * image.height;
+    diff.differingPixels = acc.differingPixels;
+    for (unsigned c = 0; c < channels; ++c)
+    {
+        ImageDiff::Channel &ch = diff.channel[c];
+        ch.sumSquaredError = acc.sumSquaredError[c];
+        ch.sumAbsDiff = acc.sumAbsDiff[c];
+        ch.maxAbsDiff = acc.maxAbsDiff[c];
+        ch.mse = diff.pixels ? (double)ch.sumSquaredError / diff.pixels : 0.0;
+        ch.meanAbsDiff = diff.pixels ? (double)ch.sumAbsDiff / diff.pixels : 0.0;
+        diff.sumSquaredError += ch.sumSquaredError;
+        diff.maxAbsDiff = std::max(diff.maxAbsDiff, ch.maxAbsDiff);
+    }
+    diff.mse = diff.pixels ? (double)diff.sumSquaredError / (diff.pixels * channels) : 0.0;
+    diff.psnr = diff.mse > 0.0 ? 10.0 * log10(255.0 * 255.0 / diff.mse) : INFINITY;
+    if (ssimTile)
+    {
+        diff.ssim = diff.identical() ? 1.0 : tiledSSIM(image, ref, channels, ssimTile);
+    }
+    return true;
+}
+
+Image *diffHeatmap(const Image &image, const Image &ref, unsigned amplify)
+{
+    if (!comparable(image, ref))
+    {
+        return NULL;
+    }
+
+    const unsigned channels = std::min(image.channels, ref.channels);
+    Image *heatmap = new Image(image.width, image.height, 3);
+    unsigned char *dst = heatmap->pixels;
+    for (unsigned y = 0; y < image.height; ++y)
+    {
+        const unsigned char *pSrc = image.start() + (long)y * image.stride();
+        const unsigned char *pRef = ref.start() + (long)y * ref.stride();
+        for (unsigned x = 0; x < image.width; ++x)
+        {
+            unsigned d = 0;
+            for (unsigned c = 0; c < channels; ++c)
+            {
+                d = std::max<unsigned>(d, abs(pSrc[x * image.channels + c] - pRef[x * ref.channels + c]));
+            }
+            const unsigned v = std::min(255u, d * amplify);
+            *dst++ = std::min(255u, v * 2);
+            *dst++ = v > 127 ? (v - 128) * 2 : 0;
+            *dst++ = 0;
+        }
+    }
+    return heatmap;
+}
+
+} /* namespace image */
@@ -0,0 +1,50 @@
+#ifndef _COMMON_IMAGE_COMPARE_HPP_
+#define _COMMON_IMAGE_COMPARE_HPP_
+
+#include "image.hpp"
+
+namespace image {
+
+// How much an image differs from a reference image. All differences are
+// taken per channel, in 8 bit units.
+struct ImageDiff
+{
+    enum { MAX_CHANNELS = 4 };
+
+    struct Channel
+    {
+        unsigned long long sumSquaredError = 0;
+        unsigned long long sumAbsDiff = 0;
+        unsigned maxAbsDiff = 0;
+        double mse = 0.0;
+        double meanAbsDiff = 0.0;
+    };
+
+    unsigned channels = 0; // number of channels compared
+    unsigned long long pixels = 0;
+    unsigned long long differingPixels = 0; // pixels with any channel different
+    unsigned long long sumSquaredError = 0;
+    unsigned maxAbsDiff = 0;
+    double mse = 0.0;
+    double psnr = 0.0; // in dB, infinite if the images are identical
+    double ssim = 1.0; // mean SSIM of the tiles, only if asked for
+    Channel channel[MAX_CHANNELS];
+
+    bool identical() const { return sumSquaredError == 0; }
+};
+
+// Compare image with ref. The images must have the same size and at least
+// 3 channels. Alpha is ignored when comparing RGB with RGBA. With ssimTile,
+// the SSIM of the color channels is also computed on tiles of ssimTile
+// pixels square. Returns false if the images cannot be compared.
+bool compareImages(const Image &image, const Image &ref, ImageDiff &diff, unsigned ssimTile = 0);
+
+// Make an RGB heat map of the largest channel difference of each pixel,
+// from black (equal) through red to yellow. Differences are multiplied by
+// amplify first, so that small ones are visible. Returns NULL if the images
+// cannot be compared.
+Image *diffHeatmap(const Image &image, const Image &ref, unsigned amplify = 1);
+
+} /* namespace image */
+
+#endif
@@ -33,7 +33,11 @@
 #include <stdlib.h>
 #include <errno.h>
 #include <unistd.h>
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <thread>
+#include <vector>
 
 #include "image.hpp"
 #include "os.hpp"
@@ -41,90 +45,251 @@
 namespace image {
 
 
-static const int png_compression_level = Z_BEST_SPEED;
+static std::atomic<int> pngLevel(Z_BEST_SPEED);
+static std::atomic<unsigned> pngThreads(0);
 
+void setPNGCompression(int level, unsigned threads)
+{
+    pngLevel = std::max(Z_NO_COMPRESSION, std::min(level, Z_BEST_COMPRESSION));
+    pngThreads = threads;
+}
 
-bool Image::writePNG(const char *filename) const
+namespace {
+
+// Rows are deflated in bands of about this many bytes. Each band is a
+// separate deflate stream without a dictionary, so smaller bands compress
+// a little worse.
+const size_t PNG_BAND_BYTES = 256 * 1024;
+const size_t PNG_IDAT_BYTES = 256 * 1024;
+
+struct PNGRows
 {
-    FILE *fp;
-    png_structp png_ptr;
-    png_infop info_ptr;
+    const unsigned char *pixels;
+    unsigned width;
+    unsigned height;
+    unsigned channels;
+    bool flipped;
+    int level;
 
-    fp = fopen(filename, "wb");
-    if (!fp)
+    size_t rowBytes() const { return (size_t)width * channels; }
+
+    // Rows in the order they are stored in the PNG, top first
+    const unsigned char *row(unsigned y) const
     {
-        DBG_LOG("Failed to open %s: %s\n", filename, strerror(errno));
-        goto no_fp;
+        return pixels + (flipped ? height - 1 - y : y) * rowBytes();
     }
+};
 
-    png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
-    if (!png_ptr)
-        goto no_png;
+inline unsigned char paeth(int a, int b, int c)
+{
+    const int p = a + b - c;
+    const int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    return (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+}
 
-    info_ptr = png_create_info_struct(png_ptr);
-    if (!info_ptr) {
-        png_destroy_write_struct(&png_ptr,  NULL);
-        goto no_png;
+inline unsigned char filterByte(unsigned filter, int x, int a, int b, int c)
+{
+    switch (filter)
+    {
+    case 1: return x - a;
+    case 2: return x - b;
+    case 3: return x - ((a + b) >> 1);
+    case 4: return x - paeth(a, b, c);
+    default: return x;
     }
+}
 
-    if (setjmp(png_jmpbuf(png_ptr))) {
-        png_destroy_write_struct(&png_ptr, &info_ptr);
-        goto no_png;
+// Filter one row with the PNG filter that gives the smallest sum of absolute
+// values, like libpng does. prev is the row above, all zeros for the first
+// row. dst gets the filter byte then the filtered row.
+void filterRow(const unsigned char *cur, const unsigned char *prev, size_t len, unsigned bpp,
+               int level, unsigned char *dst)
+{
+    unsigned best = 0;
+    if (level != Z_NO_COMPRESSION)
+    {
+        unsigned long long sums[5] = {};
+        for (size_t i = 0; i < len; ++i)
+        {
+            const int x = cur[i];
+            const int b = prev[i];
+            const int a = i >= bpp ? cur[i - bpp] : 0;
+            const int c = i >= bpp ? prev[i - bpp] : 0;
+            sums[0] += abs((signed char)x);
+            sums[1] += abs((signed char)(x - a));
+            sums[2] += abs((signed char)(x - b));
+            sums[3] += abs((signed char)(x - ((a + b) >> 1)));
+            sums[4] += abs((signed char)(x - paeth(a, b, c)));
+        }
+        best = std::min_element(sums, sums + 5) - sums;
     }
 
-    png_init_io(png_ptr, fp);
+    dst[0] = best;
+    for (size_t i = 0; i < len; ++i)
+    {
+        dst[i + 1] = filterByte(best, cur[i], i >= bpp ? cur[i - bpp] : 0, prev[i], i >= bpp ? prev[i - bpp] : 0);
+    }
+}
 
-    int color_type;
-    switch (channels) {
-    case 4:
-        color_type = PNG_COLOR_TYPE_RGB_ALPHA;
-        break;
-    case 3:
-        color_type = PNG_COLOR_TYPE_RGB;
-        break;
-    case 2:
-        color_type = PNG_COLOR_TYPE_GRAY_ALPHA;
-        break;
-    case 1:
-        color_type = PNG_COLOR_TYPE_GRAY;
-        break;
-    default:
-        assert(0);
-        return false;
+struct PNGBand
+{
+    unsigned firstRow;
+    unsigned rows;
+    std::vector<unsigned char> deflated;
+    uLong adler;
+    uLong rawBytes;
+    bool ok;
+};
+
+// Filter and deflate the rows of one band as a raw deflate stream. All but
+// the last band end with a sync flush, so that the bands can be joined.
+void deflateBand(const PNGRows &rows, PNGBand &band, bool last)
+{
+    const size_t rowBytes = rows.rowBytes();
+    std::vector<unsigned char> filtered((rowBytes + 1) * band.rows);
+    const std::vector<unsigned char> zeros(band.firstRow ? 0 : rowBytes);
+    for (unsigned i = 0; i < band.rows; ++i)
+    {
+        const unsigned y = band.firstRow + i;
+        filterRow(rows.row(y), y ? rows.row(y - 1) : zeros.data(), rowBytes, rows.channels, rows.level,
+                  &filtered[i * (rowBytes + 1)]);
+    }
+    band.rawBytes = filtered.size();
+    band.adler = adler32(adler32(0L, Z_NULL, 0), filtered.data(), filtered.size());
+
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    const int strategy = rows.level == Z_NO_COMPRESSION ? Z_DEFAULT_STRATEGY : Z_FILTERED;
+    band.ok = deflateInit2(&zs, rows.level, Z_DEFLATED, -15, 8, strategy) == Z_OK;
+    if (!band.ok)
+    {
+        return;
     }
+    band.deflated.resize(deflateBound(&zs, filtered.size()) + 16);
+    zs.next_in = filtered.data();
+    zs.avail_in = filtered.size();
+    zs.next_out = band.deflated.data();
+    zs.avail_out = band.deflated.size();
+    band.ok = deflate(&zs, last ? Z_FINISH : Z_SYNC_FLUSH) == (last ? Z_STREAM_END : Z_OK) && zs.avail_in == 0;
+    band.deflated.resize(zs.total_out);
+    deflateEnd(&zs);
+}
 
-    png_set_IHDR(png_ptr, info_ptr, width, height, 8, color_type,
-        PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
+void appendU32(std::vector<unsigned char> &out, uint32_t v)
+{
+    const unsigned char bytes[4] = { (unsigned char)(v >> 24), (unsigned char)(v >> 16), (unsigned char)(v >> 8), (unsigned char)v };
+    out.insert(out.end(), bytes, bytes + 4);
+}
 
-    png_set_compression_level(png_ptr, png_compression_level);
+void appendChunk(std::vector<unsigned char> &out, const char *type, const unsigned char *data, size_t len)
+{
+    appendU32(out, len);
+    const size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data, data + len);
+    appendU32(out, crc32(crc32(0L, Z_NULL, 0), &out[start], len + 4));
+}
 
-    png_write_info(png_ptr, info_ptr);
+} // namespace
 
-    if (!flipped) {
-        for (unsigned y = 0; y < height; ++y) {
-            png_bytep row = (png_bytep)(pixels + y*width*channels);
-            png_write_rows(png_ptr, &row, 1);
-        }
-    } else {
-        unsigned y = height;
-        while (y--) {
-            png_bytep row = (png_bytep)(pixels + y*width*channels);
-            png_write_rows(png_ptr, &row, 1);
-        }
+bool encodePNG(const unsigned char *pixels, unsigned width, unsigned height, unsigned channels,
+               bool flipped, std::vector<unsigned char> &png)
+{
+    static const unsigned char colorTypes[5] = { 0, PNG_COLOR_TYPE_GRAY, PNG_COLOR_TYPE_GRAY_ALPHA, PNG_COLOR_TYPE_RGB, PNG_COLOR_TYPE_RGB_ALPHA };
+    if (channels < 1 || channels > 4 || width == 0 || height == 0)
+    {
+        return false;
     }
 
-    png_write_end(png_ptr, info_ptr);
-    png_destroy_write_struct(&png_ptr, &info_ptr);
+    const PNGRows rows = { pixels, width, height, channels, flipped, pngLevel };
+    const unsigned bandRows = std::max<size_t>(1, PNG_BAND_BYTES / (rows.rowBytes() + 1));
+    std::vector<PNGBand> bands((height + bandRows - 1) / bandRows);
+    for (size_t i = 0; i < bands.size(); ++i)
+    {
+        bands[i].firstRow = i * bandRows;
+        bands[i].rows = std::min(bandRows, height - bands[i].firstRow);
+    }
 
-    fclose(fp);
+    // The bands are independent, so they are shared out between threads,
+    // the calling thread included
+    unsigned threads = pngThreads ? pngThreads.load() : std::min(8u, std::max(1u, std::thread::hardware_concurrency()));
+    threads = std::min<size_t>(threads, bands.size());
+    std::atomic<size_t> next(0);
+    auto work = [&]()
+    {
+        for (size_t i = next++; i < bands.size(); i = next++)
+        {
+            deflateBand(rows, bands[i], i + 1 == bands.size());
+        }
+    };
+    std::vector<std::thread> pool;
+    for (unsigned i = 1; i < threads; ++i)
+    {
+        pool.emplace_back(work);
+    }
+    work();
+    for (std::thread &thread : pool)
+    {
+        thread.join();
+    }
+
+    // Join the bands into one zlib stream: header, deflate data, then the
+    // Adler-32 of all the filtered rows
+    static const unsigned char zlibHeaders[4][2] = { { 0x78, 0x01 }, { 0x78, 0x5e }, { 0x78, 0x9c }, { 0x78, 0xda } };
+    const int flevel = rows.level < 2 ? 0 : rows.level < 6 ? 1 : rows.level == 6 ? 2 : 3;
+    std::vector<unsigned char> zlib(zlibHeaders[flevel], zlibHeaders[flevel] + 2);
+    uLong adler = adler32(0L, Z_NULL, 0);
+    for (const PNGBand &band : bands)
+    {
+        if (!band.ok)
+        {
+            return false;
+        }
+        zlib.insert(zlib.end(), band.deflated.begin(), band.deflated.end());
+        adler = adler32_combine(adler, band.adler, band.rawBytes);
+    }
+    appendU32(zlib, adler);
+
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    png.assign(signature, signature + 8);
+    std::vector<unsigned char> ihdr;
+    appendU32(ihdr, width);
+    appendU32(ihdr, height);
+    const unsigned char ihdrRest[5] = { 8, colorTypes[channels], PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE, PNG_INTERLACE_NONE };
+    ihdr.insert(ihdr.end(), ihdrRest, ihdrRest + 5);
+    appendChunk(png, "IHDR", ihdr.data(), ihdr.size());
+    for (size_t pos = 0; pos < zlib.size(); pos += PNG_IDAT_BYTES)
+    {
+        appendChunk(png, "IDAT", &zlib[pos], std::min(PNG_IDAT_BYTES, zlib.size() - pos));
+    }
+    appendChunk(png, "IEND", NULL, 0);
     return true;
+}
 
-no_png:
-    fclose(fp);
-    unlink(filename);
 
-no_fp:
-    return false;
+bool Image::writePNG(const char *filename) const
+{
+    std::vector<unsigned char> png;
+    if (!encodePNG(pixels, width, height, channels, flipped, png))
+    {
+        DBG_LOG("Failed to encode %s\n", filename);
+        return false;
+    }
+
+    FILE *fp = fopen(filename, "wb");
+    if (!fp)
+    {
+        DBG_LOG("Failed to open %s: %s\n", filename, strerror(errno));
+        return false;
+    }
+    const bool written = fwrite(png.data(), png.size(), 1, fp) == 1;
+    if (fclose(fp) != 0 || !written)
+    {
+        DBG_LOG("Failed to write %s: %s\n", filename, strerror(errno));
+        unlink(filename);
+        return false;
+    }
+    return true;
 }
 
 
@@ -183,8 +348,12 @@ readPNG(const char *filename)
         png_set_palette_to_rgb(png_ptr);
     if (color_type == PNG_COLOR_TYPE_GRAY && bit_depth < 8)
         png_set_expand_gray_1_2_4_to_8(png_ptr);
+    if (color_type == PNG_COLOR_TYPE_GRAY || color_type == PNG_COLOR_TYPE_GRAY_ALPHA)
+        png_set_gray_to_rgb(png_ptr);
     if (png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS))
         png_set_tRNS_to_alpha(png_ptr);
+    else if (!(color_type & PNG_COLOR_MASK_ALPHA))
+        png_set_add_alpha(png_ptr, 0xff, PNG_FILLER_AFTER);
     if (bit_depth == 16)
         png_set_strip_16(png_ptr);
 
@@ -207,114 +376,26 @@ no_fp:
 }
 
 
-struct png_tmp_buffer
-{
-    char *buffer;
-    size_t size;
-};
-
-static void
-pngWriteCallback(png_structp png_ptr, png_bytep data, png_size_t length)
-{
-    struct png_tmp_buffer *buf = (struct png_tmp_buffer*) png_get_io_ptr(png_ptr);
-    size_t nsize = buf->size + length;
-
-    /* allocate or grow buffer */
-    if (buf->buffer)
-        buf->buffer = (char*)realloc(buf->buffer, nsize);
-    else
-        buf->buffer = (char*)malloc(nsize);
-
-    if (!buf->buffer)
-        png_error(png_ptr, "Buffer allocation error");
-
-    memcpy(buf->buffer + buf->size, data, length);
-    buf->size += length;
-}
-
 bool writePixelsToBuffer(unsigned char *pixels,
                          unsigned width, unsigned height, unsigned numChannels,
                          bool flipped,
                          char **buffer,
                          int *size)
 {
-    struct png_tmp_buffer png_mem;
-    png_structp png_ptr;
-    png_infop info_ptr;
-    int type;
-
-    png_mem.buffer = NULL;
-    png_mem.size = 0;
-
-    switch (numChannels) {
-    case 4:
-        type = PNG_COLOR_TYPE_RGB_ALPHA;
-        break;
-    case 3:
-        type = PNG_COLOR_TYPE_RGB;
-        break;
-    case 2:
-        type = PNG_COLOR_TYPE_GRAY_ALPHA;
-        break;
-    case 1:
-        type = PNG_COLOR_TYPE_GRAY;
-        break;
-    default:
-        goto no_png;
-    }
-
-    png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
-    if (!png_ptr)
-        goto no_png;
-
-    info_ptr = png_create_info_struct(png_ptr);
-    if (!info_ptr) {
-        png_destroy_write_struct(&png_ptr,  NULL);
-        goto no_png;
-    }
-
-    if (setjmp(png_jmpbuf(png_ptr))) {
-        png_destroy_write_struct(&png_ptr, &info_ptr);
-        goto no_png;
-    }
-
-    png_set_write_fn(png_ptr, &png_mem, pngWriteCallback, NULL);
-
-    png_set_IHDR(png_ptr, info_ptr, width, height, 8,
-                 type, PNG_INTERLACE_NONE,
-                 PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
-
-    png_set_compression_level(png_ptr, png_compression_level);
-
-    png_write_info(png_ptr, info_ptr);
-
-    if (!flipped) {
-        for (unsigned y = 0; y < height; ++y) {
-            png_bytep row = (png_bytep)(pixels + y*width*numChannels);
-            png_write_rows(png_ptr, &row, 1);
-        }
-    } else {
-        unsigned y = height;
-        while (y--) {
-            png_bytep row = (png_bytep)(pixels + y*width*numChannels);
-            png_write_rows(png_ptr, &row, 1);
+    std::vector<unsigned char> png;
+    if (encodePNG(pixels, width, height, numChannels, flipped, png))
+    {
+        *buffer = (char*)malloc(png.size());
+        if (*buffer)
+        {
+            memcpy(*buffer, png.data(), png.size());
+            *size = png.size();
+            return true;
         }
     }
 
-    png_write_end(png_ptr, info_ptr);
-    png_destroy_write_struct(&png_ptr, &info_ptr);
-
-    *buffer = png_mem.buffer;
-    *size = png_mem.size;
-
-    return true;
-
-no_png:
     *buffer = NULL;
     *size = 0;
-
-    if (png_mem.buffer)
-        free(png_mem.buffer);
     return false;
 }
 
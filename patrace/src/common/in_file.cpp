@@ -1,4 +1,5 @@
 #include <common/in_file.hpp>
+#include <common/blob_table.hpp>
 
 namespace common {
 
@@ -18,6 +19,11 @@ bool InFileBase::Open()
     }
 
     mIsOpen = true;
+    if (!mUsesBlobTable)
+    {
+        gBlobTable.OpenFile();
+        mUsesBlobTable = true;
+    }
 
     // Read Base Header that is common for all header versions
     common::BHeader bHeader;
@@ -40,7 +46,7 @@ bool InFileBase::Open()
         BHeaderV2 hdr;
         mStream.read((char*)&hdr, sizeof(hdr));
         mHeaderParseComplete = parseHeader(hdr, mJsonHeader);
-    } else if (bHeader.version >= HEADER_VERSION_3 && bHeader.version <= HEADER_VERSION_4) {
+    } else if (bHeader.version >= HEADER_VERSION_3 && bHeader.version <= HEADER_VERSION_6) {
         BHeaderV3 hdr;
         mStream.read((char*)&hdr, sizeof(hdr));
         mHeaderParseComplete = parseHeader(hdr, mJsonHeader);
@@ -59,6 +65,11 @@ bool InFileBase::Open()
 
 void InFileBase::Close()
 {
+    if (mUsesBlobTable)
+    {
+        gBlobTable.CloseFile();
+        mUsesBlobTable = false;
+    }
 }
 
 bool InFileBase::parseHeader(BHeaderV1 hdrV1, Json::Value &jsonRoot )
@@ -25,6 +25,7 @@ public:
      ,mExIdToLen(NULL)
      ,mExIdToFunc(NULL)
      ,mHeaderVer(HEADER_VERSION_1)
+     ,mUsesBlobTable(false)
     {
     }
 
@@ -48,6 +49,12 @@ public:
         return mExIdToName[id].c_str();
     }
 
+    // Serialized length of a call, 0 for calls in BCall_vlen format
+    int ExIdToLen(unsigned short id) const
+    {
+        return mExIdToLen[id];
+    }
+
     int getDefaultThreadID() const;
 
     std::streamoff GetReadPos()
@@ -84,6 +91,7 @@ protected:
 
 private:
     HeaderVersion        mHeaderVer;
+    bool                 mUsesBlobTable; // registered with gBlobTable until closed
 };
 
 } // namespace common
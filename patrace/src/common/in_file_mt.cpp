@@ -1,4 +1,5 @@
 #include <common/in_file_mt.hpp>
+#include <common/blob_table.hpp>
 #include <common/memoryinfo.hpp>
 #include <common/trace_limits.hpp>
 
@@ -230,7 +231,7 @@ int InFile::PreloadFrames(unsigned int frameCnt, int tid)
                     curChunk->retain();
                 }
                 curChunk->setStatus(UnCompressedChunk::READING);
-                curChunk->LoadFromFileStream(mStream);
+                curChunk->LoadFromFileStream(mStream, getHeaderVersion());
             }
             else
             {
@@ -305,7 +306,7 @@ void InFile::run()
             newChunk = freeChunkQueue.reserve_pop();
             if (newChunk == NULL) break;
             newChunk->setStatus(UnCompressedChunk::READING);
-            newChunk->LoadFromFileStream(mStream);
+            newChunk->LoadFromFileStream(mStream, getHeaderVersion());
             newChunk->retain();
             newChunk->setStatus(UnCompressedChunk::PRECALLING);
 
@@ -334,6 +335,14 @@ bool InFile::GetNextCall(void*& fptr, common::BCall_vlen& call, char*& src)
     common::BCall tmpCall;
     tmpCall = *(common::BCall*)mReadP;
 
+    if (unlikely(tmpCall.funcId == BLOB_DEFINITION_FUNC_ID))
+    {
+        // Not a call, store the blob and continue with the next block
+        gBlobTable.ReadDefinition(mReadP);
+        mReadP += reinterpret_cast<common::BCall_vlen*>(mReadP)->toNext;
+        return GetNextCall(fptr, call, src);
+    }
+
     if (unlikely(tmpCall.funcId > mMaxSigId))
     {
         DBG_LOG("funcId %d is out of range (%d max)!\n", (int)tmpCall.funcId, (int)mMaxSigId);
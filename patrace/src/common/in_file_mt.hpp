@@ -6,9 +6,9 @@
 #include <common/api_info.hpp>
 #include <common/os_time.hpp>
 #include <common/in_file.hpp>
+#include <common/chunk_codec.hpp>
 
 #include <atomic>
-#include <snappy.h>
 #include <queue>
 #include <sstream>
 
@@ -80,10 +80,19 @@ public:
         delete [] mData;
     }
 
-    void LoadFromFileStream(std::fstream& stream) {
-        const unsigned int compressedLength = ReadCompressedLength(stream);
+    void LoadFromFileStream(std::fstream& stream, HeaderVersion version) {
+        const unsigned int lengthWord = ReadCompressedLength(stream);
+        unsigned int compressedLength = ChunkLengthWordLength(lengthWord, version);
+        if (ChunkLengthWordIsLong(lengthWord, version))
+            compressedLength = ReadCompressedLength(stream);
         if (compressedLength)
         {
+            const ChunkCodec* codec = GetChunkCodec(ChunkLengthWordCodec(lengthWord, version));
+            if (codec == NULL) {
+                DBG_LOG("Unknown chunk codec %u, the trace file is corrupt or too new\n", ChunkLengthWordCodec(lengthWord, version));
+                os::abort();
+            }
+
             if (gCompBufLen < compressedLength) {
                 delete [] gCompBuf;
                 gCompBufLen = compressedLength;
@@ -92,15 +101,16 @@ public:
 
             stream.read(gCompBuf, compressedLength);
 
-            mLen = 0;
-            ::snappy::GetUncompressedLength(gCompBuf, (size_t)compressedLength,
-                (size_t*)&mLen);
+            size_t uncompressedLength = 0;
+            codec->GetUncompressedLength(gCompBuf, (size_t)compressedLength,
+                &uncompressedLength);
+            mLen = uncompressedLength;
             if (mCapacity < mLen) {
                 delete [] mData;
                 mCapacity = mLen;
                 mData = new char [mLen];
             }
-            ::snappy::RawUncompress(gCompBuf, compressedLength,
+            codec->Uncompress(gCompBuf, compressedLength,
                 mData);
         }
     }
@@ -199,6 +209,11 @@ public:
         return mStream.eof();
     }
 
+    inline unsigned int GetMaxSigId() const
+    {
+        return mMaxSigId;
+    }
+
     inline unsigned short NameToExId(const char* str) const
     {
         for (unsigned short id = 1; id <= mMaxSigId; ++id) {
@@ -1,4 +1,6 @@
 #include <common/in_file_ra.hpp>
+#include <common/blob_table.hpp>
+#include <common/chunk_codec.hpp>
 #include <libgen.h> // basename()
 
 namespace common {
@@ -116,6 +118,7 @@ bool InFileRA::CreateRAFile(const char* name, const std::string& target)
     mStream.open(mFileName.c_str(), std::fstream::binary | std::fstream::out | std::fstream::trunc);
 
     // header part
+    HeaderVersion version = HEADER_VERSION_1;
     {
         common::BHeader bHeader;
         inStream.read((char*)&bHeader, sizeof(bHeader));
@@ -123,6 +126,7 @@ bool InFileRA::CreateRAFile(const char* name, const std::string& target)
             DBG_LOG("Warning: %s seems to be an invalid trace file!\n", name);
             bHeader.version = 0; // only for supporting legency trace files
         }
+        version = static_cast<HeaderVersion>(bHeader.version);
 
         inStream.seekg(0, std::ios_base::beg);
         if (bHeader.version == 0) {
@@ -170,8 +174,17 @@ bool InFileRA::CreateRAFile(const char* name, const std::string& target)
 
     while ( !inStream.eof() )
     {
-        unsigned int compressedLength = ReadCompressedLength(inStream);
+        const unsigned int lengthWord = ReadCompressedLength(inStream);
+        unsigned int compressedLength = ChunkLengthWordLength(lengthWord, version);
+        if (ChunkLengthWordIsLong(lengthWord, version))
+            compressedLength = ReadCompressedLength(inStream);
         size_t uncompressedLength = 0;
+        const ChunkCodec* codec = GetChunkCodec(ChunkLengthWordCodec(lengthWord, version));
+        if (codec == NULL)
+        {
+            DBG_LOG("Unknown chunk codec %u, the trace file is corrupt or too new\n", ChunkLengthWordCodec(lengthWord, version));
+            os::abort();
+        }
         if (compressedLength)
         {
             if (compressedCacheLen < compressedLength)
@@ -183,7 +196,7 @@ bool InFileRA::CreateRAFile(const char* name, const std::string& target)
         }
 
         inStream.read(compressedCache, compressedLength);
-        ::snappy::GetUncompressedLength(compressedCache, (size_t)compressedLength,
+        codec->GetUncompressedLength(compressedCache, (size_t)compressedLength,
             &uncompressedLength);
         if (unCompressedCacheLen < uncompressedLength)
         {
@@ -191,7 +204,7 @@ bool InFileRA::CreateRAFile(const char* name, const std::string& target)
             unCompressedCacheLen = uncompressedLength;
             unCompressedCache = new char [unCompressedCacheLen];
         }
-        ::snappy::RawUncompress(compressedCache, compressedLength,
+        codec->Uncompress(compressedCache, compressedLength,
             unCompressedCache);
 
         mStream.write(unCompressedCache, uncompressedLength);
@@ -204,6 +217,26 @@ bool InFileRA::CreateRAFile(const char* name, const std::string& target)
     return true;
 }
 
+bool InFileRA::ReadBlobDefinition()
+{
+    // The BCall part of the block is already in mCache
+    unsigned int toNext;
+    mStream.read((char*)&toNext, sizeof(toNext));
+    if (mStream.fail())
+    {
+        mStream.clear();
+        return false;
+    }
+
+    if (!ReadChunk(toNext - sizeof(common::BCall_vlen)))
+    {
+        mStream.clear();
+        return false;
+    }
+    gBlobTable.ReadDefinitionContent(mCache);
+    return true;
+}
+
 void InFileRA::ReadSigBook() {
     unsigned int toNext;
     mStream.read((char*)&toNext, sizeof(toNext));
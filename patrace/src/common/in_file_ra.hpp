@@ -4,7 +4,6 @@
 #include <common/api_info.hpp>
 #include <common/in_file.hpp>
 
-#include <snappy.h>
 
 namespace common {
 
@@ -41,6 +40,13 @@ public:
         }
 
         call = *(common::BCall*)mCache;
+        if (call.funcId == BLOB_DEFINITION_FUNC_ID) {
+            // Not a call, store the blob and continue with the next block
+            if (!ReadBlobDefinition())
+                return false;
+            return GetNextCall(fptr, call, src);
+        }
+
         unsigned int callLen = mExIdToLen[call.funcId];
         unsigned int contentLen = callLen - sizeof(common::BCall);
         if (callLen == 0) {
@@ -60,6 +66,41 @@ public:
         return true;
     }
 
+    // Like GetNextCall(), but seeks over the arguments instead of reading
+    // them. Blob definitions are still stored, later calls may refer to them.
+    inline bool SkipNextCall(common::BCall& call) {
+        mStream.read(mCache, sizeof(common::BCall));
+        if (mStream.fail()) {
+            mStream.clear();
+            return false;
+        }
+
+        call = *(common::BCall*)mCache;
+        if (call.funcId == BLOB_DEFINITION_FUNC_ID) {
+            if (!ReadBlobDefinition())
+                return false;
+            return SkipNextCall(call);
+        }
+
+        unsigned int callLen = mExIdToLen[call.funcId];
+        unsigned int contentLen = callLen - sizeof(common::BCall);
+        if (callLen == 0) {
+            mStream.read((char*)&callLen, sizeof(unsigned int));
+            contentLen = callLen - sizeof(common::BCall_vlen);
+        }
+
+        mStream.seekg(contentLen, std::ios_base::cur);
+        if (mStream.fail()) {
+            mStream.clear();
+            return false;
+        }
+        return true;
+    }
+
+    unsigned int GetMaxSigId() const {
+        return mMaxSigId;
+    }
+
     unsigned short NameToExId(const char* str) const {
         for (unsigned short id = 1; id <= mMaxSigId; ++id) {
         if (strcmp(ExIdToName(id), str) == 0)
@@ -82,6 +123,7 @@ private:
         return true;
     }
 
+    bool ReadBlobDefinition();
     unsigned int ReadCompressedLength(std::fstream& inStream);
     bool CreateRAFile(const char* name, const std::string& target);
     void ReadSigBook();
@@ -49,6 +49,19 @@ public:
 
     MD5Digest(const std::string& str) : MD5Digest(str.c_str(), str.size()) {}
 
+    // Hash the rest of the stream, a chunk at a time
+    explicit MD5Digest(std::istream& stream)
+    {
+        md5_state_t mdContext;
+        md5_init(&mdContext);
+        std::vector<char> chunk(1024 * 1024);
+        while (stream.read(chunk.data(), chunk.size()) || stream.gcount() > 0)
+        {
+            md5_append(&mdContext, reinterpret_cast<const unsigned char*>(chunk.data()), stream.gcount());
+        }
+        md5_finish(&mdContext, _digest);
+    }
+
     MD5Digest(const std::vector<std::string>& strlist)
     {
         md5_state_t mdContext;
@@ -5,7 +5,6 @@
 #include <common/api_info.hpp>
 #include <common/pa_exception.h>
 
-#include <snappy.h> // Compression
 
 namespace common {
 
@@ -19,6 +18,16 @@ OutFile::OutFile()
  , mCompressedCache(NULL)
  , mCompressedCacheLen(0)
  , mFileName()
+ , mChunkSize(SNAPPY_CHUNK_SIZE)
+ , mFrameAligned(false)
+ , mFrameAlignTid(0)
+ , mCodec(common::GetChunkCodec(CHUNK_CODEC_SNAPPY))
+ , mBlobTableEnabled(false)
+ , mMinTableBlobSize(DEFAULT_MIN_TABLE_BLOB_SIZE)
+ , mWrittenBlobs()
+ , mKnownBlobsWritten(0)
+ , mBlobTableHits(0)
+ , mBlobTableSavedBytes(0)
 {}
 
 OutFile::OutFile(const char *name)
@@ -31,6 +40,16 @@ OutFile::OutFile(const char *name)
  , mCompressedCache(NULL)
  , mCompressedCacheLen(0)
  , mFileName()
+ , mChunkSize(SNAPPY_CHUNK_SIZE)
+ , mFrameAligned(false)
+ , mFrameAlignTid(0)
+ , mCodec(common::GetChunkCodec(CHUNK_CODEC_SNAPPY))
+ , mBlobTableEnabled(false)
+ , mMinTableBlobSize(DEFAULT_MIN_TABLE_BLOB_SIZE)
+ , mWrittenBlobs()
+ , mKnownBlobsWritten(0)
+ , mBlobTableHits(0)
+ , mBlobTableSavedBytes(0)
 {
     Open(name);
 }
@@ -63,6 +82,8 @@ bool OutFile::Open(const char* name, bool writeSigBook, const std::vector<std::s
     }
 
     mFileName = name;
+    if (!mIsOpen)
+        gBlobTable.OpenFile();
     mIsOpen = true;
 
     // It will be re-written before the file is closed.
@@ -79,7 +100,7 @@ bool OutFile::Open(const char* name, bool writeSigBook, const std::vector<std::s
         mHeader.jsonFileEnd = jsonEnd; // is this more robust than calculating it beforehand, assuming all bytes we have is header+jsonMaxLength?
     }
 
-    CreateCache(SNAPPY_CHUNK_SIZE);
+    CreateCache(mChunkSize);
     if (writeSigBook)
     {
         if (sigbook)
@@ -117,6 +138,11 @@ void OutFile::Close()
     delete [] mCompressedCache;
     mCompressedCache = NULL;
     mCompressedCacheLen = 0;
+
+    // Blob definitions are per file
+    mWrittenBlobs.clear();
+    mKnownBlobsWritten = 0;
+    gBlobTable.CloseFile();
 }
 
 void OutFile::Flush()
@@ -125,8 +151,19 @@ void OutFile::Flush()
     if (len == 0)
         return;
 
+    if (mCodec->MaxCompressedLength(len) > (size_t)mCompressedCacheLen)
+    {
+        delete [] mCompressedCache;
+        mCompressedCacheLen = mCodec->MaxCompressedLength(mCacheLen);
+        mCompressedCache = new char[mCompressedCacheLen];
+    }
+
     size_t compressedLen;
-    ::snappy::RawCompress(mCache, len, mCompressedCache, &compressedLen);
+    if (!mCodec->Compress(mCache, len, mCompressedCache, &compressedLen))
+    {
+        DBG_LOG("Failed to compress chunk with %s\n", mCodec->Name());
+        os::abort();
+    }
     WriteCompressedLength((unsigned int)compressedLen);
     mStream.write(mCompressedCache, compressedLen);
     mStream.flush();
@@ -178,7 +215,7 @@ void OutFile::CreateCache(int len)
     delete [] mCompressedCache;
 
     mCacheLen = len;
-    mCompressedCacheLen = snappy::MaxCompressedLength(mCacheLen);
+    mCompressedCacheLen = mCodec->MaxCompressedLength(mCacheLen);
     mCache = new char[mCacheLen];
     mCacheP = mCache;
     mCompressedCache = new char[mCompressedCacheLen];
@@ -253,4 +290,105 @@ std::string OutFile::getFileName() const
     return mFileName;
 }
 
+void OutFile::SetChunkSize(unsigned int size)
+{
+    if (mIsOpen)
+    {
+        DBG_LOG("Chunk size can not be changed after the file has been opened\n");
+        return;
+    }
+    if (size == 0 || size > MAX_CHUNK_SIZE)
+    {
+        DBG_LOG("Invalid chunk size %u, using %u\n", size, (unsigned int)SNAPPY_CHUNK_SIZE);
+        size = SNAPPY_CHUNK_SIZE;
+    }
+    mChunkSize = size;
+}
+
+void OutFile::SetFrameAlignedChunks(bool enable, int tid)
+{
+    mFrameAligned = enable;
+    mFrameAlignTid = tid;
+}
+
+void OutFile::SetChunkCodec(ChunkCodecId codec)
+{
+    const ChunkCodec* newCodec = common::GetChunkCodec(codec);
+    if (newCodec == NULL)
+    {
+        DBG_LOG("Unknown chunk codec %d, keeping %s\n", (int)codec, mCodec->Name());
+        return;
+    }
+    // Chunks written so far keep their codec
+    Flush();
+    mCodec = newCodec;
+    if (codec != CHUNK_CODEC_SNAPPY && mHeader.version < HEADER_VERSION_6)
+        mHeader.version = HEADER_VERSION_6;
+}
+
+void OutFile::EnableBlobTable(unsigned int minBlobSize)
+{
+    mBlobTableEnabled = true;
+    mMinTableBlobSize = minBlobSize;
+    if (mHeader.version < HEADER_VERSION_5)
+        mHeader.version = HEADER_VERSION_5;
+}
+
+char* OutFile::WriteBlob(char* dest, const char* data, unsigned int len)
+{
+    if (!mBlobTableEnabled || data == NULL || len < mMinTableBlobSize)
+        return Write1DArray<char>(dest, len, data);
+
+    const MD5Digest digest(data, len);
+    if (mWrittenBlobs.insert(digest).second)
+    {
+        WriteBlobDefinition(digest, data, len);
+    }
+    else
+    {
+        mBlobTableHits++;
+        mBlobTableSavedBytes += len;
+    }
+    return WriteBlobReference(dest, digest);
+}
+
+void OutFile::WriteKnownBlobDefinitions()
+{
+    if (gBlobTable.Count() == mKnownBlobsWritten)
+        return;
+
+    if (!mBlobTableEnabled)
+        EnableBlobTable();
+
+    gBlobTable.ForEach(mKnownBlobsWritten, [this](const MD5Digest& digest, const char* data, unsigned int len) {
+        if (mWrittenBlobs.insert(digest).second)
+            WriteBlobDefinition(digest, data, len);
+    });
+    mKnownBlobsWritten = gBlobTable.Count();
+}
+
+void OutFile::WriteRaw(const void* data, unsigned int len)
+{
+    WriteKnownBlobDefinitions();
+    Write(data, len);
+}
+
+void OutFile::WriteBlobDefinition(const MD5Digest& digest, const char* data, unsigned int len)
+{
+    // Same layout as common::WriteBlobDefinition(), but written piecewise
+    // so that the blob itself is not copied into a scratch buffer first.
+    const unsigned int paddedLen = (len + 3) & ~3u;
+    const char zeros[4] = { 0, 0, 0, 0 };
+
+    BCall_vlen call;
+    call.funcId = BLOB_DEFINITION_FUNC_ID;
+    call.toNext = sizeof(BCall_vlen) + BLOB_DIGEST_LEN + sizeof(unsigned int) + paddedLen;
+
+    Write(&call, sizeof(call));
+    Write((const unsigned char*)digest, BLOB_DIGEST_LEN);
+    Write(&len, sizeof(len));
+    Write(data, len);
+    Write(zeros, paddedLen - len);
+}
+
 }
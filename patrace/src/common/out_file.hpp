@@ -3,13 +3,18 @@
 
 #include <fstream>
 #include <string>
+#include <unordered_set>
 
+#include <common/blob_table.hpp>
+#include <common/chunk_codec.hpp>
 #include <common/file_format.hpp>
 #include <common/os_string.hpp>
 
 namespace common {
 
 #define SNAPPY_CHUNK_SIZE (1*1024*1024)
+#define MAX_CHUNK_SIZE (128*1024*1024)
+#define DEFAULT_MIN_TABLE_BLOB_SIZE (4*1024)
 
 class OutFile {
 public:
@@ -39,11 +44,61 @@ public:
                 CreateCache(len);
             memcpy(mCacheP, buf, len);
             mCacheP += len;
+            // A call larger than the chunk size gets a chunk of its own
+            if (len >= mChunkSize)
+                Flush();
         }
     }
 
     std::string getFileName() const;
 
+    // Uncompressed size of the chunks that are compressed and written to the file.
+    // Larger chunks compress better, smaller ones need less memory to read.
+    // Must be set before Open().
+    void SetChunkSize(unsigned int size);
+    unsigned int GetChunkSize() const { return mChunkSize; }
+
+    // Start a new chunk at the end of every frame of thread tid, so that
+    // no chunk holds data from more than one frame of that thread.
+    // Chunks are still flushed whenever the chunk size is reached.
+    // Frame ends are reported by the writer through EndFrame().
+    void SetFrameAlignedChunks(bool enable, int tid = 0);
+    bool IsFrameAligned() const { return mFrameAligned; }
+
+    // Codec used for the chunks written from now on, snappy by default.
+    // Any other codec makes this a HEADER_VERSION_6 file. See chunk_codec.hpp.
+    void SetChunkCodec(ChunkCodecId codec);
+    ChunkCodecId GetChunkCodecId() const { return mCodec->Id(); }
+
+    // Called by the writer after a frame ending call (eglSwapBuffers)
+    // of thread tid has been written.
+    inline void EndFrame(int tid)
+    {
+        if (mFrameAligned && tid == mFrameAlignTid)
+            Flush();
+    }
+
+    // Store blobs of at least minBlobSize bytes only once, in the blob table.
+    // Makes this at least a HEADER_VERSION_5 file. See file_format.hpp.
+    void EnableBlobTable(unsigned int minBlobSize = DEFAULT_MIN_TABLE_BLOB_SIZE);
+    bool IsBlobTableEnabled() const { return mBlobTableEnabled; }
+
+    // Serialize a blob argument of a call, same as Write1DArray<char>() unless
+    // the blob table is enabled. Then a blob definition is written to the file
+    // the first time the content is seen, and a blob reference is written to dest.
+    // Must be called before the call that contains dest is written.
+    char* WriteBlob(char* dest, const char* data, unsigned int len);
+
+    // Write the definitions of all blobs in gBlobTable not yet written to this file.
+    // Needed before copying raw call data that may contain blob references.
+    void WriteKnownBlobDefinitions();
+    // Write call data copied from a file being read, after the definitions
+    // of the blobs it may refer to. The reader has consumed those.
+    void WriteRaw(const void* data, unsigned int len);
+
+    unsigned int BlobTableHits() const { return mBlobTableHits; }
+    unsigned long long BlobTableSavedBytes() const { return mBlobTableSavedBytes; }
+
     common::BHeaderV3   mHeader;
 
 private:
@@ -58,11 +113,26 @@ private:
     }
 
     void WriteCompressedLength(unsigned int len) {
+        if (len >= CHUNK_LENGTH_MASK)
+        {
+            // Too long for the length word, the full length follows it
+            if (mHeader.version < HEADER_VERSION_6)
+                mHeader.version = HEADER_VERSION_6;
+            WriteLengthWord(ChunkLengthWord(mCodec->Id(), len));
+            WriteLengthWord(len);
+        }
+        else
+        {
+            WriteLengthWord(ChunkLengthWord(mCodec->Id(), len));
+        }
+    }
+
+    void WriteLengthWord(unsigned int word) {
         unsigned char buf[4];
-        buf[0] = len & 0xff; len >>= 8;
-        buf[1] = len & 0xff; len >>= 8;
-        buf[2] = len & 0xff; len >>= 8;
-        buf[3] = len & 0xff; len >>= 8;
+        buf[0] = word & 0xff; word >>= 8;
+        buf[1] = word & 0xff; word >>= 8;
+        buf[2] = word & 0xff; word >>= 8;
+        buf[3] = word & 0xff; word >>= 8;
         mStream.write((const char *)buf, sizeof(buf));
     }
 
@@ -72,6 +142,8 @@ private:
 
     os::String AutogenTraceFileName();
 
+    void WriteBlobDefinition(const MD5Digest& digest, const char* data, unsigned int len);
+
     bool                mIsOpen;
     std::fstream        mStream;
 
@@ -83,6 +155,18 @@ private:
 
 
     std::string         mFileName;
+
+    unsigned int        mChunkSize;
+    bool                mFrameAligned;
+    int                 mFrameAlignTid;
+    const ChunkCodec*   mCodec;
+
+    bool                mBlobTableEnabled;
+    unsigned int        mMinTableBlobSize;
+    std::unordered_set<MD5Digest, MD5DigestHash> mWrittenBlobs;
+    size_t              mKnownBlobsWritten;
+    unsigned int        mBlobTableHits;
+    unsigned long long  mBlobTableSavedBytes;
 };
 
 }
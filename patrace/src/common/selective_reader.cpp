@@ -0,0 +1,78 @@
+#include <common/selective_reader.hpp>
+#include <common/parse_api.hpp>
+
+namespace common {
+
+SelectiveReader::SelectiveReader()
+ : mSelectedApiIds(ApiInfo::MaxSigId + 1, false)
+ , mCall(NULL)
+ , mCallNo(0)
+{
+}
+
+SelectiveReader::~SelectiveReader()
+{
+    delete mCall;
+}
+
+void SelectiveReader::Select(unsigned short apiId)
+{
+    if (apiId < mSelectedApiIds.size())
+    {
+        mSelectedApiIds[apiId] = true;
+    }
+}
+
+void SelectiveReader::Select(const char* name)
+{
+    Select(gApiInfo.NameToId(name));
+}
+
+bool SelectiveReader::Open(const char* name)
+{
+    gApiInfo.RegisterEntries(parse_callbacks);
+    mFile.prepareChunks();
+    if (!mFile.Open(name))
+    {
+        return false;
+    }
+
+    // The ids of the trace file depend on its sigbook, look them up once
+    mSelected.assign(mFile.GetMaxSigId() + 1, false);
+    for (unsigned short id = 1; id <= mFile.GetMaxSigId(); ++id)
+    {
+        const unsigned short apiId = gApiInfo.NameToId(mFile.ExIdToName(id));
+        mSelected[id] = apiId != 0 && mSelectedApiIds[apiId];
+    }
+    mCallNo = 0;
+    return true;
+}
+
+void SelectiveReader::Close()
+{
+    delete mCall;
+    mCall = NULL;
+    mFile.Close();
+}
+
+CallTM* SelectiveReader::NextCall()
+{
+    delete mCall;
+    mCall = NULL;
+
+    void *fptr = NULL;
+    char *src = NULL;
+    BCall_vlen call;
+    while (mFile.GetNextCall(fptr, call, src))
+    {
+        const unsigned int callNo = mCallNo++;
+        if (mSelected[call.funcId] && fptr)
+        {
+            mCall = new CallTM(mFile, callNo, call);
+            return mCall;
+        }
+    }
+    return NULL;
+}
+
+}
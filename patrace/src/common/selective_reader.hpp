@@ -0,0 +1,48 @@
+#ifndef _COMMON_SELECTIVE_READER_HPP_
+#define _COMMON_SELECTIVE_READER_HPP_
+
+#include <common/in_file_mt.hpp>
+#include <common/trace_model.hpp>
+
+#include <vector>
+
+namespace common {
+
+// Streams the calls of a trace and decodes only the selected ones. Every
+// other call is stepped over by the length in its header, without building
+// a CallTM or parsing its parameters, so that a scan for a few kinds of calls
+// runs at about the speed of decompression. Unlike TraceFileTM, the trace is
+// not unpacked to a random access file first.
+class SelectiveReader
+{
+public:
+    SelectiveReader();
+    ~SelectiveReader();
+
+    // Select a call by its id in api_info.hpp, before Open()
+    void Select(unsigned short apiId);
+    void Select(const char* name);
+
+    bool Open(const char* name);
+    void Close();
+
+    // The next selected call, owned by the reader and valid until the next
+    // call to NextCall(). NULL at the end of the trace.
+    CallTM* NextCall();
+
+    // Number of calls read so far, selected or not
+    unsigned int CallCount() const { return mCallNo; }
+
+    InFile& File() { return mFile; }
+
+private:
+    InFile              mFile;
+    std::vector<bool>   mSelectedApiIds;
+    std::vector<bool>   mSelected; // by the id of the call in the trace file
+    CallTM*             mCall;
+    unsigned int        mCallNo;
+};
+
+}
+
+#endif
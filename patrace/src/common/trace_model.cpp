@@ -3,6 +3,7 @@
 #include <common/parse_api.hpp>
 #include <common/api_info.hpp>
 #include <common/file_format.hpp>
+#include <common/out_file.hpp>
 
 #include <eglstate/common.hpp>
 
@@ -818,7 +819,7 @@ std::string ValueTM::TypeNameToStr()
 }
 
 
-char* ValueTM::Serialize(char* dest, bool doPadding)
+char* ValueTM::Serialize(char* dest, bool doPadding, OutFile* blobFile)
 {
     switch (mType) {
     case Int8_Type:
@@ -874,12 +875,15 @@ char* ValueTM::Serialize(char* dest, bool doPadding)
         }
         break;
     case Blob_Type:
-        dest = Write1DArray<char>(dest, mBlobLen, mBlob);
+        if (blobFile)
+            dest = blobFile->WriteBlob(dest, mBlob, mBlobLen);
+        else
+            dest = Write1DArray<char>(dest, mBlobLen, mBlob);
         break;
     case Opaque_Type:
         dest = WriteFixed<unsigned int>(dest, mOpaqueType);
         if (mOpaqueIns)
-            dest = mOpaqueIns->Serialize(dest, true);
+            dest = mOpaqueIns->Serialize(dest, true, blobFile);
         break;
     case Pointer_Type:
         dest = WriteFixed<unsigned int>(dest, mPointer ? 1 : 0);
@@ -1085,7 +1089,7 @@ std::string CallTM::ToStr(bool isAbbreviate)
     return mRet.ToStr(this, isAbbreviate ? 32 : 0) + " " + mCallName + "(" + strArgs + ")" + strErr;
 }
 
-char* CallTM::Serialize(char* dest, int overrideID)
+char* CallTM::Serialize(char* dest, int overrideID, OutFile* blobFile)
 {
     if (mCallId == 0) // This call is not supported by ApiInfo
     {
@@ -1115,7 +1119,7 @@ char* CallTM::Serialize(char* dest, int overrideID)
     }
 
     for (unsigned int i = 0; i < mArgs.size(); ++i) {
-        dest = mArgs[i]->Serialize(dest, true);
+        dest = mArgs[i]->Serialize(dest, true, blobFile);
     }
 
     if (mRet.mType != Void_Type)
@@ -1350,6 +1354,45 @@ void FrameTM::UnloadCalls()
     mIsLoaded = false;
 }
 
+void FrameTM::IndexCalls(InFileRA *infile, bool loadQuery, const std::string &loadFilter)
+{
+    ClearCallIndex();
+    infile->SetReadPos(mReadPos);
+
+    common::BCall       curCall;
+
+    for (unsigned int i = 0; i < GetCallCount(); ++i) {
+        // A blob definition in front of the call is read again by CallTM::Load()
+        const std::streamoff readPos = infile->GetReadPos();
+        if (!infile->SkipNextCall(curCall)) {
+            DBG_LOG("File inconsistent!\n");
+            break;
+        }
+
+        const std::string callName = infile->ExIdToName(curCall.funcId);
+        if (!loadQuery && IsQueryCall(callName))
+            continue;
+        if (loadFilter.size() && !MatchFilterString(callName, loadFilter))
+            continue;
+
+        CallIndexEntry entry;
+        entry.mReadPos = readPos;
+        entry.mCallNo = mFirstCallOfThisFrame + i;
+        entry.mFuncId = curCall.funcId;
+        entry.mTid = curCall.tid;
+        mCallIndex.push_back(entry);
+    }
+
+    mIsIndexed = true;
+}
+
+void FrameTM::ClearCallIndex()
+{
+    // swap rather than clear, to give the memory back
+    std::vector<CallIndexEntry>().swap(mCallIndex);
+    mIsIndexed = false;
+}
+
 TraceFileTM::TraceFileTM()
 : mpInFileRA(new InFileRA),
   mCurFrameIndex(0),
@@ -1522,7 +1565,12 @@ unsigned int TraceFileTM::FindNext(unsigned int callNo, const char* name)
 
             string callStr = frTM.mCalls[ca]->ToStr(false);
             if (callStr.find(name) != string::npos)
-                return frTM.mCalls[ca]->mCallNo;
+            {
+                const unsigned int found = frTM.mCalls[ca]->mCallNo;
+                if (needToUnload)
+                    frTM.UnloadCalls();
+                return found;
+            }
         }
 
         if (needToUnload)
@@ -1556,7 +1604,12 @@ unsigned int TraceFileTM::FindPrevious(unsigned int callNo, const char* name)
 
                 string callStr = frTM.mCalls[ca]->ToStr(false);
                 if (callStr.find(name) != string::npos)
-                    return frTM.mCalls[ca]->mCallNo;
+                {
+                    const unsigned int found = frTM.mCalls[ca]->mCallNo;
+                    if (needToUnload)
+                        frTM.UnloadCalls();
+                    return found;
+                }
             }
         }
 
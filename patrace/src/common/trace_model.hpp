@@ -27,6 +27,7 @@ namespace common {
 // Forwad declaration
 class TraceFileTM;
 class CallTM;
+class OutFile;
 
 enum Value_Type_TM {
     Void_Type = 1,
@@ -178,7 +179,8 @@ public:
     std::string ToStr(const CallTM *call, int maxLen=32);
     std::string ToC(const CallTM *call, bool asSourceCode=false);
     std::string TypeNameToStr();
-    char* Serialize(char* dest, bool doPadding);
+    // If blobFile is given, blobs are written through OutFile::WriteBlob()
+    char* Serialize(char* dest, bool doPadding, OutFile* blobFile = NULL);
 
     ValueTM(const ValueTM &other);
     ValueTM &operator =(const ValueTM &other);
@@ -289,7 +291,7 @@ public:
     unsigned int            mTxtColor;
 
     std::string ToStr(bool isAbbreviate = true);
-    char* Serialize(char* dest, int overrideID = -1);
+    char* Serialize(char* dest, int overrideID = -1, OutFile* blobFile = NULL);
     void Stylize();
 
     std::string ToCppCall();
@@ -299,11 +301,21 @@ private:
     CallTM &operator =(const CallTM &);
 };
 
+// Where a call is in the random access file, enough to show its name and
+// to decode it later with CallTM::Load()
+struct CallIndexEntry
+{
+    std::streamoff          mReadPos;
+    unsigned int            mCallNo;
+    unsigned short          mFuncId; // ID in the trace file, see InFileRA::ExIdToName()
+    unsigned char           mTid;
+};
+
 class FrameTM
 {
 public:
     FrameTM():
-        mIsLoaded(false), mCallCount(0)
+        mIsLoaded(false), mIsIndexed(false), mCallCount(0)
     {}
 
     ~FrameTM() {
@@ -317,6 +329,12 @@ public:
     void LoadCallsForTraceToTxt(InFileRA *infile, bool loadQuery, const std::string &loadFilter, unsigned int callNum, unsigned int fromFirstcall, unsigned int max_cycle);
     void UnloadCalls();
 
+    // Finds the calls that pass the filters like LoadCalls(), but without
+    // reading their arguments, so that a viewer can decode just the calls it shows
+    void IndexCalls(InFileRA *infile, bool loadQuery, const std::string &loadFilter);
+    void ClearCallIndex();
+    bool IsIndexed() const { return mIsIndexed; }
+
     // How many calls in the data of this frame, including loaded and non-loaded
     unsigned int GetCallCount() const { return mCallCount; }
     void SetCallCount(unsigned int c) { mCallCount = c; }
@@ -330,12 +348,15 @@ public:
 
     // Properties only exist after been loaded
     std::vector<CallTM*>    mCalls;
+    // Only exists after been indexed, sorted by call number
+    std::vector<CallIndexEntry> mCallIndex;
 
 private:
     FrameTM(const FrameTM &);
     FrameTM &operator =(const FrameTM &);
 
     bool                    mIsLoaded;
+    bool                    mIsIndexed;
     unsigned int            mCallCount;
 };
 
@@ -0,0 +1,361 @@
+#include <common/trace_patcher.hpp>
+#include <common/chunk_codec.hpp>
+#include <common/os.hpp>
+
+#include <jsoncpp/include/json/reader.h>
+#include <jsoncpp/include/json/writer.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+namespace common {
+
+static const unsigned int TRACE_MAGIC_NO = 0x20122012;
+
+static bool readLengthWord(std::istream& in, unsigned int& word)
+{
+    unsigned char buf[4];
+    if (!in.read((char*)buf, sizeof(buf)))
+        return false;
+    word = buf[0] | (buf[1] << 8) | (buf[2] << 16) | ((unsigned int)buf[3] << 24);
+    return true;
+}
+
+static bool copyStream(std::istream& in, std::ostream& out)
+{
+    std::vector<char> buf(1024 * 1024);
+    while (in.read(buf.data(), buf.size()) || in.gcount() > 0)
+    {
+        out.write(buf.data(), in.gcount());
+    }
+    return in.eof() && out.good();
+}
+
+TracePatcher::TracePatcher()
+ : mJsonChanged(false)
+ , mSigBookChanged(false)
+ , mRewritten(false)
+ , mFirstChunkCodec(NULL)
+ , mFirstChunkLength(0)
+ , mSigBookBlockLength(0)
+{
+}
+
+bool TracePatcher::Open(const char* name)
+{
+    mFileName = name;
+    mJsonChanged = mSigBookChanged = mRewritten = false;
+
+    std::ifstream in(name, std::ios::binary);
+    if (!in.is_open())
+    {
+        DBG_LOG("Failed to open file %s\n", name);
+        return false;
+    }
+    if (!in.read((char*)&mHeader, sizeof(mHeader)) || mHeader.magicNo != TRACE_MAGIC_NO)
+    {
+        DBG_LOG("%s is not a trace file\n", name);
+        return false;
+    }
+    if (mHeader.version < HEADER_VERSION_3)
+    {
+        DBG_LOG("%s has a version %d header, only version 3 and later can be patched\n", name, mHeader.version - HEADER_VERSION_1 + 1);
+        return false;
+    }
+
+    if (mHeader.jsonFileBegin < (long long)sizeof(mHeader)
+        || mHeader.jsonFileEnd < mHeader.jsonFileBegin + (long long)mHeader.jsonLength)
+    {
+        DBG_LOG("%s has a corrupt JSON region\n", name);
+        return false;
+    }
+    std::vector<char> json(mHeader.jsonLength);
+    in.seekg(mHeader.jsonFileBegin, std::ios_base::beg);
+    Json::Reader reader;
+    if (!in.read(json.data(), json.size()) || !reader.parse(json.data(), json.data() + json.size(), mJsonHeader))
+    {
+        DBG_LOG("Failed to parse the JSON header of %s\n", name);
+        return false;
+    }
+
+    // The sigbook is the first block of the first chunk
+    unsigned int lengthWord = 0;
+    in.seekg(mHeader.jsonFileEnd, std::ios_base::beg);
+    if (!readLengthWord(in, lengthWord))
+    {
+        DBG_LOG("%s has no calls\n", name);
+        return false;
+    }
+    const HeaderVersion version = static_cast<HeaderVersion>(mHeader.version);
+    if (ChunkLengthWordIsLong(lengthWord, version))
+    {
+        DBG_LOG("The first chunk of %s is too large to be patched\n", name);
+        return false;
+    }
+    mFirstChunkCodec = GetChunkCodec(ChunkLengthWordCodec(lengthWord, version));
+    mFirstChunkLength = ChunkLengthWordLength(lengthWord, version);
+    std::vector<char> compressed(mFirstChunkLength);
+    size_t len = 0;
+    if (!mFirstChunkCodec || !in.read(compressed.data(), compressed.size())
+        || !mFirstChunkCodec->GetUncompressedLength(compressed.data(), compressed.size(), &len))
+    {
+        DBG_LOG("Failed to read the first chunk of %s\n", name);
+        return false;
+    }
+    mFirstChunkData.resize(len);
+    if (len < 2 * sizeof(unsigned int) || !mFirstChunkCodec->Uncompress(compressed.data(), compressed.size(), mFirstChunkData.data()))
+    {
+        DBG_LOG("Failed to uncompress the first chunk of %s\n", name);
+        return false;
+    }
+
+    char* src = mFirstChunkData.data();
+    unsigned int maxSigId = 0;
+    src = ReadFixed(src, mSigBookBlockLength);
+    src = ReadFixed(src, maxSigId);
+    if (mSigBookBlockLength > len)
+    {
+        DBG_LOG("The sigbook of %s is corrupt\n", name);
+        return false;
+    }
+    mSigBook.assign(1, std::string());
+    for (unsigned int id = 1; id <= maxSigId; ++id)
+    {
+        unsigned int id_notused;
+        src = ReadFixed(src, id_notused);
+        char* str = NULL;
+        src = ReadString(src, str);
+        mSigBook.push_back(str ? str : "");
+    }
+    return true;
+}
+
+void TracePatcher::SetJSONHeader(const Json::Value& header)
+{
+    mJsonHeader = header;
+    mJsonChanged = true;
+}
+
+void TracePatcher::SetSigBook(const std::vector<std::string>& sigbook)
+{
+    mSigBook = sigbook;
+    if (mSigBook.empty())
+        mSigBook.push_back(std::string());
+    mSigBookChanged = true;
+}
+
+std::vector<char> TracePatcher::SigBookBlock(unsigned int padding, unsigned int noise) const
+{
+    // Same layout as OutFile::WriteSigBook()
+    size_t len = 2 * sizeof(unsigned int);
+    for (size_t id = 1; id < mSigBook.size(); ++id)
+    {
+        len += 2 * sizeof(unsigned int) + ((mSigBook[id].size() + 1 + 3) & ~3u);
+    }
+    std::vector<char> block(len + padding, 0);
+    char* dest = block.data();
+    dest = WriteFixed<unsigned int>(dest, block.size());
+    dest = WriteFixed<unsigned int>(dest, mSigBook.size() - 1);
+    for (size_t id = 1; id < mSigBook.size(); ++id)
+    {
+        dest = WriteFixed<unsigned int>(dest, id);
+        dest = WriteString(dest, mSigBook[id].c_str());
+    }
+
+    // Readers skip the padding, so it can be anything
+    unsigned int seed = TRACE_MAGIC_NO;
+    for (unsigned int i = 0; i < noise; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        *dest++ = (char)(seed >> 16);
+    }
+    return block;
+}
+
+bool TracePatcher::EncodeFirstChunk(const std::vector<char>& sigbookBlock, std::vector<char>& chunk) const
+{
+    std::vector<char> data(sigbookBlock);
+    data.insert(data.end(), mFirstChunkData.begin() + mSigBookBlockLength, mFirstChunkData.end());
+
+    size_t len = 0;
+    chunk.resize(sizeof(unsigned int) + mFirstChunkCodec->MaxCompressedLength(data.size()));
+    if (!mFirstChunkCodec->CompressTight(data.data(), data.size(), chunk.data() + sizeof(unsigned int), &len))
+    {
+        DBG_LOG("Failed to compress the first chunk with %s\n", mFirstChunkCodec->Name());
+        return false;
+    }
+    if (len >= CHUNK_LENGTH_MASK)
+    {
+        DBG_LOG("The first chunk is too large to be patched\n");
+        return false;
+    }
+    const unsigned int lengthWord = ChunkLengthWord(mFirstChunkCodec->Id(), len);
+    memcpy(chunk.data(), &lengthWord, sizeof(lengthWord));
+    chunk.resize(sizeof(unsigned int) + len);
+    return true;
+}
+
+bool TracePatcher::StretchFirstChunk(std::vector<char>& chunk) const
+{
+    const size_t len = chunk.size() - sizeof(unsigned int);
+    if (len > mFirstChunkLength)
+        return false;
+    std::vector<char> stretched(sizeof(unsigned int) + mFirstChunkLength);
+    if (!mFirstChunkCodec->Stretch(chunk.data() + sizeof(unsigned int), len, stretched.data() + sizeof(unsigned int), mFirstChunkLength))
+        return false;
+    const unsigned int lengthWord = ChunkLengthWord(mFirstChunkCodec->Id(), mFirstChunkLength);
+    memcpy(stretched.data(), &lengthWord, sizeof(lengthWord));
+    chunk.swap(stretched);
+    return true;
+}
+
+bool TracePatcher::FitFirstChunk(std::vector<char>& chunk) const
+{
+    // Codecs that ignore trailing bytes take the bare sigbook block, and so
+    // may a codec that can stretch its output by the few bytes it saves
+    if (!EncodeFirstChunk(SigBookBlock(0, 0), chunk))
+        return false;
+    if (StretchFirstChunk(chunk))
+        return true;
+
+    // Otherwise the new sigbook block is padded to the length of the old one.
+    // Zeros compress to almost nothing and noise to about its own size, so the
+    // amount of noise at the start of the padding brings the chunk close to its
+    // old size, and the codec stretches it by whatever is left.
+    const size_t sigbookLength = SigBookBlock(0, 0).size();
+    if (sigbookLength > mSigBookBlockLength)
+        return false;
+    const long target = mFirstChunkLength;
+    const long padding = mSigBookBlockLength - sigbookLength;
+    long noise = 0;
+    for (int attempt = 0; attempt < 16 && noise >= 0 && noise <= padding; ++attempt)
+    {
+        if (!EncodeFirstChunk(SigBookBlock(padding, noise), chunk))
+            return false;
+        const long size = chunk.size() - sizeof(unsigned int);
+        if (size <= target && StretchFirstChunk(chunk))
+            return true;
+        if (attempt == 0 && size > target)
+            return false;
+        // Tags make the size jump by a few bytes, so when over aim a little short
+        noise += target - size - (size > target ? 8 : 0);
+        noise = std::min(noise, padding);
+    }
+    return false;
+}
+
+bool TracePatcher::Commit()
+{
+    mRewritten = false;
+    if (!mJsonChanged && !mSigBookChanged)
+        return true;
+
+    Json::FastWriter writer;
+    const std::string json = writer.write(mJsonHeader);
+    const bool jsonFits = (long long)json.size() <= mHeader.jsonFileEnd - mHeader.jsonFileBegin;
+
+    std::vector<char> firstChunk;
+    if (mSigBookChanged && !FitFirstChunk(firstChunk))
+    {
+        if (!EncodeFirstChunk(SigBookBlock(0, 0), firstChunk))
+            return false;
+        return Rewrite(json, firstChunk);
+    }
+    if (!jsonFits)
+    {
+        return Rewrite(json, firstChunk);
+    }
+    return PatchInPlace(json, mSigBookChanged ? &firstChunk : NULL);
+}
+
+bool TracePatcher::PatchInPlace(const std::string& json, const std::vector<char>* firstChunk)
+{
+    std::fstream file(mFileName.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+    if (!file.is_open())
+    {
+        DBG_LOG("Failed to open file %s for writing\n", mFileName.c_str());
+        return false;
+    }
+
+    if (firstChunk)
+    {
+        file.seekp(mHeader.jsonFileEnd, std::ios_base::beg);
+        file.write(firstChunk->data(), firstChunk->size());
+    }
+    if (mJsonChanged)
+    {
+        // Clear what is left of the old JSON, readers stop at jsonLength anyway
+        std::vector<char> region(std::max<size_t>(json.size(), mHeader.jsonLength), 0);
+        std::copy(json.begin(), json.end(), region.begin());
+        file.seekp(mHeader.jsonFileBegin, std::ios_base::beg);
+        file.write(region.data(), region.size());
+
+        // The fixed size header goes last, so that it only refers to a complete JSON
+        mHeader.jsonLength = json.size();
+        file.seekp(0, std::ios_base::beg);
+        file.write((const char*)&mHeader, sizeof(mHeader));
+    }
+    file.flush();
+    if (!file.good())
+    {
+        DBG_LOG("Failed to patch %s\n", mFileName.c_str());
+        return false;
+    }
+    mJsonChanged = mSigBookChanged = false;
+    // The padding is part of the sigbook block now, later commits fit around it
+    return firstChunk ? Open(mFileName.c_str()) : true;
+}
+
+// Writes a new file with a JSON region large enough for the header, and the
+// new first chunk if there is one, then replaces the old file with it.
+bool TracePatcher::Rewrite(const std::string& json, const std::vector<char>& firstChunk)
+{
+    std::ifstream in(mFileName.c_str(), std::ios::binary);
+    const std::string tmpName = mFileName + ".tmp";
+    std::ofstream out(tmpName.c_str(), std::ios::binary | std::ios::trunc);
+    if (!in.is_open() || !out.is_open())
+    {
+        DBG_LOG("Failed to open %s for rewriting\n", tmpName.c_str());
+        return false;
+    }
+
+    BHeaderV3 header = mHeader;
+    // Never less than a new file reserves, so that the doubling gets somewhere
+    long long jsonRegion = std::max(mHeader.jsonFileEnd - mHeader.jsonFileBegin, (long long)BHeaderV3::jsonMaxLength);
+    while (jsonRegion < (long long)json.size())
+        jsonRegion *= 2;
+    header.jsonLength = json.size();
+    header.jsonFileEnd = header.jsonFileBegin + jsonRegion;
+
+    std::vector<char> region(header.jsonFileEnd, 0);
+    memcpy(region.data(), &header, sizeof(header));
+    std::copy(json.begin(), json.end(), region.begin() + header.jsonFileBegin);
+    out.write(region.data(), region.size());
+
+    // All other chunks are copied as they are
+    long long copyFrom = mHeader.jsonFileEnd;
+    if (!firstChunk.empty())
+    {
+        out.write(firstChunk.data(), firstChunk.size());
+        copyFrom += sizeof(unsigned int) + mFirstChunkLength;
+    }
+    in.seekg(copyFrom, std::ios_base::beg);
+    const bool copied = copyStream(in, out);
+    in.close();
+    out.close();
+    if (!copied || !out.good() || std::rename(tmpName.c_str(), mFileName.c_str()) != 0)
+    {
+        DBG_LOG("Failed to rewrite %s\n", mFileName.c_str());
+        std::remove(tmpName.c_str());
+        return false;
+    }
+
+    DBG_LOG("%s had to be rewritten, the new header or sigbook did not fit\n", mFileName.c_str());
+    // Later commits patch the file as it is now
+    const bool reopened = Open(mFileName.c_str());
+    mRewritten = true;
+    return reopened;
+}
+
+}
@@ -0,0 +1,69 @@
+#ifndef _COMMON_TRACE_PATCHER_HPP_
+#define _COMMON_TRACE_PATCHER_HPP_
+
+#include <string>
+#include <vector>
+#include <jsoncpp/include/json/value.h>
+
+#include <common/file_format.hpp>
+
+namespace common {
+
+class ChunkCodec;
+
+// Changes the JSON header and the sigbook of a trace file (HEADER_VERSION_3
+// and later) without decoding its calls, touching as few bytes as possible.
+//
+// The JSON is written into the region that BHeaderV3 reserves for it. The
+// sigbook is the first block of the first chunk, so only that chunk is
+// recompressed, with the sigbook block padded (readers skip to its toNext)
+// until the chunk is about its old compressed size, and the codec stretches
+// it to exactly that size (see ChunkCodec::Stretch). Only when the JSON or
+// the first chunk no longer fit is the file rewritten, and even then the
+// other chunks are copied as they are.
+class TracePatcher
+{
+public:
+    TracePatcher();
+
+    bool Open(const char* name);
+
+    const Json::Value& GetJSONHeader() const { return mJsonHeader; }
+    // Indexed by the function ids of the file, entry 0 is unused
+    const std::vector<std::string>& GetSigBook() const { return mSigBook; }
+
+    void SetJSONHeader(const Json::Value& header);
+    // The ids of the calls do not change, so every id used by a call must
+    // keep its name. Unused entries may be emptied or dropped from the end.
+    void SetSigBook(const std::vector<std::string>& sigbook);
+
+    // Writes the changes. Returns false if the file could not be written.
+    bool Commit();
+    // Whether the last Commit() had to rewrite the whole file
+    bool Rewritten() const { return mRewritten; }
+
+private:
+    std::vector<char> SigBookBlock(unsigned int padding, unsigned int noise) const;
+    bool EncodeFirstChunk(const std::vector<char>& sigbookBlock, std::vector<char>& chunk) const;
+    bool StretchFirstChunk(std::vector<char>& chunk) const;
+    bool FitFirstChunk(std::vector<char>& chunk) const;
+    bool PatchInPlace(const std::string& json, const std::vector<char>* firstChunk);
+    bool Rewrite(const std::string& json, const std::vector<char>& firstChunk);
+
+    std::string mFileName;
+    BHeaderV3 mHeader;
+    Json::Value mJsonHeader;
+    std::vector<std::string> mSigBook;
+    bool mJsonChanged;
+    bool mSigBookChanged;
+    bool mRewritten;
+
+    const ChunkCodec* mFirstChunkCodec;
+    unsigned int mFirstChunkLength;         // compressed
+    std::vector<char> mFirstChunkData;      // uncompressed
+    unsigned int mSigBookBlockLength;       // the calls of the first chunk follow it
+};
+
+}
+
+#endif
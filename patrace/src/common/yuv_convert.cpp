@@ -0,0 +1,379 @@
+#include "yuv_convert.hpp"
+
+#include <stddef.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define YUV_NEON 1
+#endif
+
+// The kernels must round exactly like the scalar code, so products are
+// never fused with the additions that follow them
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+namespace image {
+
+namespace {
+
+struct Layout
+{
+    int width;
+    int height;
+    int yStride;
+    int cStride;
+    int ySize;
+    int cSize;
+    int size;
+    bool interleaved; // NV12
+};
+
+inline unsigned char clamp(int v)
+{
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+inline unsigned char luma(int r, int g, int b)
+{
+    return clamp((int)(0.299 * r + 0.587 * g + 0.114 * b));
+}
+
+inline unsigned char chromaU(int r, int g, int b)
+{
+    return clamp((int)(-0.169 * r - 0.331 * g + 0.500 * b + 128));
+}
+
+inline unsigned char chromaV(int r, int g, int b)
+{
+    return clamp((int)(0.500 * r - 0.419 * g - 0.081 * b + 128));
+}
+
+// Convert the luma of one row from x on, after the vector code
+void lumaRowScalar(const unsigned char *src, unsigned char *dst, int x, int width)
+{
+    for (; x < width; ++x)
+    {
+        dst[x] = luma(src[x * 4], src[x * 4 + 1], src[x * 4 + 2]);
+    }
+}
+
+// The chroma of the even pixels of one row from x (even) on. dstU and dstV
+// advance by step for every chroma sample. The vector versions of both
+// return how many pixels they converted.
+void chromaRowScalar(const unsigned char *src, unsigned char *dstU, unsigned char *dstV, int step, int x, int width)
+{
+    for (; x < width; x += 2)
+    {
+        const int r = src[x * 4], g = src[x * 4 + 1], b = src[x * 4 + 2];
+        dstU[x / 2 * step] = chromaU(r, g, b);
+        dstV[x / 2 * step] = chromaV(r, g, b);
+    }
+}
+
+#if defined(__SSE2__)
+
+// Two pixels per double vector, with the operations in the same order as
+// the scalar code
+
+inline __m128i lumaSSE(__m128d r, __m128d g, __m128d b)
+{
+    const __m128d rg = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(0.299), r), _mm_mul_pd(_mm_set1_pd(0.587), g));
+    return _mm_cvttpd_epi32(_mm_add_pd(rg, _mm_mul_pd(_mm_set1_pd(0.114), b)));
+}
+
+inline __m128i chromaUSSE(__m128d r, __m128d g, __m128d b)
+{
+    const __m128d rg = _mm_sub_pd(_mm_mul_pd(_mm_set1_pd(-0.169), r), _mm_mul_pd(_mm_set1_pd(0.331), g));
+    return _mm_cvttpd_epi32(_mm_add_pd(_mm_add_pd(rg, _mm_mul_pd(_mm_set1_pd(0.500), b)), _mm_set1_pd(128.0)));
+}
+
+inline __m128i chromaVSSE(__m128d r, __m128d g, __m128d b)
+{
+    const __m128d rg = _mm_sub_pd(_mm_mul_pd(_mm_set1_pd(0.500), r), _mm_mul_pd(_mm_set1_pd(0.419), g));
+    return _mm_cvttpd_epi32(_mm_add_pd(_mm_sub_pd(rg, _mm_mul_pd(_mm_set1_pd(0.081), b)), _mm_set1_pd(128.0)));
+}
+
+// The red, green and blue of 4 RGBA pixels in 32 bit lanes
+inline void loadSSE(const unsigned char *src, __m128i &r, __m128i &g, __m128i &b)
+{
+    const __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    const __m128i mask = _mm_set1_epi32(0xff);
+    r = _mm_and_si128(p, mask);
+    g = _mm_and_si128(_mm_srli_epi32(p, 8), mask);
+    b = _mm_and_si128(_mm_srli_epi32(p, 16), mask);
+}
+
+// Clamp 4 32 bit lanes to bytes, like clamp()
+inline int packSSE(__m128i v)
+{
+    const __m128i v16 = _mm_packs_epi32(v, v);
+    return _mm_cvtsi128_si32(_mm_packus_epi16(v16, v16));
+}
+
+int lumaRowVector(const unsigned char *src, unsigned char *dst, int width)
+{
+    int x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i r, g, b;
+        loadSSE(src + x * 4, r, g, b);
+        const __m128i lo = lumaSSE(_mm_cvtepi32_pd(r), _mm_cvtepi32_pd(g), _mm_cvtepi32_pd(b));
+        const __m128i hi = lumaSSE(_mm_cvtepi32_pd(_mm_shuffle_epi32(r, _MM_SHUFFLE(3, 2, 3, 2))),
+                                   _mm_cvtepi32_pd(_mm_shuffle_epi32(g, _MM_SHUFFLE(3, 2, 3, 2))),
+                                   _mm_cvtepi32_pd(_mm_shuffle_epi32(b, _MM_SHUFFLE(3, 2, 3, 2))));
+        const int y = packSSE(_mm_unpacklo_epi64(lo, hi));
+        memcpy(dst + x, &y, 4);
+    }
+    return x;
+}
+
+int chromaRowVector(const unsigned char *src, unsigned char *dstU, unsigned char *dstV, int step, int width)
+{
+    int x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i r, g, b;
+        loadSSE(src + x * 4, r, g, b);
+        // Pixels 0 and 2 only
+        const __m128d rd = _mm_cvtepi32_pd(_mm_shuffle_epi32(r, _MM_SHUFFLE(3, 1, 2, 0)));
+        const __m128d gd = _mm_cvtepi32_pd(_mm_shuffle_epi32(g, _MM_SHUFFLE(3, 1, 2, 0)));
+        const __m128d bd = _mm_cvtepi32_pd(_mm_shuffle_epi32(b, _MM_SHUFFLE(3, 1, 2, 0)));
+        const int u = packSSE(chromaUSSE(rd, gd, bd));
+        const int v = packSSE(chromaVSSE(rd, gd, bd));
+        unsigned char *pU = dstU + x / 2 * step;
+        unsigned char *pV = dstV + x / 2 * step;
+        pU[0] = u;
+        pU[step] = u >> 8;
+        pV[0] = v;
+        pV[step] = v >> 8;
+    }
+    return x;
+}
+
+#elif defined(YUV_NEON)
+
+// Two pixels per double vector, with the operations in the same order as
+// the scalar code
+
+inline int64x2_t lumaNEON(float64x2_t r, float64x2_t g, float64x2_t b)
+{
+    const float64x2_t rg = vaddq_f64(vmulq_n_f64(r, 0.299), vmulq_n_f64(g, 0.587));
+    return vcvtq_s64_f64(vaddq_f64(rg, vmulq_n_f64(b, 0.114)));
+}
+
+inline int64x2_t chromaUNEON(float64x2_t r, float64x2_t g, float64x2_t b)
+{
+    const float64x2_t rg = vsubq_f64(vmulq_n_f64(r, -0.169), vmulq_n_f64(g, 0.331));
+    return vcvtq_s64_f64(vaddq_f64(vaddq_f64(rg, vmulq_n_f64(b, 0.500)), vdupq_n_f64(128.0)));
+}
+
+inline int64x2_t chromaVNEON(float64x2_t r, float64x2_t g, float64x2_t b)
+{
+    const float64x2_t rg = vsubq_f64(vmulq_n_f64(r, 0.500), vmulq_n_f64(g, 0.419));
+    return vcvtq_s64_f64(vaddq_f64(vsubq_f64(rg, vmulq_n_f64(b, 0.081)), vdupq_n_f64(128.0)));
+}
+
+// Lanes 0-1, 2-3, 4-5 and 6-7 of 8 16 bit values as doubles
+inline void widenNEON(uint16x8_t v, float64x2_t out[4])
+{
+    const uint32x4_t lo = vmovl_u16(vget_low_u16(v));
+    const uint32x4_t hi = vmovl_u16(vget_high_u16(v));
+    out[0] = vcvtq_f64_u64(vmovl_u32(vget_low_u32(lo)));
+    out[1] = vcvtq_f64_u64(vmovl_u32(vget_high_u32(lo)));
+    out[2] = vcvtq_f64_u64(vmovl_u32(vget_low_u32(hi)));
+    out[3] = vcvtq_f64_u64(vmovl_u32(vget_high_u32(hi)));
+}
+
+// Clamp 8 64 bit lanes to bytes, like clamp()
+inline uint8x8_t packNEON(const int64x2_t v[4])
+{
+    const int32x4_t lo = vcombine_s32(vqmovn_s64(v[0]), vqmovn_s64(v[1]));
+    const int32x4_t hi = vcombine_s32(vqmovn_s64(v[2]), vqmovn_s64(v[3]));
+    return vqmovn_u16(vcombine_u16(vqmovun_s32(lo), vqmovun_s32(hi)));
+}
+
+int lumaRowVector(const unsigned char *src, unsigned char *dst, int width)
+{
+    int x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        const uint8x8x4_t p = vld4_u8(src + x * 4);
+        float64x2_t r[4], g[4], b[4];
+        widenNEON(vmovl_u8(p.val[0]), r);
+        widenNEON(vmovl_u8(p.val[1]), g);
+        widenNEON(vmovl_u8(p.val[2]), b);
+        int64x2_t y[4];
+        for (int i = 0; i < 4; ++i)
+        {
+            y[i] = lumaNEON(r[i], g[i], b[i]);
+        }
+        vst1_u8(dst + x, packNEON(y));
+    }
+    return x;
+}
+
+int chromaRowVector(const unsigned char *src, unsigned char *dstU, unsigned char *dstV, int step, int width)
+{
+    int x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        // Deinterleaving two pixels at a time keeps the even pixels only
+        const uint16x8x4_t p = vld4q_u16(reinterpret_cast<const uint16_t*>(src + x * 4));
+        const uint16x8_t mask = vdupq_n_u16(0xff);
+        float64x2_t r[4], g[4], b[4];
+        widenNEON(vandq_u16(p.val[0], mask), r);
+        widenNEON(vshrq_n_u16(p.val[0], 8), g);
+        widenNEON(vandq_u16(p.val[1], mask), b);
+        int64x2_t u[4], v[4];
+        for (int i = 0; i < 4; ++i)
+        {
+            u[i] = chromaUNEON(r[i], g[i], b[i]);
+            v[i] = chromaVNEON(r[i], g[i], b[i]);
+        }
+        const uint8x8_t u8 = packNEON(u);
+        const uint8x8_t v8 = packNEON(v);
+        if (step == 2 && dstV == dstU + 1)
+        {
+            const uint8x8x2_t uv = { { u8, v8 } };
+            vst2_u8(dstU + x, uv);
+        }
+        else
+        {
+            unsigned char us[8], vs[8];
+            vst1_u8(us, u8);
+            vst1_u8(vs, v8);
+            for (int i = 0; i < 8; ++i)
+            {
+                dstU[(x / 2 + i) * step] = us[i];
+                dstV[(x / 2 + i) * step] = vs[i];
+            }
+        }
+    }
+    return x;
+}
+
+#else
+
+int lumaRowVector(const unsigned char *, unsigned char *, int)
+{
+    return 0;
+}
+
+int chromaRowVector(const unsigned char *, unsigned char *, unsigned char *, int, int)
+{
+    return 0;
+}
+
+#endif
+
+void convertRow(const unsigned char *rgba, unsigned char *yuv, const Layout &layout, int y)
+{
+    const unsigned char *src = rgba + (size_t)y * layout.width * 4;
+    unsigned char *dstY = yuv + (size_t)y * layout.yStride;
+    lumaRowScalar(src, dstY, lumaRowVector(src, dstY, layout.width), layout.width);
+
+    if ((y & 1) == 0)
+    {
+        unsigned char *dstU, *dstV;
+        int step;
+        if (layout.interleaved)
+        {
+            dstU = yuv + layout.ySize + y / 2 * layout.cStride;
+            dstV = dstU + 1;
+            step = 2;
+        }
+        else
+        {
+            dstV = yuv + layout.ySize + y / 2 * layout.cStride;
+            dstU = dstV + layout.cSize;
+            step = 1;
+        }
+        chromaRowScalar(src, dstU, dstV, step, chromaRowVector(src, dstU, dstV, step, layout.width), layout.width);
+    }
+}
+
+int convert(const unsigned char *rgba, unsigned char *yuv, const Layout &layout, unsigned threads)
+{
+    // With an odd height, the chroma of the last row goes past the end of its
+    // plane, over the start of the next one for YV12. It is converted last,
+    // after every other row, so that it overwrites them as it always did.
+    const int pairedRows = layout.height & ~1;
+    const int BAND_ROWS = 32;
+    const int bands = (pairedRows + BAND_ROWS - 1) / BAND_ROWS;
+
+    std::atomic<int> next(0);
+    auto work = [&]()
+    {
+        for (int band = next++; band < bands; band = next++)
+        {
+            const int end = std::min(pairedRows, (band + 1) * BAND_ROWS);
+            for (int y = band * BAND_ROWS; y < end; ++y)
+            {
+                convertRow(rgba, yuv, layout, y);
+            }
+        }
+    };
+    if (threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    std::vector<std::thread> pool;
+    for (unsigned i = 1; i < std::min<unsigned>(threads, bands); ++i)
+    {
+        pool.emplace_back(work);
+    }
+    work();
+    for (std::thread &thread : pool)
+    {
+        thread.join();
+    }
+
+    if (pairedRows < layout.height)
+    {
+        convertRow(rgba, yuv, layout, pairedRows);
+    }
+    return layout.size;
+}
+
+} // namespace
+
+int RGBAtoYV12(const unsigned char *rgba, unsigned char *yv12, int width, int height, unsigned threads)
+{
+    Layout layout;
+    layout.width = width;
+    layout.height = height;
+    layout.yStride = (width + 15) / 16 * 16;
+    layout.ySize = layout.yStride * height;
+    layout.cStride = (layout.yStride / 2 + 15) / 16 * 16;
+    layout.cSize = layout.cStride * height / 2;
+    layout.size = layout.ySize + layout.cSize * 2;
+    layout.interleaved = false;
+    return convert(rgba, yv12, layout, threads);
+}
+
+int RGBAtoNV12(const unsigned char *rgba, unsigned char *nv12, int width, int height, unsigned threads)
+{
+    Layout layout;
+    layout.width = width;
+    layout.height = height;
+    layout.yStride = (width + 15) / 16 * 16;
+    layout.ySize = layout.yStride * height;
+    layout.cStride = layout.yStride;
+    layout.cSize = layout.cStride * height / 2;
+    layout.size = layout.ySize + layout.cSize;
+    layout.interleaved = true;
+    return convert(rgba, nv12, layout, threads);
+}
+
+} /* namespace image */
@@ -0,0 +1,27 @@
+#ifndef _COMMON_YUV_CONVERT_HPP_
+#define _COMMON_YUV_CONVERT_HPP_
+
+namespace image {
+
+// Convert RGBA8 pixels to the YUV 4:2:0 layouts of Android graphic buffers.
+// Luma rows are padded to 16 bytes; padding bytes are left untouched. The
+// chroma of each 2x2 block is taken from its top left pixel. YV12 has the V
+// plane then the U plane, each with rows padded to 16 bytes, NV12 has one
+// plane of interleaved U and V.
+//
+// The rows are converted in bands on several threads, with SSE2 or NEON
+// where available. The result is the same, byte for byte, as converting
+// one pixel at a time with
+//
+//   y =  0.299r + 0.587g + 0.114b
+//   u = -0.169r - 0.331g + 0.500b + 128
+//   v =  0.500r - 0.419g - 0.081b + 128
+//
+// in double precision, truncated and clamped to [0, 255]. With 0 threads,
+// one per core is used. Returns the size of the YUV image in bytes.
+int RGBAtoYV12(const unsigned char *rgba, unsigned char *yv12, int width, int height, unsigned threads = 0);
+int RGBAtoNV12(const unsigned char *rgba, unsigned char *nv12, int width, int height, unsigned threads = 0);
+
+} /* namespace image */
+
+#endif
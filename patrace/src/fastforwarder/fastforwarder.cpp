@@ -3,6 +3,9 @@
 #include <fstream>
 #include <unistd.h>
 #include <ctime>
+#include <list>
+#include <sstream>
+#include <vector>
 
 #include "common/out_file.hpp"
 #include "common/image.hpp"
@@ -60,21 +63,55 @@ enum FastForwardOptionFlags
     FASTFORWARD_RESTORE_TEXTURES  = 1 << 0,
 };
 
-struct FastForwardOptions
+// One fastforward trace to cut out of the input trace
+struct FastForwardTarget
 {
+    unsigned int mTargetFrame;
+    unsigned int mEndFrame; // last frame to keep, 0 to keep everything until the end of the trace
     std::string mOutputFileName;
+
+    FastForwardTarget(unsigned int targetFrame, unsigned int endFrame)
+        : mTargetFrame(targetFrame)
+        , mEndFrame(endFrame)
+        , mOutputFileName()
+    {}
+};
+
+struct FastForwardOptions
+{
+    std::vector<std::string> mOutputFileNames;
     std::string mComment;
-    unsigned int mTargetFrame;
+    std::vector<FastForwardTarget> mTargets;
     unsigned int mFlags;
 
     FastForwardOptions()
-        : mOutputFileName("fastforward.pat")
+        : mOutputFileNames()
         , mComment("")
-        , mTargetFrame(0)
+        , mTargets()
         , mFlags(0)
     {}
 };
 
+// A fastforward trace being written. All of them are written during the same retrace.
+struct FastForwardOutput
+{
+    FastForwardTarget mTarget;
+    common::OutFile mOut;
+    Json::Value mFFJson;
+
+    FastForwardOutput(const FastForwardTarget& target, const Json::Value& ffJson)
+        : mTarget(target)
+        , mOut(target.mOutputFileName.c_str())
+        , mFFJson(ffJson)
+    {}
+
+    // Past the end frame, nothing more is written
+    bool isDone(unsigned int curFrame) const
+    {
+        return mTarget.mEndFrame != 0 && curFrame > mTarget.mEndFrame;
+    }
+};
+
 namespace RetraceAndTrim
 {
 class ScratchBuffer
@@ -1295,7 +1332,44 @@ static void injectClear(retracer::Context& retracerContext, common::OutFile& out
 }
 
 
-static bool retraceAndTrim(common::OutFile &out, const FastForwardOptions& ffOptions, Json::Value& ffJson)
+static void saveState(FastForwardOutput& output, const FastForwardOptions& ffOptions, retracer::Retracer& retracer)
+{
+    common::OutFile& out = output.mOut;
+    Json::Value& ffJson = output.mFFJson;
+
+    DBG_LOG("Started saving GL state for %s\n", output.mTarget.mOutputFileName.c_str());
+    RetraceAndTrim::checkError("RetraceAndTrim state-saving begin");
+
+    // Should have a valid GL state at this point
+    char* version = (char*) _glGetString(GL_VERSION);
+    ffJson["GL_VERSION"]  = version;
+    ffJson["GL_VENDOR"]   = (char*) _glGetString(GL_VENDOR);
+    ffJson["GL_RENDERER"] = (char*) _glGetString(GL_RENDERER);
+
+    // Sync
+    _glMemoryBarrier(GL_ALL_BARRIER_BITS);
+    _glFlush();
+    _glFinish();
+
+    // Save buffers
+    {
+        RetraceAndTrim::BufferSaver::run(retracer.getCurrentContext(), retracer.mFile, out, retracer.getCurTid());
+    }
+
+    // Save texture
+    if (ffOptions.mFlags & FASTFORWARD_RESTORE_TEXTURES)
+    {
+        RetraceAndTrim::TextureSaver ts(retracer.getCurrentContext(), retracer.mFile, out, retracer.getCurTid());
+        ts.run();
+    }
+
+    injectClear(retracer.getCurrentContext(), out, retracer);
+
+    RetraceAndTrim::checkError("RetraceAndTrim state-saving end");
+    DBG_LOG("Done saving GL state\n");
+}
+
+static bool retraceAndTrim(std::list<FastForwardOutput>& outputs, const FastForwardOptions& ffOptions)
 {
     using namespace retracer;
 
@@ -1333,39 +1407,30 @@ static bool retraceAndTrim(common::OutFile &out, const FastForwardOptions& ffOpt
         }
 
         const char *funcName = retracer.mFile.ExIdToName(retracer.mCurCall.funcId);
+        const unsigned int curFrame = retracer.GetCurFrameId();
 
-        if (retracer.GetCurFrameId() == ffOptions.mTargetFrame-1 && strcmp(funcName, "eglSwapBuffers") == 0)
+        // Stop as soon as the last output is complete, there is no need to replay the rest
+        bool allDone = true;
+        for (std::list<FastForwardOutput>::const_iterator it = outputs.begin(); it != outputs.end(); ++it)
         {
-            DBG_LOG("Started saving GL state\n");
-            RetraceAndTrim::checkError("RetraceAndTrim state-saving begin");
-
-            // Should have a valid GL state at this point
-            char* version = (char*) _glGetString(GL_VERSION);
-            ffJson["GL_VERSION"]  = version;
-            ffJson["GL_VENDOR"]   = (char*) _glGetString(GL_VENDOR);
-            ffJson["GL_RENDERER"] = (char*) _glGetString(GL_RENDERER);
-
-            // Sync
-            _glMemoryBarrier(GL_ALL_BARRIER_BITS);
-            _glFlush();
-            _glFinish();
-
-            // Save buffers
-            {
-                RetraceAndTrim::BufferSaver::run(retracer.getCurrentContext(), retracer.mFile, out, retracer.getCurTid());
-            }
+            allDone = allDone && it->isDone(curFrame);
+        }
+        if (allDone)
+        {
+            GLWS::instance().Cleanup();
+            retracer.CloseTraceFile();
+            return true;
+        }
 
-            // Save texture
-            if (ffOptions.mFlags & FASTFORWARD_RESTORE_TEXTURES)
+        if (strcmp(funcName, "eglSwapBuffers") == 0)
+        {
+            for (std::list<FastForwardOutput>::iterator it = outputs.begin(); it != outputs.end(); ++it)
             {
-                RetraceAndTrim::TextureSaver ts(retracer.getCurrentContext(), retracer.mFile, out, retracer.getCurTid());
-                ts.run();
+                if (curFrame == it->mTarget.mTargetFrame-1)
+                {
+                    saveState(*it, ffOptions, retracer);
+                }
             }
-
-            injectClear(retracer.getCurrentContext(), out, retracer);
-
-            RetraceAndTrim::checkError("RetraceAndTrim state-saving end");
-            DBG_LOG("Done saving GL state\n");
         }
 
         if (retracer.getCurTid() != retracer.mOptions.mRetraceTid)
@@ -1376,16 +1441,27 @@ static bool retraceAndTrim(common::OutFile &out, const FastForwardOptions& ffOpt
         // Save calls.
         // Calling the function might modify what's pointed to by src (e.g. ReadStringArray does this),
         // so it's important that we copy the call before actually calling the function.
-        if (true)
+        bool shouldSkip = (strstr(funcName, "SwapBuffers"))
+            || (strstr(funcName, "glDraw") && strcmp(funcName, "glDrawBuffers") != 0) // By excluding glDrawBuffers, glDraw* matches all drawing funcs.
+            || (strstr(funcName, "glDispatchCompute")) // Matches glDispatchCompute*
+            || (strstr(funcName, "glClearBuffer")) // Matches glClearBuffer*
+            || (strcmp(funcName, "glBlitFramebuffer") == 0) // NOTE: strCMP == 0
+            || (strcmp(funcName, "glClear") == 0); // NOTE: strCMP == 0
+
+        // The call is only copied once, and then written to every output that wants it
+        char* callEnd = NULL;
+        for (std::list<FastForwardOutput>::iterator it = outputs.begin(); it != outputs.end(); ++it)
         {
-            bool shouldSkip = (strstr(funcName, "SwapBuffers"))
-                || (strstr(funcName, "glDraw") && strcmp(funcName, "glDrawBuffers") != 0) // By excluding glDrawBuffers, glDraw* matches all drawing funcs.
-                || (strstr(funcName, "glDispatchCompute")) // Matches glDispatchCompute*
-                || (strstr(funcName, "glClearBuffer")) // Matches glClearBuffer*
-                || (strcmp(funcName, "glBlitFramebuffer") == 0) // NOTE: strCMP == 0
-                || (strcmp(funcName, "glClear") == 0); // NOTE: strCMP == 0
-            bool targetFrameOrLater = (retracer.GetCurFrameId() >= ffOptions.mTargetFrame);
-            if (strstr(funcName, "SwapBuffers") && (retracer.GetCurFrameId()+1 == ffOptions.mTargetFrame))
+            common::OutFile& out = it->mOut;
+            const unsigned int targetFrame = it->mTarget.mTargetFrame;
+
+            if (it->isDone(curFrame))
+            {
+                continue;
+            }
+
+            bool targetFrameOrLater = (curFrame >= targetFrame);
+            if (strstr(funcName, "SwapBuffers") && (curFrame+1 == targetFrame))
             {
                 // We save the call before the call is executed, and GetCurFrameId() isn't
                 // updated until the call (SwapBuffers) is made. This handles the case where this
@@ -1395,9 +1471,13 @@ static bool retraceAndTrim(common::OutFile &out, const FastForwardOptions& ffOpt
                 targetFrameOrLater = true;
             }
 
-
             // Until the target frame, output everything but skipped calls. After that, output everything.
-            if (targetFrameOrLater || !shouldSkip)
+            if (!targetFrameOrLater && shouldSkip)
+            {
+                continue;
+            }
+
+            if (callEnd == NULL)
             {
                 // Translate funcId for call to id in current sigbook.
                 unsigned short newId = common::gApiInfo.NameToId(funcName);
@@ -1418,7 +1498,7 @@ static bool retraceAndTrim(common::OutFile &out, const FastForwardOptions& ffOpt
                     memcpy(curScratch, src, common::gApiInfo.IdToLenArr[newId] - sizeof(common::BCall));
                     curScratch += common::gApiInfo.IdToLenArr[newId] - sizeof(common::BCall);
 
-                    out.Write(buffer.bufferPtr(), curScratch - buffer.bufferPtr());
+                    callEnd = curScratch;
                 }
                 else
                 {
@@ -1432,9 +1512,11 @@ static bool retraceAndTrim(common::OutFile &out, const FastForwardOptions& ffOpt
                     memcpy(curScratch, src, outBCall.toNext - sizeof(outBCall));
                     curScratch += outBCall.toNext - sizeof(outBCall);
 
-                    out.Write(buffer.bufferPtr(), curScratch - buffer.bufferPtr());
+                    callEnd = curScratch;
                 }
             }
+
+            out.WriteRaw(buffer.bufferPtr(), callEnd - buffer.bufferPtr());
         }
 
         // Call function
@@ -1460,7 +1542,10 @@ usage(const char *argv0)
         "\n"
         "  --input <input_trace> Target frame to fastforward [REQUIRED]\n"
         "  --output <output_file_name> Where to write fastforwarded trace file [REQUIRED]\n"
-        "  --targetFrame <target> The frame number that should be fastforwarded to [REQUIRED]\n"
+        "      Give it once per target, or only once to name the files <output_file_name>_<target>.pat\n"
+        "  --targetFrame <target>[-<end>][,...] The frame number that should be fastforwarded to [REQUIRED]\n"
+        "      Can be repeated, or be a list of frames. All fastforward traces are written in the same retrace.\n"
+        "      If an end frame is given, the fastforward trace ends after that frame.\n"
         "  --offscreen Run in offscreen mode\n"
         "  --noscreen Run in pbuffer output mode\n"
         "  --restoretex When generating a fastforward trace, inject commands to restore the contents of textures to what the would've been when retracing the original. (NOTE: EXPERIMENTAL FEATURE)\n"
@@ -1491,6 +1576,49 @@ static int readValidValue(const char* v)
     return val;
 }
 
+// Parse "<target>[-<end>][,<target>[-<end>]...]"
+static bool parseTargets(const char* v, std::vector<FastForwardTarget>& targets)
+{
+    std::stringstream ss(v);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        unsigned int endFrame = 0;
+        const size_t dash = item.find('-');
+        if (dash != std::string::npos)
+        {
+            endFrame = readValidValue(item.substr(dash + 1).c_str());
+            item = item.substr(0, dash);
+        }
+        const int targetFrame = readValidValue(item.c_str());
+        if (targetFrame < 1 || (endFrame != 0 && endFrame < (unsigned int)targetFrame))
+        {
+            DBG_LOG("error: invalid target frame range %s\n", v);
+            return false;
+        }
+        targets.push_back(FastForwardTarget(targetFrame, endFrame));
+    }
+    return true;
+}
+
+// "out.pat" -> "out_<target>.pat"
+static std::string targetFileName(const std::string& base, const FastForwardTarget& target)
+{
+    std::stringstream suffix;
+    suffix << "_" << target.mTargetFrame;
+    if (target.mEndFrame)
+    {
+        suffix << "-" << target.mEndFrame;
+    }
+
+    const size_t ext = base.rfind(".pat");
+    if (ext != std::string::npos && ext + 4 == base.size())
+    {
+        return base.substr(0, ext) + suffix.str() + ".pat";
+    }
+    return base + suffix.str();
+}
+
 static bool ParseCommandLine(int argc, char** argv, FastForwardOptions& ffOptions, CmdOptions& cmdOpts )
 {
     bool gotOutput = false;
@@ -1518,7 +1646,7 @@ static bool ParseCommandLine(int argc, char** argv, FastForwardOptions& ffOption
         }
         else if (!strcmp(arg, "--output"))
         {
-            ffOptions.mOutputFileName = argv[++i];
+            ffOptions.mOutputFileNames.push_back(argv[++i]);
             gotOutput = true;
         }
         else if (!strcmp(arg, "--comment"))
@@ -1527,7 +1655,10 @@ static bool ParseCommandLine(int argc, char** argv, FastForwardOptions& ffOption
         }
         else if (!strcmp(arg, "--targetFrame"))
         {
-            ffOptions.mTargetFrame = readValidValue(argv[++i]);
+            if (!parseTargets(argv[++i], ffOptions.mTargets))
+            {
+                return false;
+            }
             gotTargetFrame = true;
         }
         else if (!strcmp(arg, "--restoretex"))
@@ -1565,6 +1696,29 @@ static bool ParseCommandLine(int argc, char** argv, FastForwardOptions& ffOption
     }
 
     bool success = gotOutput && gotInput && gotTargetFrame;
+    if (success)
+    {
+        const std::vector<std::string>& names = ffOptions.mOutputFileNames;
+        if (names.size() == ffOptions.mTargets.size())
+        {
+            for (unsigned int i = 0; i < names.size(); ++i)
+            {
+                ffOptions.mTargets[i].mOutputFileName = names[i];
+            }
+        }
+        else if (names.size() == 1)
+        {
+            for (unsigned int i = 0; i < ffOptions.mTargets.size(); ++i)
+            {
+                ffOptions.mTargets[i].mOutputFileName = targetFileName(names[0], ffOptions.mTargets[i]);
+            }
+        }
+        else
+        {
+            DBG_LOG("error: got %u output file names for %u target frames\n", (unsigned int)names.size(), (unsigned int)ffOptions.mTargets.size());
+            success = false;
+        }
+    }
     if (!success)
     {
         usage(argv[0]);
@@ -1617,9 +1771,6 @@ int main(int argc, char** argv)
 
     // Prepare ffJson
     {
-        // Target frame
-        ffJson["originalFrame"] = ffOptions.mTargetFrame;
-
         // Misc.
         std::stringstream cmdlineSS;
         cmdlineSS << argv[0];
@@ -1643,29 +1794,42 @@ int main(int argc, char** argv)
         ffJson["versions"] = ffVersions;
     }
 
-    // Open output file
-    common::OutFile out(ffOptions.mOutputFileName.c_str());
-
+    // Open output files
+    std::list<FastForwardOutput> outputs;
+    for (unsigned int i = 0; i < ffOptions.mTargets.size(); ++i)
+    {
+        const FastForwardTarget& target = ffOptions.mTargets[i];
+        outputs.emplace_back(target, ffJson);
 
+        // Target frame
+        outputs.back().mFFJson["originalFrame"] = target.mTargetFrame;
+        if (target.mEndFrame)
+        {
+            outputs.back().mFFJson["originalEndFrame"] = target.mEndFrame;
+        }
+    }
 
-    // Do fastforwarding: pass ffJson in case we want to add anything
-    retraceAndTrim(out, ffOptions, ffJson);
+    // Do fastforwarding: the outputs' ffJson is passed in case we want to add anything
+    retraceAndTrim(outputs, ffOptions);
 
-    // Get existing header
-    Json::Value jsonRoot = gRetracer.mFile.getJSONHeader();
+    for (std::list<FastForwardOutput>::iterator it = outputs.begin(); it != outputs.end(); ++it)
+    {
+        // Get existing header
+        Json::Value jsonRoot = gRetracer.mFile.getJSONHeader();
 
-    // Add our conversion to the list
-    addConversionEntry(jsonRoot, "fastforward", cmdOptions.fileName, ffJson);
+        // Add our conversion to the list
+        addConversionEntry(jsonRoot, "fastforward", cmdOptions.fileName, it->mFFJson);
 
-    // Serialize header
-    Json::FastWriter writer;
-    std::string jsonData = writer.write(jsonRoot);
+        // Serialize header
+        Json::FastWriter writer;
+        std::string jsonData = writer.write(jsonRoot);
 
-    // Write header to file
-    out.WriteHeader(jsonData.c_str(), jsonData.length());
+        // Write header to file
+        it->mOut.WriteHeader(jsonData.c_str(), jsonData.length());
+        it->mOut.Close();
+    }
 
-    // Close and cleanup
-    out.Close();
+    // Cleanup
     GLWS::instance().Cleanup();
 
     return 0;
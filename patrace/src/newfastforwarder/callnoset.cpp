@@ -0,0 +1,218 @@
+#include <newfastforwarder/callnoset.hpp>
+#include <algorithm>
+
+size_t CallNoSet::Page::size() const
+{
+    if (!isBitmap())
+        return members.size();
+
+    size_t n = 0;
+    for (unsigned int i = 0; i < PAGE_WORDS; ++i)
+        n += __builtin_popcountll(bits[i]);
+    return n;
+}
+
+void CallNoSet::Page::toBitmap()
+{
+    bits.assign(PAGE_WORDS, 0);
+    for (size_t i = 0; i < members.size(); ++i)
+        bits[members[i] >> 6] |= 1ull << (members[i] & 63);
+    std::vector<uint16_t>().swap(members);
+}
+
+unsigned int CallNoSet::const_iterator::offset() const
+{
+    const Page& page = mPage->second;
+    return page.isBitmap() ? mPos : page.members[mPos];
+}
+
+void CallNoSet::const_iterator::next(unsigned int pos)
+{
+    while (mPage != mPages->end())
+    {
+        const Page& page = mPage->second;
+        if (!page.isBitmap())
+        {
+            if (pos < page.members.size())
+            {
+                mPos = pos;
+                return;
+            }
+        }
+        else
+        {
+            unsigned int word = pos >> 6;
+            if (word < PAGE_WORDS)
+            {
+                // Skip the bits before pos in the first word
+                uint64_t bits = page.bits[word] & (~0ull << (pos & 63));
+                while (bits == 0 && ++word < PAGE_WORDS)
+                    bits = page.bits[word];
+                if (bits)
+                {
+                    mPos = (word << 6) + __builtin_ctzll(bits);
+                    return;
+                }
+            }
+        }
+        ++mPage;
+        pos = 0;
+    }
+    mPos = 0;
+}
+
+bool CallNoSet::insert(unsigned int callNo)
+{
+    Page& page = mPages[callNo >> PAGE_BITS];
+    const uint16_t offset = callNo & (PAGE_SIZE - 1);
+
+    if (page.isBitmap())
+    {
+        uint64_t& word = page.bits[offset >> 6];
+        const uint64_t bit = 1ull << (offset & 63);
+        if (word & bit)
+            return false;
+        word |= bit;
+    }
+    else
+    {
+        // Call numbers are mostly inserted in ascending order
+        if (page.members.empty() || page.members.back() < offset)
+        {
+            page.members.push_back(offset);
+        }
+        else
+        {
+            std::vector<uint16_t>::iterator it = std::lower_bound(page.members.begin(), page.members.end(), offset);
+            if (*it == offset)
+                return false;
+            page.members.insert(it, offset);
+        }
+        if (page.members.size() > MAX_ARRAY_SIZE)
+            page.toBitmap();
+    }
+    mSize++;
+    return true;
+}
+
+void CallNoSet::insert(const CallNoSet& other)
+{
+    if (&other != this)
+        unite(other.mPages);
+}
+
+void CallNoSet::unite(const PageMap& pages)
+{
+    for (PageMap::const_iterator src = pages.begin(); src != pages.end(); ++src)
+    {
+        PageMap::iterator hint = mPages.lower_bound(src->first);
+        if (hint == mPages.end() || hint->first != src->first)
+        {
+            // Page not present yet, copy it as it is
+            hint = mPages.insert(hint, *src);
+            mSize += src->second.size();
+            continue;
+        }
+
+        Page& dst = hint->second;
+        const size_t before = dst.size();
+        if (dst.isBitmap() || src->second.isBitmap())
+        {
+            if (!dst.isBitmap())
+                dst.toBitmap();
+            if (src->second.isBitmap())
+            {
+                for (unsigned int i = 0; i < PAGE_WORDS; ++i)
+                    dst.bits[i] |= src->second.bits[i];
+            }
+            else
+            {
+                const std::vector<uint16_t>& members = src->second.members;
+                for (size_t i = 0; i < members.size(); ++i)
+                    dst.bits[members[i] >> 6] |= 1ull << (members[i] & 63);
+            }
+        }
+        else
+        {
+            std::vector<uint16_t> merged;
+            merged.reserve(dst.members.size() + src->second.members.size());
+            std::set_union(dst.members.begin(), dst.members.end(),
+                           src->second.members.begin(), src->second.members.end(),
+                           std::back_inserter(merged));
+            dst.members.swap(merged);
+            if (dst.members.size() > MAX_ARRAY_SIZE)
+                dst.toBitmap();
+        }
+        mSize += dst.size() - before;
+    }
+}
+
+void CallNoSet::insert(const_iterator first, const_iterator last)
+{
+    // A whole other set is merged page by page
+    if (first.mPages != NULL && first.mPages != &mPages && last.mPages == first.mPages
+        && last.mPage == first.mPages->end()
+        && first == const_iterator(first.mPages, first.mPages->begin(), 0))
+    {
+        unite(*first.mPages);
+        return;
+    }
+
+    for (; first != last; ++first)
+        insert(*first);
+}
+
+size_t CallNoSet::erase(unsigned int callNo)
+{
+    PageMap::iterator it = mPages.find(callNo >> PAGE_BITS);
+    if (it == mPages.end())
+        return 0;
+
+    Page& page = it->second;
+    const uint16_t offset = callNo & (PAGE_SIZE - 1);
+    if (page.isBitmap())
+    {
+        uint64_t& word = page.bits[offset >> 6];
+        const uint64_t bit = 1ull << (offset & 63);
+        if (!(word & bit))
+            return 0;
+        word &= ~bit;
+    }
+    else
+    {
+        std::vector<uint16_t>::iterator m = std::lower_bound(page.members.begin(), page.members.end(), offset);
+        if (m == page.members.end() || *m != offset)
+            return 0;
+        page.members.erase(m);
+    }
+    mSize--;
+    if (page.size() == 0)
+        mPages.erase(it);
+    return 1;
+}
+
+size_t CallNoSet::count(unsigned int callNo) const
+{
+    PageMap::const_iterator it = mPages.find(callNo >> PAGE_BITS);
+    if (it == mPages.end())
+        return 0;
+
+    const Page& page = it->second;
+    const uint16_t offset = callNo & (PAGE_SIZE - 1);
+    if (page.isBitmap())
+        return (page.bits[offset >> 6] >> (offset & 63)) & 1;
+    return std::binary_search(page.members.begin(), page.members.end(), offset) ? 1 : 0;
+}
+
+CallNoSet::const_iterator CallNoSet::find(unsigned int callNo) const
+{
+    if (!count(callNo))
+        return end();
+
+    PageMap::const_iterator it = mPages.find(callNo >> PAGE_BITS);
+    const Page& page = it->second;
+    const uint16_t offset = callNo & (PAGE_SIZE - 1);
+    if (page.isBitmap())
+        return const_iterator(&mPages, it, offset);
+    return const_iterator(&mPages, it, std::lower_bound(page.members.begin(), page.members.end(), offset) - page.members.begin());
+}
@@ -0,0 +1,136 @@
+#ifndef _CALLNOSET_HPP_
+#define _CALLNOSET_HPP_
+
+#include <map>
+#include <vector>
+#include <iterator>
+#include <stddef.h>
+#include <stdint.h>
+
+// A set of call numbers, stored as a compressed bitmap.
+//
+// Call numbers are grouped into pages of PAGE_SIZE consecutive numbers. A page
+// with few members keeps them in a sorted array, a fuller page is a bitmap.
+// Dependencies are mostly runs of nearby calls, so this takes a fraction of the
+// memory of a hash set, and union is done page by page without hashing.
+//
+// The interface follows std::set<unsigned int>, and iteration is in ascending order.
+class CallNoSet
+{
+public:
+    enum
+    {
+        PAGE_BITS = 12,
+        PAGE_SIZE = 1 << PAGE_BITS,
+        PAGE_WORDS = PAGE_SIZE / 64,
+        MAX_ARRAY_SIZE = PAGE_WORDS * 4, // array of uint16_t as large as the bitmap
+    };
+
+private:
+    struct Page
+    {
+        std::vector<uint16_t> members; // sorted, used while bits is empty
+        std::vector<uint64_t> bits;    // PAGE_WORDS words once the page is full enough
+
+        bool isBitmap() const { return !bits.empty(); }
+        size_t size() const;
+        void toBitmap();
+    };
+    typedef std::map<unsigned int, Page> PageMap;
+
+public:
+    class const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef unsigned int value_type;
+        typedef ptrdiff_t difference_type;
+        typedef const unsigned int* pointer;
+        typedef unsigned int reference;
+
+        const_iterator() : mPages(NULL), mPage(), mPos(0) {}
+
+        unsigned int operator*() const { return (mPage->first << PAGE_BITS) | offset(); }
+        const_iterator& operator++() { next(mPos + 1); return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; ++*this; return old; }
+        bool operator==(const const_iterator& other) const { return mPage == other.mPage && mPos == other.mPos; }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    private:
+        friend class CallNoSet;
+        typedef PageMap::const_iterator PageIterator;
+
+        const_iterator(const PageMap* pages, PageIterator page, unsigned int pos)
+            : mPages(pages), mPage(page), mPos(pos)
+        {
+            if (mPage != mPages->end())
+                next(mPos);
+        }
+
+        unsigned int offset() const;
+        // Move to the first member at position pos or later
+        void next(unsigned int pos);
+
+        const PageMap* mPages;
+        PageIterator mPage;
+        unsigned int mPos; // index in the array, or bit in the bitmap
+    };
+    typedef const_iterator iterator;
+
+    CallNoSet() : mPages(), mSize(0) {}
+
+    // Returns true if callNo was not in the set before
+    bool insert(unsigned int callNo);
+    template <class InputIterator>
+    void insert(InputIterator first, InputIterator last)
+    {
+        for (; first != last; ++first)
+            insert(*first);
+    }
+    // Union: add all members of other
+    void insert(const CallNoSet& other);
+    void insert(const_iterator first, const_iterator last);
+
+    // Returns the number of members removed
+    size_t erase(unsigned int callNo);
+
+    size_t count(unsigned int callNo) const;
+    const_iterator find(unsigned int callNo) const;
+
+    size_t size() const { return mSize; }
+    bool empty() const { return mSize == 0; }
+    void clear() { mPages.clear(); mSize = 0; }
+
+    const_iterator begin() const { return const_iterator(&mPages, mPages.begin(), 0); }
+    const_iterator end() const { return const_iterator(&mPages, mPages.end(), 0); }
+
+    // Visit the members as runs of consecutive call numbers in ascending order,
+    // calling visit(first, last) with both ends included.
+    template <class Visitor>
+    void forEachRun(Visitor visit) const
+    {
+        const_iterator it = begin();
+        if (it == end())
+            return;
+        unsigned int first = *it, last = first;
+        for (++it; it != end(); ++it)
+        {
+            const unsigned int callNo = *it;
+            if (callNo != last + 1)
+            {
+                visit(first, last);
+                first = callNo;
+            }
+            last = callNo;
+        }
+        visit(first, last);
+    }
+
+private:
+    void unite(const PageMap& pages);
+
+    PageMap mPages;
+    size_t mSize;
+};
+
+#endif
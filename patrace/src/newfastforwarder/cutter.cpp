@@ -1,3 +1,6 @@
+#include <utility>
+#include <vector>
+
 #include "common/out_file.hpp"
 #include <newfastforwarder/parser.hpp>
 
@@ -46,10 +49,14 @@ bool retraceAndTrim(common::OutFile &out, const CmdOptions& mOptions)
     //getline(inFile, str, '\n');
     //fileLine.str(str);
     //---------------------------
-    unsigned int judge;
-    std::set<unsigned int>::iterator set_iter = retracer.callNoListOut.begin();
-    if(*set_iter == 0)set_iter++;
-    judge=*set_iter;
+    // The kept calls as runs of consecutive call numbers in ascending order,
+    // run is the first one that does not end before the current call
+    std::vector<std::pair<unsigned int, unsigned int> > runs;
+    retracer.callNoListOut.forEachRun([&runs](unsigned int first, unsigned int last)
+    {
+        runs.push_back(std::make_pair(first, last));
+    });
+    size_t run = 0;
 
     for ( ;; retracer.IncCurCallId())
     {
@@ -76,22 +83,19 @@ bool retraceAndTrim(common::OutFile &out, const CmdOptions& mOptions)
             //--------------- for debug
             //fileLine.str("");
             //fileLine.clear();
-            if(retracer.mCurCallNo>=0)
             {
-                if(retracer.mCurCallNo!=judge)shouldSkip=true;
-                if(retracer.mCurCallNo == judge)
-                {
-                    shouldSkip=false;
-                    set_iter++;
-                    judge = *set_iter;
+                const unsigned int callNo = retracer.mCurCallNo;
+                while (run < runs.size() && runs[run].second < callNo)
+                    run++;
+                // Call 0 is never copied from the set
+                shouldSkip = callNo == 0 || run == runs.size() || callNo < runs[run].first;
 
-                    //for debug
-                    //getline(inFile, str, '\n');
-                    //outFile<<judge<<"    "<<retracer.mCurCallNo;
-                    //outFile<<funcName<<std::endl;
-                    //fileLine.str(str);
-                }
-            }//if
+                //for debug
+                //getline(inFile, str, '\n');
+                //outFile<<callNo<<"    "<<retracer.mCurCallNo;
+                //outFile<<funcName<<std::endl;
+                //fileLine.str(str);
+            }
 
             //Note: callNo will_vary_depending_on_the_content. This clip of code is to go to the specific draw for debugging
             //if(retracer.mCurCallNo <= callNo)
@@ -134,7 +138,7 @@ bool retraceAndTrim(common::OutFile &out, const CmdOptions& mOptions)
                     curScratch += sizeof(common::BCall);
                     memcpy(curScratch, src, common::gApiInfo.IdToLenArr[newId] - sizeof(common::BCall));
                     curScratch += common::gApiInfo.IdToLenArr[newId] - sizeof(common::BCall);
-                    out.Write(buffer.bufferPtr(), curScratch - buffer.bufferPtr());
+                    out.WriteRaw(buffer.bufferPtr(), curScratch - buffer.bufferPtr());
                 }
                 else
                 {
@@ -145,7 +149,7 @@ bool retraceAndTrim(common::OutFile &out, const CmdOptions& mOptions)
                     curScratch += sizeof(outBCall);
                     memcpy(curScratch, src, outBCall.toNext - sizeof(outBCall));
                     curScratch += outBCall.toNext - sizeof(outBCall);
-                    out.Write(buffer.bufferPtr(), curScratch - buffer.bufferPtr());
+                    out.WriteRaw(buffer.bufferPtr(), curScratch - buffer.bufferPtr());
                 }
             }
         }
@@ -28,20 +28,20 @@ preExecuteState::preExecuteState()
 const unsigned int CUBE_MAP_INDEX = 500000000;
 const unsigned int FIRST_10_BIT = 1000000000;
 
-unordered_set<unsigned int> & frameStoreState::queryTextureNoList(unsigned int textureIdx)
+CallNoSet & frameStoreState::queryTextureNoList(unsigned int textureIdx)
 {
     if(textureIdx >= CUBE_MAP_INDEX)//500000000+ for cube_map
     {
         cube_map_list.insert(textureIdx % CUBE_MAP_INDEX);
     }
 
-    map<unsigned int, unordered_set<unsigned int>>::iterator it = textureNoList.find(textureIdx);
+    map<unsigned int, CallNoSet>::iterator it = textureNoList.find(textureIdx);
 
     if(it == textureNoList.end())
     {
-        unordered_set<unsigned int> newTextureNo;
-        textureNoList.insert(pair<unsigned int, unordered_set<unsigned int>>(textureIdx, newTextureNo));
-        map<unsigned int, unordered_set<unsigned int>>::iterator it2 = textureNoList.find(textureIdx);
+        CallNoSet newTextureNo;
+        textureNoList.insert(pair<unsigned int, CallNoSet>(textureIdx, newTextureNo));
+        map<unsigned int, CallNoSet>::iterator it2 = textureNoList.find(textureIdx);
         return (it2->second);
     }
     else
@@ -51,19 +51,19 @@ unordered_set<unsigned int> & frameStoreState::queryTextureNoList(unsigned int t
 }
 
 
-unordered_set<unsigned int> & frameStoreState::queryTextureClearNoList(unsigned int textureIdx)
+CallNoSet & frameStoreState::queryTextureClearNoList(unsigned int textureIdx)
 {
     if(textureIdx >= CUBE_MAP_INDEX)//500000000+ for cube_map
     {
         cube_map_list.insert(textureIdx % CUBE_MAP_INDEX);
     }
 
-    map<unsigned int, unordered_set<unsigned int>>::iterator it = textureClearNoList.find(textureIdx);
+    map<unsigned int, CallNoSet>::iterator it = textureClearNoList.find(textureIdx);
     if(it == textureClearNoList.end())
     {
-        unordered_set<unsigned int> newTextureClearNo;
-        textureClearNoList.insert(pair<unsigned int, unordered_set<unsigned int>>(textureIdx, newTextureClearNo));
-        map<unsigned int, unordered_set<unsigned int>>::iterator it2 = textureClearNoList.find(textureIdx);
+        CallNoSet newTextureClearNo;
+        textureClearNoList.insert(pair<unsigned int, CallNoSet>(textureIdx, newTextureClearNo));
+        map<unsigned int, CallNoSet>::iterator it2 = textureClearNoList.find(textureIdx);
         return (it2->second);
     }
     else
@@ -72,7 +72,7 @@ unordered_set<unsigned int> & frameStoreState::queryTextureClearNoList(unsigned
     }
 }
 
-void frameStoreState::insertTextureListNo(vector<unsigned int> &textureIdx, unordered_set<unsigned int> &callNoList)
+void frameStoreState::insertTextureListNo(vector<unsigned int> &textureIdx, CallNoSet &callNoList)
 {
     sort(textureIdx.begin(), textureIdx.end());
     textureIdx.erase(unique(textureIdx.begin(), textureIdx.end()), textureIdx.end());
@@ -80,15 +80,15 @@ void frameStoreState::insertTextureListNo(vector<unsigned int> &textureIdx, unor
     long long start_time = os::getTime();
     for(unsigned int i=0; i<textureIdx.size(); i++)
     {
-        map<unsigned int, unordered_set<unsigned int>>::iterator it = textureNoList.find(textureIdx[i]);
+        map<unsigned int, CallNoSet>::iterator it = textureNoList.find(textureIdx[i]);
         if(it != textureNoList.end())
         {
-                callNoList.insert(it->second.begin(), it->second.end());
+                callNoList.insert(it->second);
         }
-            map<unsigned int, unordered_set<unsigned int>>::iterator it2 = textureClearNoList.find(textureIdx[i]);
+            map<unsigned int, CallNoSet>::iterator it2 = textureClearNoList.find(textureIdx[i]);
             if(it2 != textureClearNoList.end())
             {
-                callNoList.insert(it2->second.begin(), it2->second.end());
+                callNoList.insert(it2->second);
             }
             //  save for glFramebufferTexture2D GL_TEXTURE_CUBE_MAP
             set<unsigned int>::iterator it3 = cube_map_list.find(textureIdx[i]);
@@ -99,12 +99,12 @@ void frameStoreState::insertTextureListNo(vector<unsigned int> &textureIdx, unor
                 it = textureNoList.find(textureIdx[i]+j);
                 if(it != textureNoList.end())
                 {
-                    callNoList.insert(it->second.begin(), it->second.end());
+                    callNoList.insert(it->second);
                 }
                 it2 = textureClearNoList.find(textureIdx[i]+j);
                 if(it2 != textureClearNoList.end())
                 {
-                    callNoList.insert(it2->second.begin(), it2->second.end());
+                    callNoList.insert(it2->second);
                 }
             }//j cycle
         }//if cube map
@@ -117,12 +117,12 @@ void frameStoreState::insertTextureListNo(vector<unsigned int> &textureIdx, unor
 
 void frameStoreState::clearTextureNoList(unsigned int textureIdx)
 {
-    map<unsigned int, unordered_set<unsigned int>>::iterator it = textureNoList.find(textureIdx);
+    map<unsigned int, CallNoSet>::iterator it = textureNoList.find(textureIdx);
     if(it != textureNoList.end())
     {
         it->second.clear();
     }
-    map<unsigned int, unordered_set<unsigned int>>::iterator it2 = textureClearNoList.find(textureIdx);
+    map<unsigned int, CallNoSet>::iterator it2 = textureClearNoList.find(textureIdx);
     if(it2 != textureClearNoList.end())
     {
         it2->second.clear();
@@ -166,18 +166,18 @@ void frameStoreState::debug()
 
 //preExecute
 
-unordered_set<unsigned int> & preExecuteState::queryTextureNoList(unsigned int textureIdx)
+CallNoSet & preExecuteState::queryTextureNoList(unsigned int textureIdx)
 {
     if(textureIdx >= CUBE_MAP_INDEX)
     {
         cube_map_list.insert(textureIdx % CUBE_MAP_INDEX);
     }
-    map<unsigned int, unordered_set<unsigned int>>::iterator it = textureNoList.find(textureIdx);
+    map<unsigned int, CallNoSet>::iterator it = textureNoList.find(textureIdx);
     if(it == textureNoList.end())
     {
-        unordered_set<unsigned int> newTextureNo;
-        textureNoList.insert(pair<unsigned int, unordered_set<unsigned int>>(textureIdx, newTextureNo));
-        map<unsigned int, unordered_set<unsigned int>>::iterator it2 = textureNoList.find(textureIdx);
+        CallNoSet newTextureNo;
+        textureNoList.insert(pair<unsigned int, CallNoSet>(textureIdx, newTextureNo));
+        map<unsigned int, CallNoSet>::iterator it2 = textureNoList.find(textureIdx);
         return (it2->second);
     }
     else
@@ -217,14 +217,14 @@ void preExecuteState::debug()
 
 void preExecuteState::clearTextureNoList(unsigned int textureIdx)
 {
-    map<unsigned int, unordered_set<unsigned int>>::iterator it = textureNoList.find(textureIdx);
+    map<unsigned int, CallNoSet>::iterator it = textureNoList.find(textureIdx);
     if(it != textureNoList.end())
     {
         it->second.clear();
     }
 }
 
-void preExecuteState::insertTextureListNo(vector<unsigned int> &textureIdx, unordered_set<unsigned int> &callNoList)
+void preExecuteState::insertTextureListNo(vector<unsigned int> &textureIdx, CallNoSet &callNoList)
 {
     sort(textureIdx.begin(), textureIdx.end());
     textureIdx.erase(unique(textureIdx.begin(), textureIdx.end()), textureIdx.end());
@@ -233,10 +233,10 @@ void preExecuteState::insertTextureListNo(vector<unsigned int> &textureIdx, unor
     for(unsigned int i=0; i<textureIdx.size(); i++)
     {
         loopTime++;
-        map<unsigned int, unordered_set<unsigned int>>::iterator it = textureNoList.find(textureIdx[i]);
+        map<unsigned int, CallNoSet>::iterator it = textureNoList.find(textureIdx[i]);
         if(it != textureNoList.end())
         {
-            callNoList.insert(it->second.begin(), it->second.end());
+            callNoList.insert(it->second);
         }
         //  save for glFramebufferTexture2D GL_TEXTURE_CUBE_MAP
         set<unsigned int>::iterator it3 = cube_map_list.find(textureIdx[i]);
@@ -247,12 +247,7 @@ void preExecuteState::insertTextureListNo(vector<unsigned int> &textureIdx, unor
                 it = textureNoList.find(textureIdx[i]+j);
                 if(it != textureNoList.end())
                 {
-                    unordered_set<unsigned int>::iterator potr = it->second.begin();
-                    while(potr != it->second.end())
-                    {
-                        callNoList.insert(*potr);
-                        potr++;
-                    }
+                    callNoList.insert(it->second);
                 }
             }//j cycle
         }//if cube map
@@ -305,7 +300,7 @@ void preExecuteState::newInsertTextureListNo(vector<unsigned int> &textureIdx, u
 
 void preExecuteState::finalTextureNoListDraw()
 {
-    map<unsigned int, unordered_set<unsigned int>>::iterator it = textureNoList.find(0);
+    map<unsigned int, CallNoSet>::iterator it = textureNoList.find(0);
     finalTextureNoList.insert(it->second.begin(), it->second.end());
 }
 
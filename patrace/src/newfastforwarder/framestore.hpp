@@ -6,13 +6,15 @@
 #include <set>
 #include <unordered_set>
 
+#include "newfastforwarder/callnoset.hpp"
+
 class frameStoreState
 {
 public:
     frameStoreState();
-    std::unordered_set<unsigned int> & queryTextureNoList(unsigned int textureIdx);
-    std::unordered_set<unsigned int> & queryTextureClearNoList(unsigned int textureIdx);
-    void insertTextureListNo(std::vector<unsigned int> &textureIdx, std::unordered_set<unsigned int> &callNoList);
+    CallNoSet & queryTextureNoList(unsigned int textureIdx);
+    CallNoSet & queryTextureClearNoList(unsigned int textureIdx);
+    void insertTextureListNo(std::vector<unsigned int> &textureIdx, CallNoSet &callNoList);
     void clearTextureNoList(unsigned int index);
     void setEndDraw(bool index);
     bool readEndDraw();
@@ -21,8 +23,8 @@ public:
     void debug();
     void setEndReadFrameBuffer(bool index);
     bool readEndReadFrameBuffer();
-    std::map<unsigned int, std::unordered_set<unsigned int>> textureNoList;//
-    std::map<unsigned int, std::unordered_set<unsigned int>> textureClearNoList;//save glClear for every texture
+    std::map<unsigned int, CallNoSet> textureNoList;//
+    std::map<unsigned int, CallNoSet> textureClearNoList;//save glClear for every texture
     std::set<unsigned int> cube_map_list;
     bool endDraw;
     bool endDrawClear;
@@ -34,9 +36,9 @@ class preExecuteState
 {
 public:
     preExecuteState();
-    std::unordered_set<unsigned int> & queryTextureNoList(unsigned int textureIdx);
+    CallNoSet & queryTextureNoList(unsigned int textureIdx);
     std::unordered_set<unsigned long long> & newQueryTextureNoList(unsigned int textureIdx);
-    void insertTextureListNo(std::vector<unsigned int> &textureIdx, std::unordered_set<unsigned int> &callNoList);
+    void insertTextureListNo(std::vector<unsigned int> &textureIdx, CallNoSet &callNoList);
     void clearTextureNoList(unsigned int index);
     void finalTextureNoListDraw();
     void newFinalTextureNoListDraw();
@@ -45,7 +47,7 @@ public:
     void newInsertCallIntoList(bool clear, unsigned int drawTextureIdx);
     void test();
     void debug();
-    std::map<unsigned int, std::unordered_set<unsigned int>> textureNoList;//0 means no texture
+    std::map<unsigned int, CallNoSet> textureNoList;//0 means no texture
     std::set<unsigned int> finalTextureNoList;
     std::set<unsigned long long> newFinalTextureNoList;
     std::set<unsigned int>::iterator finalPotr;
@@ -299,7 +299,7 @@ unsigned int shaderState::getShaderType(unsigned int index)
     }
 }
 
-void shaderState::readCurShaderState(unsigned int index, unordered_set<unsigned int> &callNoList)
+void shaderState::readCurShaderState(unsigned int index, CallNoSet &callNoList)
 {
     map<unsigned int, shaderContext>::iterator it = allShaderList.find(index);
     callNoList.insert(it->second.glCreateShaderNo);
@@ -594,7 +594,7 @@ void programState::ff_glUniform_Types(unsigned int LocationIndex, unsigned int c
     }
 }
 
-void programState::readCurProgramState(unordered_set<unsigned int> &callNoList)///*vector<unsigned int> &clientSideBufferList, vector<unsigned int> &bufferList, */
+void programState::readCurProgramState(CallNoSet &callNoList)///*vector<unsigned int> &clientSideBufferList, vector<unsigned int> &bufferList, */
 {
     if(curProgramNo != 0)
     {
@@ -938,7 +938,7 @@ void textureState::ff_glSamplerParameter_Types(unsigned int index, unsigned int
 }
 
 //and glCompressedTexImage2D
-void textureState::ff_glTypes_TexImage2D(unsigned int TypeIndex, unsigned int GL_PIXEL_UNPACK_BUFFERNo, unsigned int callNo, unordered_set<unsigned int> &callNoList)
+void textureState::ff_glTypes_TexImage2D(unsigned int TypeIndex, unsigned int GL_PIXEL_UNPACK_BUFFERNo, unsigned int callNo, CallNoSet &callNoList)
 {
     map<unsigned int, textureContext>::iterator it = allTextureList.find(activeTextureNo[curActiveTextureIdx].curTextureIdx);
     textureContext::imageWithBinder curBinder = {callNo, activeTextureNo[curActiveTextureIdx].curTextureNo, activeTextureNo[curActiveTextureIdx].curActiveTextureNo, curActiveTextureNo, globalGlPixelStoreiNo.gl_pack_row_lengthNo,
@@ -950,9 +950,9 @@ void textureState::ff_glTypes_TexImage2D(unsigned int TypeIndex, unsigned int GL
     it->second.glTexImage2DNoList.insert(pair<unsigned int, textureContext::imageWithBinder>(it->second.glTexImage2DIdx, curBinder));
     if(GL_PIXEL_UNPACK_BUFFERNo != 0&&callNoList.size()!=0)
     {
-        unordered_set<unsigned int> newSet;
-        newSet.insert(callNoList.begin(), callNoList.end());
-        it->second.glTexImage2DGL_PIXEL_UNPACK_BUFFERList.insert(pair<unsigned int, unordered_set<unsigned int>>(it->second.glTexImage2DIdx, newSet));
+        CallNoSet newSet;
+        newSet.insert(callNoList);
+        it->second.glTexImage2DGL_PIXEL_UNPACK_BUFFERList.insert(pair<unsigned int, CallNoSet>(it->second.glTexImage2DIdx, newSet));
     }
 }
 
@@ -1025,7 +1025,7 @@ void textureState::ff_glActiveTexture(unsigned int TypeIndex, unsigned int callN
         }
 }
 
-void textureState::ff_glTypes_TexSubImage2D(unsigned int Typeindex, unsigned int GL_PIXEL_UNPACK_BUFFERNo, unsigned int callNo, unordered_set<unsigned int> &callNoList)
+void textureState::ff_glTypes_TexSubImage2D(unsigned int Typeindex, unsigned int GL_PIXEL_UNPACK_BUFFERNo, unsigned int callNo, CallNoSet &callNoList)
 {
     map<unsigned int, textureContext>::iterator it = allTextureList.find(activeTextureNo[curActiveTextureIdx].curTextureIdx);
     if(Typeindex == GL_TEXTURE_3D)
@@ -1047,9 +1047,9 @@ void textureState::ff_glTypes_TexSubImage2D(unsigned int Typeindex, unsigned int
         it->second.glTexSubImage2DNoList.insert(pair<unsigned int, textureContext::imageWithBinder>(it->second.glTexSubImage2DIdx, curBinder));
         if(GL_PIXEL_UNPACK_BUFFERNo != 0 && callNoList.size() != 0)
         {
-            unordered_set<unsigned int> newSet;
-            newSet.insert(callNoList.begin(), callNoList.end());
-            it->second.glTexSubImage2DGL_PIXEL_UNPACK_BUFFERList.insert(pair<unsigned int, unordered_set<unsigned int>>(it->second.glTexSubImage2DIdx, newSet));
+            CallNoSet newSet;
+            newSet.insert(callNoList);
+            it->second.glTexSubImage2DGL_PIXEL_UNPACK_BUFFERList.insert(pair<unsigned int, CallNoSet>(it->second.glTexSubImage2DIdx, newSet));
         }
     }//else
 }
@@ -1109,7 +1109,7 @@ void textureState::ff_glCopyImageSubData(unsigned int srcName, unsigned int dest
     }
 }
 
-void textureState::findTextureContext(vector<unsigned int> &textureList, unordered_set<unsigned int> &callNoList)
+void textureState::findTextureContext(vector<unsigned int> &textureList, CallNoSet &callNoList)
 {
     for(unsigned int i=0; i<textureList.size(); i++)
     {
@@ -1271,18 +1271,18 @@ void textureState::findTextureContext(vector<unsigned int> &textureList, unorder
                 callNoList.insert(potr->second.gl_texture_min_filterNo.activeCallNo2);
                 potr++;
             }
-            map<unsigned int, unordered_set<unsigned int>>::iterator potr2 = it->second.glTexImage2DGL_PIXEL_UNPACK_BUFFERList.begin();
+            map<unsigned int, CallNoSet>::iterator potr2 = it->second.glTexImage2DGL_PIXEL_UNPACK_BUFFERList.begin();
             while(potr2 != it->second.glTexImage2DGL_PIXEL_UNPACK_BUFFERList.end())
             {
-                callNoList.insert(potr2->second.begin(), potr2->second.end());
-                callNoList.insert(potr2->second.begin(), potr2->second.end());
+                callNoList.insert(potr2->second);
+                callNoList.insert(potr2->second);
                 potr2++;
             }
             potr2 = it->second.glTexSubImage2DGL_PIXEL_UNPACK_BUFFERList.begin();
             while(potr2 != it->second.glTexSubImage2DGL_PIXEL_UNPACK_BUFFERList.end())
             {
-                callNoList.insert(potr2->second.begin(), potr2->second.end());
-                callNoList.insert(potr2->second.begin(), potr2->second.end());
+                callNoList.insert(potr2->second);
+                callNoList.insert(potr2->second);
                 potr2++;
             }
 
@@ -1293,12 +1293,12 @@ void textureState::findTextureContext(vector<unsigned int> &textureList, unorder
                 potr3++;
             }
 
-            callNoList.insert(it->second.glCopyImageSubData_textureContextNoList.begin(), it->second.glCopyImageSubData_textureContextNoList.end());
+            callNoList.insert(it->second.glCopyImageSubData_textureContextNoList);
 
     }//for
 }
 /*
-void textureState::readCurTextureState(unordered_set<unsigned int> &callNoList)
+void textureState::readCurTextureState(CallNoSet &callNoList)
 {
     callNoList.insert(curActiveTextureNo);
     for(int i=0; i<MAX_ACTIVE_TEXTURE_NUM; i++)
@@ -1469,18 +1469,18 @@ void textureState::readCurTextureState(unordered_set<unsigned int> &callNoList)
                 callNoList.insert(potr->second.gl_texture_min_filterNo.activeCallNo2);
                 potr++;
             }
-            map<unsigned int, unordered_set<unsigned int>>::iterator potr2 = it->second.glTexImage2DGL_PIXEL_UNPACK_BUFFERList.begin();
+            map<unsigned int, CallNoSet>::iterator potr2 = it->second.glTexImage2DGL_PIXEL_UNPACK_BUFFERList.begin();
             while(potr2 != it->second.glTexImage2DGL_PIXEL_UNPACK_BUFFERList.end())
             {
-                callNoList.insert(potr2->second.begin(), potr2->second.end());
-                callNoList.insert(potr2->second.begin(), potr2->second.end());
+                callNoList.insert(potr2->second);
+                callNoList.insert(potr2->second);
                 potr2++;
             }
             potr2 = it->second.glTexSubImage2DGL_PIXEL_UNPACK_BUFFERList.begin();
             while(potr2 != it->second.glTexSubImage2DGL_PIXEL_UNPACK_BUFFERList.end())
             {
-                callNoList.insert(potr2->second.begin(), potr2->second.end());
-                callNoList.insert(potr2->second.begin(), potr2->second.end());
+                callNoList.insert(potr2->second);
+                callNoList.insert(potr2->second);
                 potr2++;
             }
         }//if
@@ -1488,7 +1488,7 @@ void textureState::readCurTextureState(unordered_set<unsigned int> &callNoList)
 }
 */
 
-void textureState::readCurTextureState(unordered_set<unsigned int> &callNoList, bool * callNoListJudge)
+void textureState::readCurTextureState(CallNoSet &callNoList, bool * callNoListJudge)
 {
     if(curActiveTextureNo != 0 && callNoListJudge[curActiveTextureNo] == false)
     {
@@ -2171,18 +2171,18 @@ void textureState::readCurTextureState(unordered_set<unsigned int> &callNoList,
                 }
                 potr++;
             }
-            map<unsigned int, unordered_set<unsigned int>>::iterator potr2 = it->second.glTexImage2DGL_PIXEL_UNPACK_BUFFERList.begin();
+            map<unsigned int, CallNoSet>::iterator potr2 = it->second.glTexImage2DGL_PIXEL_UNPACK_BUFFERList.begin();
             while(potr2 != it->second.glTexImage2DGL_PIXEL_UNPACK_BUFFERList.end())
             {
-                callNoList.insert(potr2->second.begin(), potr2->second.end());
-                //callNoList.insert(potr2->second.begin(), potr2->second.end());
+                callNoList.insert(potr2->second);
+                //callNoList.insert(potr2->second);
                 potr2++;
             }
             potr2 = it->second.glTexSubImage2DGL_PIXEL_UNPACK_BUFFERList.begin();
             while(potr2 != it->second.glTexSubImage2DGL_PIXEL_UNPACK_BUFFERList.end())
             {
-                callNoList.insert(potr2->second.begin(), potr2->second.end());
-                //callNoList.insert(potr2->second.begin(), potr2->second.end());
+                callNoList.insert(potr2->second);
+                //callNoList.insert(potr2->second);
                 potr2++;
             }
 
@@ -2193,7 +2193,7 @@ void textureState::readCurTextureState(unordered_set<unsigned int> &callNoList,
                 potr3++;
             }
 
-            callNoList.insert(it->second.glCopyImageSubData_textureContextNoList.begin(), it->second.glCopyImageSubData_textureContextNoList.end());
+            callNoList.insert(it->second.glCopyImageSubData_textureContextNoList);
 
         }//if
     }//for
@@ -2277,7 +2277,7 @@ void textureState::clear()
     globalGlPixelStoreiNo = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
 }
 
-void bufferState::readCurDeleteBuffers(unordered_set<unsigned int> &callNoList)
+void bufferState::readCurDeleteBuffers(CallNoSet &callNoList)
 {
     map<unsigned int, vector<unsigned>>::iterator it = GlobalDeleteIndexList.begin();
     while(it!=GlobalDeleteIndexList.end())
@@ -2293,8 +2293,7 @@ void bufferState::readCurDeleteBuffers(unordered_set<unsigned int> &callNoList)
             }
             for(unsigned int j=0; j<potr->second.size(); j++)
             {
-                unordered_set<unsigned int>::iterator judge = callNoList.find(potr->second[j]);
-                if(potr->second[j] < it->second[i] && judge != callNoList.end())
+                if(potr->second[j] < it->second[i] && callNoList.count(potr->second[j]))
                 {
                     printf("it->first  %d\n", it->first);
                     //callNoList.insert(it->second[i]);
@@ -2655,7 +2654,7 @@ unsigned int bufferState::getCurGL_PIXEL_UNPACK_BUFFERNo()
     return curGL_PIXEL_UNPACK_BUFFERNo;
 }
 
-void bufferState::readCurBufferState(unsigned int type, vector<unsigned int> &bufferList, unordered_set<unsigned int> &callNoList)
+void bufferState::readCurBufferState(unsigned int type, vector<unsigned int> &bufferList, CallNoSet &callNoList)
 {
     unsigned int firstOffset;
     unsigned int lastOffset;
@@ -2985,7 +2984,7 @@ void bufferState::readCurBufferState(unsigned int type, vector<unsigned int> &bu
     }
 }
 
-void bufferState::findABufferState(unsigned int index, unordered_set<unsigned int> &callNoList)
+void bufferState::findABufferState(unsigned int index, CallNoSet &callNoList)
 {
     unsigned int firstOffset;
     unsigned int lastOffset;
@@ -3617,7 +3616,7 @@ unsigned long long clientSideBufferState::findAClientSideBufferState(unsigned in
     }
 }
 
-void clientSideBufferState::readClientSideBufferState(vector<unsigned int> &clientSideBufferList, unordered_set<unsigned int> &callNoList)
+void clientSideBufferState::readClientSideBufferState(vector<unsigned int> &clientSideBufferList, CallNoSet &callNoList)
 {
     for(unsigned int i=0; i<clientSideBufferList.size(); i++)
     {
@@ -4080,7 +4079,7 @@ void globalState::ff_glDrawBuffers(unsigned int callNo)
     glDrawBuffersNo = callNo;
 }
 
-void globalState::readCurGlobalStateForFrameBufferClear(unordered_set<unsigned int> &callNoList)
+void globalState::readCurGlobalStateForFrameBufferClear(CallNoSet &callNoList)
 {
     callNoList.insert(glClearNo.gl_color_buffer_bitNo);
     callNoList.insert(glClearNo.gl_color_buffer_bitBinderNo);
@@ -4103,7 +4102,7 @@ void globalState::readCurGlobalStateForFrameBufferClear(unordered_set<unsigned i
     callNoList.insert(glEnableNo.gl_scissor_testNo);
 }
 
-void globalState::readCurGlobalState(vector<unsigned int> &clientSideBufferList, vector<unsigned int> &bufferList, unordered_set<unsigned int> &callNoList, bool framebuffer)
+void globalState::readCurGlobalState(vector<unsigned int> &clientSideBufferList, vector<unsigned int> &bufferList, CallNoSet &callNoList, bool framebuffer)
 {
     callNoList.insert(glFrontFaceNo);
     callNoList.insert(glEnableNo.gl_blendNo);
@@ -4286,7 +4285,7 @@ void eglState::ff_eglDestroySurface(unsigned int callNo)
     eglDestroySurfaceNoList.push_back(callNo);
 }
 
-void eglState::readCurEglState(unordered_set<unsigned int> &callNoList)
+void eglState::readCurEglState(CallNoSet &callNoList)
 {
     for(unsigned int i=0; i<eglCreateContextNoList.size(); i++)
     {
@@ -4344,7 +4343,7 @@ void renderBufferState::ff_glRenderbufferStorage(unsigned int callNo)
     it->second.glRenderbufferStorageNo.thisCallNo = callNo;
 }
 
-void renderBufferState::readCurRenderBufferState(unsigned int index, unordered_set<unsigned int> &callNoList)
+void renderBufferState::readCurRenderBufferState(unsigned int index, CallNoSet &callNoList)
 {
     map<unsigned int, renderBufferContext>::iterator it = allRenderBufferList.find(index);
     callNoList.insert(it->second.glGenRenderbuffersNo);
@@ -4591,7 +4590,7 @@ void frameBufferState::ff_glFramebufferRenderbuffer(unsigned int type, unsigned
     }
 }
 
-void frameBufferState::ff_glDeleteFramebuffers(unsigned int n, unsigned int index[], unsigned int callNo, std::unordered_set<unsigned int> &callNoList)
+void frameBufferState::ff_glDeleteFramebuffers(unsigned int n, unsigned int index[], unsigned int callNo, CallNoSet &callNoList)
 {
     for(unsigned int i =0; i<n; i++)
     {
@@ -4670,7 +4669,7 @@ void frameBufferState::clearBlitFramebuffer()
     it->second.glBlitFramebufferNoList.clear();
 }
 
-void frameBufferState::readCurFrameBufferState(vector<unsigned int> &textureList, unordered_set<unsigned int> &callNoList)
+void frameBufferState::readCurFrameBufferState(vector<unsigned int> &textureList, CallNoSet &callNoList)
 {
     map<unsigned int, frameBufferContext>::iterator it;
     list<frameBufferContext::glBlitFramebufferState>::iterator potr;
@@ -4977,7 +4976,7 @@ void frameBufferState::clear()
 }
 
 //indices for some draws have indices
-void contextState::readAllState(unsigned int frameNo, unsigned int drawType, unsigned int indices, unordered_set<unsigned int> &callNoList, bool * callNoListJudge)
+void contextState::readAllState(unsigned int frameNo, unsigned int drawType, unsigned int indices, CallNoSet &callNoList, bool * callNoListJudge)
 {
     long long start_time = os::getTime();
     vector<unsigned int> clientSideBufferList;
@@ -4998,7 +4997,7 @@ void contextState::readAllState(unsigned int frameNo, unsigned int drawType, uns
     retracer::gRetracer.timeCount = retracer::gRetracer.timeCount +duration;
 }
 
-void contextState::readStateForDispatchCompute(unordered_set<unsigned int> &callNoList, bool * callNoListJudge)
+void contextState::readStateForDispatchCompute(CallNoSet &callNoList, bool * callNoListJudge)
 {
     curProgramState.readCurProgramState(callNoList);///*clientSideBufferList, bufferList, */
     curTextureState.readCurTextureState(callNoList, callNoListJudge);
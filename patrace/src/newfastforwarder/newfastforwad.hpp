@@ -9,6 +9,8 @@
 #include <set>
 #include <unordered_set>
 
+#include "newfastforwarder/callnoset.hpp"
+
 namespace newfastforwad {
 
 class shaderContext;
@@ -32,7 +34,7 @@ public:
     //----------
     //internal
     unsigned int getShaderType(unsigned int index);
-    void readCurShaderState(unsigned int index, std::unordered_set<unsigned int> &callNoList);
+    void readCurShaderState(unsigned int index, CallNoSet &callNoList);
     void clear();
     //  std::map<unsigned int,shaderContext> allShaderList;
     //private:
@@ -73,7 +75,7 @@ public:
     //internal...
     void clear();
     shaderState curShaderState;
-    void readCurProgramState(std::unordered_set<unsigned int> &callNoList);///*std::vector<unsigned int> &clientSideBufferList,std::vector<unsigned int> &bufferList,*/
+    void readCurProgramState(CallNoSet &callNoList);///*std::vector<unsigned int> &clientSideBufferList,std::vector<unsigned int> &bufferList,*/
 private:
     unsigned int curProgramIdx;
     unsigned int curProgramNo;
@@ -166,10 +168,10 @@ public:
     void ff_glGenTextures(unsigned int size, unsigned int index[], unsigned int callNo);
     void ff_glBindTexture(unsigned int index, unsigned int type, unsigned int callNo);
     void ff_glTexParameter_Types(unsigned int Typeindex, unsigned int type, unsigned int callNo);
-    void ff_glTypes_TexImage2D(unsigned int Typeindex, unsigned int GL_PIXEL_UNPACK_BUFFERNo, unsigned int callNo, std::unordered_set<unsigned int> & callNoList);
+    void ff_glTypes_TexImage2D(unsigned int Typeindex, unsigned int GL_PIXEL_UNPACK_BUFFERNo, unsigned int callNo, CallNoSet & callNoList);
     void ff_glPixelStorei(unsigned int Typeindex, unsigned int param, unsigned int callNo);
     void ff_glActiveTexture(unsigned int TypeIndex, unsigned int callNo);
-    void ff_glTypes_TexSubImage2D(unsigned int Typeindex, unsigned int GL_PIXEL_UNPACK_BUFFERNo, unsigned int callNo, std::unordered_set<unsigned int> & callNoList);
+    void ff_glTypes_TexSubImage2D(unsigned int Typeindex, unsigned int GL_PIXEL_UNPACK_BUFFERNo, unsigned int callNo, CallNoSet & callNoList);
     void ff_glGenerateMipmap(unsigned int callNo);
     void ff_glBindImageTexture(unsigned int unit, unsigned int index, unsigned int access, unsigned int callNo);
     void ff_glBindSampler(unsigned int unit, unsigned int index, unsigned int callNo);
@@ -177,8 +179,8 @@ public:
     void ff_glSamplerParameter_Types(unsigned int index, unsigned int type, unsigned int callNo);
     void ff_glCopyImageSubData(unsigned int srcName, unsigned int destName, unsigned int callNo);
     //internal...
-    void readCurTextureState(std::unordered_set<unsigned int> &callNoList, bool * callNoListJudge);
-    void findTextureContext(std::vector<unsigned int> &textureList, std::unordered_set<unsigned int> & callNoList);
+    void readCurTextureState(CallNoSet &callNoList, bool * callNoListJudge);
+    void findTextureContext(std::vector<unsigned int> &textureList, CallNoSet & callNoList);
     void readCurTextureIdx(std::vector<unsigned int> &textureList);
     unsigned int readCurTextureNIdx(unsigned int n);
     void clear();
@@ -294,10 +296,10 @@ public:
     };
     std::map<unsigned int, imageWithBinder> glTexImage2DNoList;
     unsigned int glTexImage2DIdx;
-    std::map<unsigned int, std::unordered_set<unsigned int>> glTexImage2DGL_PIXEL_UNPACK_BUFFERList;
+    std::map<unsigned int, CallNoSet> glTexImage2DGL_PIXEL_UNPACK_BUFFERList;
     std::map<unsigned int, imageWithBinder> glTexSubImage2DNoList;
     unsigned int glTexSubImage2DIdx;
-    std::map<unsigned int, std::unordered_set<unsigned int>> glTexSubImage2DGL_PIXEL_UNPACK_BUFFERList;
+    std::map<unsigned int, CallNoSet> glTexSubImage2DGL_PIXEL_UNPACK_BUFFERList;
     withBinderForGenerate glGenerateMipmapNo;
     struct withBinderSampler
     {
@@ -309,7 +311,7 @@ public:
     withBinderSampler glBindSamplerNo[32];//max sampler num is 32
 
     std::list<unsigned int> glCopyImageSubDataNoList;
-    std::unordered_set<unsigned int> glCopyImageSubData_textureContextNoList;
+    CallNoSet glCopyImageSubData_textureContextNoList;
 
 };
 
@@ -359,9 +361,9 @@ public:
     unsigned int getCurGL_PIXEL_UNPACK_BUFFERIdx();
     unsigned int getCurGL_PIXEL_UNPACK_BUFFERNo();
     unsigned int getVAOindex();
-    void readCurBufferState(unsigned int type, std::vector<unsigned int> &bufferList, std::unordered_set<unsigned int> &callNoList);
-    void findABufferState(unsigned int index, std::unordered_set<unsigned int> &callNoList);
-    void readCurDeleteBuffers(std::unordered_set<unsigned int> &callNoList);
+    void readCurBufferState(unsigned int type, std::vector<unsigned int> &bufferList, CallNoSet &callNoList);
+    void findABufferState(unsigned int index, CallNoSet &callNoList);
+    void readCurDeleteBuffers(CallNoSet &callNoList);
     void clear();
     void debug(unsigned int callNo);
     struct mapBufferWithBinder
@@ -493,7 +495,7 @@ class clientSideBufferState
 public:
     clientSideBufferState();
     void ff_glClientSideBufferData(unsigned int index, unsigned int callNo);
-    void readClientSideBufferState(std::vector<unsigned int> &clientSideBufferList, std::unordered_set<unsigned int> &callNoList);
+    void readClientSideBufferState(std::vector<unsigned int> &clientSideBufferList, CallNoSet &callNoList);
     void clear();
     unsigned long long findAClientSideBufferState(unsigned int name);
     std::map<unsigned int, unsigned long long>* glClientSideBuffDataNoList;
@@ -541,8 +543,8 @@ public:
     void ff_glVertexAttribDivisor(unsigned int LocationIndex, unsigned int callNo);
     void ff_glPatchParameteri(unsigned int callNo);
     //internal...
-    void readCurGlobalState(std::vector<unsigned int> &clientSideBufferList, std::vector<unsigned int> &bufferList, std::unordered_set<unsigned int> &callNoList, bool framebuffer);
-    void readCurGlobalStateForFrameBufferClear(std::unordered_set<unsigned int> &callNoList);
+    void readCurGlobalState(std::vector<unsigned int> &clientSideBufferList, std::vector<unsigned int> &bufferList, CallNoSet &callNoList, bool framebuffer);
+    void readCurGlobalStateForFrameBufferClear(CallNoSet &callNoList);
     void clear();
     void debug(unsigned int callNo);
     bool TransformFeedbackSwitch;
@@ -669,7 +671,7 @@ public:
     void ff_eglMakeCurrent(unsigned int callNo);
     void ff_eglDestroySurface(unsigned int callNo);
     //internal...
-    void readCurEglState(std::unordered_set<unsigned int> &callNoList);
+    void readCurEglState(CallNoSet &callNoList);
     void clear();
 private:
     std::vector<unsigned int> eglCreateContextNoList;
@@ -686,7 +688,7 @@ public:
     void ff_glBindRenderbuffer(unsigned int index, unsigned int callNo);
     void ff_glRenderbufferStorage(unsigned int callNo);
     //internal...
-    void readCurRenderBufferState(unsigned int index, std::unordered_set<unsigned int> &callNoList);
+    void readCurRenderBufferState(unsigned int index, CallNoSet &callNoList);
     void clear();
 private:
     unsigned int curRenderBufferIdx;
@@ -715,10 +717,10 @@ public:
     void ff_glBindFramebuffer(unsigned int index, unsigned int type, unsigned int callNo);
     void ff_glFramebufferTexture2D(unsigned int type, unsigned int attachment, unsigned int textarget, unsigned int index, unsigned int callNo);
     void ff_glFramebufferRenderbuffer(unsigned int type, unsigned int attachment, unsigned int index, unsigned int callNo);
-    void ff_glDeleteFramebuffers(unsigned int n, unsigned int index[], unsigned int callNo, std::unordered_set<unsigned int> &callNoList);
+    void ff_glDeleteFramebuffers(unsigned int n, unsigned int index[], unsigned int callNo, CallNoSet &callNoList);
     void ff_glBlitFramebuffer(unsigned int callNo);
     void ff_glDrawBuffers(unsigned int callNo);
-    void readCurFrameBufferState(std::vector<unsigned int> &textureList, std::unordered_set<unsigned int> &callNoList);
+    void readCurFrameBufferState(std::vector<unsigned int> &textureList, CallNoSet &callNoList);
     bool isBindFrameBuffer();
     bool isBindReadFrameBuffer();
     unsigned int getDrawTextureIdx();
@@ -796,8 +798,8 @@ public:
     bufferState                curBufferState;
     frameBufferState           curFrameBufferState;
     clientSideBufferState      curClientSideBufferState;
-    void readAllState(unsigned int frameNo, unsigned int drawType, unsigned int indices, std::unordered_set<unsigned int> &callNoList, bool * callNoListJudge);
-    void readStateForDispatchCompute(std::unordered_set<unsigned int> &callNoList, bool * callNoListJudge);
+    void readAllState(unsigned int frameNo, unsigned int drawType, unsigned int indices, CallNoSet &callNoList, bool * callNoListJudge);
+    void readStateForDispatchCompute(CallNoSet &callNoList, bool * callNoListJudge);
     void clear();
     int share_context;
 };
@@ -161,21 +161,21 @@ static void retrace_glBindFramebuffer(char* _src)
         if(gRetracer.curFrameStoreState.readEndReadFrameBuffer()==true && gRetracer.curContextState->curFrameBufferState.isBindReadFrameBuffer()==true && framebuffer ==0 && readBuffer == true)
         {
             int drawTextureIdx = gRetracer.curContextState->curFrameBufferState.getReadTextureIdx();
-            std::unordered_set<unsigned int> &textureNoList = gRetracer.curFrameStoreState.queryTextureNoList(drawTextureIdx);
+            CallNoSet &textureNoList = gRetracer.curFrameStoreState.queryTextureNoList(drawTextureIdx);
             textureNoList.insert(gRetracer.mCurCallNo);
             gRetracer.curFrameStoreState.setEndReadFrameBuffer(false);
         }
         if(gRetracer.curFrameStoreState.readEndDraw()==true && gRetracer.curContextState->curFrameBufferState.isBindFrameBuffer()==true && framebuffer ==0 && readBuffer == false)
         {
             int drawTextureIdx = gRetracer.curContextState->curFrameBufferState.getDrawTextureIdx();
-            std::unordered_set<unsigned int> &textureNoList = gRetracer.curFrameStoreState.queryTextureNoList(drawTextureIdx);
+            CallNoSet &textureNoList = gRetracer.curFrameStoreState.queryTextureNoList(drawTextureIdx);
             textureNoList.insert(gRetracer.mCurCallNo);
             gRetracer.curFrameStoreState.setEndDraw(false);
         }
         if(gRetracer.curFrameStoreState.readEndDrawClear()==true && gRetracer.curContextState->curFrameBufferState.isBindFrameBuffer()==true && framebuffer ==0 && readBuffer == false)
         {
             int drawTextureIdx = gRetracer.curContextState->curFrameBufferState.getDrawTextureIdx();
-            std::unordered_set<unsigned int> &textureNoList = gRetracer.curFrameStoreState.queryTextureClearNoList(drawTextureIdx);
+            CallNoSet &textureNoList = gRetracer.curFrameStoreState.queryTextureClearNoList(drawTextureIdx);
             textureNoList.insert(gRetracer.mCurCallNo);
             gRetracer.curFrameStoreState.setEndDrawClear(false);
         }
@@ -652,7 +652,7 @@ static void retrace_glCompressedTexImage2D(char* _src)
     // ---------- register handles ------------
 
     //for fastforwad
-    std::unordered_set<unsigned int> newList;
+    CallNoSet newList;
     unsigned int GL_PIXEL_UNPACK_BUFFERNo = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERNo();
     unsigned int GL_PIXEL_UNPACK_BUFFERIdx = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERIdx();
     if(GL_PIXEL_UNPACK_BUFFERIdx!=0)
@@ -727,7 +727,7 @@ static void retrace_glCompressedTexSubImage2D(char* _src)
     // ------------- retrace ------------------
     //   glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
     // ---------- register handles ------------
-    std::unordered_set<unsigned int> newList;
+    CallNoSet newList;
     unsigned int GL_PIXEL_UNPACK_BUFFERNo = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERNo();
     unsigned int GL_PIXEL_UNPACK_BUFFERIdx = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERIdx();
     if(GL_PIXEL_UNPACK_BUFFERIdx!=0)
@@ -2127,7 +2127,7 @@ static void retrace_glTexImage2D(char* _src)
     // ---------- register handles ------------
 
     //for fastforwad
-    std::unordered_set<unsigned int> newList;
+    CallNoSet newList;
     unsigned int GL_PIXEL_UNPACK_BUFFERNo = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERNo();
     unsigned int GL_PIXEL_UNPACK_BUFFERIdx = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERIdx();
     if(GL_PIXEL_UNPACK_BUFFERIdx!=0)
@@ -2276,7 +2276,7 @@ static void retrace_glTexSubImage2D(char* _src)
 
 
     //for fastforwad
-    std::unordered_set<unsigned int> newList;
+    CallNoSet newList;
     unsigned int GL_PIXEL_UNPACK_BUFFERNo = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERNo();
     unsigned int GL_PIXEL_UNPACK_BUFFERIdx = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERIdx();
     if(GL_PIXEL_UNPACK_BUFFERIdx!=0)
@@ -5389,7 +5389,7 @@ static void retrace_glTexImage3DOES(char* _src)
     //   glTexImage3DOES(target, level, internalformat, width, height, depth, border, format, type, pixels);
     // ---------- register handles ------------
 
-    std::unordered_set<unsigned int> newList;
+    CallNoSet newList;
     unsigned int GL_PIXEL_UNPACK_BUFFERNo = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERNo();
     unsigned int GL_PIXEL_UNPACK_BUFFERIdx = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERIdx();
     if(GL_PIXEL_UNPACK_BUFFERIdx!=0)
@@ -5458,7 +5458,7 @@ static void retrace_glTexSubImage3DOES(char* _src)
     //   glTexSubImage3DOES(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
     // ---------- register handles ------------
 
-    std::unordered_set<unsigned int> newList;
+    CallNoSet newList;
     unsigned int GL_PIXEL_UNPACK_BUFFERNo = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERNo();
     unsigned int GL_PIXEL_UNPACK_BUFFERIdx = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERIdx();
     if(GL_PIXEL_UNPACK_BUFFERIdx!=0)
@@ -5564,7 +5564,7 @@ static void retrace_glCompressedTexImage3DOES(char* _src)
     //   glCompressedTexImage3DOES(target, level, internalformat, width, height, depth, border, imageSize, data);
     // ---------- register handles ------------
 
-    std::unordered_set<unsigned int> newList;
+    CallNoSet newList;
     unsigned int GL_PIXEL_UNPACK_BUFFERNo = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERNo();
     unsigned int GL_PIXEL_UNPACK_BUFFERIdx = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERIdx();
     if(GL_PIXEL_UNPACK_BUFFERIdx!=0)
@@ -6507,7 +6507,7 @@ static void retrace_glCopyClientSideBuffer(char* _src)
     //   glCopyClientSideBuffer(target, name);
     // ---------- register handles ------------
     /*
-    std::unordered_set<unsigned int> newList;
+    CallNoSet newList;
     unsigned int binderNo = 0;
     unsigned int binderIdx = 0;
 
@@ -8468,7 +8468,7 @@ static void retrace_glTexStorage2DEXT(char* _src)
     // ------------- retrace ------------------
     //   glTexStorage2DEXT(target, levels, internalformat, width, height);
     // ---------- register handles ------------
-    std::unordered_set<unsigned int> newList;
+    CallNoSet newList;
 
     gRetracer.curContextState->curTextureState.ff_glTypes_TexImage2D(target, 0, gRetracer.mCurCallNo, newList);
 }
@@ -8497,7 +8497,7 @@ static void retrace_glTexStorage3DEXT(char* _src)
     //   glTexStorage3DEXT(target, levels, internalformat, width, height, depth);
     // ---------- register handles ------------
 
-    std::unordered_set<unsigned int> newList;
+    CallNoSet newList;
     gRetracer.curContextState->curTextureState.ff_glTypes_TexImage2D(target, 0, gRetracer.mCurCallNo, newList);
 }
 
@@ -9466,7 +9466,7 @@ static void retrace_glCompressedTexSubImage3D(char* _src)
     //   glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
     // ---------- register handles ------------
 
-    std::unordered_set<unsigned int> newList;
+    CallNoSet newList;
     unsigned int GL_PIXEL_UNPACK_BUFFERNo = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERNo();
     unsigned int GL_PIXEL_UNPACK_BUFFERIdx = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERIdx();
     if(GL_PIXEL_UNPACK_BUFFERIdx != 0)
@@ -11937,7 +11937,7 @@ static void retrace_glTexStorage2D(char* _src)
     // ------------- retrace ------------------
     //   glTexStorage2D(target, levels, internalformat, width, height);
     // ---------- register handles ------------
-    std::unordered_set<unsigned int> newList;
+    CallNoSet newList;
 
     gRetracer.curContextState->curTextureState.ff_glTypes_TexImage2D(target, 0, gRetracer.mCurCallNo, newList);
 }
@@ -11990,7 +11990,7 @@ static void retrace_glTexStorage3D(char* _src)
     // ------------- retrace ------------------
     //  glTexStorage3D(target, levels, internalformat, width, height, depth);
     // ---------- register handles ------------
-    std::unordered_set<unsigned int> newList;
+    CallNoSet newList;
 
     gRetracer.curContextState->curTextureState.ff_glTypes_TexImage2D(target, 0, gRetracer.mCurCallNo, newList);
 }
@@ -12051,7 +12051,7 @@ static void retrace_glTexSubImage3D(char* _src)
     //  glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
     // ---------- register handles ------------
 
-    std::unordered_set<unsigned int> newList;
+    CallNoSet newList;
     unsigned int GL_PIXEL_UNPACK_BUFFERNo = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERNo();
     unsigned int GL_PIXEL_UNPACK_BUFFERIdx = gRetracer.curContextState->curBufferState.getCurGL_PIXEL_UNPACK_BUFFERIdx();
     if(GL_PIXEL_UNPACK_BUFFERIdx!=0)
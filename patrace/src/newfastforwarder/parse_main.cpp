@@ -185,12 +185,7 @@ int main(int argc, char** argv)
     //printf("time 1.2 = %f\n", gRetracer.curFrameStoreState.timeCount);
 
     //cutter.......
-    std::unordered_set<unsigned int>::iterator set_iter = gRetracer.callNoList.begin();
-    while(set_iter != gRetracer.callNoList.end())
-    {
-        gRetracer.callNoListOut.insert(*set_iter);
-        set_iter++;
-    }
+    gRetracer.callNoListOut.insert(gRetracer.callNoList);
 
     printf("callNoList size  %ld\n", (long)gRetracer.callNoList.size());
 
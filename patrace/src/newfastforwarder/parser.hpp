@@ -89,9 +89,9 @@ public:
     newfastforwad::contextState defaultContextState;
     bool defaultContextJudge;
     std::map<int, newfastforwad::contextState> multiThreadContextState;
-    std::unordered_set<unsigned int> callNoList;
+    CallNoSet callNoList;
     bool * callNoListJudge = new bool[100000000];//max API number
-    std::set<unsigned int> callNoListOut;
+    CallNoSet callNoListOut;
     frameStoreState curFrameStoreState;
     float               timeCount;
     bool                preExecute;
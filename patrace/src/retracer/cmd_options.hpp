@@ -20,6 +20,8 @@ struct CmdOptions
     bool stepMode = false;
     common::CallSet* snapshotCallSet = nullptr;
     bool snapshotFrameNames = false;
+    int snapshotThreads = -1;
+    int pngLevel = -1;
     int beginMeasureFrame = -1;
     int endMeasureFrame = -1;
     bool preload = false;
@@ -23,6 +23,8 @@ usage(const char *argv0) {
         "\n"
         "  -tid THREADID the function calls invoked by thread <THREADID> will be retraced\n"
         "  -s CALL_SET take snapshot for the calls in the specific call set\n"
+        "  -snapshotthreads THREADS number of threads compressing snapshots in the background, 0 to write them on the retrace thread (default 2)\n"
+        "  -pnglevel LEVEL compression of the snapshots, from 0 (none, fastest) to 9 (smallest) (default 1)\n"
         "  -step use F1-F4 to step forward frame by frame, F5-F8 to step forward draw call by draw call (only supported on desktop linux)\n"
         "  -ores W H override resolution of onscreen rendering (FBO's are not affected)\n"
         "  -msaa SAMPLES enable multi sample anti alias\n"
@@ -132,6 +134,10 @@ bool ParseCommandLine(int argc, char** argv, CmdOptions& cmdOpts)
             cmdOpts.perfFreq = readValidValue(argv[++i]);
         } else if (!strcmp(arg, "-s")) {
             cmdOpts.snapshotCallSet = new common::CallSet(argv[++i]);
+        } else if (!strcmp(arg, "-snapshotthreads")) {
+            cmdOpts.snapshotThreads = readValidValue(argv[++i]);
+        } else if (!strcmp(arg, "-pnglevel")) {
+            cmdOpts.pngLevel = readValidValue(argv[++i]);
         } else if (!strcmp(arg, "-framenamesnaps")) {
             cmdOpts.snapshotFrameNames = true;
         } else if (!strcmp(arg, "-step")) {
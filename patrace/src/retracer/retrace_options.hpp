@@ -59,6 +59,8 @@ struct RetraceOptions
     bool                mMeasureSwapTime = false;
     Profile             mApiVersion = PROFILE_ES2;
     bool                mSnapshotFrameNames = false;
+    unsigned int        mSnapshotThreads = 2; // 0 writes snapshots on the retrace thread
+    int                 mPngLevel = 1; // zlib level of the snapshots
 
     bool                mStrictEGLMode = false;
     bool                mStrictColorMode = false;
@@ -243,6 +243,103 @@ void StepWork::run()
     gRetracer.StepShot(getCallID(), getFrameID());
 }
 
+SnapshotWriter::SnapshotWriter(const unsigned int& threads, std::vector<std::string>& uploads)
+    : mThreadCount(threads)
+    , mUploads(uploads)
+{
+}
+
+SnapshotWriter::~SnapshotWriter()
+{
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mWorkCond.notify_all();
+    for (std::thread& thread : mThreads)
+    {
+        thread.join();
+    }
+}
+
+void SnapshotWriter::write(image::Image* image, const std::string& filename, unsigned callNo, unsigned frameNo, bool upload)
+{
+    Job job = { image, filename, callNo, frameNo, upload };
+    std::unique_lock<std::mutex> lock(mMutex);
+    if (mThreads.empty())
+    {
+        if (mThreadCount == 0)
+        {
+            lock.unlock();
+            writeJob(job);
+            return;
+        }
+        for (unsigned i = 0; i < mThreadCount; ++i)
+        {
+            mThreads.emplace_back(&SnapshotWriter::run, this);
+        }
+    }
+    const size_t maxPending = mThreads.size() * 2;
+    mSpaceCond.wait(lock, [&]{ return mQueue.size() < maxPending; });
+    mQueue.push_back(job);
+    lock.unlock();
+    mWorkCond.notify_one();
+}
+
+void SnapshotWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mSpaceCond.wait(lock, [this]{ return mQueue.empty() && mBusy == 0; });
+}
+
+void SnapshotWriter::run()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    for (;;)
+    {
+        mWorkCond.wait(lock, [this]{ return mStop || !mQueue.empty(); });
+        if (mQueue.empty())
+        {
+            return;
+        }
+        const Job job = mQueue.front();
+        mQueue.pop_front();
+        mBusy++;
+        lock.unlock();
+        mSpaceCond.notify_all();
+
+        writeJob(job);
+
+        lock.lock();
+        mBusy--;
+        if (mQueue.empty() && mBusy == 0)
+        {
+            mSpaceCond.notify_all();
+        }
+    }
+}
+
+void SnapshotWriter::writeJob(const Job& job)
+{
+    if (job.image->writePNG(job.filename.c_str()))
+    {
+        DBG_LOG("Snapshot (frame %d, call %d) : %s\n", job.frameNo, job.callNo, job.filename.c_str());
+
+        // Register the snapshot to be uploaded
+        if (job.upload)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mUploads.push_back(job.filename);
+        }
+    }
+    else
+    {
+        DBG_LOG("Failed to write snapshot : %s\n", job.filename.c_str());
+    }
+    delete job.image;
+}
+
 Retracer::Retracer()
  : mFile()
  , mOptions()
@@ -268,6 +365,7 @@ Retracer::Retracer()
  , mStateLogger()
  , mFileFormatVersion(INVALID_VERSION)
  , mSnapshotPaths()
+ , mSnapshotWriter(mOptions.mSnapshotThreads, mSnapshotPaths)
 {
 #ifndef NDEBUG
     mVBODataSize = 0;
@@ -286,6 +384,7 @@ Retracer::~Retracer()
 {
     wakeupAllWorkThreads();
     waitWorkThreadPoolIdle();
+    mSnapshotWriter.flush();
 
     if (mOptions.mDumpStatic)
     {
@@ -412,6 +511,7 @@ void Retracer::CloseTraceFile() {
 
     mState.Reset();
     mCSBuffers.clear();
+    mSnapshotWriter.flush();
     mSnapshotPaths.clear();
 }
 
@@ -497,6 +597,15 @@ bool Retracer::overrideWithCmdOptions( const CmdOptions &cmdOptions )
     }
 
     mOptions.mSnapshotFrameNames = cmdOptions.snapshotFrameNames;
+    if (cmdOptions.snapshotThreads >= 0)
+    {
+        mOptions.mSnapshotThreads = cmdOptions.snapshotThreads;
+    }
+    if (cmdOptions.pngLevel >= 0)
+    {
+        mOptions.mPngLevel = cmdOptions.pngLevel;
+        image::setPNGCompression(mOptions.mPngLevel);
+    }
     mOptions.mPbufferRendering = cmdOptions.pbufferRendering;
 
     if (cmdOptions.tid != -1 && cmdOptions.tid != mOptions.mRetraceTid)
@@ -986,22 +1095,7 @@ void Retracer::TakeSnapshot(unsigned int callNo, unsigned int frameNo, const cha
                 filenameToBeUsed = ss.str();
             }
 
-            if (src->writePNG(filenameToBeUsed.c_str()))
-            {
-                DBG_LOG("Snapshot (frame %d, call %d) : %s\n", frameNo, callNo, filenameToBeUsed.c_str());
-
-                // Register the snapshot to be uploaded
-                if (mOptions.mUploadSnapshots)
-                {
-                    mSnapshotPaths.push_back(filenameToBeUsed);
-                }
-            }
-            else
-            {
-                DBG_LOG("Failed to write snapshot : %s\n", filenameToBeUsed.c_str());
-            }
-
-            delete src;
+            mSnapshotWriter.write(src, filenameToBeUsed, callNo, frameNo, mOptions.mUploadSnapshots);
         }
     }
     if (!colorAttach)   // no color attachment, there might be a depth attachment
@@ -1050,22 +1144,7 @@ void Retracer::TakeSnapshot(unsigned int callNo, unsigned int frameNo, const cha
             filenameToBeUsed = ss.str();
         }
 
-        if (src->writePNG(filenameToBeUsed.c_str()))
-        {
-            DBG_LOG("Snapshot (frame %d, call %d) : %s\n", frameNo, callNo, filenameToBeUsed.c_str());
-
-            // Register the snapshot to be uploaded
-            if (mOptions.mUploadSnapshots)
-            {
-                mSnapshotPaths.push_back(filenameToBeUsed);
-            }
-        }
-        else
-        {
-            DBG_LOG("Failed to write snapshot : %s\n", filenameToBeUsed.c_str());
-        }
-
-        delete src;
+        mSnapshotWriter.write(src, filenameToBeUsed, callNo, frameNo, mOptions.mUploadSnapshots);
     }
 
     std::vector<Texture> textures = getTexturesToDump();
@@ -1686,6 +1765,8 @@ void Retracer::saveResult()
     {
         mCollectors->stop();
     }
+    // After the timer, so that snapshots still being encoded do not count
+    mSnapshotWriter.flush();
     DBG_LOG("Saving results...\n");
     if (!TraceExecutor::writeData(numOfFrames, duration, mTimerBeginTime, endTime))
     {
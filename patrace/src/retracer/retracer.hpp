@@ -19,7 +19,11 @@
 #include "common/memoryinfo.hpp"
 #endif
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #ifdef __APPLE__
@@ -30,6 +34,10 @@ class OffscreenManager;
 class Quad;
 class Collection;
 
+namespace image {
+class Image;
+}
+
 namespace retracer {
 
 class Retracer;
@@ -175,6 +183,51 @@ private:
 
 typedef std::unordered_map<int, WorkThread*> WorkThreadPool_t;
 
+// Compresses and writes snapshots on background threads, so that the
+// retrace thread only pays for reading back the framebuffer. At most two
+// images per thread wait to be written; write() blocks while the queue is
+// full, which bounds the memory held by snapshots that were taken faster
+// than they can be encoded.
+class SnapshotWriter
+{
+public:
+    // The number of threads is read at the first write(), so that it can be
+    // set by the options after construction. With no threads, snapshots are
+    // written by write() itself. The names of the snapshots written with
+    // upload set are added to uploads.
+    SnapshotWriter(const unsigned int& threads, std::vector<std::string>& uploads);
+    ~SnapshotWriter();
+
+    // Takes ownership of image
+    void write(image::Image* image, const std::string& filename, unsigned callNo, unsigned frameNo, bool upload);
+
+    // Wait until every snapshot handed to write() is on disk
+    void flush();
+
+private:
+    struct Job
+    {
+        image::Image* image;
+        std::string filename;
+        unsigned callNo;
+        unsigned frameNo;
+        bool upload;
+    };
+
+    void run();
+    void writeJob(const Job& job);
+
+    const unsigned int& mThreadCount;
+    std::vector<std::string>& mUploads;
+    std::vector<std::thread> mThreads;
+    std::deque<Job> mQueue;
+    unsigned mBusy = 0;
+    bool mStop = false;
+    std::mutex mMutex;
+    std::condition_variable mWorkCond;  // a job was queued, or stopping
+    std::condition_variable mSpaceCond; // a job was taken, or all are done
+};
+
 class Retracer
 {
 public:
@@ -291,6 +344,7 @@ private:
     StateLogger mStateLogger;
     common::HeaderVersion mFileFormatVersion;
     std::vector<std::string> mSnapshotPaths;
+    SnapshotWriter mSnapshotWriter;
 
     struct CallStat
     {
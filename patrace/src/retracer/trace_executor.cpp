@@ -14,6 +14,7 @@
 #include <errno.h>
 
 #include "common/base64.hpp"
+#include "common/image.hpp"
 #include "common/os_string.hpp"
 #include "common/trace_callset.hpp"
 
@@ -183,6 +184,9 @@ void TraceExecutor::overrideDefaultsWithJson(Json::Value &value)
 
     // Whether or not to upload taken snapshots.
     options.mUploadSnapshots = value.get("snapshotUpload", false).asBool();
+    options.mSnapshotThreads = value.get("snapshotThreads", options.mSnapshotThreads).asUInt();
+    options.mPngLevel = value.get("snapshotPngLevel", options.mPngLevel).asInt();
+    image::setPNGCompression(options.mPngLevel);
 
     if (value.isMember("snapshotCallset")) {
         DBG_LOG("snapshotCallset = %s\n", value.get("snapshotCallset", "").asCString());
@@ -16,8 +16,11 @@
 #include <limits.h>
 #include <iomanip>
 #include <sstream>
+#include <memory>
+#include <thread>
 
 #include "tool/parse_interface_retracing.hpp"
+#include "tool/call_dispatch.hpp"
 
 #include "jsoncpp/include/json/writer.h"
 #include "common/in_file.hpp"
@@ -28,6 +31,7 @@
 #include "common/trace_model.hpp"
 #include "common/gl_utility.hpp"
 #include "common/os.hpp"
+#include "common/os_thread.hpp"
 #include "eglstate/context.hpp"
 #include "tool/config.hpp"
 #include "base/base.hpp"
@@ -84,9 +88,101 @@ static inline bool relevant(int frame)
     return (frame >= startframe && frame <= lastframe);
 }
 #define debugstream if (!debug) {} else std::cerr
-#define dumpstream if (!(relevant(frames) && dump_to_text)) {} else std::cout
+static std::ostringstream dumptext; // dumped since the last call was handed to the DumpFormatter
+#define dumpstream if (!(relevant(frames) && dump_to_text)) {} else dumptext
 #define DEBUG_LOG(...) if (debug) DBG_LOG(__VA_ARGS__)
 
+// Writes the text dump to stdout on a separate thread, so that turning the
+// calls into text does not hold up the analysis. The output is in the same
+// order as when written directly.
+class DumpFormatter
+{
+public:
+    enum
+    {
+        BATCH_ENTRIES = 256,
+        MAX_BATCHES = 8,
+    };
+
+    DumpFormatter() : mBatches(MAX_BATCHES), mBatch(new Batch)
+    {
+        mThread = std::thread(&DumpFormatter::run, this);
+    }
+
+    // Write what is left in text and wait for the thread
+    void finish(std::ostringstream& text)
+    {
+        add(text, NULL);
+        mBatch->entries.push_back(std::move(mPending));
+        mBatch->last = true;
+        push();
+        mThread.join();
+    }
+
+    // Write text, followed by the call, which is deleted once written. The call
+    // is only formatted after the next add(), until then the caller may use it.
+    void add(std::ostringstream& text, common::CallTM* call)
+    {
+        if (mPending.call || !mPending.text.empty())
+        {
+            mBatch->entries.push_back(std::move(mPending));
+            if (mBatch->entries.size() == BATCH_ENTRIES)
+            {
+                push();
+                mBatch = new Batch;
+            }
+        }
+        mPending.text = text.str();
+        mPending.call = call;
+        text.str(std::string());
+    }
+
+private:
+    struct Entry
+    {
+        std::string text;
+        common::CallTM* call = NULL;
+    };
+
+    struct Batch
+    {
+        std::vector<Entry> entries;
+        bool last = false;
+    };
+
+    void push()
+    {
+        while (!mBatches.push(mBatch)) {}
+    }
+
+    void run()
+    {
+        bool last = false;
+        while (!last)
+        {
+            Batch* batch = NULL;
+            while (!(batch = mBatches.pop())) {} // woken up without a batch
+            for (Entry& entry : batch->entries)
+            {
+                std::cout << entry.text;
+                if (entry.call)
+                {
+                    std::cout << entry.call->ToStr(false) << std::endl;
+                    delete entry.call;
+                }
+            }
+            last = batch->last;
+            delete batch;
+        }
+        std::cout.flush();
+    }
+
+    std::thread mThread;
+    os::MTQueue<Batch*> mBatches;
+    Batch* mBatch; // being filled
+    Entry mPending; // its call may still be in use
+};
+
 // For legacy texture functions, merge input format and type into sized internal format
 static GLenum merge_texture_format(GLenum internalformat, GLenum type)
 {
@@ -289,6 +385,8 @@ static std::map<std::string, PerUnit> createPerDraw()
     v["spatial_locality"].csv_description = "Spatial Locality %";
     v["temporal_locality"].csv_description = "Temporal Locality %";
     v["vec4_locality"].csv_description = "Block of 4 Locality %";
+    v["fifo_hit_rate"].csv_description = "FIFO Vertex Cache Hit %";
+    v["lru_hit_rate"].csv_description = "LRU Vertex Cache Hit %";
     v["instancing"].csv_description = "Instancing";
     v["uniforms"].csv_description = "Uniform calls";
     v["uniform_values"].csv_description = "Uniform values";
@@ -359,7 +457,7 @@ struct BlendMode {
 
     std::string to_str() const
     {
-        return "Equation { RGB=" + blendEnum(modeRGB) + ", Alpha=" + blendEnum(modeAlpha) + " }, Function { RGB=(" + blendEnum(srcRGB)
+        return std::string("Equation { RGB=") + blendEnum(modeRGB) + ", Alpha=" + blendEnum(modeAlpha) + " }, Function { RGB=(" + blendEnum(srcRGB)
                + ", " + blendEnum(dstRGB) + "), Alpha=(" + blendEnum(srcAlpha) + ", " + blendEnum(dstAlpha) + ") }";
     }
 
@@ -549,7 +647,7 @@ private:
     std::map<std::string, Json::Value::Int64> scissor_sizes;
 
 public:
-    AnalyzeTrace() : features(FEATURE_MAX) {}
+    AnalyzeTrace() : features(FEATURE_MAX), mCallDataById(common::ApiInfo::MaxSigId + 1) {}
 
     void analyze(ParseInterfaceRetracing &input);
 
@@ -563,6 +661,7 @@ private:
     double calculate_dump_heaviness(const ParseInterfaceRetracing& input, int frame);
     double calculate_complexity(const ParseInterfaceRetracing& input);
     std::map<std::string, CallData> mCallData;
+    std::vector<CallData> mCallDataById; // by CallTM::mCallId, merged into mCallData at the end
 };
 
 static void write_callstats(const std::map<std::string, CallData>& calldata, const std::string& basename)
@@ -633,6 +732,134 @@ void AnalyzeTrace::buffer_bound(GLenum target)
     }
 }
 
+// The calls that analyze() looks at. The EGL calls come first, the GLES calls
+// after them are only looked at with a current context.
+enum AnalyzedCall
+{
+    ANALYZE_NONE = 0,
+    ANALYZE_eglCreateWindowSurface,
+    ANALYZE_eglCreateImage,
+    ANALYZE_glEGLImageTargetTexture2DOES,
+    ANALYZE_eglCreateContext,
+    ANALYZE_eglDestroySurface,
+    ANALYZE_eglDestroyContext,
+    ANALYZE_eglMakeCurrent,
+    ANALYZE_eglSwapBuffers,
+    ANALYZE_LAST_EGL = ANALYZE_eglSwapBuffers,
+    ANALYZE_glDiscardFramebufferEXT,
+    ANALYZE_glInvalidateFramebuffer,
+    ANALYZE_glBlendEquation,
+    ANALYZE_glBlendEquationSeparate,
+    ANALYZE_glBlendFunc,
+    ANALYZE_glBlendFuncSeparate,
+    ANALYZE_glDepthFunc,
+    ANALYZE_glGenProgramPipelines,
+    ANALYZE_glLinkProgram,
+    ANALYZE_glTexImage,
+    ANALYZE_glVertexAttribBinding,
+    ANALYZE_glBindVertexBuffer,
+    ANALYZE_glCreateShader,
+    ANALYZE_glShaderSource,
+    ANALYZE_glBindFramebuffer,
+    ANALYZE_glFramebufferTexture2D,
+    ANALYZE_glFinish,
+    ANALYZE_glGenFramebuffers,
+    ANALYZE_glActiveTexture,
+    ANALYZE_glUseProgram,
+    ANALYZE_glBindTexture,
+    ANALYZE_glMapBuffer,
+    ANALYZE_glBufferData,
+    ANALYZE_glCopyBufferSubData,
+    ANALYZE_glVertexAttribIPointer,
+    ANALYZE_glBindBuffer,
+    ANALYZE_glUniform,
+    ANALYZE_glEnable,
+    ANALYZE_glGenVertexArrays,
+    ANALYZE_glBindVertexArray,
+    ANALYZE_glClientSideBufferData,
+    ANALYZE_glProgramBinary,
+    ANALYZE_glDispatch,
+    ANALYZE_glDrawTexiOES,
+    ANALYZE_glDraw,
+    ANALYZE_glClear,
+};
+
+// Built once, so that analyze() does not compare the name of every call against all of the above.
+// The order matters where a prefix or substring also matches names added before it.
+static const CallDispatchTable<AnalyzedCall>& analyzedCalls()
+{
+    static const CallDispatchTable<AnalyzedCall> table = CallDispatchTable<AnalyzedCall>(ANALYZE_NONE)
+        .add("eglCreateWindowSurface", ANALYZE_eglCreateWindowSurface)
+        .add("eglCreateWindowSurface2", ANALYZE_eglCreateWindowSurface)
+        .add("eglCreatePbufferSurface", ANALYZE_eglCreateWindowSurface)
+        .add("eglCreatePixmapSurface", ANALYZE_eglCreateWindowSurface)
+        .add("eglCreateImage", ANALYZE_eglCreateImage)
+        .add("eglCreateImageKHR", ANALYZE_eglCreateImage)
+        .add("glEGLImageTargetTexture2DOES", ANALYZE_glEGLImageTargetTexture2DOES)
+        .add("eglCreateContext", ANALYZE_eglCreateContext)
+        .add("eglDestroySurface", ANALYZE_eglDestroySurface)
+        .add("eglDestroyContext", ANALYZE_eglDestroyContext)
+        .add("eglMakeCurrent", ANALYZE_eglMakeCurrent)
+        .addPrefix("eglSwapBuffers", ANALYZE_eglSwapBuffers)
+        .add("glDiscardFramebufferEXT", ANALYZE_glDiscardFramebufferEXT)
+        .add("glInvalidateFramebuffer", ANALYZE_glInvalidateFramebuffer)
+        .add("glBlendEquation", ANALYZE_glBlendEquation)
+        .add("glBlendEquationSeparate", ANALYZE_glBlendEquationSeparate)
+        .add("glBlendFunc", ANALYZE_glBlendFunc)
+        .add("glBlendFuncSeparate", ANALYZE_glBlendFuncSeparate)
+        .add("glDepthFunc", ANALYZE_glDepthFunc)
+        .add("glGenProgramPipelines", ANALYZE_glGenProgramPipelines)
+        .add("glLinkProgram", ANALYZE_glLinkProgram)
+        .addContaining("glTexImage", ANALYZE_glTexImage)
+        .addContaining("glTexStorage", ANALYZE_glTexImage)
+        .addContaining("glCompressedTexImage", ANALYZE_glTexImage)
+        .add("glVertexAttribBinding", ANALYZE_glVertexAttribBinding)
+        .add("glBindVertexBuffer", ANALYZE_glBindVertexBuffer)
+        .add("glCreateShader", ANALYZE_glCreateShader)
+        .add("glCreateShaderProgramv", ANALYZE_glCreateShader)
+        .add("glShaderSource", ANALYZE_glShaderSource)
+        .add("glBindFramebuffer", ANALYZE_glBindFramebuffer)
+        .add("glFramebufferTexture2D", ANALYZE_glFramebufferTexture2D)
+        .add("glFramebufferTextureLayer", ANALYZE_glFramebufferTexture2D)
+        .add("glFramebufferRenderbuffer", ANALYZE_glFramebufferTexture2D)
+        .add("glFramebufferTexture2DOES", ANALYZE_glFramebufferTexture2D)
+        .add("glFramebufferTextureLayerOES", ANALYZE_glFramebufferTexture2D)
+        .add("glFramebufferRenderbufferOES", ANALYZE_glFramebufferTexture2D)
+        .add("glFinish", ANALYZE_glFinish)
+        .add("glFlush", ANALYZE_glFinish)
+        .add("glGenFramebuffers", ANALYZE_glGenFramebuffers)
+        .add("glActiveTexture", ANALYZE_glActiveTexture)
+        .add("glUseProgram", ANALYZE_glUseProgram)
+        .add("glBindTexture", ANALYZE_glBindTexture)
+        .add("glMapBuffer", ANALYZE_glMapBuffer)
+        .add("glMapBufferRange", ANALYZE_glMapBuffer)
+        .add("glBufferData", ANALYZE_glBufferData)
+        .add("glBufferSubData", ANALYZE_glBufferData)
+        .add("glCopyBufferSubData", ANALYZE_glCopyBufferSubData)
+        .add("glVertexAttribIPointer", ANALYZE_glVertexAttribIPointer)
+        .add("glVertexAttribPointer", ANALYZE_glVertexAttribIPointer)
+        .add("glBindBuffer", ANALYZE_glBindBuffer)
+        .add("glBindBufferBase", ANALYZE_glBindBuffer)
+        .add("glBindBufferRange", ANALYZE_glBindBuffer)
+        .addContaining("glUniform", ANALYZE_glUniform)
+        .addContaining("glProgramUniform", ANALYZE_glUniform)
+        .add("glEnable", ANALYZE_glEnable)
+        .add("glGenVertexArrays", ANALYZE_glGenVertexArrays)
+        .add("glGenVertexArraysOES", ANALYZE_glGenVertexArrays)
+        .add("glBindVertexArray", ANALYZE_glBindVertexArray)
+        .add("glBindVertexArrayOES", ANALYZE_glBindVertexArray)
+        .add("glClientSideBufferData", ANALYZE_glClientSideBufferData)
+        .add("glProgramBinary", ANALYZE_glProgramBinary)
+        .add("glProgramBinaryOES", ANALYZE_glProgramBinary)
+        .addPrefix("glDispatch", ANALYZE_glDispatch)
+        .add("glDrawTexiOES", ANALYZE_glDrawTexiOES)
+        .exclude("glDrawBuffers")
+        .addPrefix("glDraw", ANALYZE_glDraw)
+        .add("glClear", ANALYZE_glClear)
+        .addPrefix("glClearBuffer", ANALYZE_glClear);
+    return table;
+}
+
 void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
 {
     common::CallTM *call = NULL;
@@ -651,6 +878,8 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
         input.setQuickMode(false); // start analysing index buffers
         in_renderpass_frame = true;
     }
+    PerUnit& perframeCalls = perframe["calls"];
+    std::unique_ptr<DumpFormatter> formatter(dump_to_text ? new DumpFormatter : NULL);
     while ((call = input.next_call()))
     {
         const int context_index = input.context_index;
@@ -666,21 +895,33 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
         {
             dumpstream << call->mCallNo << ": ";
         }
-        dumpstream << call->ToStr(false) << std::endl;
+        if (relevant(frames) && dump_to_text)
+        {
+            formatter->add(dumptext, input.releaseCall()); // the call is still ours until the next one
+        }
 
-        if (call->mCallName == "eglCreateWindowSurface" || call->mCallName == "eglCreateWindowSurface2"
-            || call->mCallName == "eglCreatePbufferSurface" || call->mCallName == "eglCreatePixmapSurface")
+        AnalyzedCall analyzed = analyzedCalls()[call->mCallId];
+        if (analyzed > ANALYZE_LAST_EGL && context_index == UNBOUND)
+        {
+            analyzed = ANALYZE_NONE; // prevent the GLES calls from being processed without a GLES context
+        }
+
+        switch (analyzed)
+        {
+        case ANALYZE_eglCreateWindowSurface:
         {
             int mret = call->mRet.GetAsInt();
             int display = call->mArgs[0]->GetAsInt();
             dumpstream << "    idx=" << surfaces.size() << std::endl;
             surfaces.push_back(Surface(mret, surfaces.size(), display, call->mCallNo, frames));
+            break;
         }
-        else if (call->mCallName == "eglCreateImage" || call->mCallName == "eglCreateImageKHR")
+        case ANALYZE_eglCreateImage:
         {
             features[FEATURE_EGLCREATEIMAGE]++;
+            break;
         }
-        else if (call->mCallName == "glEGLImageTargetTexture2DOES") // size can be inferred, original format lost
+        case ANALYZE_glEGLImageTargetTexture2DOES: // size can be inferred, original format lost
         {
             const GLenum target = interpret_texture_target(call->mArgs[0]->GetAsUInt());
             const GLuint unit = contexts[context_index].activeTextureUnit;
@@ -691,8 +932,9 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
             features[FEATURE_EGL_IMAGE]++;
             dumpstream << "    bound=" << tex_id << " active=" << unit << std::endl;
             DEBUG_LOG("Created EGL image texture %u on context %d with target 0x%04x\n", tex_id, context_index, target);
+            break;
         }
-        else if (call->mCallName == "eglCreateContext")
+        case ANALYZE_eglCreateContext:
         {
             int mret = call->mRet.GetAsInt();
             int display = call->mArgs[0]->GetAsInt();
@@ -703,22 +945,25 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
             {
                 features[FEATURE_CONTEXT_SHARING]++;
             }
+            break;
         }
-        else if (call->mCallName == "eglDestroySurface")
+        case ANALYZE_eglDestroySurface:
         {
             int surface = call->mArgs[1]->GetAsInt();
             int target_surface_index = input.surface_remapping[surface];
             surfaces[target_surface_index].call_destroyed = call->mCallNo;
             surfaces[target_surface_index].frame_destroyed = frames;
             dumpstream << "    call created=" << surfaces[target_surface_index].call_created << " frames=" << frames - surfaces[target_surface_index].frame_created << std::endl;
+            break;
         }
-        else if (call->mCallName == "eglDestroyContext")
+        case ANALYZE_eglDestroyContext:
         {
             int context = call->mArgs[1]->GetAsInt();
             int target_context_index = input.context_remapping[context];
             dumpstream << "    call created=" << input.contexts[target_context_index].call_created << " frames=" << frames - input.contexts[target_context_index].frame_created << std::endl;
+            break;
         }
-        else if (call->mCallName == "eglMakeCurrent")
+        case ANALYZE_eglMakeCurrent:
         {
             int surface = call->mArgs[1]->GetAsInt();
             int context = call->mArgs[3]->GetAsInt();
@@ -735,8 +980,9 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
                     DBG_LOG("Warning: eglMakeCurrent on destroyed thread idx %d, id %u at call %u!\n", new_surface_index, surfaces[new_surface_index].id, call->mCallNo);
                 }
             }
+            break;
         }
-        else if (call->mCallName.compare(0, 14, "eglSwapBuffers") == 0)
+        case ANALYZE_eglSwapBuffers:
         {
             int surface = call->mArgs[1]->GetAsInt();
             int target_surface_index = input.surface_remapping[surface];
@@ -794,62 +1040,70 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
 
             perdraw = createPerDraw();
             startNewRows(perdraw);
+            break;
         }
         /// --- end EGL ---
-        else if (context_index == UNBOUND)
-        {
-            // nothing, just prevent the GLES calls below from being processed without a GLES context
-        }
         /// --- start GLES ---
-        else if (call->mCallName == "glDiscardFramebufferEXT")
+        case ANALYZE_glDiscardFramebufferEXT:
         {
             features[FEATURE_DISCARD_FBO]++;
+            break;
         }
-        else if (call->mCallName == "glInvalidateFramebuffer")
+        case ANALYZE_glInvalidateFramebuffer:
         {
             features[FEATURE_INVALIDATE_FBO]++;
+            break;
         }
-        else if (call->mCallName == "glBlendEquation")
+        case ANALYZE_glBlendEquation:
         {
             int mode = call->mArgs[0]->GetAsInt();
             contexts[context_index].blendMode.setEquation(mode, mode);
+            break;
         }
-        else if (call->mCallName == "glBlendEquationSeparate")
+        case ANALYZE_glBlendEquationSeparate:
         {
             int modeRGB = call->mArgs[0]->GetAsInt();
             int modeAlpha = call->mArgs[1]->GetAsInt();
             contexts[context_index].blendMode.setEquation(modeRGB, modeAlpha);
+            break;
         }
-        else if (call->mCallName == "glBlendFunc")
+        case ANALYZE_glBlendFunc:
         {
             int sfactor = call->mArgs[0]->GetAsInt();
             int dfactor = call->mArgs[1]->GetAsInt();
             contexts[context_index].blendMode.setFunction(sfactor, dfactor, sfactor, dfactor);
+            break;
         }
-        else if (call->mCallName == "glBlendFuncSeparate")
+        case ANALYZE_glBlendFuncSeparate:
         {
             int sfactorRGB = call->mArgs[0]->GetAsInt();
             int dfactorRGB = call->mArgs[1]->GetAsInt();
             int sfactorAlpha = call->mArgs[2]->GetAsInt();
             int dfactorAlpha = call->mArgs[3]->GetAsInt();
             contexts[context_index].blendMode.setFunction(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+            break;
         }
-        else if (call->mCallName == "glDepthFunc")
+        case ANALYZE_glDepthFunc:
         {
             GLenum func = call->mArgs[0]->GetAsUInt();
             depthfuncs[func] = true;
+            break;
         }
-        else if (call->mCallName == "glGenProgramPipelines")
+        case ANALYZE_glGenProgramPipelines:
         {
             features[FEATURE_SEPARATE_SHADER_OBJECTS] += call->mArgs[0]->GetAsInt();
+            break;
         }
-        else if (call->mCallName == "glLinkProgram" && relevant(frames))
+        case ANALYZE_glLinkProgram:
         {
+            if (!relevant(frames))
+            {
+                break;
+            }
             perframe["programs_linked"].values.back()++;
+            break;
         }
-        else if (call->mCallName.find("glTexImage") != std::string::npos
-                 || call->mCallName.find("glTexStorage") != std::string::npos
-                 || call->mCallName.find("glCompressedTexImage") != std::string::npos)
+        case ANALYZE_glTexImage:
         {
             const GLenum target = interpret_texture_target(call->mArgs[0]->GetAsUInt());
             int level = 0;
@@ -919,13 +1173,19 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
                 tex_sizes[size]++;
                 texturetypes[texEnum(target)]++;
             }
+            break;
         }
-        else if (call->mCallName == "glVertexAttribBinding")
+        case ANALYZE_glVertexAttribBinding:
         {
             features[FEATURE_VERTEX_ATTR_BINDING] = true;
+            break;
         }
-        else if (call->mCallName == "glBindVertexBuffer" && relevant(frames))
+        case ANALYZE_glBindVertexBuffer:
         {
+            if (!relevant(frames))
+            {
+                break;
+            }
             features[FEATURE_VERTEX_BUFFER_BINDING] = true;
             if (relevant(frames))
             {
@@ -933,15 +1193,17 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
                 perdraw["vertex_buffer_binding"].values.back()++;
                 perframe["buffer_binding"].values.back()++;
             }
+            break;
         }
-        else if (call->mCallName == "glCreateShader" || call->mCallName == "glCreateShaderProgramv")
+        case ANALYZE_glCreateShader:
         {
             const int mret = call->mRet.GetAsInt();
             const int type = call->mArgs[0]->GetAsInt();
             contexts[context_index].shadertypes[mret] = type;
             shaders[type]++;
+            break;
         }
-        else if (call->mCallName == "glShaderSource")
+        case ANALYZE_glShaderSource:
         {
             const GLuint shader = call->mArgs[0]->GetAsUInt();
             const GLenum type = contexts[context_index].shadertypes[shader];
@@ -1018,8 +1280,9 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
                 contexts[context_index].shaders[shaderidx] = s;
                 pclose(result);
             }
+            break;
         }
-        else if (call->mCallName == "glBindFramebuffer")
+        case ANALYZE_glBindFramebuffer:
         {
             GLenum target = call->mArgs[0]->GetAsUInt();
             GLuint fb = call->mArgs[1]->GetAsUInt();
@@ -1038,10 +1301,9 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
             {
                 perframe["framebuffers"].values.back()++;
             }
+            break;
         }
-        else if (call->mCallName == "glFramebufferTexture2D" || call->mCallName == "glFramebufferTextureLayer"
-                 || call->mCallName == "glFramebufferRenderbuffer" || call->mCallName == "glFramebufferTexture2DOES"
-                 || call->mCallName == "glFramebufferTextureLayerOES" || call->mCallName == "glFramebufferRenderbufferOES")
+        case ANALYZE_glFramebufferTexture2D:
         {
             GLenum target = call->mArgs[0]->GetAsUInt();
             GLenum attachment = call->mArgs[1]->GetAsUInt();
@@ -1078,25 +1340,24 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
                 perframe["fbo_attachments"].values.back()++;
             }
             (void)attachment; // silence compiler
+            break;
         }
-        else if ((call->mCallName == "glFinish" || call->mCallName == "glFlush") && relevant(frames))
+        case ANALYZE_glFinish:
         {
+            if (!relevant(frames))
+            {
+                break;
+            }
            perframe["flushes"].values.back()++;
            flushes++;
+            break;
         }
-        else if (call->mCallName == "glGenFramebuffers")
+        case ANALYZE_glGenFramebuffers:
         {
             contexts[context_index].framebuffers += call->mArgs[0]->GetAsUInt();
+            break;
         }
-        else if (relevant(frames) && (call->mCallName == "glFramebufferRenderbuffer" || call->mCallName == "glFramebufferTexture2D"))
-        {
-            const unsigned attachment = call->mArgs[1]->GetAsUInt();
-            if (attachment >= GL_COLOR_ATTACHMENT0 && attachment <= GL_COLOR_ATTACHMENT31)
-            {
-                numColorAttachments = std::max<unsigned>(numColorAttachments, attachment - GL_COLOR_ATTACHMENT0 + 1);
-            }
-        }
-        else if (call->mCallName == "glActiveTexture")
+        case ANALYZE_glActiveTexture:
         {
             GLuint unit = call->mArgs[0]->GetAsUInt() - GL_TEXTURE0;
             contexts[context_index].activeTextureUnit = unit;
@@ -1104,8 +1365,9 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
             {
                 highestTextureUnitUsed = std::max<GLuint>(highestTextureUnitUsed, unit);
             }
+            break;
         }
-        else if (call->mCallName == "glUseProgram")
+        case ANALYZE_glUseProgram:
         {
             const GLuint id = call->mArgs[0]->GetAsUInt();
             if (id != 0 && relevant(frames))
@@ -1113,8 +1375,9 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
                 perdraw["program_binding"].values.back()++;
                 perframe["program_binding"].values.back()++;
             }
+            break;
         }
-        else if (call->mCallName == "glBindTexture")
+        case ANALYZE_glBindTexture:
         {
             const unsigned unit = contexts[context_index].activeTextureUnit;
             const unsigned target = call->mArgs[0]->GetAsUInt();
@@ -1126,8 +1389,9 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
                 perdraw["texture_binding"].values.back()++;
                 perframe["texture_binding"].values.back()++;
             }
+            break;
         }
-        else if (call->mCallName == "glMapBuffer" || call->mCallName == "glMapBufferRange")
+        case ANALYZE_glMapBuffer:
         {
             const GLenum target = call->mArgs[0]->GetAsUInt();
             unsigned access = 0;
@@ -1145,20 +1409,31 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
             {
                 buffer_changed(target);
             }
+            break;
         }
-        else if (relevant(frames) && (call->mCallName == "glBufferData" || call->mCallName == "glBufferSubData"))
+        case ANALYZE_glBufferData:
         {
+            if (!relevant(frames))
+            {
+                break;
+            }
             const GLenum target = call->mArgs[0]->GetAsUInt();
             buffer_changed(target);
+            break;
         }
-        else if (relevant(frames) && call->mCallName == "glCopyBufferSubData")
+        case ANALYZE_glCopyBufferSubData:
         {
+            if (!relevant(frames))
+            {
+                break;
+            }
             // This is likely to use GL_COPY_WRITE_BUFFER for target, which will not tell us anything useful,
             // but we try looking anyway.
             const GLenum writetarget = call->mArgs[1]->GetAsUInt();
             buffer_changed(writetarget);
+            break;
         }
-        else if (call->mCallName == "glVertexAttribIPointer" || call->mCallName == "glVertexAttribPointer")
+        case ANALYZE_glVertexAttribIPointer:
         {
             if (last_changed_vertex_buffer == -1)
             {
@@ -1168,8 +1443,9 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
                 }
                 last_changed_vertex_buffer = input.contexts[context_index].boundBufferIds[GL_ARRAY_BUFFER][0].buffer;
             }
+            break;
         }
-        else if (call->mCallName == "glBindBuffer" || call->mCallName == "glBindBufferBase" || call->mCallName == "glBindBufferRange")
+        case ANALYZE_glBindBuffer:
         {
             GLenum target = call->mArgs[0]->GetAsInt();
             GLenum bufferid;
@@ -1196,8 +1472,9 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
             {
                 buffer_bound(target);
             }
+            break;
         }
-        else if (call->mCallName.find("glUniform") != std::string::npos || call->mCallName.find("glProgramUniform") != std::string::npos)
+        case ANALYZE_glUniform:
         {
             GLint location = 0;
             GLuint program_id = 0;
@@ -1238,40 +1515,46 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
                 perframe["uniforms"].values.back()++;
                 perframe["uniform_values"].values.back() += count;
             }
+            break;
         }
-        else if (call->mCallName == "glEnable")
+        case ANALYZE_glEnable:
         {
             GLenum target = call->mArgs[0]->GetAsInt();
             if (target == GL_PRIMITIVE_RESTART_FIXED_INDEX && relevant(frames))
             {
                 features[FEATURE_PRIMRESTART] = true;
             }
+            break;
         }
-        else if (call->mCallName == "glVertexAttribPointer" && relevant(frames))
+        case ANALYZE_glGenVertexArrays:
         {
-            if (contexts[context_index].curbuffer != 0)
-            {
-                features[FEATURE_VBO]++;
-            }
-            else
+            if (!relevant(frames))
             {
-                features[FEATURE_VA]++;
+                break;
             }
-        }
-        else if (relevant(frames) && (call->mCallName == "glGenVertexArrays" || call->mCallName == "glGenVertexArraysOES"))
-        {
             features[FEATURE_VAO]++;
+            break;
         }
-        else if (relevant(frames) && (call->mCallName == "glBindVertexArray" || call->mCallName == "glBindVertexArrayOES"))
+        case ANALYZE_glBindVertexArray:
         {
+            if (!relevant(frames))
+            {
+                break;
+            }
             perframe["vao_binding"].values.back()++;
+            break;
         }
-        else if (call->mCallName == "glClientSideBufferData" && relevant(frames))
+        case ANALYZE_glClientSideBufferData:
         {
+            if (!relevant(frames))
+            {
+                break;
+            }
             clientsidebuffersize += call->mArgs[1]->GetAsUInt();
             clientsidebuffers = std::max<int>(clientsidebuffers, call->mArgs[0]->GetAsInt() + 1);
+            break;
         }
-        else if (call->mCallName == "glProgramBinary" || call->mCallName == "glProgramBinaryOES")
+        case ANALYZE_glProgramBinary:
         {
             // binaryFormat=0xDEADDEAD means we're messing with the driver to make this feature fail
             GLenum binaryFormat = call->mArgs[1]->GetAsUInt();
@@ -1279,22 +1562,33 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
             {
                 features[FEATURE_BINARY_SHADERS]++;
             }
+            break;
         }
-        else if (call->mCallName.compare(0, 10, "glDispatch") == 0 && relevant(frames))
+        case ANALYZE_glDispatch:
         {
+            if (!relevant(frames))
+            {
+                break;
+            }
             compute++;
             perframe["compute"].values.back()++;
             if (call->mCallName == "glDispatchComputeIndirect")
             {
                 features[FEATURE_INDIRECT_COMPUTE]++;
             }
+            break;
         }
-        else if (call->mCallName == "glDrawTexiOES")
+        case ANALYZE_glDrawTexiOES:
         {
             // GLES1 texture to screen blitting extension
+            break;
         }
-        else if (call->mCallName.compare(0, 6, "glDraw") == 0 && call->mCallName != "glDrawBuffers" && relevant(frames))
+        case ANALYZE_glDraw:
         {
+            if (!relevant(frames))
+            {
+                break;
+            }
             StateTracker::Framebuffer* writeframebuffer = nullptr;
 
             if (input.contexts[context_index].drawframebuffer != 0)
@@ -1380,6 +1674,8 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
                 perdraw["spatial_locality"].values.back() = params.spatial_locality * 100.0;
                 perdraw["temporal_locality"].values.back() = params.temporal_locality * 100.0;
                 perdraw["vec4_locality"].values.back() = params.vec4_locality * 100.0;
+                perdraw["fifo_hit_rate"].values.back() = params.fifo_hit_rate * 100.0;
+                perdraw["lru_hit_rate"].values.back() = params.lru_hit_rate * 100.0;
                 perdraw["instancing"].values.back() = params.instances;
                 startNewRows(perdraw);
             }
@@ -1434,7 +1730,7 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
                     }
                     const GLuint texture_id = input.contexts[context_index].textureUnits[s.value][binding];
                     contexts[context_index].textureIdUsed.insert(texture_id);
-                    dumpstream << "TextureUnit:" << s.value << "(" + texEnum(binding) + ") = TexureId:" << texture_id << ",SamplerId:"
+                    dumpstream << "TextureUnit:" << s.value << "(" << texEnum(binding) << ") = TexureId:" << texture_id << ",SamplerId:"
                                << input.contexts[context_index].sampler_binding[s.value] << std::endl << "    ";
                     StateTracker::SamplerState sampler;
                     const GLuint samplerObject = input.contexts[context_index].sampler_binding[s.value];
@@ -1481,11 +1777,20 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
             dumpstream << "frame=" << frames << " ";
             dumpstream << std::endl;
             drawcalls++;
+            break;
         }
-        else if ((call->mCallName == "glClear" || call->mCallName.compare(0, 13, "glClearBuffer") == 0) && relevant(frames))
+        case ANALYZE_glClear:
         {
+            if (!relevant(frames))
+            {
+                break;
+            }
             clears++;
             perframe["clears"].values.back()++;
+            break;
+        }
+        default:
+            break;
         }
 
         if (surfaces.size() > static_cast<unsigned>(input.surface_index) && input.surface_index != UNBOUND)
@@ -1505,12 +1810,16 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
         if (relevant(frames))
         {
             calls++;
-            CallData& callData = mCallData[call->mCallName];
+            CallData& callData = (call->mCallId > 0 && call->mCallId < mCallDataById.size()) ? mCallDataById[call->mCallId] : mCallData[call->mCallName];
             callData.cycles += input.getCpuCycles();
             callData.count++;
-            perframe["calls"].values.back()++;
+            perframeCalls.values.back()++;
         }
     }
+    if (formatter)
+    {
+        formatter->finish(dumptext);
+    }
 
     for (auto& c : input.contexts)
     {
@@ -1553,6 +1862,13 @@ void AnalyzeTrace::analyze(ParseInterfaceRetracing& input)
     // CSV
     write_CSV(dump_csv_filename.empty() ? "trace" : dump_csv_filename, perframe, true);
     // Dump out callstats
+    for (unsigned int id = 1; id < mCallDataById.size(); ++id)
+    {
+        if (mCallDataById[id].count > 0)
+        {
+            mCallData[common::ApiInfo::IdToNameArr[id]] = mCallDataById[id];
+        }
+    }
     write_callstats(mCallData, dump_csv_filename.empty() ? "trace" : dump_csv_filename);
 }
 
@@ -2275,7 +2591,7 @@ Json::Value AnalyzeTrace::frame_json(ParseInterfaceRetracing& input, int frame)
             Json::Value rb = json_base(c.renderbuffers[idx]);
             GLuint id = c.renderbuffers[idx].id;
             digraph += "    rb_" + std::to_string(id) + " [shape=Mrecord, label=\"{Renderbuffer " + std::to_string(id) + "|";
-            digraph += texEnum(c.renderbuffers[idx].internalformat) + "}|{" + std::to_string(c.renderbuffers[idx].samples) + "|";
+            digraph += std::string(texEnum(c.renderbuffers[idx].internalformat)) + "}|{" + std::to_string(c.renderbuffers[idx].samples) + "|";
             digraph += dim2str(c.renderbuffers[idx].width, c.renderbuffers[idx].height, 1) + "}\"];\n";
             subresult["renderbuffers"].append(rb);
         }
@@ -2283,7 +2599,7 @@ Json::Value AnalyzeTrace::frame_json(ParseInterfaceRetracing& input, int frame)
         {
             GLuint id = c.textures[idx].id;
             digraph += "    tex_" + std::to_string(id) + " [shape=record, label=\"{Texture " + std::to_string(id) + "|";
-            digraph += texEnum(c.textures[idx].internal_format) + "}|{" + texEnum(c.textures[idx].binding_point) + "|";
+            digraph += std::string(texEnum(c.textures[idx].internal_format)) + "}|{" + texEnum(c.textures[idx].binding_point) + "|";
             digraph += dim2str(c.textures[idx].width, c.textures[idx].height, c.textures[idx].depth) + "}\"];\n";
         }
         if (c.render_passes.size() > 0)
@@ -0,0 +1,93 @@
+#ifndef _TOOL_CALL_DISPATCH_HPP_
+#define _TOOL_CALL_DISPATCH_HPP_
+
+#include <string.h>
+#include <vector>
+
+#include "common/api_info.hpp"
+
+// Maps the call ids of api_info.hpp (CallTM::mCallId) to small codes, so
+// that code looking at every call of a trace can switch on an integer
+// instead of comparing call names.
+//
+// The table is filled by name once, before any call is looked at. Like an
+// if/else chain, a call keeps the first code it is given, so exact names
+// should be added (or excluded) before the prefixes that also match them.
+template <typename Code>
+class CallDispatchTable
+{
+public:
+    explicit CallDispatchTable(Code unhandled)
+        : mUnhandled(unhandled)
+        , mCodes(common::ApiInfo::MaxSigId + 1, unhandled)
+        , mAssigned(mCodes.size(), false)
+    {
+    }
+
+    CallDispatchTable& add(const char* name, Code code)
+    {
+        const unsigned short id = common::gApiInfo.NameToId(name);
+        if (id)
+        {
+            assign(id, code);
+        }
+        return *this;
+    }
+
+    // Keep a call unhandled, even if a later prefix matches it
+    CallDispatchTable& exclude(const char* name)
+    {
+        return add(name, mUnhandled);
+    }
+
+    // All calls whose name starts with prefix
+    CallDispatchTable& addPrefix(const char* prefix, Code code)
+    {
+        const size_t len = strlen(prefix);
+        for (unsigned int id = 1; id < mCodes.size(); ++id)
+        {
+            const char* name = common::ApiInfo::IdToNameArr[id];
+            if (name && strncmp(name, prefix, len) == 0)
+            {
+                assign(id, code);
+            }
+        }
+        return *this;
+    }
+
+    // All calls whose name contains part
+    CallDispatchTable& addContaining(const char* part, Code code)
+    {
+        for (unsigned int id = 1; id < mCodes.size(); ++id)
+        {
+            const char* name = common::ApiInfo::IdToNameArr[id];
+            if (name && strstr(name, part))
+            {
+                assign(id, code);
+            }
+        }
+        return *this;
+    }
+
+    // Calls unknown to api_info.hpp (id 0) are unhandled
+    Code operator[](unsigned int id) const
+    {
+        return id < mCodes.size() ? mCodes[id] : mUnhandled;
+    }
+
+private:
+    void assign(unsigned int id, Code code)
+    {
+        if (!mAssigned[id])
+        {
+            mCodes[id] = code;
+            mAssigned[id] = true;
+        }
+    }
+
+    Code mUnhandled;
+    std::vector<Code> mCodes;
+    std::vector<bool> mAssigned;
+};
+
+#endif
@@ -0,0 +1,213 @@
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "common/in_file.hpp"
+#include "common/file_format.hpp"
+#include "common/out_file.hpp"
+#include "common/os.hpp"
+#include "tool/config.hpp"
+#include "tool/utils.hpp"
+
+static void printHelp()
+{
+    std::cout <<
+        "Usage : concat [OPTIONS] <target trace> <segment> [<segment> ...]\n"
+        "Joins traces, usually the segments written by split, into one trace.\n"
+        "The state prefix that split -s puts in front of a segment is left out, and\n"
+        "the call and frame counts of the header are recomputed. The prefix is skipped by\n"
+        "its call count, so a warning is printed if a segment no longer matches its header.\n"
+        "Options:\n"
+        "  -h            print help\n"
+        "  -v            print version\n"
+        ;
+}
+
+static void printVersion()
+{
+    std::cout << PATRACE_VERSION << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    int argIndex = 1;
+    for (; argIndex < argc; ++argIndex)
+    {
+        const char *arg = argv[argIndex];
+
+        if (arg[0] != '-')
+            break;
+
+        if (!strcmp(arg, "-h"))
+        {
+            printHelp();
+            return 1;
+        }
+        else if (!strcmp(arg, "-v"))
+        {
+            printVersion();
+            return 1;
+        }
+        else
+        {
+            printf("Error: Unknow option %s\n", arg);
+            printHelp();
+            return 1;
+        }
+    }
+
+    if (argIndex + 2 > argc)
+    {
+        printHelp();
+        return 1;
+    }
+    const char* target_trace_filename = argv[argIndex++];
+    const std::vector<std::string> segment_filenames(argv + argIndex, argv + argc);
+
+    // The segments may have been processed by tools that write their own sigbook,
+    // so the target gets the union of them and the ids are translated per segment.
+    std::vector<std::string> sigbook(1);
+    std::map<std::string, unsigned short> sigbookIds;
+    Json::Value header;
+    int tid = 0;
+    for (size_t i = 0; i < segment_filenames.size(); ++i)
+    {
+        common::InFile inputFile;
+        inputFile.prepareChunks();
+        if (!inputFile.Open(segment_filenames[i].c_str()))
+        {
+            DBG_LOG("Failed to open for reading: %s\n", segment_filenames[i].c_str());
+            return 1;
+        }
+        for (unsigned int id = 1; id <= inputFile.GetMaxSigId(); ++id)
+        {
+            const std::string name = inputFile.ExIdToName(id);
+            if (sigbookIds.insert(std::make_pair(name, (unsigned short)sigbook.size())).second)
+            {
+                sigbook.push_back(name);
+            }
+        }
+
+        const Json::Value segmentHeader = inputFile.getJSONHeader();
+        if (i == 0)
+        {
+            header = segmentHeader;
+            tid = segmentHeader["segment"].get("frameThread", inputFile.getDefaultThreadID()).asInt();
+        }
+        if (segmentHeader.isMember("segment") && segmentHeader["segment"]["index"].asUInt() != i)
+        {
+            DBG_LOG("Warning: %s is segment %u, not %u\n", segment_filenames[i].c_str(),
+                    segmentHeader["segment"]["index"].asUInt(), (unsigned int)i);
+        }
+        inputFile.Close();
+    }
+
+    common::OutFile outputFile;
+    if (!outputFile.Open(target_trace_filename, true, &sigbook))
+    {
+        DBG_LOG("Failed to open for writing: %s\n", target_trace_filename);
+        return 1;
+    }
+
+    unsigned long long callCount = 0;
+    unsigned int frameCount = 0;
+    std::vector<char> buffer;
+    Json::Value sources = Json::arrayValue;
+    for (const std::string& segment_filename : segment_filenames)
+    {
+        common::InFile inputFile;
+        inputFile.prepareChunks();
+        if (!inputFile.Open(segment_filename.c_str()))
+        {
+            DBG_LOG("Failed to open for reading: %s\n", segment_filename.c_str());
+            return 1;
+        }
+        sources.append(segment_filename);
+
+        std::vector<unsigned short> ids(inputFile.GetMaxSigId() + 1, 0);
+        bool sameIds = true;
+        for (unsigned int id = 1; id < ids.size(); ++id)
+        {
+            ids[id] = sigbookIds[inputFile.ExIdToName(id)];
+            sameIds = sameIds && ids[id] == id;
+        }
+
+        const Json::Value segmentHeader = inputFile.getJSONHeader();
+        const Json::Value& segmentInfo = segmentHeader["segment"];
+        const unsigned long long prefixCalls = segmentInfo.get("prefixCalls", 0).asUInt64();
+        if (segmentInfo.isMember("firstCall") && segmentInfo["firstCall"].asUInt64() != callCount)
+        {
+            DBG_LOG("Warning: %s starts at call %llu of the split trace, but %llu calls were joined before it\n",
+                    segment_filename.c_str(), (unsigned long long)segmentInfo["firstCall"].asUInt64(), callCount);
+        }
+        const unsigned short swapId = inputFile.NameToExId("eglSwapBuffers");
+        const unsigned short swapWithDamageId = inputFile.NameToExId("eglSwapBuffersWithDamageKHR");
+
+        unsigned long long callNo = 0;
+        unsigned int segmentFrames = 0;
+        bool swapInPrefix = false;
+        void *fptr = NULL;
+        char *src = NULL;
+        common::BCall_vlen call;
+        while (inputFile.GetNextCall(fptr, call, src))
+        {
+            const bool isSwap = (int)call.tid == tid && (call.funcId == swapId || call.funcId == swapWithDamageId);
+            if (callNo++ < prefixCalls)
+            {
+                // The state prefix has no frame work, so it never ends a frame
+                swapInPrefix = swapInPrefix || isSwap;
+                continue;
+            }
+            const int fixedLen = inputFile.ExIdToLen(call.funcId);
+            const char* data = fixedLen == 0 ? src - sizeof(common::BCall_vlen) : src - sizeof(common::BCall);
+            const unsigned int len = fixedLen == 0 ? call.toNext : fixedLen;
+            if (sameIds)
+            {
+                outputFile.WriteRaw(data, len);
+            }
+            else
+            {
+                buffer.assign(data, data + len);
+                common::BCall* copy = reinterpret_cast<common::BCall*>(buffer.data());
+                copy->funcId = ids[call.funcId];
+                outputFile.WriteRaw(buffer.data(), len);
+            }
+            callCount++;
+
+            if (isSwap)
+            {
+                frameCount++;
+                segmentFrames++;
+                outputFile.EndFrame(tid);
+            }
+        }
+        inputFile.Close();
+
+        // The prefix is skipped by its call count, so check that the calls after it
+        // are still the frames split wrote, in case the segment was changed since.
+        if (callNo < prefixCalls || swapInPrefix ||
+            (segmentInfo.isMember("prefixCalls") && (callNo != segmentHeader.get("callCnt", 0).asUInt64() ||
+                                                     segmentFrames != segmentHeader.get("frameCnt", 0).asUInt())))
+        {
+            DBG_LOG("Warning: %s no longer matches the calls and frames split wrote, so skipping a state prefix of %llu calls may drop or repeat calls\n",
+                    segment_filename.c_str(), prefixCalls);
+        }
+    }
+
+    header.removeMember("segment");
+    header["callCnt"] = (Json::Value::UInt64)callCount;
+    header["frameCnt"] = frameCount;
+    Json::Value info;
+    info["segments"] = sources;
+    addConversionEntry(header, "concat", segment_filenames.front(), info);
+    Json::FastWriter writer;
+    const std::string json_header = writer.write(header);
+    outputFile.mHeader.jsonLength = json_header.size();
+    outputFile.WriteHeader(json_header.c_str(), json_header.size());
+    outputFile.Close();
+
+    DBG_LOG("Joined %u segments: %llu calls, %u frames in thread %d\n", (unsigned int)segment_filenames.size(),
+            callCount, frameCount, tid);
+    return 0;
+}
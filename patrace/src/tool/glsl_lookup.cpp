@@ -237,7 +237,8 @@ const std::string& lookup_get_string(Keyword key)
 
 KeywordDefinition lookup_get(const std::string& key)
 {
-    if (keywords.count(key)) return keywords.at(key);
+    const auto it = keywords.find(key);
+    if (it != keywords.end()) return it->second;
     else return { Keyword::None, KeywordType::None };
 }
 
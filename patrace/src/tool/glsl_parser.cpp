@@ -1,7 +1,6 @@
 #include <algorithm>
 #include <cassert>
 #include <string>
-#include <sstream>
 #include <stddef.h>
 #include <unordered_map>
 #include <climits>
@@ -9,7 +8,6 @@
 
 // TBD:
 // * support UTF-8
-// * could be _a lot_ more efficient if I used c++14 string views, but probably don't care about performance here
 // * parse any binding values of samplers (and other inputs)
 
 #include "glsl_parser.h"
@@ -24,6 +22,8 @@
 #define ASSERT(_stmt, _line, ...) do { if (!(_stmt)) { fprintf(stderr, "input=\"%s\" lineno=%d line=\"%s\"\n", mShaderName.c_str(), mLineNo, _line); fprintf(stderr, __VA_ARGS__); fprintf(stderr, "\n"); assert(false); } } while(0)
 #define ELOG(...) do { fprintf(stderr, __VA_ARGS__); fprintf(stderr, " (filename=%s, line=%d)\n", mShaderName.c_str(), mLineNo); } while(0)
 
+typedef std::unordered_map<std::string, Define> Defines;
+
 static inline int is_special(char curr, char next, char next2)
 {
     static const char* start_special = ";|&()!=+-*/%<>&^|<>|&!*/%<><>^~:,{}[]??++--.\n";
@@ -54,42 +54,87 @@ static void special_test()
     assert(is_special('>','=', ' ') == 2);
 }
 
+/// A piece of the shader source, pointing into it rather than holding a copy
+struct TextRef
+{
+    const char* data = "";
+    size_t size = 0;
+
+    TextRef() {}
+    TextRef(const char* begin, const char* end) : data(begin), size(end - begin) {}
+
+    bool empty() const { return size == 0; }
+    const char* end() const { return data + size; }
+    std::string str() const { return std::string(data, size); }
+    bool contains(char c) const { return memchr(data, c, size) != nullptr; }
+
+    template<size_t N> bool operator==(const char (&s)[N]) const { return size == N - 1 && memcmp(data, s, N - 1) == 0; }
+    template<size_t N> bool operator!=(const char (&s)[N]) const { return !(*this == s); }
+    bool operator==(const std::string& s) const { return size == s.size() && memcmp(data, s.data(), size) == 0; }
+    bool operator!=(const std::string& s) const { return !(*this == s); }
+};
+
+static inline std::string& operator+=(std::string& s, const TextRef& t)
+{
+    return s.append(t.data, t.size);
+}
+
 struct Token
 {
-    std::string str;
+    TextRef str;
     enum tokentype
     {
         OPERATOR, IDENTIFIER, KEYWORD, EMPTY
     } type = EMPTY;
-    Keyword keyword;
-    KeywordType keywordType;
-    std::string whitespace;
-    Token(const std::string& s, tokentype t, KeywordDefinition k, const std::string& w) : str(s), type(t), keyword(k.keyword), keywordType(k.type), whitespace(w) {}
-    Token() {}
+    Keyword keyword = Keyword::None;
+    KeywordType keywordType = KeywordType::None;
+    TextRef whitespace;
 };
 
-static Token scan_token(std::string& line, unsigned start = 0)
+/// Splits source text into tokens in a single pass. Tokens are separated by
+/// spaces and tabs or by operators, and newlines are tokens of their own.
+/// The tokens point into the source, which must outlive them.
+class Lexer
 {
-    std::string whitespace;
-    Token::tokentype type = Token::IDENTIFIER;
-    const size_t length = line.size();
-    if (length == 0)
+public:
+    Lexer(const char* begin, const char* end) : mPos(begin), mEnd(end) {}
+    explicit Lexer(const std::string& s) : mPos(s.data()), mEnd(s.data() + s.size()) {}
+    explicit Lexer(const TextRef& t) : mPos(t.data), mEnd(t.end()) {}
+
+    bool done() const { return mPos >= mEnd; }
+    const char* position() const { return mPos; }
+    const char* end() const { return mEnd; }
+    void seek(const char* pos) { mPos = pos; }
+    /// The source that has not been consumed yet
+    TextRef rest() const { return TextRef(mPos, mEnd); }
+    Token next();
+
+private:
+    const char* mPos;
+    const char* mEnd;
+};
+
+Token Lexer::next()
+{
+    Token token;
+    if (mPos >= mEnd)
     {
-        line = "";
-        return { "", Token::EMPTY, { Keyword::None, KeywordType::None }, "" };
+        return token;
     }
-    while (start < length && line[start] != '\0' && (line[start] == '\t' || line[start] == ' '))
+    const char* start = mPos;
+    while (start < mEnd && (*start == '\t' || *start == ' '))
     {
-        whitespace += line[start]; // store whitespace
         start++; // skip whitespace
     }
-    size_t end = start;
-    while (end < length && line[end] != '\0' && line[end] != '\t' && line[end] != ' ')
+    token.whitespace = TextRef(mPos, start);
+    token.type = Token::IDENTIFIER;
+    const char* end = start;
+    while (end < mEnd && *end != '\0' && *end != '\t' && *end != ' ')
     {
-        const int special = is_special(line[end], (length - end > 0) ? line[end + 1] : ' ', (length - end > 1) ? line[end + 2] : ' ');
+        const int special = is_special(*end, (end + 1 < mEnd) ? end[1] : '\0', (end + 2 < mEnd) ? end[2] : ' ');
         if (special && end == start) {
             end += special;    // got something
-            type = Token::OPERATOR;
+            token.type = Token::OPERATOR;
             break;
         }
         else if (special && end != start) {
@@ -97,126 +142,169 @@ static Token scan_token(std::string& line, unsigned start = 0)
         }
         end++;
     }
-    std::string ret = line.substr(start, end - start); // non-inclusive for end
-    KeywordDefinition k = lookup_get(ret);
-    if (k.keyword != Keyword::None)
+    if (end == start && end < mEnd && *end == '\0')
+    {
+        end++; // step over stray nul characters instead of stopping at them forever
+    }
+    token.str = TextRef(start, end);
+    mPos = end;
+    if (token.type == Token::IDENTIFIER && !token.str.empty() && (isalpha((unsigned char)*start) || *start == '_'))
+    {
+        const KeywordDefinition k = lookup_get(token.str.str());
+        token.keyword = k.keyword;
+        token.keywordType = k.type;
+        if (k.keyword != Keyword::None)
+        {
+            token.type = Token::KEYWORD;
+        }
+    }
+    return token;
+}
+
+/// First of the given characters in [p, end), or nullptr
+static const char* find_any(const char* p, const char* end, const char* chars)
+{
+    for (; p < end && *p != '\0'; p++)
     {
-        type = Token::KEYWORD;
+        if (strchr(chars, *p))
+        {
+            return p;
+        }
     }
-    line = line.substr(end);
-    return { ret, type, k, whitespace };
+    return nullptr;
 }
 
-static std::string scan_rest(std::string& line, unsigned start = 0)
+/// End of the line starting at p, that is its newline or the end of the text
+static const char* line_end(const char* p, const char* end)
 {
-    if (start >= line.size()) return std::string();
-    unsigned end = start + 1;
-    while (start == end || line[end] != '\0') end++; // skip non-whitespace
-    std::string ret = line.substr(start, end - start);
-    if (end > line.size()) line = std::string();
-    else line = line.substr(end);
-    return ret;
+    const char* newline = static_cast<const char*>(memchr(p, '\n', end - p));
+    return newline ? newline : end;
 }
 
-static std::string macro_expansion(const std::string& orig, const std::unordered_map<std::string, Define>& defines);
+static void macro_expansion(Lexer& input, const Defines& defines, std::string& out);
 
-static std::string replace_macro(std::string& s, const Define& define, const std::unordered_map<std::string, Define>& defines)
+static std::string macro_expansion(const TextRef& text, const Defines& defines)
+{
+    std::string r;
+    Lexer input(text);
+    macro_expansion(input, defines, r);
+    return r;
+}
+
+static std::string macro_expansion(const std::string& text, const Defines& defines)
+{
+    return macro_expansion(TextRef(text.data(), text.data() + text.size()), defines);
+}
+
+/// Appends the expansion of a macro to out. The arguments of a function-like
+/// macro are consumed from input. Returns false, consuming nothing, if they
+/// cannot be found.
+static bool replace_macro(Lexer& input, const Define& define, const Defines& defines, std::string& out)
 {
     if (define.params.size() == 0) // easy! (simple macro)
     {
-        return define.value;
+        out += define.value;
+        return true;
     }
-    else if (s.size() == 0 || s[0] == '\n' || s[0] == '\0')
+    else if (input.done() || *input.position() == '\n' || *input.position() == '\0')
     {
-        return s;
+        out += input.rest();
+        return true;
     }
-    else // harder (macro function)
+
+    // harder (macro function)
+    std::vector<std::string> replacements;
+    const char* const end = input.end();
+    // cannot use the lexer below, since input does not follow token rules
+    const char* next = find_any(input.position(), end, "(");
+    if (!next)
     {
-        std::vector<std::string> replacements;
-        // cannot use scan_token() below, since input does not follow token rules
-        const char* start = strchr(s.c_str(), '(');
-        assert(start);
-        unsigned i = 0;
-        const char* next = start;
-        do
+        return false;
+    }
+    do
+    {
+        next++;
+        while (next < end && (*next == ' ' || *next == '\t')) next++; // skip spaces
+        const char* probe = find_any(next, end, "(,)");
+        if (!probe)
+        {
+            return false;
+        }
+        if (*probe == '(') // function call inside function call
         {
-            next++;
-            while (*next == ' ' || *next == '\t') next++; // skip spaces
-            const char* probe = strpbrk(next, "(,)");
-            if (*probe == '(') // function call inside function call
+            int recursive = 1;
+            probe++;
+            while (recursive && probe)
             {
-                int recursive = 1;
-                probe++;
-                do
+                probe = find_any(probe, end, "()");
+                if (probe)
                 {
-                    probe = strpbrk(probe, "()");
-                    if (*probe == '(') recursive++;
-                    else if (*probe == ')') recursive--;
+                    recursive += (*probe == '(') ? 1 : -1;
                     probe++;
-                } while (probe && recursive);
-                replacements.push_back(macro_expansion(std::string(next, probe - next), defines));
-                probe = strpbrk(probe, ",)");
+                }
             }
-            else
+            if (!probe)
             {
-                const char* lim = probe;
-                while (*lim == ' ' || *lim == '\t' || *lim == ',' || *lim == ')') lim--;
-                replacements.push_back(std::string(next, (lim + 1) - next));
+                return false;
             }
-            next = probe;
-            i++;
-        }
-        while (next && *next != ')');
-        s = std::string(++next); // consume parameters in input, let callee keep remains
-        assert(i == define.params.size()); // we found same number of parameters
-        // Ok, now replace
-        std::string ret;
-        std::string repl = define.value;
-        Token curr = scan_token(repl);
-        ret += curr.whitespace;
-        while (curr.str.size())
-        {
-            bool found = false;
-            int j = 0;
-            for (const std::string& r : define.params)
+            replacements.push_back(macro_expansion(TextRef(next, probe), defines));
+            probe = find_any(probe, end, ",)");
+            if (!probe)
             {
-                if (curr.str == r)
-                {
-                    ret += macro_expansion(replacements.at(j), defines);// + " ";
-                    found = true;
-                    break;
-                }
-                j++;
+                return false;
             }
-            if (!found)
+        }
+        else
+        {
+            const char* lim = probe;
+            while (lim >= next && (*lim == ' ' || *lim == '\t' || *lim == ',' || *lim == ')')) lim--;
+            replacements.push_back(std::string(next, lim + 1));
+        }
+        next = probe;
+    }
+    while (*next != ')');
+    input.seek(next + 1); // consume parameters in input, let caller keep remains
+    assert(replacements.size() == define.params.size()); // we found same number of parameters
+
+    // Ok, now replace
+    Lexer repl(define.value);
+    Token curr = repl.next();
+    out += curr.whitespace;
+    while (!curr.str.empty())
+    {
+        bool found = false;
+        for (size_t j = 0; j < define.params.size() && j < replacements.size(); j++)
+        {
+            if (curr.str == define.params[j])
             {
-                ret += macro_expansion(curr.str, defines);// + " ";
+                out += macro_expansion(replacements[j], defines);
+                found = true;
+                break;
             }
-            curr = scan_token(repl);
-            ret += curr.whitespace;
         }
-        return ret;
+        if (!found)
+        {
+            out += macro_expansion(curr.str, defines);
+        }
+        curr = repl.next();
+        out += curr.whitespace;
     }
+    return true;
 }
 
 /// As a side-effect, this strips most whitespace. Takes a line or line fragment as input.
-static std::string macro_expansion(const std::string& orig, const std::unordered_map<std::string, Define>& defines)
+static void macro_expansion(Lexer& input, const Defines& defines, std::string& out)
 {
-    std::string r;
-    std::string s = orig;
-    Token prev;
-    while (s.size())
+    while (!input.done())
     {
-        Token curr = scan_token(s);
-        if (defines.count(curr.str) > 0)
+        const Token curr = input.next();
+        out += curr.whitespace;
+        const auto define = (curr.type != Token::OPERATOR) ? defines.find(curr.str.str()) : defines.end();
+        if (define == defines.end() || !replace_macro(input, define->second, defines, out))
         {
-            const Define& d = defines.at(curr.str);
-            curr.str = replace_macro(s, d, defines);
+            out += curr.str;
         }
-        r += curr.whitespace + curr.str;
-        prev = curr;
     }
-    return r;
 }
 
 // All non-unary, non-parenthetical operators, all of which are left
@@ -290,18 +378,19 @@ bool GLSLParser::resolve_conditionals(const std::unordered_map<std::string, Defi
     ///
     std::vector<std::string> ops;
     std::vector<std::string> vals;
-    std::string tmpstr = expr;
+    Lexer lexer(expr);
     bool was_defined = false; // was previous directive a 'defined'? if so, do not macro expand!
     int was_unary = 0;
     bool may_be_unary = true;
     do {
-        Token token = scan_token(tmpstr);
+        const Token token = lexer.next();
+        const std::string str = token.str.str();
 
         char *end = nullptr;
-        long value = strtol(token.str.c_str(), &end, 10);
-        int op = match_operator(token.str);
+        long value = strtol(str.c_str(), &end, 10);
+        int op = match_operator(str);
 
-        if (end != nullptr && *end == '\0' && token.str.size() > 0) // valid integer value
+        if (end != nullptr && *end == '\0' && !token.str.empty()) // valid integer value
         {
             vals.push_back(std::to_string(value));
             may_be_unary = false;
@@ -337,7 +426,7 @@ bool GLSLParser::resolve_conditionals(const std::unordered_map<std::string, Defi
         else if (token.str == "defined" || token.str == "!" || token.str == "~")
         {
             may_be_unary = true;
-            ops.push_back(token.str);
+            ops.push_back(str);
             was_defined = (token.str == "defined");
             was_unary++;
         }
@@ -355,7 +444,7 @@ bool GLSLParser::resolve_conditionals(const std::unordered_map<std::string, Defi
                 top_op = 0;
                 if (ops.size() > 0) top_op = match_operator(ops.back());
             }
-            ops.push_back(token.str);
+            ops.push_back(str);
         }
         else if (token.str == ")")
         {
@@ -371,30 +460,34 @@ bool GLSLParser::resolve_conditionals(const std::unordered_map<std::string, Defi
         {
             // macro expansion
             may_be_unary = false;
-            if (!was_defined && defines.count(token.str) > 0)
+            const auto define = was_defined ? defines.end() : defines.find(str);
+            if (define != defines.end())
             {
                 // can only pray they don't nest resolving somehow
-                const Define& d = defines.at(token.str);
+                const Define& d = define->second;
                 if (d.params.size() > 0) // macro function
                 {
-                    std::string t = token.str;
-                    token = scan_token(tmpstr, 0);
-                    ASSERT(token.str == "(", expr.c_str(), "Function without parenthesis begin");
-                    t += token.str;
-                    while (token.str.size() && token.str != ")")
+                    std::string t = str;
+                    Token arg = lexer.next();
+                    ASSERT(arg.str == "(", expr.c_str(), "Function without parenthesis begin");
+                    t += arg.str;
+                    while (!arg.str.empty() && arg.str != ")")
                     {
-                        token = scan_token(tmpstr, 0);
-                        t += token.str;
+                        arg = lexer.next();
+                        t += arg.str;
                     }
-                    ASSERT(token.str == ")", expr.c_str(), "Function without parenthesis end");
-                    token.str = macro_expansion(t, defines);
+                    ASSERT(arg.str == ")", expr.c_str(), "Function without parenthesis end");
+                    vals.push_back(macro_expansion(t, defines));
                 }
                 else
                 {
-                    token.str = d.value;
+                    vals.push_back(d.value);
                 }
             }
-            vals.push_back(token.str);
+            else
+            {
+                vals.push_back(str);
+            }
             was_defined = false;
             while (was_unary && ops.size() > 0 && ops.back() != "(")
             {
@@ -404,7 +497,7 @@ bool GLSLParser::resolve_conditionals(const std::unordered_map<std::string, Defi
                 was_unary--;
             }
         }
-    } while (tmpstr.size());
+    } while (!lexer.done());
     while (ops.size() > 0)
     {
         vals.push_back(ops.back());
@@ -482,10 +575,11 @@ bool GLSLParser::resolve_conditionals(const std::unordered_map<std::string, Defi
 
 // Implements GLSL spec 3.10 step 9. Steps 4, 6 and 7 must have
 // been done previously. Steps 5 and 8 are to be skipped.
-GLSLShader GLSLParser::preprocessor(std::string shader, int shaderType)
+GLSLShader GLSLParser::preprocessor(const std::string& shader, int shaderType)
 {
     GLSLShader ret;
     ret.shaderType = shaderType;
+    ret.code.reserve(shader.size());
     std::unordered_map<std::string, Define> defines;
     defines["GL_ES"] = { "1" };
     defines["GL_FRAGMENT_PRECISION_HIGH"] = { "1" };
@@ -496,34 +590,34 @@ GLSLShader GLSLParser::preprocessor(std::string shader, int shaderType)
     defines["GL_EXT_primitive_bounding_box"] = { "1" };
     defines["GL_OES_shader_io_blocks"] = { "1" };
     defines["GL_EXT_shader_non_constant_global_initializers"] = { "1" };
-    std::istringstream lines(shader);
-    std::string orig_line;
     std::vector<int> nested; // 1 - true, 0 - false, -1 - false but has been true
     mLineNo = 1;
-    while (std::getline(lines, orig_line))
+    const char* const shaderEnd = shader.data() + shader.size();
+    const char* lineEnd = nullptr;
+    for (const char* lineBegin = shader.data(); lineBegin < shaderEnd; lineBegin = lineEnd + 1) // past the terminating nul at most
     {
-        int i = 0;
-        std::string line = orig_line;
-        while (line[i] != '\0' && (line[i] == '\t' || line[i] == ' ')) i++; // skip whitespace
-        if (line[i] == '#') // found a preprocessor directive
+        lineEnd = line_end(lineBegin, shaderEnd);
+        const char* p = lineBegin;
+        while (p < lineEnd && *p != '\0' && (*p == '\t' || *p == ' ')) p++; // skip whitespace
+        if (p < lineEnd && *p == '#') // found a preprocessor directive
         {
-            i++; // skip the #
-            std::string directive = scan_token(line, i).str;
+            Lexer line(p + 1, lineEnd); // skip the #
+            const std::string directive = line.next().str.str();
             if (directive == "endif")
             {
-                ASSERT(nested.size(), orig_line.c_str(), "Mismatched if...endif");
+                ASSERT(nested.size(), std::string(lineBegin, lineEnd).c_str(), "Mismatched if...endif");
                 nested.pop_back();
                 if (mDebug) ret.code += "//## removed endif nesting=" + std::to_string(nested.size());
             }
             else if (directive == "else")
             {
-                ASSERT(nested.size(), orig_line.c_str(), "Mismatched if...else");
+                ASSERT(nested.size(), std::string(lineBegin, lineEnd).c_str(), "Mismatched if...else");
                 nested.back() = (nested.back() == 0);
                 if (mDebug) ret.code += std::string("//## removed else next=") + std::to_string(nested.back());
             }
             else if (directive == "ifdef" || directive == "ifndef")
             {
-                std::string macro = scan_token(line).str;
+                std::string macro = line.next().str.str();
                 bool success = (defines.count(macro) > 0 || macro == "GL_ES");
                 if (directive == "ifndef")
                 {
@@ -541,7 +635,7 @@ GLSLShader GLSLParser::preprocessor(std::string shader, int shaderType)
                 }
                 else
                 {
-                    std::string conditionals = scan_rest(line);
+                    const std::string conditionals = line.rest().str();
                     bool success = resolve_conditionals(defines, conditionals, shaderType);
                     if (directive != "elif")
                     {
@@ -563,39 +657,38 @@ GLSLShader GLSLParser::preprocessor(std::string shader, int shaderType)
             }
             else if (directive == "define")
             {
-                std::string key = scan_token(line).str;
+                std::string key = line.next().str.str();
                 std::string value;
                 // it is only a function-like macro if the parenthesis follows immediately after WITHOUT any whitespace
                 Define d = { key };
-                if (line[0] == '(') // is a function-like macro
+                if (!line.done() && *line.position() == '(') // is a function-like macro
                 {
-                    value = scan_token(line).str;
-                    while (value != ")")
+                    value = line.next().str.str();
+                    while (value != ")" && !line.done())
                     {
-                        value = scan_token(line).str;
+                        value = line.next().str.str();
                         if (value != ")" && value != ",")
                         {
                             d.params.push_back(value);
                         }
                     }
                 }
-                value = scan_rest(line);
-                d.value = macro_expansion(value, defines);
-                ASSERT(key.size() > 0, orig_line.c_str(), "Bad define key!");
+                d.value = macro_expansion(line.rest(), defines);
+                ASSERT(key.size() > 0, std::string(lineBegin, lineEnd).c_str(), "Bad define key!");
                 defines[key] = d;
                 if (mDebug) ret.code += "//## gobbled up define key=" + key + " value=\"" + d.value + "\"";
             }
             else if (directive == "undef")
             {
-                std::string key = scan_token(line).str;
+                std::string key = line.next().str.str();
                 defines.erase(key);
                 if (mDebug) ret.code += "//## gobbled up undef key=" + key;
             }
             else if (directive == "extension")
             {
-                std::string ext = scan_token(line).str;
-                std::string colon = scan_token(line).str;
-                std::string cond = scan_token(line).str;
+                std::string ext = line.next().str.str();
+                std::string colon = line.next().str.str();
+                std::string cond = line.next().str.str();
                 assert(colon == ":");
                 assert(ext.size() > 0);
                 assert(cond.size() > 0);
@@ -605,14 +698,14 @@ GLSLShader GLSLParser::preprocessor(std::string shader, int shaderType)
                 }
                 else if (cond != "disable")
                 {
-                    ELOG("Bad extension directive: %s", orig_line.c_str());
+                    ELOG("Bad extension directive: %s", std::string(lineBegin, lineEnd).c_str());
                     assert(false);
                 }
                 if (mDebug) ret.code += "//## gobbled up extension ext=" + ext;
             }
             else if (directive == "version")
             {
-                std::string version = scan_token(line).str;
+                std::string version = line.next().str.str();
                 assert(version.size() > 0);
                 ret.version = strtol(version.c_str(), nullptr, 10);
                 assert(ret.version != INT_MAX && ret.version != INT_MIN); // over-/underflow
@@ -620,60 +713,60 @@ GLSLShader GLSLParser::preprocessor(std::string shader, int shaderType)
             }
             else if (directive == "error")
             {
-                std::string err_msg = scan_rest(line);
+                const std::string err_msg = line.rest().str();
                 ELOG("ERROR directive: %s", err_msg.c_str());
                 assert(false);
                 if (mDebug) ret.code += "//## triggered error";
             }
             else if (directive == "line")
             {
-                std::string newlineno = scan_token(line).str;
+                std::string newlineno = line.next().str.str();
                 long lineno2 = strtol(newlineno.c_str(), nullptr, 10);
                 assert(lineno2 != INT_MAX && lineno2 != INT_MIN); // over-/underflow
                 if (mDebug) ret.code += "//## gobbled up (ignored) line " + newlineno;
             }
             else if (directive == "pragma")
             {
-                std::string token = scan_token(line).str;
+                std::string token = line.next().str.str();
                 if (token.compare(0, 5, "debug") == 0)
                 {
-                    std::string first = scan_token(line).str;
-                    ASSERT(first == "(", orig_line.c_str(), "Pragma missing start parenthesis");
-                    std::string value = scan_token(line).str;
+                    std::string first = line.next().str.str();
+                    ASSERT(first == "(", std::string(lineBegin, lineEnd).c_str(), "Pragma missing start parenthesis");
+                    std::string value = line.next().str.str();
                     if (value == "on")
                     {
                         ret.contains_debug_on_pragma = true;
                     }
-                    std::string last = scan_token(line).str;
-                    ASSERT(last == ")", orig_line.c_str(), "Pragma missing close parenthesis");
+                    std::string last = line.next().str.str();
+                    ASSERT(last == ")", std::string(lineBegin, lineEnd).c_str(), "Pragma missing close parenthesis");
                 }
                 else if (token.compare(0, 8, "optimize") == 0)
                 {
-                    std::string first = scan_token(line).str;
-                    ASSERT(first == "(", orig_line.c_str(), "Pragma missing start parenthesis");
-                    std::string value = scan_token(line).str;
+                    std::string first = line.next().str.str();
+                    ASSERT(first == "(", std::string(lineBegin, lineEnd).c_str(), "Pragma missing start parenthesis");
+                    std::string value = line.next().str.str();
                     if (value == "off")
                     {
                         ret.contains_optimize_off_pragma = true;
                     }
-                    std::string last = scan_token(line).str;
-                    ASSERT(last == ")", orig_line.c_str(), "Pragma missing close parenthesis");
+                    std::string last = line.next().str.str();
+                    ASSERT(last == ")", std::string(lineBegin, lineEnd).c_str(), "Pragma missing close parenthesis");
                 }
                 else if (token.compare(0, 5, "STDGL") == 0)
                 {
                     // #pragma STDGL invariant(all)
-                    std::string type = scan_token(line).str;
+                    std::string type = line.next().str.str();
                     if (type == "invariant")
                     {
-                        std::string first = scan_token(line).str;
-                        ASSERT(first == "(", orig_line.c_str(), "Pragma missing start parenthesis");
-                        std::string value = scan_token(line).str;
+                        std::string first = line.next().str.str();
+                        ASSERT(first == "(", std::string(lineBegin, lineEnd).c_str(), "Pragma missing start parenthesis");
+                        std::string value = line.next().str.str();
                         if (value == "all")
                         {
                             ret.contains_invariant_all_pragma = true;
                         }
-                        std::string last = scan_token(line).str;
-                        ASSERT(last == ")", orig_line.c_str(), "Pragma missing close parenthesis");
+                        std::string last = line.next().str.str();
+                        ASSERT(last == ")", std::string(lineBegin, lineEnd).c_str(), "Pragma missing close parenthesis");
                     }
                 }
                 if (mDebug) ret.code += "//## gobbled up pragma " + token;
@@ -691,7 +784,7 @@ GLSLShader GLSLParser::preprocessor(std::string shader, int shaderType)
             }
             ret.code += "\n";
         }
-        else if (line.size() > 0 && line[0] != '\n' && line[0] != '\0')
+        else if (lineEnd > lineBegin && *lineBegin != '\0')
         {
             if (nested.size() > 0
                     && (std::find(std::begin(nested), std::end(nested), 0) != std::end(nested)
@@ -702,7 +795,8 @@ GLSLShader GLSLParser::preprocessor(std::string shader, int shaderType)
             }
             else
             {
-                ret.code += macro_expansion(orig_line, defines);
+                Lexer line(lineBegin, lineEnd);
+                macro_expansion(line, defines, ret.code);
             }
             ret.code += "\n";
         }
@@ -714,51 +808,53 @@ GLSLShader GLSLParser::preprocessor(std::string shader, int shaderType)
 std::string GLSLParser::inline_includes(const std::string& s)
 {
     std::string r;
-    std::istringstream lines(s);
-    std::string orig_line;
+    r.reserve(s.size());
     mLineNo = 1;
-    while (std::getline(lines, orig_line))
+    const char* const end = s.data() + s.size();
+    const char* lineEnd = nullptr;
+    for (const char* lineBegin = s.data(); lineBegin < end; lineBegin = lineEnd + 1) // past the terminating nul at most
     {
-        int i = 0;
-        std::string line = orig_line;
-        while (line[i] != '\0' && (line[i] == '\t' || line[i] == ' ')) i++; // skip whitespace
-        if (line[i] == '#') // found a preprocessor directive
+        lineEnd = line_end(lineBegin, end);
+        const char* p = lineBegin;
+        while (p < lineEnd && *p != '\0' && (*p == '\t' || *p == ' ')) p++; // skip whitespace
+        Lexer line(p, lineEnd);
+        bool include = false;
+        if (p < lineEnd && *p == '#') // found a preprocessor directive
         {
-            i++; // skip the #
-            std::string directive = scan_token(line, i).str;
-            if (directive == "include")
+            line.seek(p + 1); // skip the #
+            include = (line.next().str == "include");
+        }
+        if (include)
+        {
+            p = line.position();
+            while (p < lineEnd && (*p == '\t' || *p == ' ' || *p == '"' || *p == '<')) p++; // skip noise
+            const char* q = p;
+            while (q < lineEnd && *q != '\0') q++;
+            std::string filename(p, q > p ? q - 1 : q); // drop the closing quote
+            FILE* fp = fopen(filename.c_str(), "r");
+            if (!fp)
             {
-                while (line[i] != '\0' && (line[i] == '\t' || line[i] == ' ' || line[i] == '"' || line[i] == '<')) i++; // skip noise
-                std::string filename = scan_rest(line, i); // filename
-                filename = filename.substr(0, filename.size() - 1);
-                FILE* fp = fopen(filename.c_str(), "r");
-                if (!fp)
-                {
-                    fprintf(stderr, "Include file not found \"%s\" on line %d\n", filename.c_str(), mLineNo);
-                    return "";
-                }
-                std::string data;
-                fseek(fp, 0, SEEK_END);
-                data.resize(ftell(fp));
-                fseek(fp, 0, SEEK_SET);
-                size_t result = fread(&data[0], data.size(), 1, fp);
-                if (result != 1)
-                {
-                    fprintf(stderr, "Failed to read \"%s\": %s\n", filename.c_str(), strerror(ferror(fp)));
-                    return "";
-                }
-                fclose(fp);
-                r += inline_includes(data); // recursive call
-                r += '\n';
+                fprintf(stderr, "Include file not found \"%s\" on line %d\n", filename.c_str(), mLineNo);
+                return "";
             }
-            else
+            std::string data;
+            fseek(fp, 0, SEEK_END);
+            data.resize(ftell(fp));
+            fseek(fp, 0, SEEK_SET);
+            size_t result = fread(&data[0], data.size(), 1, fp);
+            if (result != 1)
             {
-                r += orig_line;
+                fprintf(stderr, "Failed to read \"%s\": %s\n", filename.c_str(), strerror(ferror(fp)));
+                return "";
             }
+            fclose(fp);
+            r += inline_includes(data); // recursive call
+            r += '\n';
         }
         else
         {
-            r += orig_line;
+            r.append(lineBegin, lineEnd);
+            r += '\n';
         }
         mLineNo++;
     }
@@ -770,6 +866,7 @@ std::string GLSLParser::inline_includes(const std::string& s)
 std::string GLSLParser::strip_comments(const std::string& s)
 {
     std::string r;
+    r.reserve(s.size());
     char prev = '\0';
     bool inside = false;
     bool prev_star = false;
@@ -837,8 +934,8 @@ std::string GLSLParser::strip_comments(const std::string& s)
 
 static void test_scan(const std::string& k, Token::tokentype ty, const std::string& r)
 {
-    std::string kc = k;
-    Token t = scan_token(kc);
+    Lexer lexer(k);
+    Token t = lexer.next();
     assert(t.type == ty);
     assert(t.str == r);
 }
@@ -849,10 +946,12 @@ void GLSLParser::self_test()
 
     const std::unordered_map<std::string, Define> om1{{"float2", {"vec2"}}};
     const char* v1 = " Square(float2 A)";
-    std::string i1 = v1;
+    const std::string i1 = v1;
     Define d1{"vec2"};
-    std::string r1 = replace_macro(i1, d1, om1);
-    assert(i1 == v1);
+    Lexer l1(i1);
+    std::string r1;
+    assert(replace_macro(l1, d1, om1, r1));
+    assert(l1.position() == i1.data());
     assert(r1 == "vec2");
 
     v1 = "float2 Square(float2 A)";
@@ -879,29 +978,32 @@ void GLSLParser::self_test()
     test_scan("<<=", Token::OPERATOR, "<<=");
     test_scan("<<=!1", Token::OPERATOR, "<<=");
     std::string s = "TOKEN TOKEN";
-    Token t = scan_token(s);
+    Lexer l2(s);
+    Token t = l2.next();
     assert(t.str == "TOKEN" && t.type == Token::IDENTIFIER);
-    t = scan_token(s);
+    t = l2.next();
     assert(t.str == "TOKEN" && t.type == Token::IDENTIFIER);
     s = "!TOKEN&&TOKEN";
-    t = scan_token(s);
+    l2 = Lexer(s);
+    t = l2.next();
     assert(t.str == "!" && t.type == Token::OPERATOR);
-    t = scan_token(s);
+    t = l2.next();
     assert(t.str == "TOKEN" && t.type == Token::IDENTIFIER);
-    t = scan_token(s);
+    t = l2.next();
     assert(t.str == "&&" && t.type == Token::OPERATOR);
-    t = scan_token(s);
+    t = l2.next();
     assert(t.str == "TOKEN" && t.type == Token::IDENTIFIER);
     s = "\tresult /= 255.0;";
-    t = scan_token(s);
+    l2 = Lexer(s);
+    t = l2.next();
     assert(t.str == "result" && t.type == Token::IDENTIFIER);
-    t = scan_token(s);
+    t = l2.next();
     assert(t.str == "/=" && t.type == Token::OPERATOR);
-    t = scan_token(s);
+    t = l2.next();
     assert(t.str == "255" && t.type == Token::IDENTIFIER);
-    t = scan_token(s);
+    t = l2.next();
     assert(t.str == "." && t.type == Token::OPERATOR);
-    t = scan_token(s);
+    t = l2.next();
     assert(t.str == "0" && t.type == Token::IDENTIFIER);
 
     const std::unordered_map<std::string, Define> oop{{"GL_ES", {"1"}},{"GL_FRAGMENT_PRECISION_HIGH", {"1"}},{"TRUEDEF",{"1"}},{"FALSEDEF",{"0"}}, {"LIGHTING", {"1"}}, {"MAX_BONE_WEIGHTS", {"2"}}};
@@ -983,15 +1085,16 @@ void GLSLParser::self_test()
     mDebug = was_debug;
 }
 
-std::string GLSLParser::compressed(GLSLShader shader)
+std::string GLSLParser::compressed(const GLSLShader& shader)
 {
     std::string r;
-    std::string feed = shader.code;
+    r.reserve(shader.code.size());
+    Lexer lexer(shader.code);
     Token prev;
     int line = 0;
-    while (feed.size())
+    while (!lexer.done())
     {
-        Token curr = scan_token(feed);
+        const Token curr = lexer.next();
         if ((curr.type == Token::IDENTIFIER || curr.type == Token::KEYWORD)
                 && curr.str != "=" && prev.str != "=" && curr.str != "."
                 && (prev.type == Token::IDENTIFIER || prev.type == Token::KEYWORD)) r += " "; // mandatory space
@@ -1012,7 +1115,7 @@ GLSLRepresentation GLSLParser::parse(const GLSLShader& shader)
 {
     GLSLRepresentation ret;
     mLineNo = 1;
-    std::string feed = shader.code;
+    Lexer lexer(shader.code);
     int block_depth = 0;
     /// Keep track of structure type definitions. Structures without a type name are immediately parsed
     std::unordered_map<std::string, GLSLRepresentation::Variable> structs; // type name : struct definitions
@@ -1049,16 +1152,16 @@ GLSLRepresentation GLSLParser::parse(const GLSLShader& shader)
     enum class Termination { None, StructScope, InterfaceScope, StructMember };
     Termination do_terminate = Termination::None;
     std::string struct_name; // definitions never nested
-    while (feed.size())
+    while (!lexer.done())
     {
-        Token curr = scan_token(feed);
+        Token curr = lexer.next();
         if (curr.str == "\n")
         {
             mLineNo++;
             continue;
         }
-        ASSERT(curr.str.find("\n") == std::string::npos, curr.str.c_str(), "EOL mixed into token");
-        ASSERT(nesting.size() <= 2, curr.str.c_str(), "Too many nested levels");
+        ASSERT(!curr.str.contains('\n'), curr.str.str().c_str(), "EOL mixed into token");
+        ASSERT(nesting.size() <= 2, curr.str.str().c_str(), "Too many nested levels");
 
         // Outside of global scope, we only interested in counting { and }
         if (curr.str == "{")
@@ -1084,7 +1187,7 @@ GLSLRepresentation GLSLParser::parse(const GLSLShader& shader)
             in_interface = (do_terminate == Termination::InterfaceScope) ? false : in_interface;
             state = Keyword::None;
             var = GLSLRepresentation::Variable();
-            ASSERT(nesting.size() > 0, curr.str.c_str(), "Bad nesting");
+            ASSERT(nesting.size() > 0, curr.str.str().c_str(), "Bad nesting");
             nesting.pop_back();
             do_terminate = Termination::None;
         }
@@ -1096,12 +1199,12 @@ GLSLRepresentation GLSLParser::parse(const GLSLShader& shader)
                 {
                     structs[struct_name] = nesting.back();
                 }
-                curr = scan_token(feed); // we will get either a name or a ';'
+                curr = lexer.next(); // we will get either a name or a ';'
 
                 if (curr.str != ";") // delay termination (could be an array eg)
                 {
                     do_terminate = in_struct ? Termination::StructScope : Termination::InterfaceScope;
-                    nesting.back().name = curr.str;
+                    nesting.back().name = curr.str.str();
                 }
                 else
                 {
@@ -1114,13 +1217,13 @@ GLSLRepresentation GLSLParser::parse(const GLSLShader& shader)
                     state = Keyword::None;
                     in_interface = false;
                     var = GLSLRepresentation::Variable();
-                    ASSERT(nesting.size() > 0, curr.str.c_str(), "Bad nesting");
+                    ASSERT(nesting.size() > 0, curr.str.str().c_str(), "Bad nesting");
                     nesting.pop_back();
                 }
             }
             else
             {
-                ASSERT(block_depth > 0, feed.c_str(), "Too many scopes ending!");
+                ASSERT(block_depth > 0, lexer.position(), "Too many scopes ending!");
                 block_depth--;
             }
         }
@@ -1139,11 +1242,12 @@ GLSLRepresentation GLSLParser::parse(const GLSLShader& shader)
             in_array = false;
             var.dimensions += curr.str;
         }
-        else if (in_array && curr.str.size() > 0)
+        else if (in_array && !curr.str.empty())
         {
             var.dimensions += curr.str;
+            const std::string dimension = curr.str.str();
             char *end = nullptr;
-            long value = strtol(curr.str.c_str(), &end, 10);
+            long value = strtol(dimension.c_str(), &end, 10);
             if (end != nullptr && *end == '\0') // valid integer value
             {
                 var.size += value;
@@ -1213,16 +1317,16 @@ GLSLRepresentation GLSLParser::parse(const GLSLShader& shader)
                 }
                 var.type = curr.keyword;
             }
-            else if (structs.count(curr.str) > 0)
+            else if (structs.count(curr.str.str()) > 0)
             {
                 do_terminate = Termination::StructMember;
-                nesting.push_back(structs.at(curr.str));
-                nesting.back().name = curr.str;
-                ASSERT(nesting.size() <= 2, curr.str.c_str(), "Bad nesting");
+                nesting.push_back(structs.at(curr.str.str()));
+                nesting.back().name = curr.str.str();
+                ASSERT(nesting.size() <= 2, curr.str.str().c_str(), "Bad nesting");
             }
             else if (curr.type == Token::IDENTIFIER)
             {
-                var.name = curr.str;
+                var.name = curr.str.str();
             }
         }
         else if (curr.type == Token::KEYWORD) // we only care about globals
@@ -1231,12 +1335,12 @@ GLSLRepresentation GLSLParser::parse(const GLSLShader& shader)
             {
             case Keyword::Struct:
             {
-                Token type_name = scan_token(feed); // either name or {
+                Token type_name = lexer.next(); // either name or {
                 in_struct = true;
-                ASSERT(type_name.str != "{", feed.c_str(), "Anonymous structs are forbidden");
+                ASSERT(type_name.str != "{", lexer.position(), "Anonymous structs are forbidden");
                 if (type_name.str != "{") // named struct
                 {
-                    struct_name = type_name.str;
+                    struct_name = type_name.str.str();
                 }
                 state = curr.keyword;
                 break;
@@ -1272,22 +1376,22 @@ GLSLRepresentation GLSLParser::parse(const GLSLShader& shader)
                 break;
             case Keyword::Precision: // changing default precision on global scope
             {
-                Token precision = scan_token(feed);
-                Token type = scan_token(feed);
-                Token semicolon = scan_token(feed);
-                ASSERT(semicolon.str == ";", semicolon.str.c_str(), "Semicolon expected in default precision");
+                Token precision = lexer.next();
+                Token type = lexer.next();
+                Token semicolon = lexer.next();
+                ASSERT(semicolon.str == ";", semicolon.str.str().c_str(), "Semicolon expected in default precision");
                 default_precision[type.keyword] = precision.keyword;
                 break;
             }
             // TBD: "layout(early_fragment_tests) in;" special case, see 4.4.1.3 in spec
             case Keyword::Layout:
             {
-                var.layout = curr.str;
+                var.layout = curr.str.str();
                 while (curr.str != ")")
                 {
-                    curr = scan_token(feed);
+                    curr = lexer.next();
                     var.layout += curr.str;
-                    ASSERT(curr.type != Token::EMPTY, feed.c_str(), "Layout qualifier not terminated with right parenthesis!");
+                    ASSERT(curr.type != Token::EMPTY, lexer.position(), "Layout qualifier not terminated with right parenthesis!");
                 }
                 break;
             }
@@ -50,9 +50,9 @@ class GLSLParser
 public:
     GLSLParser(const std::string& name = std::string(), bool debug = false) : mShaderName(name), mDebug(debug) {}
     GLSLRepresentation parse(const GLSLShader& shader);
-    GLSLShader preprocessor(std::string shader, int shaderType);
+    GLSLShader preprocessor(const std::string& shader, int shaderType);
     std::string strip_comments(const std::string& s);
-    std::string compressed(GLSLShader shader);
+    std::string compressed(const GLSLShader& shader);
     std::string inline_includes(const std::string& s);
 
     void self_test();
@@ -1,7 +1,7 @@
 #include <retracer/config.hpp> //version info
 #include <common/file_format.hpp>
+#include <common/trace_patcher.hpp>
 
-#include <jsoncpp/include/json/writer.h>
 #include <jsoncpp/include/json/reader.h>
 
 #include <fstream>
@@ -68,25 +68,6 @@ bool ParseCommandLine(int argc, char** argv, CmdOptions& cmdOpts )
     return true;
 }
 
-void WriteHeader(std::fstream &mStream, BHeaderV3 header, const char* jsonCString)
-{
-    int jsonMaxLength = header.jsonFileEnd - header.jsonFileBegin;
-    if ( jsonMaxLength >= 0 && header.jsonLength > static_cast<unsigned int>(jsonMaxLength) ) {
-        DBG_LOG("Error: json file too long for header, %d > %d\n", header.jsonLength, jsonMaxLength);
-        os::abort();
-    } else {
-        // Write JS Header
-        mStream.seekp(header.jsonFileBegin, std::ios_base::beg);
-        mStream.write(jsonCString,header.jsonLength);
-        DBG_LOG("wrote json header,length=%d\n", header.jsonLength );
-
-        // Write fixed-size header
-        mStream.seekp(0, std::ios_base::beg);
-        mStream.write((char*)&header, sizeof(BHeaderV3));
-        mStream.flush();
-    }
-}
-
 bool fileExists(std::string filepath) {
   std::ifstream f(filepath.c_str());
   return f.good();
@@ -94,41 +75,8 @@ bool fileExists(std::string filepath) {
 
 bool modHeader(const std::string& mFileName, const std::string& fileNameJson)
 {
-    // 1. open file as read write
-    // 2. check that its V3, if not exit
-    // 3. read new js info from disk
-    // 4. modify
-    // 5. write trace
-    // 6. close
-    std::ios_base::openmode fmode = std::fstream::binary |
-                                    std::fstream::in |
-                                    std::fstream::out|
-                                    std::fstream::ate ;
-
-    std::fstream traceFileStream;
-    traceFileStream.open(mFileName.c_str(), fmode);
-    if (!traceFileStream.is_open()) {
-        DBG_LOG("Failed to open file %s\n", mFileName.c_str());
-        return false;
-    }
-
-    size_t bytesAte = traceFileStream.tellg();
-    DBG_LOG("%d kB trace file\n", (int) bytesAte/1024);
-    traceFileStream.seekp(0, std::ios_base::beg);
-
-    // Read Base Header that is common for all header versions
-    common::BHeader bHeader;
-    traceFileStream.read((char*)&bHeader, sizeof(bHeader));
-    if (bHeader.magicNo != 0x20122012) {
-        DBG_LOG("Warning: %s seems to be an invalid trace file!\n", mFileName.c_str());
-        return false;
-    }
-
-
-    if (bHeader.version >= HEADER_VERSION_3 || bHeader.version <= HEADER_VERSION_4) {
-        DBG_LOG("### .pat file format Version %d ###\n", bHeader.version - HEADER_VERSION_1 + 1);
-    } else {
-        DBG_LOG("Unsupported file version: %d\n", bHeader.version - HEADER_VERSION_1 + 1);
+    TracePatcher patcher;
+    if (!patcher.Open(mFileName.c_str())) {
         return false;
     }
 
@@ -145,23 +93,13 @@ bool modHeader(const std::string& mFileName, const std::string& fileNameJson)
         return false;
     }
 
-    // Write!
-    Json::FastWriter fastWriter;
-    std::string jsonData = fastWriter.write(mJsonHeader);
-    BHeaderV3 hdrV3;
-    traceFileStream.seekp(0, std::ios_base::beg);
-    traceFileStream.read((char*)&hdrV3, sizeof(BHeaderV3));
-
-    hdrV3.jsonLength = jsonData.length();
-
-    if ( hdrV3.jsonLength > 0) {
-        WriteHeader(traceFileStream, hdrV3, jsonData.c_str());
-    } else {
-        DBG_LOG("Error: no jsonData to write\n");
+    // Written in place if it fits the space reserved for the header, otherwise
+    // the file is rewritten with a larger one
+    patcher.SetJSONHeader(mJsonHeader);
+    if (!patcher.Commit()) {
         return false;
     }
-
-    traceFileStream.close();
+    DBG_LOG("wrote json header%s\n", patcher.Rewritten() ? ", the trace file was rewritten to make room for it" : "");
     return true;
 }
 
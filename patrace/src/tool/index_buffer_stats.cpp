@@ -0,0 +1,145 @@
+#include "tool/index_buffer_stats.hpp"
+
+#include "common/os.hpp"
+
+#include <stdint.h>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+// Index values are tracked in flat arrays when their range is at most this many times the number of indices
+const size_t dense_range_factor = 16;
+
+template<class T>
+static void analyzeIndexBuffer(const T* elements, int count, bool primitive_restart, IndexBufferStats& stats)
+{
+    const T restart_index = std::numeric_limits<T>::max();
+
+    // Give every distinct index value a slot, so that the state per vertex can be kept in flat arrays.
+    // The values are dense in almost all draws, otherwise they are ranked instead.
+    T low = elements[0];
+    T high = elements[0];
+    for (int idx = 1; idx < count; idx++)
+    {
+        low = std::min(low, elements[idx]);
+        high = std::max(high, elements[idx]);
+    }
+    const size_t range = (size_t)high - (size_t)low + 1;
+    const bool dense = range <= dense_range_factor * (size_t)count;
+    std::vector<T> values; // distinct index values, ascending
+    if (dense)
+    {
+        std::vector<uint64_t> seen((range + 63) / 64, 0);
+        for (int idx = 0; idx < count; idx++)
+        {
+            const size_t bit = elements[idx] - low;
+            seen[bit / 64] |= 1ull << (bit % 64);
+        }
+        for (size_t word = 0; word < seen.size(); word++)
+        {
+            for (uint64_t bits = seen[word]; bits; bits &= bits - 1)
+            {
+                values.push_back(low + word * 64 + __builtin_ctzll(bits));
+            }
+        }
+    }
+    else
+    {
+        values.assign(elements, elements + count);
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+    }
+    const size_t slots = dense ? range : values.size();
+
+    std::vector<int> last_use(slots, -1); // index position
+    std::vector<int> fifo_inserted(slots, -1); // number of earlier FIFO insertions
+    int fifo_insertions = 0;
+    std::vector<unsigned> lru; // most recently used slot last
+    lru.reserve(vertex_cache_entries);
+    int accesses = 0;
+    int fifo_hits = 0;
+    int lru_hits = 0;
+    int sum_age = 0;
+    for (int idx = 0; idx < count; idx++)
+    {
+        const T element = elements[idx];
+        const unsigned slot = dense ? element - low : std::lower_bound(values.begin(), values.end(), element) - values.begin();
+
+        // Distance to the previous use of the element, in indices
+        const long age = (last_use[slot] >= 0) ? std::min<long>(idx - last_use[slot], cache_size) : cache_size;
+        last_use[slot] = idx;
+        sum_age += age;
+
+        if (primitive_restart && element == restart_index)
+        {
+            stats.restarts++;
+            continue;
+        }
+        accesses++;
+
+        if (fifo_inserted[slot] >= 0 && fifo_insertions - fifo_inserted[slot] <= vertex_cache_entries)
+        {
+            fifo_hits++;
+        }
+        else
+        {
+            fifo_inserted[slot] = fifo_insertions++;
+        }
+
+        std::vector<unsigned>::iterator it = std::find(lru.begin(), lru.end(), slot);
+        if (it != lru.end())
+        {
+            lru_hits++;
+            lru.erase(it);
+        }
+        else if ((int)lru.size() == vertex_cache_entries)
+        {
+            lru.erase(lru.begin());
+        }
+        lru.push_back(slot);
+    }
+
+    stats.temporal_locality = 1.0 - (double)(sum_age / count) / (double)cache_size;
+    stats.fifo_hit_rate = accesses ? (double)fifo_hits / (double)accesses : 0.0;
+    stats.lru_hit_rate = accesses ? (double)lru_hits / (double)accesses : 0.0;
+    stats.unique_vertices = values.size();
+    stats.min_value = values.front();
+    stats.max_value = values.back();
+    stats.avg_sparseness = 0;
+    T prev = values.front();
+    int shaded_verts = 4;
+    for (const T v : values)
+    {
+        if (v - (prev / 4) * 4 >= 4)
+        {
+            shaded_verts += 4;
+        }
+        T distance = std::max<T>(1, v - prev);
+        stats.max_sparseness = std::max<T>(distance, stats.max_sparseness);
+        stats.avg_sparseness += distance;
+        prev = v;
+    }
+    stats.vec4_locality = (double)values.size() / (double)shaded_verts;
+    stats.avg_sparseness /= values.size();
+    stats.spatial_locality = 1.0 / stats.avg_sparseness;
+}
+
+bool analyzeIndexBuffer(const void *ptr, GLenum type, int count, bool primitive_restart, IndexBufferStats& stats)
+{
+    switch (type)
+    {
+    case GL_UNSIGNED_BYTE:
+        analyzeIndexBuffer<GLubyte>((const GLubyte*)ptr, count, primitive_restart, stats);
+        return true;
+    case GL_UNSIGNED_SHORT:
+        analyzeIndexBuffer<GLushort>((const GLushort*)ptr, count, primitive_restart, stats);
+        return true;
+    case GL_UNSIGNED_INT:
+        analyzeIndexBuffer<GLuint>((const GLuint*)ptr, count, primitive_restart, stats);
+        return true;
+    default:
+        DBG_LOG("Unknown index value type: %04x\n", (unsigned)type);
+        return false;
+    }
+}
+
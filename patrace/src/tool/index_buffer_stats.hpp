@@ -0,0 +1,27 @@
+#pragma once
+
+#include "dispatch/eglimports.hpp"
+
+// What the indices of a draw call tell about vertex reuse, see DrawParams
+struct IndexBufferStats
+{
+    int restarts = 0; // primitive restart indices
+    int unique_vertices = 0;
+    int max_sparseness = 0;
+    double avg_sparseness = 0.0;
+    int max_value = 0;
+    int min_value = 0;
+    double vec4_locality = 0.0;
+    double temporal_locality = 0.0;
+    double spatial_locality = 0.0;
+    double fifo_hit_rate = 0.0;
+    double lru_hit_rate = 0.0;
+};
+
+// Distance to the previous use of an index value at which temporal locality is counted as none
+const int cache_size = 512;
+// Simulate a FIFO and an LRU post-transform vertex cache with this many entries
+const int vertex_cache_entries = 32;
+
+// Fills in stats for count indices of the given GL type at ptr, or returns false for an unknown type
+bool analyzeIndexBuffer(const void *ptr, GLenum type, int count, bool primitive_restart, IndexBufferStats& stats);
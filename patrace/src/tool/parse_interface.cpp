@@ -2,12 +2,293 @@
 #include "common/memory.hpp"
 
 #include "parse_interface.h"
+#include "call_dispatch.hpp"
 #include "specs/pa_func_to_version.h"
 #include "glsl_parser.h"
 #include "glsl_utils.h"
 
 static const bool print_dupes = false;
 
+namespace {
+
+// GLES version and extensions that each call belongs to, by call id
+struct CallFeatures
+{
+    int version = 0;
+    std::vector<std::string> extensions;
+};
+
+std::vector<CallFeatures> makeCallFeatures()
+{
+    std::vector<CallFeatures> features(common::ApiInfo::MaxSigId + 1);
+    for (unsigned int id = 1; id < features.size(); ++id)
+    {
+        const char* name = common::ApiInfo::IdToNameArr[id];
+        if (!name)
+        {
+            continue;
+        }
+        if (map_func_to_version.count(name))
+        {
+            features[id].version = map_func_to_version.at(name);
+        }
+        const auto its = map_func_to_extension.equal_range(name);
+        for (auto it = its.first; it != its.second; ++it)
+        {
+            features[id].extensions.push_back(it->second);
+        }
+    }
+    return features;
+}
+
+const CallFeatures& callFeatures(unsigned int id)
+{
+    static const std::vector<CallFeatures> features = makeCallFeatures();
+    return features[id < features.size() ? id : 0];
+}
+
+// The calls that interpret_call() tracks state for. The EGL calls come first,
+// the GLES calls after them are only looked at with a current context.
+enum TrackedCall
+{
+    TRACK_NONE = 0,
+    TRACK_eglMakeCurrent,
+    TRACK_eglCreateContext,
+    TRACK_eglCreateWindowSurface,
+    TRACK_eglDestroySurface,
+    TRACK_eglDestroyContext,
+    TRACK_eglSwapBuffers,
+    TRACK_LAST_EGL = TRACK_eglSwapBuffers,
+    TRACK_glViewport,
+    TRACK_glScissor,
+    TRACK_glGenVertexArrays,
+    TRACK_glDeleteVertexArrays,
+    TRACK_glBindVertexArray,
+    TRACK_glIsEnabled,
+    TRACK_glEnable,
+    TRACK_glDisable,
+    TRACK_glEnableVertexAttribArray,
+    TRACK_glDisableVertexAttribArray,
+    TRACK_glGenFramebuffers,
+    TRACK_glDeleteFramebuffers,
+    TRACK_glBindFramebuffer,
+    TRACK_glFramebufferTexture2D,
+    TRACK_glGenerateMipmap,
+    TRACK_glGenRenderbuffers,
+    TRACK_glDeleteRenderbuffers,
+    TRACK_glFramebufferRenderbuffer,
+    TRACK_glBindRenderbuffer,
+    TRACK_glRenderbufferStorage,
+    TRACK_glRenderbufferStorageMultisample,
+    TRACK_glGenSamplers,
+    TRACK_glDeleteSamplers,
+    TRACK_glBindSampler,
+    TRACK_glGenQueries,
+    TRACK_glDeleteQueries,
+    TRACK_glBeginQuery,
+    TRACK_glEndQuery,
+    TRACK_glGenTransformFeedbacks,
+    TRACK_glDeleteTransformFeedbacks,
+    TRACK_glBindTransformFeedback,
+    TRACK_glGenBuffers,
+    TRACK_glDeleteBuffers,
+    TRACK_glBufferData,
+    TRACK_glBindBuffer,
+    TRACK_glBindBufferBase,
+    TRACK_glBindBufferRange,
+    TRACK_glVertexAttribPointer,
+    TRACK_glGenTextures,
+    TRACK_glDeleteTextures,
+    TRACK_glTexStorage3D,
+    TRACK_glTexStorage2DMultisample,
+    TRACK_glBindTexture,
+    TRACK_glActiveTexture,
+    TRACK_glTexParameteri,
+    TRACK_glSamplerParameterf,
+    TRACK_glCreateProgram,
+    TRACK_glUseProgram,
+    TRACK_glDeleteProgram,
+    TRACK_glAttachShader,
+    TRACK_glCreateShader,
+    TRACK_glDeleteShader,
+    TRACK_glLinkProgram,
+    TRACK_glShaderSource,
+    TRACK_glGetUniformLocation,
+    TRACK_glUniform1i,
+    TRACK_glUniform1iv,
+    TRACK_glProgramUniform1i,
+    TRACK_glProgramUniform1iv,
+    TRACK_glUniform,
+    TRACK_glGenProgramPipelines,
+    TRACK_glDeleteProgramPipelines,
+    TRACK_glBindProgramPipeline,
+    TRACK_glUseProgramStages,
+    TRACK_glDrawBuffers,
+    TRACK_glObjectLabel,
+    TRACK_glFinish,
+    TRACK_glFlush,
+    TRACK_glPatchParameteri,
+    TRACK_glDepthMask,
+    TRACK_glDepthFunc,
+    TRACK_glStencilMask,
+    TRACK_glStencilMaskSeparate,
+    TRACK_glColorMask,
+    TRACK_glClearColor,
+    TRACK_glClearStencil,
+    TRACK_glClearDepthf,
+    TRACK_glDispatch,
+    TRACK_glClear,
+    TRACK_glClearBufferfi,
+    TRACK_glClearBuffer,
+    TRACK_glDraw,
+};
+
+// Generated once, this replaces comparing the name of every call against all of the above.
+// The order matters where a prefix or substring also matches names added before it.
+const CallDispatchTable<TrackedCall>& trackedCalls()
+{
+    static const CallDispatchTable<TrackedCall> table = CallDispatchTable<TrackedCall>(TRACK_NONE)
+        .add("eglMakeCurrent", TRACK_eglMakeCurrent)
+        .add("eglCreateContext", TRACK_eglCreateContext)
+        .add("eglCreateWindowSurface", TRACK_eglCreateWindowSurface)
+        .add("eglCreateWindowSurface2", TRACK_eglCreateWindowSurface)
+        .add("eglCreatePbufferSurface", TRACK_eglCreateWindowSurface)
+        .add("eglCreatePixmapSurface", TRACK_eglCreateWindowSurface)
+        .add("eglDestroySurface", TRACK_eglDestroySurface)
+        .add("eglDestroyContext", TRACK_eglDestroyContext)
+        .addPrefix("eglSwapBuffers", TRACK_eglSwapBuffers)
+        .add("glViewport", TRACK_glViewport)
+        .add("glScissor", TRACK_glScissor)
+        .add("glGenVertexArrays", TRACK_glGenVertexArrays)
+        .add("glGenVertexArraysOES", TRACK_glGenVertexArrays)
+        .add("glDeleteVertexArrays", TRACK_glDeleteVertexArrays)
+        .add("glDeleteVertexArraysOES", TRACK_glDeleteVertexArrays)
+        .add("glBindVertexArray", TRACK_glBindVertexArray)
+        .add("glBindVertexArrayOES", TRACK_glBindVertexArray)
+        .add("glIsEnabled", TRACK_glIsEnabled)
+        .add("glEnable", TRACK_glEnable)
+        .add("glDisable", TRACK_glDisable)
+        .add("glEnableVertexAttribArray", TRACK_glEnableVertexAttribArray)
+        .add("glDisableVertexAttribArray", TRACK_glDisableVertexAttribArray)
+        .add("glGenFramebuffers", TRACK_glGenFramebuffers)
+        .add("glGenFramebuffersOES", TRACK_glGenFramebuffers)
+        .add("glDeleteFramebuffers", TRACK_glDeleteFramebuffers)
+        .add("glDeleteFramebuffersOES", TRACK_glDeleteFramebuffers)
+        .add("glBindFramebuffer", TRACK_glBindFramebuffer)
+        .add("glBindFramebufferOES", TRACK_glBindFramebuffer)
+        .add("glFramebufferTexture2D", TRACK_glFramebufferTexture2D)
+        .add("glFramebufferTextureLayer", TRACK_glFramebufferTexture2D)
+        .add("glFramebufferTexture2DOES", TRACK_glFramebufferTexture2D)
+        .add("glFramebufferTextureLayerOES", TRACK_glFramebufferTexture2D)
+        .add("glGenerateMipmap", TRACK_glGenerateMipmap)
+        .add("glGenerateMipmapOES", TRACK_glGenerateMipmap)
+        .add("glGenRenderbuffers", TRACK_glGenRenderbuffers)
+        .add("glGenRenderbuffersOES", TRACK_glGenRenderbuffers)
+        .add("glDeleteRenderbuffers", TRACK_glDeleteRenderbuffers)
+        .add("glDeleteRenderbuffersOES", TRACK_glDeleteRenderbuffers)
+        .add("glFramebufferRenderbuffer", TRACK_glFramebufferRenderbuffer)
+        .add("glFramebufferRenderbufferOES", TRACK_glFramebufferRenderbuffer)
+        .add("glBindRenderbuffer", TRACK_glBindRenderbuffer)
+        .add("glBindRenderbufferOES", TRACK_glBindRenderbuffer)
+        .add("glRenderbufferStorage", TRACK_glRenderbufferStorage)
+        .add("glRenderbufferStorageOES", TRACK_glRenderbufferStorage)
+        .add("glRenderbufferStorageMultisample", TRACK_glRenderbufferStorageMultisample)
+        .add("glRenderbufferStorageMultisampleEXT", TRACK_glRenderbufferStorageMultisample)
+        .add("glGenSamplers", TRACK_glGenSamplers)
+        .add("glDeleteSamplers", TRACK_glDeleteSamplers)
+        .add("glBindSampler", TRACK_glBindSampler)
+        .add("glGenQueries", TRACK_glGenQueries)
+        .add("glGenQueriesEXT", TRACK_glGenQueries)
+        .add("glDeleteQueries", TRACK_glDeleteQueries)
+        .add("glDeleteQueriesEXT", TRACK_glDeleteQueries)
+        .add("glBeginQuery", TRACK_glBeginQuery)
+        .add("glBeginQueryEXT", TRACK_glBeginQuery)
+        .add("glEndQuery", TRACK_glEndQuery)
+        .add("glEndQueryEXT", TRACK_glEndQuery)
+        .add("glGenTransformFeedbacks", TRACK_glGenTransformFeedbacks)
+        .add("glDeleteTransformFeedbacks", TRACK_glDeleteTransformFeedbacks)
+        .add("glBindTransformFeedback", TRACK_glBindTransformFeedback)
+        .add("glGenBuffers", TRACK_glGenBuffers)
+        .add("glDeleteBuffers", TRACK_glDeleteBuffers)
+        .add("glBufferData", TRACK_glBufferData)
+        .add("glBindBuffer", TRACK_glBindBuffer)
+        .add("glBindBufferBase", TRACK_glBindBufferBase)
+        .add("glBindBufferRange", TRACK_glBindBufferRange)
+        .add("glVertexAttribPointer", TRACK_glVertexAttribPointer)
+        .add("glVertexAttribIPointer", TRACK_glVertexAttribPointer)
+        .add("glGenTextures", TRACK_glGenTextures)
+        .add("glDeleteTextures", TRACK_glDeleteTextures)
+        .add("glTexStorage3D", TRACK_glTexStorage3D)
+        .add("glTexStorage2D", TRACK_glTexStorage3D)
+        .add("glTexStorage1D", TRACK_glTexStorage3D)
+        .add("glTexStorage3DEXT", TRACK_glTexStorage3D)
+        .add("glTexStorage2DEXT", TRACK_glTexStorage3D)
+        .add("glTexStorage1DEXT", TRACK_glTexStorage3D)
+        .add("glTexImage3D", TRACK_glTexStorage3D)
+        .add("glTexImage2D", TRACK_glTexStorage3D)
+        .add("glTexImage1D", TRACK_glTexStorage3D)
+        .add("glTexImage3DOES", TRACK_glTexStorage3D)
+        .add("glCompressedTexImage3D", TRACK_glTexStorage3D)
+        .add("glCompressedTexImage2D", TRACK_glTexStorage3D)
+        .add("glCompressedTexImage1D", TRACK_glTexStorage3D)
+        .add("glTexStorage2DMultisample", TRACK_glTexStorage2DMultisample)
+        .add("glBindTexture", TRACK_glBindTexture)
+        .add("glActiveTexture", TRACK_glActiveTexture)
+        .add("glTexParameteri", TRACK_glTexParameteri)
+        .add("glTexParameterf", TRACK_glTexParameteri)
+        .add("glTexParameteriv", TRACK_glTexParameteri)
+        .add("glTexParameterfv", TRACK_glTexParameteri)
+        .add("glSamplerParameterf", TRACK_glSamplerParameterf)
+        .add("glSamplerParameteri", TRACK_glSamplerParameterf)
+        .add("glSamplerParameterfv", TRACK_glSamplerParameterf)
+        .add("glSamplerParameteriv", TRACK_glSamplerParameterf)
+        .add("glCreateProgram", TRACK_glCreateProgram)
+        .add("glUseProgram", TRACK_glUseProgram)
+        .add("glDeleteProgram", TRACK_glDeleteProgram)
+        .add("glAttachShader", TRACK_glAttachShader)
+        .add("glCreateShader", TRACK_glCreateShader)
+        .add("glDeleteShader", TRACK_glDeleteShader)
+        .add("glLinkProgram", TRACK_glLinkProgram)
+        .add("glShaderSource", TRACK_glShaderSource)
+        .add("glGetUniformLocation", TRACK_glGetUniformLocation)
+        .add("glUniform1i", TRACK_glUniform1i)
+        .add("glUniform1iv", TRACK_glUniform1iv)
+        .add("glProgramUniform1i", TRACK_glProgramUniform1i)
+        .add("glProgramUniform1iv", TRACK_glProgramUniform1iv)
+        .addContaining("glUniform", TRACK_glUniform)
+        .addContaining("glProgramUniform", TRACK_glUniform)
+        .add("glGenProgramPipelines", TRACK_glGenProgramPipelines)
+        .add("glGenProgramPipelinesEXT", TRACK_glGenProgramPipelines)
+        .add("glDeleteProgramPipelines", TRACK_glDeleteProgramPipelines)
+        .add("glDeleteProgramPipelinesEXT", TRACK_glDeleteProgramPipelines)
+        .add("glBindProgramPipeline", TRACK_glBindProgramPipeline)
+        .add("glBindProgramPipelineEXT", TRACK_glBindProgramPipeline)
+        .add("glUseProgramStages", TRACK_glUseProgramStages)
+        .add("glUseProgramStagesEXT", TRACK_glUseProgramStages)
+        .add("glDrawBuffers", TRACK_glDrawBuffers)
+        .add("glObjectLabel", TRACK_glObjectLabel)
+        .add("glFinish", TRACK_glFinish)
+        .add("glFlush", TRACK_glFlush)
+        .add("glPatchParameteri", TRACK_glPatchParameteri)
+        .add("glPatchParameteriEXT", TRACK_glPatchParameteri)
+        .add("glDepthMask", TRACK_glDepthMask)
+        .add("glDepthFunc", TRACK_glDepthFunc)
+        .add("glStencilMask", TRACK_glStencilMask)
+        .add("glStencilMaskSeparate", TRACK_glStencilMaskSeparate)
+        .add("glColorMask", TRACK_glColorMask)
+        .add("glClearColor", TRACK_glClearColor)
+        .add("glClearStencil", TRACK_glClearStencil)
+        .add("glClearDepthf", TRACK_glClearDepthf)
+        .addPrefix("glDispatch", TRACK_glDispatch)
+        .add("glClear", TRACK_glClear)
+        .add("glClearBufferfi", TRACK_glClearBufferfi)
+        .addPrefix("glClearBuffer", TRACK_glClearBuffer)
+        .addPrefix("glDraw", TRACK_glDraw);
+    return table;
+}
+
+}
+
 // Does not set number of primitives. This needs to be handled separately, since we cannot query patch size.
 DrawParams ParseInterfaceBase::getDrawCallCount(common::CallTM *call)
 {
@@ -89,23 +370,52 @@ bool ParseInterfaceBase::find_duplicate_clears(const StateTracker::FillState& f,
     return false;
 }
 
+void ParseInterface::select_calls(const std::vector<std::string>& names)
+{
+    _selective.reset(new common::SelectiveReader);
+    for (const std::string& name : names)
+    {
+        _selective->Select(name.c_str());
+    }
+    for (unsigned int id = 1; id <= common::ApiInfo::MaxSigId; ++id)
+    {
+        const TrackedCall tracked = trackedCalls()[id];
+        if ((tracked != TRACK_NONE && tracked <= TRACK_LAST_EGL) || (id < mCallHooks.size() && !mCallHooks[id].empty()))
+        {
+            _selective->Select(id);
+        }
+    }
+}
+
 bool ParseInterface::open(const std::string& input, const std::string& output)
 {
     filename = input;
     common::gApiInfo.RegisterEntries(common::parse_callbacks);
-    if (!inputFile.Open(input.c_str(), false, "tmp.pat.ra"))
+    if (_selective)
     {
-        DBG_LOG("Failed to open for reading: %s\n", input.c_str());
-        return false;
+        if (!_selective->Open(input.c_str()))
+        {
+            DBG_LOG("Failed to open for reading: %s\n", input.c_str());
+            return false;
+        }
+        header = _selective->File().getJSONHeader();
+    }
+    else
+    {
+        if (!inputFile.Open(input.c_str(), false, "tmp.pat.ra"))
+        {
+            DBG_LOG("Failed to open for reading: %s\n", input.c_str());
+            return false;
+        }
+        _curFrame = inputFile.mFrames[0];
+        _curFrame->LoadCalls(inputFile.mpInFileRA);
+        header = inputFile.mpInFileRA->getJSONHeader();
     }
-    _curFrame = inputFile.mFrames[0];
-    _curFrame->LoadCalls(inputFile.mpInFileRA);
     if (!output.empty() && !outputFile.Open(output.c_str()))
     {
         DBG_LOG("Failed to open for writing: %s\n", output.c_str());
         return false;
     }
-    header = inputFile.mpInFileRA->getJSONHeader();
     threadArray = header["threads"];
     defaultTid = header["defaultTid"].asUInt();
     highest_gles_version = header["glesVersion"].asInt() * 10;
@@ -143,6 +453,20 @@ static void unbind_renderbuffers_if(StateTracker::Context& context, const int fb
 
 common::CallTM* ParseInterface::next_call()
 {
+    if (_selective)
+    {
+        common::CallTM *call = _selective->NextCall();
+        if (call)
+        {
+            context_index = current_context[call->mTid];
+            if (!only_default || call->mTid == defaultTid)
+            {
+                interpret_call(call);
+            }
+        }
+        return call;
+    }
+
     if (_curCallIndexInFrame >= _curFrame->GetLoadedCallCount())
     {
         _curFrameIndex++;
@@ -233,34 +557,60 @@ static void adjust_sampler_state(common::CallTM* call, GLenum pname, StateTracke
             state.swizzle[3] = arg->GetAsUInt();
             break;
         default:
-            DBG_LOG("Unsupported texture parameter for %s: %s\n", call->mCallName.c_str(), texEnum(pname).c_str());
+            DBG_LOG("Unsupported texture parameter for %s: %s\n", call->mCallName.c_str(), texEnum(pname));
             break;
         }
     }
     else // non-length-of-one array values - none supported yet
     {
-        DBG_LOG("Unsupported texture array parameter for %s: %s\n", call->mCallName.c_str(), texEnum(pname).c_str());
+        DBG_LOG("Unsupported texture array parameter for %s: %s\n", call->mCallName.c_str(), texEnum(pname));
     }
 }
 
 void ParseInterfaceBase::interpret_call(common::CallTM *call)
 {
-    // Check versions and extensions used
-    if (map_func_to_version.count(call->mCallName))
-    {
-        int funcver = map_func_to_version.at(call->mCallName);
-        highest_gles_version = std::max(funcver, highest_gles_version);
-    }
-    if (map_func_to_extension.count(call->mCallName))
+    track_call(call);
+
+    if (call->mCallId < mCallHooks.size())
     {
-        const auto its = map_func_to_extension.equal_range(call->mCallName);
-        for (auto it = its.first; it != its.second; ++it)
+        for (const CallHook& hook : mCallHooks[call->mCallId])
         {
-            used_extensions.insert(it->second);
+            hook(call);
         }
     }
+}
 
-    if (call->mCallName == "eglMakeCurrent") // find contexts that are used
+void ParseInterfaceBase::addCallHook(const char* name, const CallHook& hook)
+{
+    const unsigned short id = common::gApiInfo.NameToId(name);
+    if (id == 0)
+    {
+        DBG_LOG("Cannot add a hook for unknown call %s\n", name);
+        return;
+    }
+    if (mCallHooks.size() <= id)
+    {
+        mCallHooks.resize(id + 1);
+    }
+    mCallHooks[id].push_back(hook);
+}
+
+void ParseInterfaceBase::track_call(common::CallTM *call)
+{
+    // Check versions and extensions used
+    const CallFeatures& features = callFeatures(call->mCallId);
+    highest_gles_version = std::max(features.version, highest_gles_version);
+    used_extensions.insert(features.extensions.begin(), features.extensions.end());
+
+    const TrackedCall tracked = trackedCalls()[call->mCallId];
+    if (tracked > TRACK_LAST_EGL && context_index == UNBOUND)
+    {
+        return; // prevent the GLES calls from being processed without a GLES context
+    }
+
+    switch (tracked)
+    {
+    case TRACK_eglMakeCurrent: // find contexts that are used
     {
         int surface = call->mArgs[1]->GetAsInt();
         int readsurface = call->mArgs[2]->GetAsInt();
@@ -303,8 +653,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             contexts[context_index].viewport.width = surfaces[surface_index].width;
             contexts[context_index].viewport.height = surfaces[surface_index].height;
         }
+        break;
     }
-    else if (call->mCallName == "eglCreateContext")
+    case TRACK_eglCreateContext:
     {
         int mret = call->mRet.GetAsInt();
         int display = call->mArgs[0]->GetAsInt();
@@ -317,9 +668,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         } else {
             contexts.emplace_back(mret, display, contexts.size(), call->mCallNo, frames);
         }
+        break;
     }
-    else if (call->mCallName == "eglCreateWindowSurface" || call->mCallName =="eglCreateWindowSurface2"
-             || call->mCallName == "eglCreatePbufferSurface" || call->mCallName == "eglCreatePixmapSurface")
+    case TRACK_eglCreateWindowSurface:
     {
         int mret = call->mRet.GetAsInt();
         int display = call->mArgs[0]->GetAsInt();
@@ -362,16 +713,18 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         }
         surface_remapping[mret] = surfaces.size(); // generate id<->idx table
         surfaces.push_back(StateTracker::Surface(mret, display, surfaces.size(), call->mCallNo, frames, type, attribs, width, height));
+        break;
     }
-    else if (call->mCallName == "eglDestroySurface")
+    case TRACK_eglDestroySurface:
     {
         // "surface is destroyed when it becomes not current to any thread"
         int surface = call->mArgs[1]->GetAsInt();
         int target_surface_index = surface_remapping.at(surface);
         surfaces[target_surface_index].call_destroyed = call->mCallNo;
         surfaces[target_surface_index].frame_destroyed = frames;
+        break;
     }
-    else if (call->mCallName == "eglDestroyContext")
+    case TRACK_eglDestroyContext:
     {
         // "context is destroyed when it becomes not current to any thread"
         int context = call->mArgs[1]->GetAsInt();
@@ -382,8 +735,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             contexts[target_context_index].call_destroyed = call->mCallNo;
             contexts[target_context_index].frame_destroyed = frames;
         }
+        break;
     }
-    else if (call->mCallName.compare(0, 14, "eglSwapBuffers") == 0)
+    case TRACK_eglSwapBuffers:
     {
         const int surface = call->mArgs[1]->GetAsInt();
         const int target_surface_index = surface_remapping.at(surface);
@@ -398,28 +752,27 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         {
             pair.second.clears.clear(); // after swap you should probably repeat clears
         }
+        break;
     }
     /// --- end EGL ---
-    else if (context_index == UNBOUND)
-    {
-        // nothing, just prevent the GLES calls below from being processed without a GLES context
-    }
     /// --- start GLES ---
-    else if (call->mCallName == "glViewport")
+    case TRACK_glViewport:
     {
         contexts[context_index].viewport.x = call->mArgs[0]->GetAsInt();
         contexts[context_index].viewport.y = call->mArgs[1]->GetAsInt();
         contexts[context_index].viewport.width = call->mArgs[2]->GetAsInt();
         contexts[context_index].viewport.height = call->mArgs[3]->GetAsInt();
+        break;
     }
-    else if (call->mCallName == "glScissor")
+    case TRACK_glScissor:
     {
         contexts[context_index].fillstate.scissor.x = call->mArgs[0]->GetAsInt();
         contexts[context_index].fillstate.scissor.y = call->mArgs[1]->GetAsInt();
         contexts[context_index].fillstate.scissor.width = call->mArgs[2]->GetAsInt();
         contexts[context_index].fillstate.scissor.height = call->mArgs[3]->GetAsInt();
+        break;
     }
-    else if (call->mCallName == "glGenVertexArrays" || call->mCallName == "glGenVertexArraysOES")
+    case TRACK_glGenVertexArrays:
     {
         const unsigned count = call->mArgs[0]->GetAsUInt();
         assert(call->mArgs[1]->IsArray());
@@ -429,8 +782,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             const unsigned id = call->mArgs[1]->mArray[i].GetAsUInt();
             contexts[context_index].vaos.add(id, call->mCallNo, frames);
         }
+        break;
     }
-    else if (call->mCallName == "glDeleteVertexArrays" || call->mCallName == "glDeleteVertexArraysOES")
+    case TRACK_glDeleteVertexArrays:
     {
         const unsigned count = call->mArgs[0]->GetAsUInt();
         assert(call->mArgs[1]->IsArray());
@@ -451,8 +805,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 contexts[context_index].vao_index = UNBOUND;
             }
         }
+        break;
     }
-    else if (call->mCallName == "glBindVertexArray" || call->mCallName == "glBindVertexArrayOES")
+    case TRACK_glBindVertexArray:
     {
         const GLuint vao = call->mArgs[0]->GetAsUInt();
         if (vao != 0 && !contexts[context_index].vaos.contains(vao))
@@ -468,34 +823,40 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         {
             contexts[context_index].vao_index = UNBOUND;
         }
+        break;
     }
-    else if (call->mCallName == "glIsEnabled")
+    case TRACK_glIsEnabled:
     {
         GLenum target = call->mArgs[0]->GetAsInt();
         bool retval = call->mRet.GetAsInt();
         assert(retval == contexts[context_index].enabled[target]); // sanity check
+        break;
     }
-    else if (call->mCallName == "glEnable")
+    case TRACK_glEnable:
     {
         GLenum target = call->mArgs[0]->GetAsInt();
         contexts[context_index].enabled[target] = true;
+        break;
     }
-    else if (call->mCallName == "glDisable")
+    case TRACK_glDisable:
     {
         GLenum target = call->mArgs[0]->GetAsInt();
         contexts[context_index].enabled[target] = false;
+        break;
     }
-    else if (call->mCallName == "glEnableVertexAttribArray")
+    case TRACK_glEnableVertexAttribArray:
     {
         const GLuint index = call->mArgs[0]->GetAsUInt();
         contexts[context_index].vao_enabled.insert(index);
+        break;
     }
-    else if (call->mCallName == "glDisableVertexAttribArray")
+    case TRACK_glDisableVertexAttribArray:
     {
         const GLuint index = call->mArgs[0]->GetAsUInt();
         contexts[context_index].vao_enabled.erase(index);
+        break;
     }
-    else if (call->mCallName == "glGenFramebuffers" || call->mCallName == "glGenFramebuffersOES")
+    case TRACK_glGenFramebuffers:
     {
         const unsigned count = call->mArgs[0]->GetAsUInt();
         assert(call->mArgs[1]->IsArray());
@@ -505,8 +866,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             const unsigned id = call->mArgs[1]->mArray[i].GetAsUInt();
             contexts[context_index].framebuffers.add(id, call->mCallNo, frames);
         }
+        break;
     }
-    else if (call->mCallName == "glDeleteFramebuffers" || call->mCallName == "glDeleteFramebuffersOES")
+    case TRACK_glDeleteFramebuffers:
     {
         const unsigned count = call->mArgs[0]->GetAsUInt();
         assert(call->mArgs[1]->IsArray());
@@ -533,8 +895,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 contexts[context_index].readframebuffer = 0;
             }
         }
+        break;
     }
-    else if (call->mCallName == "glBindFramebuffer" || call->mCallName == "glBindFramebufferOES")
+    case TRACK_glBindFramebuffer:
     {
         GLenum target = call->mArgs[0]->GetAsUInt();
         GLuint fb = call->mArgs[1]->GetAsUInt();
@@ -561,9 +924,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 pair.second.clears.clear(); // we consider an FBO bind to be a valid point to repeat clears
             }
         }
+        break;
     }
-    else if (call->mCallName == "glFramebufferTexture2D" || call->mCallName == "glFramebufferTextureLayer"
-             || call->mCallName == "glFramebufferTexture2DOES" || call->mCallName == "glFramebufferTextureLayerOES")
+    case TRACK_glFramebufferTexture2D:
     {
         const GLenum target = call->mArgs[0]->GetAsUInt();
         int target_fb_index = 0;
@@ -609,16 +972,18 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             contexts[context_index].framebuffers[target_fb_index].attachments[attachment] = StateTracker::Attachment(texture, textarget, texture_index);
         }
         contexts[context_index].framebuffers[target_fb_index].attachment_calls++;
+        break;
     }
-    else if (call->mCallName == "glGenerateMipmap" || call->mCallName == "glGenerateMipmapOES")
+    case TRACK_glGenerateMipmap:
     {
         const GLenum target = call->mArgs[0]->GetAsUInt();
         const GLuint unit = contexts[context_index].activeTextureUnit;
         const GLuint tex_id = contexts[context_index].textureUnits[unit][target];
         const int target_texture_index = contexts[context_index].textures.remap(tex_id);
         contexts[context_index].mipmaps.push_back({ call->mCallNo, frames, target_texture_index });
+        break;
     }
-    else if (call->mCallName == "glGenRenderbuffers" || call->mCallName == "glGenRenderbuffersOES")
+    case TRACK_glGenRenderbuffers:
     {
         const unsigned count = call->mArgs[0]->GetAsUInt();
         assert(call->mArgs[1]->IsArray());
@@ -628,8 +993,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             const unsigned id = call->mArgs[1]->mArray[i].GetAsUInt();
             contexts[context_index].renderbuffers.add(id, call->mCallNo, frames);
         }
+        break;
     }
-    else if (call->mCallName == "glDeleteRenderbuffers" || call->mCallName == "glDeleteRenderbuffersOES")
+    case TRACK_glDeleteRenderbuffers:
     {
         const unsigned count = call->mArgs[0]->GetAsUInt();
         assert(call->mArgs[1]->IsArray());
@@ -647,8 +1013,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 unbind_renderbuffers_if(contexts[context_index], contexts[context_index].framebuffers.remap(contexts[context_index].readframebuffer), true, id);
             }
         }
+        break;
     }
-    else if (call->mCallName == "glFramebufferRenderbuffer" || call->mCallName == "glFramebufferRenderbufferOES")
+    case TRACK_glFramebufferRenderbuffer:
     {
         const GLenum target = call->mArgs[0]->GetAsUInt();
         int target_fb_index = 0;
@@ -679,8 +1046,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             contexts[context_index].framebuffers[target_fb_index].attachments[attachment] = StateTracker::Attachment(renderbuffer, renderbuffertarget, rb_index);
         }
         contexts[context_index].framebuffers[target_fb_index].attachment_calls++;
+        break;
     }
-    else if (call->mCallName == "glBindRenderbuffer" || call->mCallName == "glBindRenderbufferOES")
+    case TRACK_glBindRenderbuffer:
     {
         GLenum target = call->mArgs[0]->GetAsUInt();
         assert(target == GL_RENDERBUFFER);
@@ -698,8 +1066,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         {
             contexts[context_index].renderbuffer_index = UNBOUND;
         }
+        break;
     }
-    else if (call->mCallName == "glRenderbufferStorage" || call->mCallName == "glRenderbufferStorageOES")
+    case TRACK_glRenderbufferStorage:
     {
         GLenum target = call->mArgs[0]->GetAsUInt();
         assert(target == GL_RENDERBUFFER);
@@ -714,8 +1083,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         {
             DBG_LOG("API ERROR [%d]: %s attempts to operate on an unbound renderbuffer\n", (int)call->mCallNo, call->mCallName.c_str());
         }
+        break;
     }
-    else if (call->mCallName == "glRenderbufferStorageMultisample" || call->mCallName == "glRenderbufferStorageMultisampleEXT")
+    case TRACK_glRenderbufferStorageMultisample:
     {
         GLenum target = call->mArgs[0]->GetAsUInt();
         assert(target == GL_RENDERBUFFER);
@@ -731,8 +1101,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         {
             DBG_LOG("API ERROR [%d]: %s attempts to operate on an unbound renderbuffer\n", (int)call->mCallNo, call->mCallName.c_str());
         }
+        break;
     }
-    else if (call->mCallName == "glGenSamplers")
+    case TRACK_glGenSamplers:
     {
         GLuint count = call->mArgs[0]->GetAsInt();
         assert(call->mArgs[1]->IsArray());
@@ -742,8 +1113,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             const unsigned id = call->mArgs[1]->mArray[i].GetAsUInt();
             contexts[context_index].samplers.add(id, call->mCallNo, frames);
         }
+        break;
     }
-    else if (call->mCallName == "glDeleteSamplers")
+    case TRACK_glDeleteSamplers:
     {
         const unsigned count = call->mArgs[0]->GetAsUInt();
         assert(call->mArgs[1]->IsArray());
@@ -756,14 +1128,16 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 contexts[context_index].samplers.remove(id, call->mCallNo, frames);
             }
         }
+        break;
     }
-    else if (call->mCallName == "glBindSampler")
+    case TRACK_glBindSampler:
     {
         // The usual rule that you can create objects with glBind*() calls apparently does not apply to to glBindSampler()
         const GLuint unit = call->mArgs[0]->GetAsUInt();
         contexts[context_index].sampler_binding[unit] = call->mArgs[1]->GetAsUInt();
+        break;
     }
-    else if (call->mCallName == "glGenQueries" || call->mCallName == "glGenQueriesEXT")
+    case TRACK_glGenQueries:
     {
         GLuint count = call->mArgs[0]->GetAsInt();
         assert(call->mArgs[1]->IsArray());
@@ -773,8 +1147,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             const unsigned id = call->mArgs[1]->mArray[i].GetAsUInt();
             contexts[context_index].queries.add(id, call->mCallNo, frames);
         }
+        break;
     }
-    else if (call->mCallName == "glDeleteQueries" || call->mCallName == "glDeleteQueriesEXT")
+    case TRACK_glDeleteQueries:
     {
         const unsigned count = call->mArgs[0]->GetAsUInt();
         assert(call->mArgs[1]->IsArray());
@@ -787,19 +1162,22 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 contexts[context_index].queries.remove(id, call->mCallNo, frames);
             }
         }
+        break;
     }
-    else if (call->mCallName == "glBeginQuery" || call->mCallName == "glBeginQueryEXT")
+    case TRACK_glBeginQuery:
     {
         const GLenum target = call->mArgs[0]->GetAsUInt();
         const GLuint id = call->mArgs[1]->GetAsUInt();
         contexts[context_index].query_binding[target] = id;
+        break;
     }
-    else if (call->mCallName == "glEndQuery" || call->mCallName == "glEndQueryEXT")
+    case TRACK_glEndQuery:
     {
         const GLenum target = call->mArgs[0]->GetAsUInt();
         contexts[context_index].query_binding[target] = UNBOUND;
+        break;
     }
-    else if (call->mCallName == "glGenTransformFeedbacks")
+    case TRACK_glGenTransformFeedbacks:
     {
         GLuint count = call->mArgs[0]->GetAsInt();
         assert(call->mArgs[1]->IsArray());
@@ -809,8 +1187,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             const unsigned id = call->mArgs[1]->mArray[i].GetAsUInt();
             contexts[context_index].transform_feedbacks.add(id, call->mCallNo, frames);
         }
+        break;
     }
-    else if (call->mCallName == "glDeleteTransformFeedbacks")
+    case TRACK_glDeleteTransformFeedbacks:
     {
         const unsigned count = call->mArgs[0]->GetAsUInt();
         assert(call->mArgs[1]->IsArray());
@@ -823,8 +1202,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 contexts[context_index].transform_feedbacks.remove(id, call->mCallNo, frames);
             }
         }
+        break;
     }
-    else if (call->mCallName == "glBindTransformFeedback")
+    case TRACK_glBindTransformFeedback:
     {
         assert(call->mArgs[0]->GetAsUInt() == GL_TRANSFORM_FEEDBACK);
         GLuint id = call->mArgs[1]->GetAsUInt();
@@ -834,22 +1214,25 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             contexts[context_index].transform_feedbacks.add(id, call->mCallNo, frames);
         }
         contexts[context_index].transform_feedback_binding = id;
+        break;
     }
 #if 0 // this was not working as it should; apparently non-object transform feedback is legal in GLES
-    else if (call->mCallName == "glBeginTransformFeedback")
+    case TRACK_glBeginTransformFeedback:
     {
         const GLuint id = contexts[context_index].transform_feedback_binding;
         const int index = contexts[context_index].transform_feedbacks.remap(id);
         contexts[context_index].transform_feedbacks[index].primitiveMode = call->mArgs[0]->GetAsUInt();
+        break;
     }
-    else if (call->mCallName == "glEndTransformFeedback")
+    case TRACK_glEndTransformFeedback:
     {
         const int id = contexts[context_index].transform_feedback_binding;
         const int index = contexts[context_index].transform_feedbacks.remap(id);
         contexts[context_index].transform_feedbacks[index].primitiveMode = GL_NONE;
+        break;
     }
 #endif
-    else if (call->mCallName == "glGenBuffers")
+    case TRACK_glGenBuffers:
     {
         GLuint count = call->mArgs[0]->GetAsInt();
         assert(call->mArgs[1]->IsArray());
@@ -859,8 +1242,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             const unsigned id = call->mArgs[1]->mArray[i].GetAsUInt();
             contexts[context_index].buffers.add(id, call->mCallNo, frames);
         }
+        break;
     }
-    else if (call->mCallName == "glDeleteBuffers")
+    case TRACK_glDeleteBuffers:
     {
         const unsigned count = call->mArgs[0]->GetAsUInt();
         assert(call->mArgs[1]->IsArray());
@@ -876,8 +1260,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         // TBD: "When a buffer, texture, or renderbuffer object is deleted, it is unbound from any
         // bind points it is bound to in the current context, and detached from any attachments
         // of container objects that are bound to the current context"
+        break;
     }
-    else if (call->mCallName == "glBufferData")
+    case TRACK_glBufferData:
     {
         const GLenum target = call->mArgs[0]->GetAsUInt();
         const GLuint id = contexts[context_index].boundBufferIds[target][0].buffer;
@@ -886,8 +1271,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         StateTracker::Buffer &buffer = contexts[context_index].buffers[index];
         buffer.usages.insert(call->mArgs[3]->GetAsUInt());
         //call->mArgs[2]->GetAsBlob() contains the buffer itself
+        break;
     }
-    else if (call->mCallName == "glBindBuffer")
+    case TRACK_glBindBuffer:
     {
         const GLenum target = call->mArgs[0]->GetAsUInt();
         const GLuint id = call->mArgs[1]->GetAsUInt();
@@ -897,8 +1283,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             contexts[context_index].buffers.add(id, call->mCallNo, frames);
         }
         contexts[context_index].boundBufferIds[target][0] = { id, 0, 0 };
+        break;
     }
-    else if (call->mCallName == "glBindBufferBase")
+    case TRACK_glBindBufferBase:
     {
         const GLenum target = call->mArgs[0]->GetAsUInt();
         const GLuint index = call->mArgs[1]->GetAsUInt();
@@ -909,8 +1296,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             contexts[context_index].buffers.add(id, call->mCallNo, frames);
         }
         contexts[context_index].boundBufferIds[target][index] = { id, 0, 0 };
+        break;
     }
-    else if (call->mCallName == "glBindBufferRange")
+    case TRACK_glBindBufferRange:
     {
         const GLenum target = call->mArgs[0]->GetAsUInt();
         const GLuint index = call->mArgs[1]->GetAsUInt();
@@ -923,8 +1311,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             contexts[context_index].buffers.add(id, call->mCallNo, frames);
         }
         contexts[context_index].boundBufferIds[target][index] = { id, offset, size };
+        break;
     }
-    else if (call->mCallName == "glVertexAttribPointer" || call->mCallName == "glVertexAttribIPointer")
+    case TRACK_glVertexAttribPointer:
     {
         const GLuint id = contexts[context_index].boundBufferIds[GL_ARRAY_BUFFER][0].buffer;
         if (id != 0)
@@ -943,8 +1332,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 DBG_LOG("API ERROR [%d]: %s specifies a bad target %u\n", (int)call->mCallNo, call->mCallName.c_str(), id);
             }
         }
+        break;
     }
-    else if (call->mCallName == "glGenTextures")
+    case TRACK_glGenTextures:
     {
         GLuint count = call->mArgs[0]->GetAsInt();
         assert(call->mArgs[1]->IsArray());
@@ -954,8 +1344,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             const unsigned id = call->mArgs[1]->mArray[i].GetAsUInt();
             contexts[context_index].textures.add(id, call->mCallNo, frames);
         }
+        break;
     }
-    else if (call->mCallName == "glDeleteTextures")
+    case TRACK_glDeleteTextures:
     {
         const unsigned count = call->mArgs[0]->GetAsUInt();
         assert(call->mArgs[1]->IsArray());
@@ -994,12 +1385,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                                         contexts[context_index].framebuffers.remap(contexts[context_index].readframebuffer), false, id);
             }
         }
+        break;
     }
-    else if (call->mCallName == "glTexStorage3D" || call->mCallName == "glTexStorage2D" || call->mCallName == "glTexStorage1D"
-             || call->mCallName == "glTexStorage3DEXT" || call->mCallName == "glTexStorage2DEXT" || call->mCallName == "glTexStorage1DEXT"
-             || call->mCallName == "glTexImage3D" || call->mCallName == "glTexImage2D" || call->mCallName == "glTexImage1D" || call->mCallName == "glTexImage3DOES"
-             || call->mCallName == "glCompressedTexImage3D" || call->mCallName == "glCompressedTexImage2D"
-             || call->mCallName == "glCompressedTexImage1D")
+    case TRACK_glTexStorage3D:
     {
         const GLenum target = interpret_texture_target(call->mArgs[0]->GetAsUInt());
         const GLuint unit = contexts[context_index].activeTextureUnit;
@@ -1035,8 +1423,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         {
             DBG_LOG("API ERROR [%d]: Cannot find texture id %u for %s on context %d\n", (int)call->mCallNo, tex_id, call->mCallName.c_str(), context_index);
         }
+        break;
     }
-    else if (call->mCallName == "glTexStorage2DMultisample")
+    case TRACK_glTexStorage2DMultisample:
     {
         const GLenum target = interpret_texture_target(call->mArgs[0]->GetAsUInt()); // must be GL_TEXTURE_2D_MULTISAMPLE
         assert(target == GL_TEXTURE_2D_MULTISAMPLE);
@@ -1050,8 +1439,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         tex.width = call->mArgs[3]->GetAsInt();
         tex.height = call->mArgs[4]->GetAsInt();
         tex.levels = 0;
+        break;
     }
-    else if (call->mCallName == "glBindTexture")
+    case TRACK_glBindTexture:
     {
         const unsigned unit = contexts[context_index].activeTextureUnit;
         const unsigned target = call->mArgs[0]->GetAsUInt();
@@ -1062,13 +1452,15 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             // It is legal to create objects with a call to this function.
             contexts[context_index].textures.add(tex_id, call->mCallNo, frames);
         }
+        break;
     }
-    else if (call->mCallName == "glActiveTexture")
+    case TRACK_glActiveTexture:
     {
         const GLuint unit = call->mArgs[0]->GetAsUInt() - GL_TEXTURE0;
         contexts[context_index].activeTextureUnit = unit;
+        break;
     }
-    else if (call->mCallName == "glTexParameteri" || call->mCallName == "glTexParameterf" || call->mCallName == "glTexParameteriv" || call->mCallName == "glTexParameterfv")
+    case TRACK_glTexParameteri:
     {
         const GLenum target = call->mArgs[0]->GetAsUInt();
         const GLenum pname = call->mArgs[1]->GetAsUInt();
@@ -1079,8 +1471,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         }
         const int texture_index = contexts[context_index].textures.remap(texture_id);
         adjust_sampler_state(call, pname, contexts[context_index].textures[texture_index].state, call->mArgs[2]);
+        break;
     }
-    else if (call->mCallName == "glSamplerParameterf" || call->mCallName == "glSamplerParameteri" || call->mCallName == "glSamplerParameterfv" || call->mCallName == "glSamplerParameteriv")
+    case TRACK_glSamplerParameterf:
     {
         const GLenum sampler = call->mArgs[0]->GetAsUInt();
         if (!contexts[context_index].samplers.contains(sampler))
@@ -1091,13 +1484,15 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         const GLenum pname = call->mArgs[1]->GetAsUInt();
         const GLuint sampler_idx = contexts[context_index].samplers.remap(sampler);
         adjust_sampler_state(call, pname, contexts[context_index].samplers[sampler_idx].state, call->mArgs[2]);
+        break;
     }
-    else if (call->mCallName == "glCreateProgram")
+    case TRACK_glCreateProgram:
     {
         GLuint id = call->mRet.GetAsUInt();
         contexts[context_index].programs.add(id, call->mCallNo, frames);
+        break;
     }
-    else if (call->mCallName == "glUseProgram")
+    case TRACK_glUseProgram:
     {
         GLuint id = call->mArgs[0]->GetAsUInt();
         if (id != 0)
@@ -1116,8 +1511,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         {
             contexts[context_index].program_index = UNBOUND;
         }
+        break;
     }
-    else if (call->mCallName == "glDeleteProgram")
+    case TRACK_glDeleteProgram:
     {
         GLuint id = call->mArgs[0]->GetAsUInt();
         // "DeleteProgram will silently ignore the value zero". Also, some content assumes it will also
@@ -1133,8 +1529,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 DBG_LOG("API ERROR [%d]: Deleting non-existent program ID %u in context %d\n", (int)call->mCallNo, id, context_index);
             }
         }
+        break;
     }
-    else if (call->mCallName == "glAttachShader")
+    case TRACK_glAttachShader:
     {
         GLuint program = call->mArgs[0]->GetAsUInt();
         GLuint shader = call->mArgs[1]->GetAsUInt();
@@ -1158,15 +1555,17 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             DBG_LOG("API ERROR [%d]: Failed to attach shader ID %u to program ID %u, context %d (program or shader not found by IDs)\n",
                     (int)call->mCallNo, shader, program, context_index);
         }
+        break;
     }
-    else if (call->mCallName == "glCreateShader")
+    case TRACK_glCreateShader:
     {
         GLuint id = call->mRet.GetAsUInt();
         GLenum type = call->mArgs[0]->GetAsInt();
         StateTracker::Shader& s = contexts[context_index].shaders.add(id, call->mCallNo, frames);
         s.shader_type = type;
+        break;
     }
-    else if (call->mCallName == "glDeleteShader")
+    case TRACK_glDeleteShader:
     {
         GLuint id = call->mArgs[0]->GetAsUInt();
         // "DeleteShader will silently ignore the value zero". Also, some content assumes it will also
@@ -1182,8 +1581,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 DBG_LOG("API ERROR [%d]: Deleting non-existent shader ID %u in context %d\n", (int)call->mCallNo, id, context_index);
             }
         }
+        break;
     }
-    else if (call->mCallName == "glLinkProgram")
+    case TRACK_glLinkProgram:
     {
         GLuint program = call->mArgs[0]->GetAsUInt();
         int target_program_index = contexts[context_index].programs.remap(program);
@@ -1200,8 +1600,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             }
         }
         p.md5sum = common::MD5Digest(code).text_lower();
+        break;
     }
-    else if (call->mCallName == "glShaderSource")
+    case TRACK_glShaderSource:
     {
         const GLuint shader = call->mArgs[0]->GetAsUInt();
         int target_shader_index = contexts[context_index].shaders.remap(shader);
@@ -1249,8 +1650,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         {
             used_extensions.insert(e);
         }
+        break;
     }
-    else if (call->mCallName == "glGetUniformLocation") // these are injected if necessary by tracer
+    case TRACK_glGetUniformLocation: // these are injected if necessary by tracer
     {
         GLint location = call->mRet.GetAsInt();
         GLuint program = call->mArgs[0]->GetAsUInt();
@@ -1258,9 +1660,10 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         int target_program_index = contexts[context_index].programs.remap(program);
         contexts[context_index].programs[target_program_index].uniformNames[location] = name;
         contexts[context_index].programs[target_program_index].uniformLocations[name] = location;
+        break;
     }
     // Standard: "Sampler values must be set by calling Uniform1i{v}". That's why we only save those.
-    else if (call->mCallName == "glUniform1i")
+    case TRACK_glUniform1i:
     {
         const GLint location = call->mArgs[0]->GetAsInt();
         if (location != -1)
@@ -1275,8 +1678,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 assert(contexts[context_index].programs[program_index].uniformValues[location].size() == 1);
             }
         }
+        break;
     }
-    else if (call->mCallName == "glUniform1iv")
+    case TRACK_glUniform1iv:
     {
         const GLint location = call->mArgs[0]->GetAsInt();
         if (location != -1)
@@ -1296,9 +1700,10 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 contexts[context_index].programs[program_index].uniformLastChanged[location] = call->mCallNo;
             }
         }
+        break;
     }
     // glProgramUniform1i and glProgramUniform1iv also apply because they are functional mirrors of the above.
-    else if (call->mCallName == "glProgramUniform1i")
+    case TRACK_glProgramUniform1i:
     {
         const GLuint program = call->mArgs[0]->GetAsUInt();
         const GLint location = call->mArgs[1]->GetAsInt();
@@ -1313,8 +1718,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 contexts[context_index].programs[program_index].uniformLastChanged[location] = call->mCallNo;
             }
         }
+        break;
     }
-    else if (call->mCallName == "glProgramUniform1iv")
+    case TRACK_glProgramUniform1iv:
     {
         const GLuint program = call->mArgs[0]->GetAsUInt();
         const GLint location = call->mArgs[1]->GetAsInt();
@@ -1335,8 +1741,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 contexts[context_index].programs[program_index].uniformLastChanged[location] = call->mCallNo;
             }
         }
+        break;
     }
-    else if (call->mCallName.find("glUniform") != std::string::npos || call->mCallName.find("glProgramUniform") != std::string::npos) // other uniforms
+    case TRACK_glUniform: // other uniforms
     {
         GLint location = 0;
         GLuint program_id = 0;
@@ -1363,8 +1770,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         {
             contexts[context_index].programs[program_index].uniformLastChanged[location] = call->mCallNo;
         }
+        break;
     }
-    else if (call->mCallName == "glGenProgramPipelines" || call->mCallName == "glGenProgramPipelinesEXT")
+    case TRACK_glGenProgramPipelines:
     {
         const unsigned count = call->mArgs[0]->GetAsUInt();
         assert(call->mArgs[1]->IsArray());
@@ -1374,8 +1782,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
             const unsigned id = call->mArgs[1]->mArray[i].GetAsUInt();
             contexts[context_index].program_pipelines.add(id, call->mCallNo, frames);
         }
+        break;
     }
-    else if (call->mCallName == "glDeleteProgramPipelines" || call->mCallName == "glDeleteProgramPipelinesEXT")
+    case TRACK_glDeleteProgramPipelines:
     {
         const unsigned count = call->mArgs[0]->GetAsUInt();
         assert(call->mArgs[1]->IsArray());
@@ -1396,8 +1805,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 contexts[context_index].program_pipeline_index = UNBOUND;
             }
         }
+        break;
     }
-    else if (call->mCallName == "glBindProgramPipeline" || call->mCallName == "glBindProgramPipelineEXT")
+    case TRACK_glBindProgramPipeline:
     {
         GLuint id = call->mArgs[0]->GetAsUInt();
         if (id != 0)
@@ -1416,8 +1826,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         {
             contexts[context_index].program_pipeline_index = UNBOUND;
         }
+        break;
     }
-    else if (call->mCallName == "glUseProgramStages" || call->mCallName == "glUseProgramStagesEXT")
+    case TRACK_glUseProgramStages:
     {
         const GLuint pipeline = call->mArgs[0]->GetAsUInt();
         const GLuint stages = call->mArgs[1]->GetAsUInt();
@@ -1450,8 +1861,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                 }
             }
         }
+        break;
     }
-    else if (call->mCallName == "glDrawBuffers")
+    case TRACK_glDrawBuffers:
     {
         unsigned count = call->mArgs[0]->GetAsUInt();
         assert(call->mArgs[1]->IsArray());
@@ -1461,8 +1873,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         {
             contexts[context_index].draw_buffers[i] = call->mArgs[1]->mArray[i].GetAsUInt();
         }
+        break;
     }
-    else if (call->mCallName == "glObjectLabel")
+    case TRACK_glObjectLabel:
     {
         const GLenum identifier = call->mArgs[0]->GetAsUInt();
         const GLuint name = call->mArgs[1]->GetAsUInt();
@@ -1501,38 +1914,45 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         default:
             break;
         }
+        break;
     }
-    else if (call->mCallName == "glFinish" && context_index != UNBOUND)
+    case TRACK_glFinish:
     {
         contexts[context_index].finish_calls_per_frame[frames]++;
+        break;
     }
-    else if (call->mCallName == "glFlush" && context_index != UNBOUND)
+    case TRACK_glFlush:
     {
         contexts[context_index].flush_calls_per_frame[frames]++;
+        break;
     }
-    else if (call->mCallName == "glPatchParameteri" || call->mCallName == "glPatchParameteriEXT")
+    case TRACK_glPatchParameteri:
     {
         GLenum pname = call->mArgs[0]->GetAsUInt();
         if (pname == GL_PATCH_VERTICES)
         {
             contexts[context_index].patchSize = call->mArgs[1]->GetAsInt();
         }
+        break;
     }
-    else if (call->mCallName == "glDepthMask")
+    case TRACK_glDepthMask:
     {
         contexts[context_index].fillstate.depthmask = call->mArgs[0]->GetAsUInt();
+        break;
     }
-    else if (call->mCallName == "glDepthFunc")
+    case TRACK_glDepthFunc:
     {
         contexts[context_index].fillstate.depthfunc = call->mArgs[0]->GetAsUInt();
+        break;
     }
-    else if (call->mCallName == "glStencilMask")
+    case TRACK_glStencilMask:
     {
         const GLuint mask = call->mArgs[0]->GetAsUInt();
         contexts[context_index].fillstate.stencilmask[GL_FRONT] = mask;
         contexts[context_index].fillstate.stencilmask[GL_BACK] = mask;
+        break;
     }
-    else if (call->mCallName == "glStencilMaskSeparate")
+    case TRACK_glStencilMaskSeparate:
     {
         const GLenum face = call->mArgs[0]->GetAsUInt();
         const GLuint mask = call->mArgs[1]->GetAsUInt();
@@ -1545,30 +1965,35 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         {
             contexts[context_index].fillstate.stencilmask[face] = mask;
         }
+        break;
     }
-    else if (call->mCallName == "glColorMask")
+    case TRACK_glColorMask:
     {
         contexts[context_index].fillstate.colormask[0] = call->mArgs[0]->GetAsUInt();
         contexts[context_index].fillstate.colormask[1] = call->mArgs[1]->GetAsUInt();
         contexts[context_index].fillstate.colormask[2] = call->mArgs[2]->GetAsUInt();
         contexts[context_index].fillstate.colormask[3] = call->mArgs[3]->GetAsUInt();
+        break;
     }
-    else if (call->mCallName == "glClearColor")
+    case TRACK_glClearColor:
     {
         contexts[context_index].fillstate.clearcolor[0] = call->mArgs[0]->GetAsFloat();
         contexts[context_index].fillstate.clearcolor[1] = call->mArgs[1]->GetAsFloat();
         contexts[context_index].fillstate.clearcolor[2] = call->mArgs[2]->GetAsFloat();
         contexts[context_index].fillstate.clearcolor[3] = call->mArgs[3]->GetAsFloat();
+        break;
     }
-    else if (call->mCallName == "glClearStencil")
+    case TRACK_glClearStencil:
     {
         contexts[context_index].fillstate.clearstencil = call->mArgs[0]->GetAsInt();
+        break;
     }
-    else if (call->mCallName == "glClearDepthf")
+    case TRACK_glClearDepthf:
     {
         contexts[context_index].fillstate.cleardepth = call->mArgs[0]->GetAsFloat();
+        break;
     }
-    else if (call->mCallName.compare(0, 10, "glDispatch") == 0)
+    case TRACK_glDispatch:
     {
         const int current_program = contexts[context_index].program_index;
         contexts[context_index].programs[current_program].stats.dispatches++;
@@ -1580,8 +2005,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         }
         StateTracker::RenderPass &rp = contexts[context_index].render_passes.back();
         rp.used_programs.insert(contexts[context_index].program_index);
+        break;
     }
-    else if (call->mCallName == "glClear")
+    case TRACK_glClear:
     {
        GLbitfield mask = call->mArgs[0]->GetAsUInt();
        if (mask & GL_COLOR_BUFFER_BIT) // interacts with glDrawBuffers()
@@ -1627,8 +2053,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
                at.clears.push_back(contexts[context_index].fillstate);
            }
        }
+        break;
     }
-    else if (call->mCallName == "glClearBufferfi")
+    case TRACK_glClearBufferfi:
     {
        GLenum buffertype = call->mArgs[0]->GetAsUInt();
        assert(buffertype == GL_DEPTH_STENCIL);
@@ -1646,8 +2073,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
        stencil.clears.push_back(fillstate);
        find_duplicate_clears(fillstate, depth, GL_DEPTH, fbo, call->mCallName);
        depth.clears.push_back(fillstate);
+        break;
     }
-    else if (call->mCallName.compare(0, 13, "glClearBuffer") == 0) // except glClearBufferfi which is handled above
+    case TRACK_glClearBuffer: // except glClearBufferfi which is handled above
     {
        GLenum buffertype = call->mArgs[0]->GetAsUInt();
        GLint drawbuffer = call->mArgs[1]->GetAsInt();
@@ -1685,8 +2113,9 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
        }
        find_duplicate_clears(fillstate, at, buffertype, fbo, call->mCallName);
        at.clears.push_back(fillstate);
+        break;
     }
-    else if (call->mCallName.compare(0, 6, "glDraw") == 0 && call->mCallName != "glDrawBuffers")
+    case TRACK_glDraw:
     {
         contexts[context_index].draw_calls_per_frame[frames]++;
         if (contexts[context_index].program_index == UNBOUND && contexts[context_index].program_pipeline_index == UNBOUND)
@@ -1752,11 +2181,19 @@ void ParseInterfaceBase::interpret_call(common::CallTM *call)
         }
         rp.vertices += params.vertices;
         rp.primitives += params.primitives;
+        break;
+    }
+    default:
+        break;
     }
 }
 
 void ParseInterface::close()
 {
+    if (_selective)
+    {
+        _selective->Close();
+    }
     inputFile.Close();
     outputFile.Close();
 }
@@ -2,8 +2,10 @@
 #define PARSE_INTERFACE_H
 
 #include <deque>
+#include <functional>
 #include <vector>
 #include <list>
+#include <memory>
 #include <map> // do not use unordered, since we want reproducible output
 #include <tuple>
 #include <unordered_set>
@@ -19,6 +21,7 @@
 #include "common/out_file.hpp"
 #include "common/api_info.hpp"
 #include "common/parse_api.hpp"
+#include "common/selective_reader.hpp"
 #include "common/trace_model.hpp"
 #include "common/trace_model_utility.hpp"
 #include "common/os.hpp"
@@ -48,21 +51,24 @@ struct DrawParams
     double vec4_locality = 0.0;
     double temporal_locality = 0.0;
     double spatial_locality = 0.0;
+    // hit rates of simulated post-transform vertex caches, 0.0->1.0
+    double fifo_hit_rate = 0.0;
+    double lru_hit_rate = 0.0;
 };
 
-static inline const std::string drawEnum(unsigned int enumToFind)
+static inline const char* drawEnum(unsigned int enumToFind)
 {
     const char *retval = EnumString(enumToFind, "glDraw");
     return retval ? retval : "Unknown";
 }
 
-static inline const std::string blendEnum(unsigned int enumToFind)
+static inline const char* blendEnum(unsigned int enumToFind)
 {
     const char *retval = EnumString(enumToFind, "glBlendFunc");
     return retval ? retval : "Unknown";
 }
 
-static inline const std::string texEnum(unsigned int enumToFind)
+static inline const char* texEnum(unsigned int enumToFind)
 {
     const char *retval = EnumString(enumToFind, "glTexParameter");
     return retval ? retval : "Unknown";
@@ -522,6 +528,11 @@ public:
     void setScreenshots(bool value) { mScreenshots = value; }
     void interpret_call(common::CallTM *call);
 
+    // Tools that need to look at particular calls register a hook for them here, instead of
+    // comparing the name of every call. Hooks run in interpret_call() after the state is updated.
+    typedef std::function<void(common::CallTM *call)> CallHook;
+    void addCallHook(const char* name, const CallHook& hook);
+
     std::deque<StateTracker::Context> contexts; // using deque to avoid moving contents around in memory, invalidating pointers
     std::vector<StateTracker::Surface> surfaces;
     std::map<int, int> context_remapping; // from id to index in the original file
@@ -542,6 +553,7 @@ public:
     std::unordered_set<std::string> used_extensions;
 
 private:
+    void track_call(common::CallTM *call);
     bool find_duplicate_clears(const StateTracker::FillState& f, const StateTracker::Attachment& at, GLenum type, StateTracker::Framebuffer& fbo, const std::string& call);
 
 protected:
@@ -549,6 +561,7 @@ protected:
     bool mQuickMode = true;
     bool mDisplayMode = false;
     bool mScreenshots = true;
+    std::vector<std::vector<CallHook>> mCallHooks; // by CallTM::mCallId
 };
 
 class ParseInterface : public ParseInterfaceBase
@@ -561,6 +574,12 @@ public:
     virtual void close() override;
     virtual common::CallTM* next_call() override;
 
+    // Only decode the named calls, the calls that have hooks, and the EGL calls
+    // that the context tracking needs. Must be called before open(). The trace
+    // is then streamed and next_call() steps over every other call without
+    // parsing it, so the state is only tracked for the selected calls.
+    void select_calls(const std::vector<std::string>& names);
+
     virtual void writeout(common::OutFile &outputFile, common::CallTM *call);
 
     common::TraceFileTM inputFile;
@@ -571,6 +590,7 @@ private:
     unsigned _curFrameIndex;
     unsigned _curCallIndexInFrame;
     bool only_default; // only parse default tid calls
+    std::unique_ptr<common::SelectiveReader> _selective;
 };
 
 #endif
@@ -4,8 +4,9 @@
 #include "helper/eglsize.hpp"
 
 #include <assert.h>
-#include <set>
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 #include <errno.h>
 #include <stdlib.h>
@@ -19,7 +20,6 @@
 
 using namespace retracer;
 
-const int cache_size = 512;
 static int mPerfFD = -1;
 static bool perf_initialized = false;
 
@@ -93,62 +93,75 @@ static int64_t perf_stop()
     return count;
 }
 
-template<class T>
-static void analyzeIndexBuffer(const void *ptr, intptr_t offset, DrawParams& ret)
+// Analyzed index buffers kept for reuse, dropped all at once when there are more
+const size_t index_stats_cache_entries = 65536;
+
+static GLenum bufferBinding(GLenum target)
 {
-    GLboolean primitive_restart = 0;
-    glGetBooleanv(GL_PRIMITIVE_RESTART_FIXED_INDEX, &primitive_restart);
-    std::map<T, long> cache;
-    long timestamp = 0;
-    const unsigned stride = (unsigned)sizeof(T);
-    const T* buffer = (const T*)ptr;
-    offset /= stride;
-    std::set<T> seen;
-    int sum_age = 0;
-    for (int idx = offset; idx < ret.vertices + offset; idx++)
+    switch (target)
     {
-        const T element = buffer[idx];
-        long age;
-
-        if (cache.count(element) > 0)
-        {
-            age = std::min<long>(timestamp - cache[element], cache_size);
-        }
-        else
-        {
-            age = cache_size;
-        }
+    case GL_ARRAY_BUFFER: return GL_ARRAY_BUFFER_BINDING;
+    case GL_ELEMENT_ARRAY_BUFFER: return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+    case GL_COPY_READ_BUFFER: return GL_COPY_READ_BUFFER_BINDING;
+    case GL_COPY_WRITE_BUFFER: return GL_COPY_WRITE_BUFFER_BINDING;
+    case GL_PIXEL_PACK_BUFFER: return GL_PIXEL_PACK_BUFFER_BINDING;
+    case GL_PIXEL_UNPACK_BUFFER: return GL_PIXEL_UNPACK_BUFFER_BINDING;
+    case GL_TRANSFORM_FEEDBACK_BUFFER: return GL_TRANSFORM_FEEDBACK_BUFFER_BINDING;
+    case GL_UNIFORM_BUFFER: return GL_UNIFORM_BUFFER_BINDING;
+    case GL_SHADER_STORAGE_BUFFER: return GL_SHADER_STORAGE_BUFFER_BINDING;
+    case GL_ATOMIC_COUNTER_BUFFER: return GL_ATOMIC_COUNTER_BUFFER_BINDING;
+    case GL_DRAW_INDIRECT_BUFFER: return GL_DRAW_INDIRECT_BUFFER_BINDING;
+    case GL_DISPATCH_INDIRECT_BUFFER: return GL_DISPATCH_INDIRECT_BUFFER_BINDING;
+    case GL_TEXTURE_BUFFER: return GL_TEXTURE_BUFFER_BINDING;
+    default: return GL_NONE;
+    }
+}
 
-        if (primitive_restart && element == std::numeric_limits<T>::max())
-        {
-            ret.primitives++;
-        }
-        seen.insert(element);
-        cache[element] = timestamp;
-        timestamp++;
-        sum_age += age;
+ParseInterfaceRetracing::ParseInterfaceRetracing() : ParseInterfaceBase(), mCall(NULL)
+{
+    // Keep track of which buffers may have changed since their indices were analyzed
+    const char* targetWrites[] = { "glBufferData", "glBufferSubData", "glBufferStorageEXT", "glMapBuffer", "glMapBufferOES",
+                                   "glMapBufferRange", "glMapBufferRangeEXT", "glFlushMappedBufferRange", "glFlushMappedBufferRangeEXT",
+                                   "glUnmapBuffer", "glUnmapBufferOES", "glCopyClientSideBuffer", "glPatchClientSideBuffer" };
+    for (const char* name : targetWrites)
+    {
+        addCallHook(name, [this](common::CallTM *call) { bufferWritten(call->mArgs[0]->GetAsUInt()); });
     }
-    ret.temporal_locality = 1.0 - (double)(sum_age / ret.vertices) / (double)cache_size;
-    ret.unique_vertices = seen.size();
-    ret.min_value = *seen.begin();
-    ret.max_value = *seen.rbegin();
-    ret.avg_sparseness = 0;
-    T prev = *seen.begin();
-    int shaded_verts = 4;
-    for (const T v : seen)
+    addCallHook("glCopyBufferSubData", [this](common::CallTM *call) { bufferWritten(call->mArgs[1]->GetAsUInt()); });
+    addCallHook("glDeleteBuffers", [this](common::CallTM *call)
     {
-        if (v - (prev / 4) * 4 >= 4)
+        for (unsigned i = 0; i < call->mArgs[1]->mArrayLen; i++)
         {
-            shaded_verts += 4;
+            mBufferGenerations[call->mArgs[1]->mArray[i].GetAsUInt()]++;
         }
-        T distance = std::max<T>(1, v - prev);
-        ret.max_sparseness = std::max<T>(distance, ret.max_sparseness);
-        ret.avg_sparseness += distance;
-        prev = v;
+    });
+    // Writes from shaders, transform feedback and pixel packing are not tracked per buffer
+    const char* otherWrites[] = { "glMemoryBarrier", "glMemoryBarrierByRegion", "glBeginTransformFeedback", "glEndTransformFeedback",
+                                  "glResumeTransformFeedback", "glReadPixels", "glReadnPixels", "glReadnPixelsEXT", "glReadnPixelsKHR" };
+    for (const char* name : otherWrites)
+    {
+        addCallHook(name, [this](common::CallTM *) { mBufferEpoch++; });
+    }
+}
+
+ParseInterfaceRetracing::~ParseInterfaceRetracing()
+{
+    delete mDecoder;
+    delete mBatch;
+    delete mCall;
+}
+
+void ParseInterfaceRetracing::bufferWritten(GLenum target)
+{
+    const GLenum binding = bufferBinding(target);
+    if (binding == GL_NONE || context_index == UNBOUND)
+    {
+        mBufferEpoch++;
+        return;
     }
-    ret.vec4_locality = (double)seen.size() / (double)shaded_verts;
-    ret.avg_sparseness /= seen.size();
-    ret.spatial_locality = 1.0 / ret.avg_sparseness;
+    GLint bufferId = 0;
+    _glGetIntegerv(binding, &bufferId);
+    mBufferGenerations[bufferId]++;
 }
 
 DrawParams ParseInterfaceRetracing::getDrawCallCount(common::CallTM *call)
@@ -188,61 +201,81 @@ DrawParams ParseInterfaceRetracing::getDrawCallCount(common::CallTM *call)
     ret.unique_vertices = ret.vertices; // for non-indexed case
     if (call->mCallName.find("Elements") != std::string::npos && !mQuickMode)
     {
-        GLvoid *indices = drawCallIndexPtr(call);
+        const intptr_t offset = reinterpret_cast<intptr_t>(drawCallIndexPtr(call));
         ret.value_type = drawCallIndexType(call);
         const unsigned bufferSize = _gl_type_size(ret.value_type, ret.vertices);
+        GLboolean primitive_restart = 0;
+        glGetBooleanv(GL_PRIMITIVE_RESTART_FIXED_INDEX, &primitive_restart);
         GLint bufferId = 0;
-        GLint oldCopybufferId = 0;
         _glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &bufferId);
-        _glGetIntegerv(GL_COPY_READ_BUFFER_BINDING, &oldCopybufferId);
-        const char *ptr;
+        IndexBufferStats stats;
         if (bufferId == 0) // buffer is in client memory
         {
-            ptr = reinterpret_cast<const char *>(indices);
-            indices = NULL;
+            const char *ptr = reinterpret_cast<const char *>(offset);
             if (!ptr) // this seems very very broken, but does happen in some traces
             {
                 return ret;
             }
+            if (!analyzeIndexBuffer(ptr, ret.value_type, ret.vertices, primitive_restart, stats))
+            {
+                return ret;
+            }
         }
         else
         {
-            GLint bufSize = 0;
-            _glGetBufferParameteriv(GL_ELEMENT_ARRAY_BUFFER, GL_BUFFER_SIZE, &bufSize);
-            if (bufferSize > (unsigned)bufSize)
+            // Engines draw the same meshes every frame, so the indices of a draw are only analyzed again if the buffer may have changed
+            const IndexBufferKey key = { context_index, (GLuint)bufferId, mBufferGenerations[bufferId], mBufferEpoch, offset,
+                                         ret.vertices, ret.value_type, primitive_restart == GL_TRUE };
+            std::map<IndexBufferKey, IndexBufferStats>::const_iterator it = mIndexBufferStats.find(key);
+            if (it != mIndexBufferStats.end())
             {
-                DBG_LOG("Buffer too small: Calculated to %ld, was %ld\n", (long)bufferSize, (long)bufSize);
-                assert(false);
-                return ret;
+                stats = it->second;
             }
-            _glBindBuffer(GL_COPY_READ_BUFFER, bufferId);
-            ptr = (const char *)_glMapBufferRange(GL_COPY_READ_BUFFER, 0, bufferSize, GL_MAP_READ_BIT);
-            if (!ptr)
+            else
             {
-                DBG_LOG("Failed to bind buffer %d for draw call analysis at call number %ld\n", bufferId, (long)call->mCallNo);
-                return ret;
+                GLint bufSize = 0;
+                _glGetBufferParameteriv(GL_ELEMENT_ARRAY_BUFFER, GL_BUFFER_SIZE, &bufSize);
+                if (offset + bufferSize > (unsigned)bufSize)
+                {
+                    DBG_LOG("Buffer too small: Calculated to %ld, was %ld\n", (long)(offset + bufferSize), (long)bufSize);
+                    assert(false);
+                    return ret;
+                }
+                GLint oldCopybufferId = 0;
+                _glGetIntegerv(GL_COPY_READ_BUFFER_BINDING, &oldCopybufferId);
+                _glBindBuffer(GL_COPY_READ_BUFFER, bufferId);
+                const char *ptr = (const char *)_glMapBufferRange(GL_COPY_READ_BUFFER, offset, bufferSize, GL_MAP_READ_BIT);
+                if (!ptr)
+                {
+                    DBG_LOG("Failed to bind buffer %d for draw call analysis at call number %ld\n", bufferId, (long)call->mCallNo);
+                    _glBindBuffer(GL_COPY_READ_BUFFER, oldCopybufferId);
+                    return ret;
+                }
+                const bool analyzed = analyzeIndexBuffer(ptr, ret.value_type, ret.vertices, primitive_restart, stats);
+                _glUnmapBuffer(GL_COPY_READ_BUFFER);
+                _glBindBuffer(GL_COPY_READ_BUFFER, oldCopybufferId);
+                if (!analyzed)
+                {
+                    return ret;
+                }
+                if (mIndexBufferStats.size() >= index_stats_cache_entries)
+                {
+                    mIndexBufferStats.clear();
+                }
+                mIndexBufferStats[key] = stats;
             }
         }
-        switch (ret.value_type)
-        {
-        case GL_UNSIGNED_BYTE:
-            analyzeIndexBuffer<GLubyte>(ptr, reinterpret_cast<intptr_t>(indices), ret);
-            break;
-        case GL_UNSIGNED_SHORT:
-            analyzeIndexBuffer<GLushort>(ptr, reinterpret_cast<intptr_t>(indices), ret);
-            break;
-        case GL_UNSIGNED_INT:
-            analyzeIndexBuffer<GLuint>(ptr, reinterpret_cast<intptr_t>(indices), ret);
-            break;
-        default:
-            DBG_LOG("Unknown index value type: %04x\n", (unsigned)ret.value_type);
-            break;
-        }
-        if (bufferId != 0)
-        {
-            _glUnmapBuffer(GL_COPY_READ_BUFFER);
-            _glBindBuffer(GL_COPY_READ_BUFFER, oldCopybufferId);
-        }
+        ret.primitives += stats.restarts;
+        ret.unique_vertices = stats.unique_vertices;
+        ret.max_sparseness = stats.max_sparseness;
+        ret.avg_sparseness = stats.avg_sparseness;
+        ret.max_value = stats.max_value;
+        ret.min_value = stats.min_value;
+        ret.vec4_locality = stats.vec4_locality;
+        ret.temporal_locality = stats.temporal_locality;
+        ret.spatial_locality = stats.spatial_locality;
+        ret.fifo_hit_rate = stats.fifo_hit_rate;
+        ret.lru_hit_rate = stats.lru_hit_rate;
     }
 
     if (ret.instances > 0)
@@ -289,24 +322,124 @@ void ParseInterfaceRetracing::close()
     GLWS::instance().Cleanup();
 }
 
-common::CallTM* ParseInterfaceRetracing::next_call()
+ParseInterfaceRetracing::DecodedBatch* ParseInterfaceRetracing::Decoder::pop()
+{
+    DecodedBatch* batch = NULL;
+    while (!(batch = mBatches.pop())) {} // woken up without a batch
+    mLastPopped = batch->last;
+    return batch;
+}
+
+ParseInterfaceRetracing::Decoder::~Decoder()
 {
+    mStop = true;
+    // Unblock the thread if it waits for room in the queue, until it has pushed its last batch
+    while (!mLastPopped)
+    {
+        delete pop();
+    }
+    mThread.join();
+}
+
+void ParseInterfaceRetracing::Decoder::run()
+{
+    bool last = false;
+    while (!last)
+    {
+        DecodedBatch* batch = new DecodedBatch;
+        batch->calls.reserve(BATCH_CALLS);
+        size_t bytes = 0;
+        while (batch->calls.size() < BATCH_CALLS && bytes < BATCH_BYTES)
+        {
+            if (mStop || !decode(*batch, bytes))
+            {
+                last = true;
+                break;
+            }
+        }
+        batch->last = last;
+        while (!mBatches.push(batch)) {}
+    }
+}
+
+bool ParseInterfaceRetracing::Decoder::decode(DecodedBatch& batch, size_t& bytes)
+{
+    common::InFile& file = gRetracer.mFile;
+    common::BCall_vlen header;
     void *fptr = NULL;
     char *src = NULL;
-    // Find first call on active thread
+    // Find next call on active thread
     do
     {
-        if (!gRetracer.mFile.GetNextCall(fptr, gRetracer.mCurCall, src) || gRetracer.mFinish)
+        if (!file.GetNextCall(fptr, header, src))
         {
-            GLWS::instance().Cleanup();
-            gRetracer.CloseTraceFile();
-            return NULL;
+            return false;
         }
-        gRetracer.IncCurCallId();
-    } while (gRetracer.getCurTid() != gRetracer.mOptions.mRetraceTid);
+        mCallNo++;
+    } while ((int)header.tid != mTid);
+
+    batch.calls.emplace_back();
+    DecodedCall& decoded = batch.calls.back();
+    decoded.header = header;
+    decoded.fptr = fptr;
+    // The parameter block is only valid until the next read, keep a copy for retracing
+    const int fixedLen = file.ExIdToLen(header.funcId);
+    const size_t len = fixedLen ? fixedLen - sizeof(common::BCall) : header.toNext - sizeof(common::BCall_vlen);
+    decoded.params.assign(src, src + len);
+    decoded.call = new common::CallTM(file, mCallNo, header);
+    bytes += len;
+    return true;
+}
+
+common::CallTM* ParseInterfaceRetracing::endOfCalls()
+{
+    delete mDecoder;
+    mDecoder = NULL;
+    delete mBatch;
+    mBatch = NULL;
+    mEndOfCalls = true;
+    GLWS::instance().Cleanup();
+    gRetracer.CloseTraceFile();
+    return NULL;
+}
+
+common::CallTM* ParseInterfaceRetracing::next_call()
+{
+    if (mEndOfCalls)
+    {
+        return NULL;
+    }
+    if (!mDecoder)
+    {
+        mDecoder = new Decoder(gRetracer.GetCurCallId(), gRetracer.mOptions.mRetraceTid);
+    }
+    // Take the next decoded call on active thread
+    while (!mBatch || mBatchPos == mBatch->calls.size())
+    {
+        if (mBatch && mBatch->last)
+        {
+            return endOfCalls();
+        }
+        delete mBatch;
+        mBatch = mDecoder->pop();
+        mBatchPos = 0;
+    }
+    if (gRetracer.mFinish)
+    {
+        return endOfCalls();
+    }
+    DecodedCall& decoded = mBatch->calls[mBatchPos++];
+    while (gRetracer.GetCurCallId() < decoded.call->mCallNo)
+    {
+        gRetracer.IncCurCallId(); // including the calls of other threads
+    }
+    gRetracer.mCurCall = decoded.header;
+    void *fptr = decoded.fptr;
+    char *src = decoded.params.data();
     // Interpret function
     delete mCall;
-    mCall = new common::CallTM(gRetracer.mFile, gRetracer.GetCurCallId(), gRetracer.mCurCall);
+    mCall = decoded.call;
+    decoded.call = NULL;
     interpret_call(mCall);
     if (mDumpFramebuffers && (mCall->mCallName == "glBindFramebuffer" || mCall->mCallName == "glBindFramebufferOES"
                               || mCall->mCallName.compare(0, 14, "eglSwapBuffers") == 0))
@@ -4,12 +4,21 @@
 #include "retracer/retracer.hpp"
 #include "retracer/retrace_api.hpp"
 #include "tool/parse_interface.h"
+#include "tool/index_buffer_stats.hpp"
+#include "common/os_thread.hpp"
+
+#include <atomic>
+#include <map>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 class ParseInterfaceRetracing : public ParseInterfaceBase
 {
 public:
-    ParseInterfaceRetracing() : ParseInterfaceBase(), mCall(NULL) {}
-    ~ParseInterfaceRetracing() { delete mCall; }
+    ParseInterfaceRetracing();
+    ~ParseInterfaceRetracing();
 
     virtual DrawParams getDrawCallCount(common::CallTM *call) override;
     virtual bool open(const std::string& input, const std::string& output = std::string()) override;
@@ -18,7 +27,89 @@ public:
 
     int64_t getCpuCycles() { return mCpuCycles; }
 
+    // Take over the last call returned by next_call(), so that it is not
+    // deleted by the following next_call(). The caller must delete it.
+    common::CallTM* releaseCall() { common::CallTM* call = mCall; mCall = NULL; return call; }
+
 private:
+    // A call of the retraced thread, read from the trace and parsed ahead of retracing
+    struct DecodedCall
+    {
+        common::BCall_vlen header;
+        void* fptr = NULL;
+        std::vector<char> params; // copy of the parameter block, for the retrace function
+        common::CallTM* call = NULL;
+    };
+
+    struct DecodedBatch
+    {
+        ~DecodedBatch() { for (DecodedCall& decoded : calls) delete decoded.call; }
+
+        std::vector<DecodedCall> calls;
+        bool last = false; // end of the trace, or decoding was stopped
+    };
+
+    // Reads and parses the calls of the retraced thread in batches, so that
+    // decoding runs in parallel with retracing and analysis on the GL thread.
+    class Decoder
+    {
+    public:
+        enum
+        {
+            BATCH_CALLS = 256,
+            BATCH_BYTES = 4 * 1024 * 1024,
+            MAX_BATCHES = 8,
+        };
+
+        Decoder(unsigned callNo, int tid) : mBatches(MAX_BATCHES), mStop(false), mLastPopped(false), mCallNo(callNo), mTid(tid)
+        {
+            mThread = std::thread(&Decoder::run, this);
+        }
+        // Stops decoding and waits for the thread
+        ~Decoder();
+
+        DecodedBatch* pop();
+
+    private:
+        void run();
+        bool decode(DecodedBatch& batch, size_t& bytes);
+
+        std::thread mThread;
+        os::MTQueue<DecodedBatch*> mBatches;
+        std::atomic<bool> mStop;
+        bool mLastPopped;
+        unsigned mCallNo; // number of the last call read, calls of all threads are counted
+        int mTid;
+    };
+
+    common::CallTM* endOfCalls();
+    struct IndexBufferKey
+    {
+        int context;
+        GLuint buffer;
+        unsigned generation;
+        unsigned epoch;
+        intptr_t offset;
+        int count;
+        GLenum type;
+        bool primitive_restart;
+
+        bool operator<(const IndexBufferKey& other) const
+        {
+            return std::tie(context, buffer, generation, epoch, offset, count, type, primitive_restart)
+                   < std::tie(other.context, other.buffer, other.generation, other.epoch, other.offset, other.count, other.type, other.primitive_restart);
+        }
+    };
+
+    void bufferWritten(GLenum target);
+
     int64_t mCpuCycles = 0;
     common::CallTM* mCall;
+    Decoder* mDecoder = NULL;
+    DecodedBatch* mBatch = NULL; // calls being retraced
+    size_t mBatchPos = 0;
+    bool mEndOfCalls = false;
+    std::map<IndexBufferKey, IndexBufferStats> mIndexBufferStats; // analyzed index buffers
+    std::unordered_map<GLuint, unsigned> mBufferGenerations; // by buffer id, changes whenever the buffer may have been written
+    unsigned mBufferEpoch = 0; // changes whenever any buffer may have been written
 };
@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <thread>
+#include <vector>
 #include <sys/stat.h>
 #include "commonData.hpp"
 
@@ -83,6 +87,37 @@ void writeout(common::OutFile &outputFile, common::CallTM *call)
     outputFile.Write(buffer, dest-buffer);
 }
 
+void writeoutRaw(common::OutFile &outputFile, common::InFile &inputFile, const common::BCall_vlen &call, char *src, unsigned short targetId)
+{
+    const int fixedLen = inputFile.ExIdToLen(call.funcId);
+    char *data = fixedLen == 0 ? src - sizeof(common::BCall_vlen) : src - sizeof(common::BCall);
+    const unsigned int len = fixedLen == 0 ? call.toNext : fixedLen;
+
+    // The header has already been read into call, so the copy in the read buffer can be patched in place
+    reinterpret_cast<common::BCall *>(data)->funcId = targetId;
+    outputFile.WriteRaw(data, len);
+}
+
+void runParallel(size_t count, unsigned int threads, const std::function<void(size_t)> &work)
+{
+    if (threads <= 1 || count <= 1) {
+        for (size_t i = 0; i < count; ++i)
+            work(i);
+        return;
+    }
+
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < std::min<size_t>(threads, count); ++t) {
+        workers.emplace_back([&]() {
+            for (size_t i = next++; i < count; i = next++)
+                work(i);
+        });
+    }
+    for (std::thread &worker : workers)
+        worker.join();
+}
+
 void GlesFilePath::setId()
 {
     int last_slash_idx = rfind('/');
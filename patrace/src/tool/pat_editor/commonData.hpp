@@ -1,8 +1,10 @@
 #ifndef COMMON_DATA
 #define COMMON_DATA
 
+#include <functional>
 #include <string>
 #include "base/base.hpp"
+#include "common/in_file.hpp"
 #include "common/out_file.hpp"
 #include "common/trace_model.hpp"
 
@@ -13,6 +15,10 @@ bool isDir(const std::string &path);
 std::string filenameExtension(const std::string &name);
 void makeProgress(int counter, int total, bool forcePrint = false);
 void writeout(common::OutFile &file, common::CallTM *call);
+// Write a call just read from infile without decoding it, under the function id targetId of the output file
+void writeoutRaw(common::OutFile &file, common::InFile &infile, const common::BCall_vlen &call, char *src, unsigned short targetId);
+// Run work(0) ... work(count - 1) on up to threads threads
+void runParallel(size_t count, unsigned int threads, const std::function<void(size_t)> &work);
 
 class GlesFilePath : public std::string
 {
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <fstream>
@@ -7,6 +8,8 @@
 #include <limits>
 #include <sys/stat.h>
 #include "commonData.hpp"
+#include "common/api_info.hpp"
+#include "common/parse_api.hpp"
 #include "eglstate/common.hpp"
 #include "base/base.hpp"
 
@@ -85,25 +88,17 @@ int makeExtractDir(const string &target_name)
 int callNo_width;
 string target_name;
 
-int current_resource_id;
 map<unsigned int, unsigned int> target_id_map;
 
-long callId;
-int file_counter;
-
-bool open_frame_file(ofstream &fout, bool no_frame_file_opened, int width)
+// The calls of one frame_xxxx.json file, converted by a worker thread
+struct FrameJob
 {
-    if (no_frame_file_opened) {
-        fout.open(target_name + "/GLES_calls/frame_" + intToString(file_counter, width) + ".json");
-        if (!fout.is_open()) {
-            PAT_DEBUG_LOG("Failed to open file %s when extracting\n", (target_name + "/GLES_calls/frame_" + intToString(file_counter, width) + ".json").c_str());
-            return false;
-        }
-    }
-    return true;
-}
+    int file_index;
+    vector<common::CallTM *> calls;
+    vector<int> resource_ids;   // names the texture, blob and shader files of each call
+};
 
-void setJsonValue(Json::Value &json_value, const string &s, const common::ValueTM &value, const common::CallTM *call, bool append)
+void setJsonValue(Json::Value &json_value, const string &s, const common::ValueTM &value, const common::CallTM *call, bool append, int resource_id)
 {
     switch(value.mType) {
         case common::Void_Type:
@@ -226,7 +221,7 @@ void setJsonValue(Json::Value &json_value, const string &s, const common::ValueT
                 if (call->Name() == "glShaderSource" && value.mName == "string")
                 {
                     for (unsigned int i = 0; i < value.mArrayLen; ++i) {
-                        string temp = "/shader/call" + intToString(call->mCallNo, callNo_width) + "_shader" + to_string(current_resource_id) + "." + to_string(i) + ".txt";
+                        string temp = "/shader/call" + intToString(call->mCallNo, callNo_width) + "_shader" + to_string(resource_id) + "." + to_string(i) + ".txt";
                         string shader_file = target_name + temp;
                         string relative_path = ".." + temp;
                         ofstream fout(shader_file);
@@ -242,7 +237,7 @@ void setJsonValue(Json::Value &json_value, const string &s, const common::ValueT
                 else
                 {
                     for (unsigned int i = 0; i < value.mArrayLen; ++i)
-                        setJsonValue(array_value, value_type[value.mEleType], value.mArray[i], call, true);
+                        setJsonValue(array_value, value_type[value.mEleType], value.mArray[i], call, true, resource_id);
                 }
             }
             if (append) json_value[s].append(array_value);
@@ -259,12 +254,12 @@ void setJsonValue(Json::Value &json_value, const string &s, const common::ValueT
             if (call->Name().compare(0, 10, "glTexImage") == 0 ||
                 call->Name().compare(0, 13, "glTexSubImage") == 0 ||
                 call->Name().compare(0, 15, "glCompressedTex") == 0) {
-                string temp = "/texture/call" + intToString(call->mCallNo, callNo_width) + "_tex" + to_string(current_resource_id) + ".bin";
+                string temp = "/texture/call" + intToString(call->mCallNo, callNo_width) + "_tex" + to_string(resource_id) + ".bin";
                 blob_file = target_name + temp;
                 relative_path = ".." + temp;
             }
             else {
-                string temp = "/blob/call" + intToString(call->mCallNo, callNo_width) + "_blob" + to_string(current_resource_id) + ".bin";
+                string temp = "/blob/call" + intToString(call->mCallNo, callNo_width) + "_blob" + to_string(resource_id) + ".bin";
                 blob_file = target_name + temp;
                 relative_path = ".." + temp;
             }
@@ -288,7 +283,7 @@ void setJsonValue(Json::Value &json_value, const string &s, const common::ValueT
                     opaque_value[opaque_value_type[value.mOpaqueType]] = value.mOpaqueIns->GetAsUInt();
                 }
                 else if (value.mOpaqueType == common::BlobType) {
-                    setJsonValue(opaque_value, opaque_value_type[value.mOpaqueType], *value.mOpaqueIns, call, false);
+                    setJsonValue(opaque_value, opaque_value_type[value.mOpaqueType], *value.mOpaqueIns, call, false, resource_id);
                 }
                 else {      // ClientSideBufferObjectReferenceType
                     opaque_value[opaque_value_type[value.mOpaqueType]].append(value.mOpaqueIns->mClientSideBufferName);
@@ -302,7 +297,7 @@ void setJsonValue(Json::Value &json_value, const string &s, const common::ValueT
         case common::Pointer_Type: {
             Json::Value pointer_value = Json::nullValue;
             if (value.mPointer) {
-                setJsonValue(pointer_value, value_type[value.mPointer->mType], *value.mPointer, call, false);
+                setJsonValue(pointer_value, value_type[value.mPointer->mType], *value.mPointer, call, false, resource_id);
             }
             if (append) json_value[s].append(pointer_value);
             else        json_value[s] = pointer_value;
@@ -323,10 +318,148 @@ void setJsonValue(Json::Value &json_value, const string &s, const common::ValueT
     }
 }
 
-int pat_extract(const string &source_name, const string &target_name_, int begin_call, int end_call)
+// Called for every extracted call in order, as the resource a call refers to may have been bound by an earlier one
+int trackResourceId(const common::CallTM *call)
+{
+    static int current_resource_id = 0;
+
+    if (call->mCallName.substr(0, 12) == "glBindBuffer" ||
+        call->mCallName.substr(0, 13) == "glBindTexture") {
+        unsigned int target = call->mArgs[0]->GetAsUInt();
+        unsigned int id = call->mArgs[1]->GetAsUInt();
+        target_id_map[target] = id;
+    }
+    else if (call->mCallName.substr(0, 12) == "glBufferData" ||
+             call->mCallName.substr(0, 15) == "glBufferSubData" ||
+             call->mCallName.substr(0, 12) == "glTexImage1D" ||
+             call->mCallName.substr(0, 12) == "glTexImage2D" ||
+             call->mCallName.substr(0, 12) == "glTexImage3D" ||
+             call->mCallName.substr(0, 15) == "glTexSubImage1D" ||
+             call->mCallName.substr(0, 15) == "glTexSubImage2D" ||
+             call->mCallName.substr(0, 15) == "glTexSubImage3D" ||
+             call->mCallName.substr(0, 22) == "glCompressedTexImage1D" ||
+             call->mCallName.substr(0, 22) == "glCompressedTexImage2D" ||
+             call->mCallName.substr(0, 22) == "glCompressedTexImage3D" ||
+             call->mCallName.substr(0, 25) == "glCompressedTexSubImage1D" ||
+             call->mCallName.substr(0, 25) == "glCompressedTexSubImage2D" ||
+             call->mCallName.substr(0, 25) == "glCompressedTexSubImage3D" ||
+             call->mCallName.substr(0, 29) == "glCompressedTextureSubImage1D" ||
+             call->mCallName.substr(0, 29) == "glCompressedTextureSubImage2D" ||
+             call->mCallName.substr(0, 29) == "glCompressedTextureSubImage3D" ||
+             call->mCallName.substr(0, 23) == "glPatchClientSideBuffer")
+    {
+        unsigned int target = call->mArgs[0]->GetAsUInt();
+        if (target == GL_TEXTURE_CUBE_MAP_POSITIVE_X ||
+            target == GL_TEXTURE_CUBE_MAP_POSITIVE_Y ||
+            target == GL_TEXTURE_CUBE_MAP_POSITIVE_Z ||
+            target == GL_TEXTURE_CUBE_MAP_NEGATIVE_X ||
+            target == GL_TEXTURE_CUBE_MAP_NEGATIVE_Y ||
+            target == GL_TEXTURE_CUBE_MAP_NEGATIVE_Z
+            )
+        {
+            target = GL_TEXTURE_CUBE_MAP;
+        }
+        auto it = target_id_map.find(target);
+        current_resource_id = (it != target_id_map.end() ? it->second : 0);
+    }
+    else if (call->mCallName.substr(0, 14) == "glShaderSource" ||
+             call->mCallName.substr(0, 17) == "glNamedBufferData" ||
+             call->mCallName.substr(0, 20) == "glNamedBufferSubData")
+    {
+        current_resource_id = call->mArgs[0]->GetAsUInt();
+    }
+    else if (call->mCallName == "glClientSideBufferData" ||
+             call->mCallName == "glClientSideBufferSubData")
+    {
+        current_resource_id = call->mArgs[0]->GetAsUInt();
+    }
+    return current_resource_id;
+}
+
+string callToJson(const common::CallTM *call, int resource_id)
+{
+    Json::Value function_value;
+    int index = 0;
+    function_value[genIdName(index++, "call_no")] = call->mCallNo;
+    function_value[genIdName(index++, "tid")] = call->mTid;
+    function_value[genIdName(index++, "func_name")] = call->mCallName;
+    function_value[genIdName(index++, "return_type")] = value_type[call->mRet.mType];
+    setJsonValue(function_value, genIdName(index++, "return_value"), call->mRet, call, false, resource_id);
+    unsigned int arg_id_width = 1;
+    if (call->mArgs.size() >= 10)   // It's impossible that the number of arguments of a GLES call exceeds 99
+        arg_id_width = 2;
+
+    for (unsigned int i = 0; i < call->mArgs.size(); ++i)
+    {
+        int index1 = index;
+        function_value[genIdName(index1++, "arg_type")].append(value_type[call->mArgs[i]->mType]);
+        Json::Value arg_value;
+        setJsonValue(arg_value, genIdName(i, call->mArgs[i]->mName, arg_id_width), *call->mArgs[i], call, false, resource_id);
+        Json::ValueIterator vi = arg_value.begin();
+        function_value[genIdName(index1++, "arg_value")][vi.key().asString()] = *vi;
+    }
+    if (call->mArgs.size() == 0)
+    {
+        int index1 = index;
+        function_value[genIdName(index1++, "arg_type")] = Json::arrayValue;   // This is an empty Json array
+        function_value[genIdName(index1++, "arg_value")] = Json::nullValue;   // This is an null Json value
+    }
+    Json::StyledWriter writer;
+    string strWrite = writer.write(function_value);
+    if (strWrite[strWrite.length() - 1] == '\n')
+        strWrite.pop_back();
+    return strWrite;
+}
+
+bool writeFrameFile(const FrameJob &job, int width)
+{
+    const string frame_file = target_name + "/GLES_calls/frame_" + intToString(job.file_index, width) + ".json";
+    ofstream fout(frame_file);
+    if (!fout.is_open()) {
+        PAT_DEBUG_LOG("Failed to open file %s when extracting\n", frame_file.c_str());
+        return false;
+    }
+    for (size_t i = 0; i < job.calls.size(); ++i) {
+        fout << (i == 0 ? "[\n" : ",\n") << callToJson(job.calls[i], job.resource_ids[i]);
+    }
+    fout << "\n]";
+    return true;
+}
+
+// Converts the frames of the batch on the worker threads, then frees their calls
+bool flushFrameJobs(vector<FrameJob> &batch, int width, unsigned int threads)
+{
+    vector<char> ok(batch.size(), 1);
+    runParallel(batch.size(), threads, [&](size_t i) {
+        ok[i] = writeFrameFile(batch[i], width);
+    });
+    for (FrameJob &job : batch) {
+        for (common::CallTM *call : job.calls)
+            delete call;
+    }
+    batch.clear();
+    return find(ok.begin(), ok.end(), 0) == ok.end();
+}
+
+bool openPassThroughFile(common::OutFile &file, const string &name, const vector<string> &sigbook, const string &json_header)
+{
+    // The calls are copied without decoding, so they keep the ids of the source sigbook
+    if (!file.Open(name.c_str(), true, &sigbook))
+    {
+        PAT_DEBUG_LOG("Failed to open file %s for writing extracting result!\n", name.c_str());
+        return false;
+    }
+    file.mHeader.jsonLength = json_header.size();
+    file.WriteHeader(json_header.c_str(), json_header.size());
+    return true;
+}
+
+int pat_extract(const string &source_name, const string &target_name_, int begin_call, int end_call, unsigned int threads)
 {
-    // Load input trace
-    common::TraceFileTM source_file;
+    // Open input trace. It is read once, and only the calls in the range are decoded.
+    common::gApiInfo.RegisterEntries(common::parse_callbacks);
+    common::InFile source_file;
+    source_file.prepareChunks();
     if (!source_file.Open(source_name.c_str()))
     {
         PAT_DEBUG_LOG("Failed to open pat file %s for extracting.\n", source_name.c_str());
@@ -336,15 +469,11 @@ int pat_extract(const string &source_name, const string &target_name_, int begin
     target_name = target_name_;
 
     cout << "Extract: " << source_name << " -> " << target_name << "\n" << endl;
-    Json::Value header = source_file.mpInFileRA->getJSONHeader();
+    Json::Value header = source_file.getJSONHeader();
     unsigned defaultTid = header["defaultTid"].asInt();
-    int callNo = 0, frameNo = 0;
-    common::CallTM *call = NULL;
-    for (callNo = 0; (call = source_file.NextCall()); ++callNo) {
-        if (call->mTid == defaultTid && call->mCallName.substr(0, 14) == "eglSwapBuffers") {
-            ++frameNo;
-        }
-    }
+    // The counts of the header only name the files and drive the progress bar
+    const int callNo = header["callCnt"].asInt();
+    const int frameNo = header["frameCnt"].asInt();
     cout << "callNo = " << callNo << ", frameNo = " << frameNo << endl;
     int temp_callNo = callNo;
     callNo_width = 0;
@@ -378,160 +507,73 @@ int pat_extract(const string &source_name, const string &target_name_, int begin
         strWrite.pop_back();
     fout << strWrite;
     fout.close();
-    fout.clear();
 
-    makeProgress(0, callNo, true);
-    bool finished = false, file_beginning = true, no_frame_file_opened = true;
+    vector<string> sigbook(source_file.GetMaxSigId() + 1);
+    for (unsigned int id = 1; id < sigbook.size(); ++id)
+        sigbook[id] = source_file.ExIdToName(id);
+
     common::OutFile outputFileBefore, outputFileAfter;
-    if (!outputFileBefore.Open((target_name + "/not_interested_in/before.pat").c_str()))
-    {
-        PAT_DEBUG_LOG("Failed to open file %s for writing extracting result!\n", (target_name + "/not_interested_in/before.pat").c_str());
-        return 1;
-    }
-    if (!outputFileAfter.Open((target_name + "/not_interested_in/after.pat").c_str()))
+    if (!openPassThroughFile(outputFileBefore, target_name + "/not_interested_in/before.pat", sigbook, strWrite) ||
+        !openPassThroughFile(outputFileAfter, target_name + "/not_interested_in/after.pat", sigbook, strWrite))
     {
-        PAT_DEBUG_LOG("Failed to open file %s for writing extracting result!\n", (target_name + "/not_interested_in/after.pat").c_str());
         return 1;
     }
-    outputFileBefore.mHeader.jsonLength = strWrite.size();
-    outputFileBefore.WriteHeader(strWrite.c_str(), strWrite.size());
-    outputFileAfter.mHeader.jsonLength = strWrite.size();
-    outputFileAfter.WriteHeader(strWrite.c_str(), strWrite.size());
-    file_counter = 0;
-    for (callId = 0; (call = source_file.NextCall()); ++callId)
+
+    if (callNo > 0)
+        makeProgress(0, callNo, true);
+    const unsigned short swapId = source_file.NameToExId("eglSwapBuffers");
+    const unsigned short swapWithDamageId = source_file.NameToExId("eglSwapBuffersWithDamageKHR");
+    int file_counter = 0;
+    vector<FrameJob> batch;
+    bool frame_file_open = false;
+
+    void *fptr = NULL;
+    char *src = NULL;
+    common::BCall_vlen call;
+    for (long callId = 0; source_file.GetNextCall(fptr, call, src); ++callId)
     {
-        if (callId < begin_call)           // the call before user interested in
-        {
-            writeout(outputFileBefore, call);
-            if (call->mTid == defaultTid && call->mCallName.substr(0, 14) == "eglSwapBuffers") {
-                file_counter++;
-            }
-        }
-        else if (callId > end_call)        // the call after user interested in
+        const bool frame_end = call.tid == defaultTid && (call.funcId == swapId || call.funcId == swapWithDamageId);
+        if (callId < begin_call || callId > end_call)   // the calls before and after the ones user interested in
         {
-            writeout(outputFileAfter, call);
-            if (call->mTid == defaultTid && call->mCallName.substr(0, 14) == "eglSwapBuffers") {
-                file_counter++;
-            }
+            common::OutFile &outputFile = callId < begin_call ? outputFileBefore : outputFileAfter;
+            writeoutRaw(outputFile, source_file, call, src, call.funcId);
         }
         else
         {
-            if (open_frame_file(fout, no_frame_file_opened, frameNo_width))
-                no_frame_file_opened = false;
-            else
-                return 1;
-            Json::Value function_value;
-            int index = 0;
-            function_value[genIdName(index++, "call_no")] = call->mCallNo;
-            function_value[genIdName(index++, "tid")] = call->mTid;
-            function_value[genIdName(index++, "func_name")] = call->mCallName;
-            function_value[genIdName(index++, "return_type")] = value_type[call->mRet.mType];
-            setJsonValue(function_value, genIdName(index++, "return_value"), call->mRet, call, false);
-            Json::Value arg_value;
-            unsigned int arg_id_width = 1;
-            if (call->mArgs.size() >= 10)   // It's impossible that the number of arguments of a GLES call exceeds 99
-                arg_id_width = 2;
+            if (!frame_file_open) {
+                batch.emplace_back();
+                batch.back().file_index = file_counter;
+                frame_file_open = true;
+            }
+            common::CallTM *callTM = NULL;
+            if (fptr) {
+                callTM = new common::CallTM(source_file, callId, call);
+            }
+            else {                          // a function this build cannot parse, keep its name only
+                callTM = new common::CallTM(source_file.ExIdToName(call.funcId));
+                callTM->mCallNo = callId;
+                callTM->mTid = call.tid;
+            }
+            batch.back().calls.push_back(callTM);
+            batch.back().resource_ids.push_back(trackResourceId(callTM));
+            if (frame_end)
+                frame_file_open = false;
 
-            if (call->mCallName.substr(0, 12) == "glBindBuffer" ||
-                call->mCallName.substr(0, 13) == "glBindTexture") {
-                unsigned int target = call->mArgs[0]->GetAsUInt();
-                unsigned int id = call->mArgs[1]->GetAsUInt();
-                target_id_map[target] = id;
+            // Keep the workers busy with whole frames, and do not hold on to the last one until the end of the trace
+            if ((!frame_file_open && batch.size() >= threads) || callId == end_call) {
+                if (!flushFrameJobs(batch, frameNo_width, threads))
+                    return 1;
+                frame_file_open = false;
             }
-            else if (call->mCallName.substr(0, 12) == "glBufferData" ||
-                     call->mCallName.substr(0, 15) == "glBufferSubData" ||
-                     call->mCallName.substr(0, 12) == "glTexImage1D" ||
-                     call->mCallName.substr(0, 12) == "glTexImage2D" ||
-                     call->mCallName.substr(0, 12) == "glTexImage3D" ||
-                     call->mCallName.substr(0, 15) == "glTexSubImage1D" ||
-                     call->mCallName.substr(0, 15) == "glTexSubImage2D" ||
-                     call->mCallName.substr(0, 15) == "glTexSubImage3D" ||
-                     call->mCallName.substr(0, 22) == "glCompressedTexImage1D" ||
-                     call->mCallName.substr(0, 22) == "glCompressedTexImage2D" ||
-                     call->mCallName.substr(0, 22) == "glCompressedTexImage3D" ||
-                     call->mCallName.substr(0, 25) == "glCompressedTexSubImage1D" ||
-                     call->mCallName.substr(0, 25) == "glCompressedTexSubImage2D" ||
-                     call->mCallName.substr(0, 25) == "glCompressedTexSubImage3D" ||
-                     call->mCallName.substr(0, 29) == "glCompressedTextureSubImage1D" ||
-                     call->mCallName.substr(0, 29) == "glCompressedTextureSubImage2D" ||
-                     call->mCallName.substr(0, 29) == "glCompressedTextureSubImage3D" ||
-                     call->mCallName.substr(0, 23) == "glPatchClientSideBuffer")
-            {
-                unsigned int target = call->mArgs[0]->GetAsUInt();
-                if (target == GL_TEXTURE_CUBE_MAP_POSITIVE_X ||
-                    target == GL_TEXTURE_CUBE_MAP_POSITIVE_Y ||
-                    target == GL_TEXTURE_CUBE_MAP_POSITIVE_Z ||
-                    target == GL_TEXTURE_CUBE_MAP_NEGATIVE_X ||
-                    target == GL_TEXTURE_CUBE_MAP_NEGATIVE_Y ||
-                    target == GL_TEXTURE_CUBE_MAP_NEGATIVE_Z
-                    )
-                {
-                    target = GL_TEXTURE_CUBE_MAP;
-                }
-                auto it = target_id_map.find(target);
-                current_resource_id = (it != target_id_map.end() ? it->second : 0);
-            }
-            else if (call->mCallName.substr(0, 14) == "glShaderSource" ||
-                     call->mCallName.substr(0, 17) == "glNamedBufferData" ||
-                     call->mCallName.substr(0, 20) == "glNamedBufferSubData")
-            {
-                current_resource_id = call->mArgs[0]->GetAsUInt();
-            }
-            else if (call->mCallName == "glClientSideBufferData" ||
-                     call->mCallName == "glClientSideBufferSubData")
-            {
-                current_resource_id = call->mArgs[0]->GetAsUInt();
-            }
-
-            for (unsigned int i = 0; i < call->mArgs.size(); ++i)
-            {
-                int index1 = index;
-                function_value[genIdName(index1++, "arg_type")].append(value_type[call->mArgs[i]->mType]);
-                Json::Value arg_value;
-                setJsonValue(arg_value, genIdName(i, call->mArgs[i]->mName, arg_id_width), *call->mArgs[i], call, false);
-                Json::ValueIterator vi = arg_value.begin();
-                function_value[genIdName(index1++, "arg_value")][vi.key().asString()] = *vi;
-            }
-            if (call->mArgs.size() == 0)
-            {
-                int index1 = index;
-                function_value[genIdName(index1++, "arg_type")] = Json::arrayValue;   // This is an empty Json array
-                function_value[genIdName(index1++, "arg_value")] = Json::nullValue;   // This is an null Json value
-            }
-            Json::StyledWriter writer;
-            string strWrite = writer.write(function_value);
-            if (strWrite[strWrite.length() - 1] == '\n')
-                strWrite.pop_back();
-            if (!file_beginning) {
-                fout << ",\n";
-            }
-            else {
-                fout << "[\n";
-                file_beginning = false;
-            }
-            fout << strWrite;
-            if (call->mTid == defaultTid && call->mCallName.substr(0, 14) == "eglSwapBuffers") {
-                file_counter++;
-                fout << "\n]";
-                fout.close();
-                fout.clear();
-                no_frame_file_opened = true;
-                if (callId != callNo - 1) {
-                    file_beginning = true;
-                }
-                else {
-                    finished = true;
-                }
-            }
-            function_value.clear();
         }
-        makeProgress(callId + 1, callNo);
-    }
-    if (!finished) {
-        fout << "\n]";
-        fout.close();
-        fout.clear();
+        if (frame_end)
+            file_counter++;
+        if (callNo > 0)
+            makeProgress(min<long>(callId + 1, callNo), callNo);
     }
+    if (!flushFrameJobs(batch, frameNo_width, threads))
+        return 1;
+
     cout << "\n\n";
     source_file.Close();
     outputFileBefore.Close();
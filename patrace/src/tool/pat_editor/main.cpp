@@ -1,7 +1,9 @@
+#include <algorithm>
 #include <string>
 #include <sys/stat.h>
 #include <iostream>
 #include <limits>
+#include <thread>
 #include "tool/config.hpp"
 #include "common/os_time.hpp"
 #include "eglstate/common.hpp"
@@ -29,11 +31,13 @@ static void printHelp(const char *argv0)
          << "  -m : Merge OpenGL ES calls, textures, shaders, data, etc. in a SOURCE directory to a TARGET file.\n"
          << "  -v : Print version\n"
          << "  -h : Print help\n"
-         << "  -call BEGIN_CALL END_CALL : Specify the call range user wants to extract.\n";
+         << "  -call BEGIN_CALL END_CALL : Specify the call range user wants to extract.\n"
+         << "  -j THREADS : Number of threads converting frames from and to JSON (default: number of cores).\n"
+         << "The calls outside the call range are copied without being decoded.\n";
 }
 
-int pat_extract(const string &source_name, const string &target_name, int begin_call = 0, int end_call = numeric_limits<int>::max());
-int merge_to_pat(const string &source_name, const string &target_name);
+int pat_extract(const string &source_name, const string &target_name, int begin_call, int end_call, unsigned int threads);
+int merge_to_pat(const string &source_name, const string &target_name, unsigned int threads);
 
 enum Operation {
     UNKNOWN_OPERATION = 0,
@@ -52,6 +56,7 @@ int main(int argc, char **argv)
 
     int argIndex = 1;
     int begin_call = 0, end_call = numeric_limits<int>::max();
+    unsigned int threads = max(1u, thread::hardware_concurrency());
     Operation operation = UNKNOWN_OPERATION;
     for (; argIndex < argc; ++argIndex)
     {
@@ -105,6 +110,19 @@ int main(int argc, char **argv)
                 return 0;
             }
         }
+        else if (!strcmp(arg, "-j"))
+        {
+            if (argIndex + 1 < argc && atoi(argv[argIndex + 1]) > 0)
+            {
+                threads = atoi(argv[++argIndex]);
+            }
+            else
+            {
+                cout << "Error: -j option needs a positive integer parameter" << endl;
+                printHelp(argv[0]);
+                return 0;
+            }
+        }
         else
         {
             cout << "Error: Unknown option " << arg << endl;
@@ -149,7 +167,7 @@ int main(int argc, char **argv)
             cout << source_name << " is not a pat file!" << endl;
             return 1;
         }
-        if (pat_extract(source_name, target_name, begin_call, end_call) != 0)
+        if (pat_extract(source_name, target_name, begin_call, end_call, threads) != 0)
             return 1;
     }
     else {
@@ -157,7 +175,7 @@ int main(int argc, char **argv)
             cout << source_name << " is not a directory!" << endl;
             return 1;
         }
-        if (merge_to_pat(source_name, target_name) != 0)
+        if (merge_to_pat(source_name, target_name, threads) != 0)
             return 1;
     }
     long long end_time = os::getTime();
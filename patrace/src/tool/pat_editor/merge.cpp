@@ -5,6 +5,7 @@
 #include <vector>
 #include <unordered_map>
 #include <algorithm>
+#include "common/api_info.hpp"
 #include "eglstate/common.hpp"
 #include "base/base.hpp"
 #include "commonData.hpp"
@@ -66,9 +67,16 @@ void findAllGlesFiles(const string &path, vector<GlesFilePath> &result)
 
 string source_name;
 
+// Frames are parsed on several threads, so the map must not grow on lookups
+int typeToEnum(const string &type_string)
+{
+    auto it = type_to_enum_map.find(type_string);
+    return it != type_to_enum_map.end() ? it->second : 0;
+}
+
 void setValueTM(common::ValueTM *&pValue, const string &type_string, const Json::Value &json_value, const string & func_name)
 {
-    int type = type_to_enum_map[type_string];
+    int type = typeToEnum(type_string);
     switch (type) {
         case common::Void_Type:
             pValue = new common::ValueTM();
@@ -157,7 +165,7 @@ void setValueTM(common::ValueTM *&pValue, const string &type_string, const Json:
             string array_element_type = only_value.key().asString();
             pValue = new common::ValueTM();
             pValue->mType = common::Array_Type;
-            pValue->mEleType = static_cast<common::Value_Type_TM>(type_to_enum_map[array_element_type]);
+            pValue->mEleType = static_cast<common::Value_Type_TM>(typeToEnum(array_element_type));
             pValue->mArrayLen = (*only_value).size();
             pValue->mArray = new common::ValueTM [(*only_value).size()];
             if (array_element_type == "String" && func_name == "glShaderSource") {  // This is a shader
@@ -256,7 +264,106 @@ void setValueTM(common::ValueTM *&pValue, const string &type_string, const Json:
     }
 }
 
-int merge_to_pat(const string &source_name_, const string &target_name)
+// Parse the calls of a frame_xxxx.json file. Runs on the worker threads.
+void parseFrameFile(const string &gles_file, vector<common::CallTM *> &calls)
+{
+    ifstream fin(gles_file);
+    if (!fin.is_open()) {
+        PAT_DEBUG_LOG("Cannot open file %s when mergin\n", gles_file.c_str());
+        return;
+    }
+    Json::Reader reader;
+    Json::Value json_value;
+    while ((fin.rdstate() & std::ifstream::failbit ) == 0) {
+        string s;
+        char c;
+        bool started = false;
+        int curved_bracket_stack = 0;
+        // Calculate the start and end points of the next Json value.
+        while (fin.get(c)) {
+            if (c == '{') {
+                started = true;
+                ++curved_bracket_stack;
+            }
+            else if (c == '}') {
+                --curved_bracket_stack;
+                if (curved_bracket_stack == 0) {
+                    s.push_back(c);
+                    break;
+                }
+            }
+            if (started == true)
+                s.push_back(c);
+        }
+        if ((fin.rdstate() & std::ifstream::failbit ) != 0)
+            break;
+        // Parse the next Json value
+        if (reader.parse(&s[0], &s[s.length()] , json_value, false)) {
+            int tid = json_value["1 tid"].asInt();
+            string func_name = json_value["2 func_name"].asString();
+            string return_type = json_value["3 return_type"].asString();
+
+            common::CallTM *func = new common::CallTM(func_name.c_str());
+            func->mTid = tid;
+
+            common::ValueTM *ret_value;
+            setValueTM(ret_value, return_type, json_value["4 return_value"], func_name);
+            func->mRet = *ret_value;
+
+            Json::ValueIterator vi = json_value["6 arg_value"].begin();
+            for (unsigned int j = 0; j < json_value["5 arg_type"].size(); ++j)
+            {
+                common::ValueTM *pValueTM;
+                setValueTM(pValueTM, json_value["5 arg_type"][j].asString(), *vi, func_name);
+                func->mArgs.push_back(pValueTM);
+                ++vi;
+            }
+
+            calls.push_back(func);
+            delete ret_value;
+        }
+        else {
+            PAT_DEBUG_LOG("The json file %s cannot be parsed for an unknown reason.\n", gles_file.c_str());
+        }
+    }
+}
+
+// Copy the calls of before.pat or after.pat to the target without decoding them
+bool copyPassThroughFile(const string &name, common::OutFile &target_file)
+{
+    common::InFile file;
+    file.prepareChunks();
+    if (!file.Open(name.c_str()))
+    {
+        PAT_DEBUG_LOG("Failed to open pat file %s for merging.\n", name.c_str());
+        return false;
+    }
+
+    // The target has the sigbook of this build
+    vector<unsigned short> target_ids(file.GetMaxSigId() + 1, 0);
+    for (unsigned int id = 1; id < target_ids.size(); ++id)
+        target_ids[id] = common::gApiInfo.NameToId(file.ExIdToName(id));
+
+    unsigned int call_count = 0;
+    void *fptr = NULL;
+    char *src = NULL;
+    common::BCall_vlen call;
+    while (file.GetNextCall(fptr, call, src))
+    {
+        if (target_ids[call.funcId] == 0)
+        {
+            PAT_DEBUG_LOG("Skipping call %u of %s, %s is unknown.\n", call_count, name.c_str(), file.ExIdToName(call.funcId));
+            continue;
+        }
+        writeoutRaw(target_file, file, call, src, target_ids[call.funcId]);
+        call_count++;
+    }
+    file.Close();
+    cout << "Copied " << call_count << " calls from " << name << endl;
+    return true;
+}
+
+int merge_to_pat(const string &source_name_, const string &target_name, unsigned int threads)
 {
     source_name = source_name_;
     for (unsigned int i = 0; i < sizeof(value_type) / sizeof(string); ++i)
@@ -286,141 +393,43 @@ int merge_to_pat(const string &source_name_, const string &target_name)
     }
     Json::Value json_value;
     reader.parse(fin, json_value, false);
-    unsigned defaultTid = json_value["defaultTid"].asInt();
     Json::FastWriter header_writer;
     const std::string json_header = header_writer.write(json_value);
 
     target_file.mHeader.jsonLength = json_header.size();
     target_file.WriteHeader(json_header.c_str(), json_header.size());
     fin.close();
-    fin.clear();
-
-    // calculate the frame number of before.pat
-    common::TraceFileTM file_before, file_after;
-    if (!file_before.Open((source_name + "/not_interested_in/before.pat").c_str()))
-    {
-        PAT_DEBUG_LOG("Failed to open pat file %s for extracting.\n", (source_name + "/not_interested_in/before.pat").c_str());
-        return 1;
-    }
-    common::CallTM *call = NULL;
-    int frame_num = 0;
-    while ((call = file_before.NextCall()))
-    {
-        if (call->mTid == defaultTid && call->mCallName.substr(0, 14) == "eglSwapBuffers")
-        {
-            frame_num++;
-        }
-    }
 
-    // calculate the frame number of after.pat
-    if (!file_after.Open((source_name + "/not_interested_in/after.pat").c_str()))
-    {
-        PAT_DEBUG_LOG("Failed to open pat file %s for extracting.\n", (source_name + "/not_interested_in/after.pat").c_str());
+    // write all calls in before.pat to the target
+    if (!copyPassThroughFile(source_name + "/not_interested_in/before.pat", target_file))
         return 1;
-    }
-    while ((call = file_after.NextCall()))
-    {
-        if (call->mTid == defaultTid && call->mCallName.substr(0, 14) == "eglSwapBuffers")
-        {
-            frame_num++;
-        }
-    }
-    frame_num += gles_files.size();
 
-    makeProgress(0, frame_num, true);
-
-    // write all calls in before.pat to the target
-    int counter = 0;
-    while ((call = file_before.NextCall()))
+    // write all calls in GLES_calls/frame_xxxx.json to the target, parsing a batch of frames in parallel
+    if (!gles_files.empty())
+        makeProgress(0, gles_files.size(), true);
+    for (size_t first = 0; first < gles_files.size(); first += threads)
     {
-        writeout(target_file, call);
-        if (call->mTid == defaultTid && call->mCallName.substr(0, 14) == "eglSwapBuffers")
+        const size_t count = min<size_t>(threads, gles_files.size() - first);
+        vector<vector<common::CallTM *> > frames(count);
+        runParallel(count, threads, [&](size_t i) {
+            if (gles_files[first + i] != "")
+                parseFrameFile(gles_files[first + i], frames[i]);
+        });
+        for (vector<common::CallTM *> &calls : frames)
         {
-            counter++;
-            makeProgress(counter, frame_num);
-        }
-    }
-    file_before.Close();
-
-    // write all calls in GLES_calls/frame_xxxx.pat to the target
-    for (vector<string>::size_type file_counter = 0; file_counter < gles_files.size(); ++file_counter)
-    {
-        if (gles_files[file_counter] == "")
-            continue;
-        fin.open(gles_files[file_counter]);
-        if (!fin.is_open()) {
-            PAT_DEBUG_LOG("Cannot open file %s when mergin\n", gles_files[file_counter].c_str());
-            break;
-        }
-        while ((fin.rdstate() & std::ifstream::failbit ) == 0) {
-            string s;
-            char c;
-            bool started = false;
-            int curved_bracket_stack = 0;
-            // Calculate the start and end points of the next Json value.
-            while (fin.get(c)) {
-                if (c == '{') {
-                    started = true;
-                    ++curved_bracket_stack;
-                }
-                else if (c == '}') {
-                    --curved_bracket_stack;
-                    if (curved_bracket_stack == 0) {
-                        s.push_back(c);
-                        break;
-                    }
-                }
-                if (started == true)
-                    s.push_back(c);
-            }
-            if ((fin.rdstate() & std::ifstream::failbit ) != 0)
-                break;
-            // Parse the next Json value
-            if (reader.parse(&s[0], &s[s.length()] , json_value, false)) {
-                int tid = json_value["1 tid"].asInt();
-                string func_name = json_value["2 func_name"].asString();
-                string return_type = json_value["3 return_type"].asString();
-
-                common::CallTM func(func_name.c_str());
-                func.mTid = tid;
-
-                common::ValueTM *ret_value;
-                setValueTM(ret_value, return_type, json_value["4 return_value"], func_name);
-                func.mRet = *ret_value;
-
-                Json::ValueIterator vi = json_value["6 arg_value"].begin();
-                for (unsigned int j = 0; j < json_value["5 arg_type"].size(); ++j)
-                {
-                    common::ValueTM *pValueTM;
-                    setValueTM(pValueTM, json_value["5 arg_type"][j].asString(), *vi, func_name);
-                    func.mArgs.push_back(pValueTM);
-                    ++vi;
-                }
-
-                writeout(target_file, &func);
-                delete ret_value;
-            }
-            else {
-                PAT_DEBUG_LOG("The json file %s cannot be parsed for an unknown reason.\n", gles_files[file_counter].c_str());
+            for (common::CallTM *call : calls)
+            {
+                writeout(target_file, call);
+                delete call;
             }
         }
-        fin.close();
-        fin.clear();
-        makeProgress(counter + file_counter + 1, frame_num);
-    }
-    // write all calls in after.pat to the target
-    int counter2 = 0;
-    while ((call = file_after.NextCall()))
-    {
-        writeout(target_file, call);
-        if (call->mTid == defaultTid && call->mCallName.substr(0, 14) == "eglSwapBuffers")
-        {
-            counter2++;
-            makeProgress(counter + gles_files.size() + counter2, frame_num);
-        }
+        makeProgress(first + count, gles_files.size());
     }
     cout << endl;
-    file_after.Close();
+
+    // write all calls in after.pat to the target
+    if (!copyPassThroughFile(source_name + "/not_interested_in/after.pat", target_file))
+        return 1;
     target_file.Close();
     return 0;
 }
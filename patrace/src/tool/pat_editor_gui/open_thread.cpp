@@ -1,14 +1,21 @@
 #include "open_thread.h"
 #include <QThread>
 #include <QStringList>
+#include <algorithm>
 #include <fstream>
 #include <string>
 
 bool Pat_reading = false;
 bool Pat_saving = false;
 
-int pat_extract(const std::string &source_name, const std::string &target_name, int begin_call = 0, int end_call = std::numeric_limits<int>::max());
-int merge_to_pat(const std::string &source_name, const std::string &target_name);
+int pat_extract(const std::string &source_name, const std::string &target_name, int begin_call, int end_call, unsigned int threads);
+int merge_to_pat(const std::string &source_name, const std::string &target_name, unsigned int threads);
+
+// idealThreadCount() is -1 when Qt cannot tell how many cores there are
+static unsigned int workerThreads()
+{
+    return std::max(1, QThread::idealThreadCount());
+}
 
 OpenJson_Worker::OpenJson_Worker(QObject *parent):
     QObject(parent)
@@ -62,7 +69,7 @@ void OpenJson_Worker::extractPat(const QString &filename_pat, const QString &dir
 {
     std::string source_name = filename_pat.toStdString();
     std::string target_name = dirname_pat.toStdString();
-    pat_extract(source_name, target_name); //resolve the pat and get json file
+    pat_extract(source_name, target_name, 0, std::numeric_limits<int>::max(), workerThreads()); //resolve the pat and get json file
     Pat_reading = false;
     emit extractFinish();
 }
@@ -71,6 +78,6 @@ void OpenJson_Worker::mergePat(const QString &dirname_pat, const QString &filena
 {
     std::string source_name = dirname_pat.toStdString();
     std::string target_name = filename_pat.toStdString();
-    merge_to_pat(source_name, target_name);
+    merge_to_pat(source_name, target_name, workerThreads());
     Pat_saving =false;
 }
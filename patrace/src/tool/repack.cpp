@@ -0,0 +1,173 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "common/in_file.hpp"
+#include "common/chunk_codec.hpp"
+#include "common/file_format.hpp"
+#include "common/out_file.hpp"
+#include "common/os.hpp"
+#include "tool/config.hpp"
+#include "tool/utils.hpp"
+
+static void printHelp()
+{
+    std::cout <<
+        "Usage : repack [OPTIONS] <source trace> <target trace>\n"
+        "Rewrites the compressed chunks of a trace without decoding its calls.\n"
+        "Options:\n"
+        "  -c <KiB>      uncompressed chunk size in KiB (default 1024)\n"
+        "  -z <codec>    chunk compression: snappy (default), store (uncompressed) or zlib (smallest)\n"
+        "  -f            start a new chunk after every frame of the frame thread\n"
+        "  -t <tid>      thread whose eglSwapBuffers calls end frames (default: the default thread of the trace)\n"
+        "  -h            print help\n"
+        "  -v            print version\n"
+        ;
+}
+
+static void printVersion()
+{
+    std::cout << PATRACE_VERSION << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int chunkSize = SNAPPY_CHUNK_SIZE;
+    bool frameAligned = false;
+    int tid = -1;
+    const common::ChunkCodec *codec = common::GetChunkCodec(common::CHUNK_CODEC_SNAPPY);
+
+    int argIndex = 1;
+    for (; argIndex < argc; ++argIndex)
+    {
+        const char *arg = argv[argIndex];
+
+        if (arg[0] != '-')
+            break;
+
+        if (!strcmp(arg, "-h"))
+        {
+            printHelp();
+            return 1;
+        }
+        else if (!strcmp(arg, "-v"))
+        {
+            printVersion();
+            return 1;
+        }
+        else if (!strcmp(arg, "-c") && argIndex + 1 < argc)
+        {
+            chunkSize = atoi(argv[++argIndex]) * 1024;
+        }
+        else if (!strcmp(arg, "-z") && argIndex + 1 < argc)
+        {
+            codec = common::GetChunkCodec(argv[++argIndex]);
+            if (codec == NULL)
+            {
+                printf("Error: Unknown codec %s\n", argv[argIndex]);
+                printHelp();
+                return 1;
+            }
+        }
+        else if (!strcmp(arg, "-f"))
+        {
+            frameAligned = true;
+        }
+        else if (!strcmp(arg, "-t") && argIndex + 1 < argc)
+        {
+            tid = atoi(argv[++argIndex]);
+        }
+        else
+        {
+            printf("Error: Unknow option %s\n", arg);
+            printHelp();
+            return 1;
+        }
+    }
+
+    if (argIndex + 2 > argc)
+    {
+        printHelp();
+        return 1;
+    }
+    const char* source_trace_filename = argv[argIndex++];
+    const char* target_trace_filename = argv[argIndex++];
+
+    common::InFile inputFile;
+    inputFile.prepareChunks();
+    if (!inputFile.Open(source_trace_filename))
+    {
+        DBG_LOG("Failed to open for reading: %s\n", source_trace_filename);
+        return 1;
+    }
+    if (tid < 0)
+    {
+        tid = inputFile.getDefaultThreadID();
+    }
+
+    // Keep the sigbook of the source, so that the calls can be copied as they are
+    std::vector<std::string> sigbook(inputFile.GetMaxSigId() + 1);
+    for (unsigned int id = 1; id < sigbook.size(); ++id)
+    {
+        sigbook[id] = inputFile.ExIdToName(id);
+    }
+
+    common::OutFile outputFile;
+    outputFile.SetChunkSize(chunkSize);
+    outputFile.SetFrameAlignedChunks(frameAligned, tid);
+    outputFile.SetChunkCodec(codec->Id());
+    if (!outputFile.Open(target_trace_filename, true, &sigbook))
+    {
+        DBG_LOG("Failed to open for writing: %s\n", target_trace_filename);
+        return 1;
+    }
+
+    Json::Value header = inputFile.getJSONHeader();
+    Json::Value info;
+    info["chunkSize"] = outputFile.GetChunkSize();
+    info["codec"] = codec->Name();
+    info["frameAligned"] = frameAligned;
+    if (frameAligned)
+    {
+        info["frameThread"] = tid;
+    }
+    addConversionEntry(header, "repack", source_trace_filename, info);
+    Json::FastWriter writer;
+    const std::string json_header = writer.write(header);
+    outputFile.mHeader.jsonLength = json_header.size();
+    outputFile.WriteHeader(json_header.c_str(), json_header.size());
+
+    const unsigned short swapId = inputFile.NameToExId("eglSwapBuffers");
+    const unsigned short swapWithDamageId = inputFile.NameToExId("eglSwapBuffersWithDamageKHR");
+    unsigned int callCount = 0;
+    unsigned int frameCount = 0;
+
+    void *fptr = NULL;
+    char *src = NULL;
+    common::BCall_vlen call;
+    while (inputFile.GetNextCall(fptr, call, src))
+    {
+        const int fixedLen = inputFile.ExIdToLen(call.funcId);
+        if (fixedLen == 0)
+        {
+            outputFile.WriteRaw(src - sizeof(common::BCall_vlen), call.toNext);
+        }
+        else
+        {
+            outputFile.WriteRaw(src - sizeof(common::BCall), fixedLen);
+        }
+        callCount++;
+
+        if ((int)call.tid == tid && (call.funcId == swapId || call.funcId == swapWithDamageId))
+        {
+            frameCount++;
+            outputFile.EndFrame(tid);
+        }
+    }
+
+    DBG_LOG("Repacked %u calls, %u frames in thread %d\n", callCount, frameCount, tid);
+    inputFile.Close();
+    outputFile.Close();
+
+    return 0;
+}
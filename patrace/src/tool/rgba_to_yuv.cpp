@@ -36,6 +36,7 @@
 //
 // So, the second conversion only applies to new version pat file
 
+#include <algorithm>
 #include <iostream>
 #include <map>
 #include <unordered_map>
@@ -48,6 +49,7 @@
 #include "retracer/dma_buffer/dma_buffer.hpp"
 #include "eglstate/common.hpp"
 #include "common/image.hpp"
+#include "common/yuv_convert.hpp"
 #include "tool/config.hpp"
 
 using namespace std;
@@ -63,7 +65,8 @@ static void printHelp()
         "     YV12              YV12 format\n"
         "     NV12              NV12 format\n"
         "  -u USAGE             Specify the usage of the target. USAGE must be a decimal integer.\n"
-        "  -no_crop             Abandon all the attribs of eglCreateImageKHR related to EGL_ANDROID_image_crop extension"
+        "  -no_crop             Abandon all the attribs of eglCreateImageKHR related to EGL_ANDROID_image_crop extension\n"
+        "  -j THREADS           Number of threads converting each texture (default: one per core)\n"
         "  -h                   Print help.\n"
         "  -v                   Print version.\n"
         ;
@@ -83,15 +86,6 @@ static void writeout(common::OutFile &outputFile, common::CallTM *call)
     outputFile.Write(buffer, dest-buffer);
 }
 
-int truncate(int num, int min = 0, int max = 255)
-{
-    if (num < min)
-        return min;
-    else if (num > max)
-        return max;
-    return num;
-}
-
 enum Format
 {
     REMAIN = 0,
@@ -99,85 +93,12 @@ enum Format
     NV12 = 2,
 };
 
-int NoConvert(unsigned char *rgba, unsigned char *yv12, int width, int height)
+int NoConvert(const unsigned char *rgba, unsigned char *yv12, int width, int height, unsigned threads)
 {
     return 0;
 }
 
-int RGBAtoYV12(unsigned char *rgba, unsigned char *yv12, int width, int height)
-{
-    int y_stride = (width + 15) / 16 * 16;
-    int y_height= height;
-    int y_size = y_stride * y_height;
-    int c_stride = (y_stride / 2 + 15) / 16 * 16;
-    int c_size = c_stride * y_height / 2;
-    int yuv_size = y_size + c_size * 2;
-
-    // y =  0.299r + 0.587g + 0.114b;
-    // u = -0.169r - 0.331g + 0.500b + 128;
-    // v =  0.500r - 0.419g - 0.081b + 128;
-    for (int i = 0; i < y_stride * y_height; ++i) {
-        int y_x = i % y_stride;
-        if (y_x >= width)
-            continue;
-        int y_y = i / y_stride;
-
-        int r = rgba[(y_y * width + y_x) * 4];
-        int g = rgba[(y_y * width + y_x) * 4 + 1];
-        int b = rgba[(y_y * width + y_x) * 4 + 2];
-        int y = 0.299 * r + 0.587 * g + 0.114 * b;
-        yv12[y_y * y_stride + y_x] = truncate(y);
-        if (((y_x & 0x1) == 0) && ((y_y & 0x1) == 0)) {
-            int u = -0.169 * r - 0.331 * g + 0.500 * b + 128;
-            int v =  0.500 * r - 0.419 * g - 0.081 * b + 128;
-            int u_x = y_x / 2;
-            int u_y = y_y / 2;
-            yv12[y_size + u_y * c_stride + u_x] = truncate(v);
-            yv12[y_size + c_size + u_y * c_stride + u_x] = truncate(u);
-        }
-    }
-
-    return yuv_size;
-}
-
-int RGBAtoNV12(unsigned char *rgba, unsigned char *nv12, int width, int height)
-{
-    //int y_stride = width;
-    int y_stride = (width + 15) / 16 * 16;
-    int y_height= height;
-    int y_size = y_stride * y_height;
-    int c_stride = y_stride;
-    int c_size = c_stride * y_height / 2;
-    int yuv_size = y_size + c_size;
-
-    // y =  0.299r + 0.587g + 0.114b;
-    // u = -0.169r - 0.331g + 0.500b + 128;
-    // v =  0.500r - 0.419g - 0.081b + 128;
-    for (int i = 0; i < y_stride * y_height; ++i) {
-        int y_x = i % y_stride;
-        if (y_x >= width)
-            continue;
-        int y_y = i / y_stride;
-
-        int r = rgba[(y_y * width + y_x) * 4];
-        int g = rgba[(y_y * width + y_x) * 4 + 1];
-        int b = rgba[(y_y * width + y_x) * 4 + 2];
-        int y = 0.299 * r + 0.587 * g + 0.114 * b;
-        nv12[y_y * y_stride + y_x] = truncate(y);
-        if (((y_x & 0x1) == 0) && ((y_y & 0x1) == 0)) {
-            int u = -0.169 * r - 0.331 * g + 0.500 * b + 128;
-            int v =  0.500 * r - 0.419 * g - 0.081 * b + 128;
-            int u_x = y_x / 2;
-            int u_y = y_y / 2;
-            nv12[y_size + u_y * c_stride + u_x * 2] = truncate(u);
-            nv12[y_size + u_y * c_stride + u_x * 2 + 1] = truncate(v);
-        }
-    }
-
-    return yuv_size;
-}
-
-typedef int (*CONVERT_FUNCTION)(unsigned char *rgba, unsigned char *yuv, int width, int height);
+typedef int (*CONVERT_FUNCTION)(const unsigned char *rgba, unsigned char *yuv, int width, int height, unsigned threads);
 
 map<Format, PixelFormat> androidFormatMap;
 map<PixelFormat, CONVERT_FUNCTION> functionMap;
@@ -190,8 +111,8 @@ void makeMap()
     androidFormatMap[NV12] = MALI_GRALLOC_FORMAT_INTERNAL_NV12;
 
     functionMap[PIXEL_FORMAT_NONE] = NoConvert;
-    functionMap[HAL_PIXEL_FORMAT_YV12] = RGBAtoYV12;
-    functionMap[MALI_GRALLOC_FORMAT_INTERNAL_NV12] = RGBAtoNV12;
+    functionMap[HAL_PIXEL_FORMAT_YV12] = image::RGBAtoYV12;
+    functionMap[MALI_GRALLOC_FORMAT_INTERNAL_NV12] = image::RGBAtoNV12;
 
     AndroidImageCropAttribToNameMap[0x3148] = "EGL_IMAGE_CROP_LEFT_ANDROID";
     AndroidImageCropAttribToNameMap[0x3149] = "EGL_IMAGE_CROP_TOP_ANDROID";
@@ -285,7 +206,7 @@ void process_eglCreateImageKHR(common::CallTM *call, bool no_crop)
     }
 }
 
-int convert(const string &source_name, const string &target_name, PixelFormat format, unsigned usage, bool no_crop, bool inject_delete)
+int convert(const string &source_name, const string &target_name, PixelFormat format, unsigned usage, bool no_crop, bool inject_delete, unsigned threads)
 {
     common::TraceFileTM source_file;
     CONVERT_FUNCTION convert_function;
@@ -458,7 +379,7 @@ int convert(const string &source_name, const string &target_name, PixelFormat fo
                     int width = call->mArgs[3]->GetAsInt();
                     int height = call->mArgs[4]->GetAsInt();
                     unsigned char *blob = reinterpret_cast<unsigned char *>(call->mArgs[8]->mOpaqueIns->mBlob);
-                    int yuv_size = convert_function(blob, yuv_data, width, height);
+                    int yuv_size = convert_function(blob, yuv_data, width, height, threads);
 
                     if (needToGenGraphicBuffer) {
                         common::CallTM genGraphicBuffer("glGenGraphicBuffer_ARM");
@@ -546,6 +467,7 @@ int main(int argc, char **argv)
     unsigned int usage = GraphicBuffer::USAGE_SW_READ_NEVER | GraphicBuffer::USAGE_SW_WRITE_RARELY;
     bool no_crop = false;
     bool inject_delete = false;
+    unsigned threads = 0;
     for (; argIndex < argc; ++argIndex)
     {
         string arg = argv[argIndex];
@@ -612,6 +534,10 @@ int main(int argc, char **argv)
         {
             no_crop = true;
         }
+        else if (arg == "-j" && argIndex + 1 < argc)
+        {
+            threads = std::max(1, atoi(argv[++argIndex]));
+        }
         else
         {
             DBG_LOG("Error: Unknow option %s\n", arg.c_str());
@@ -629,7 +555,7 @@ int main(int argc, char **argv)
     const char* source_trace_filename = argv[argIndex++];
     const char* target_trace_filename = argv[argIndex++];
 
-    convert(source_trace_filename, target_trace_filename, pixelFormat, usage, no_crop, inject_delete);
+    convert(source_trace_filename, target_trace_filename, pixelFormat, usage, no_crop, inject_delete, threads);
 
     return 0;
 }
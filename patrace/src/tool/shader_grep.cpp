@@ -29,7 +29,7 @@ static void printHelp()
         "Options:\n"
         "  -h            Print help\n"
         "  -v            Print version\n"
-        "  -t TYPE       Restrict search to shader type [VERT|FRAG|COMP|GEOM|TESE|TESC]"
+        "  -t TYPE       Restrict search to shader type [VERT|FRAG|COMP|GEOM|TESE|TESC]\n"
         "  -D            Add debug information to stderr\n"
         ;
 }
@@ -121,7 +121,7 @@ int main(int argc, char **argv)
             }
             else if (arg == "GEOM")
             {
-                shader_type = GL_VERTEX_SHADER;
+                shader_type = GL_GEOMETRY_SHADER;
             }
             else if (arg == "TESE")
             {
@@ -154,6 +154,8 @@ int main(int argc, char **argv)
     std::string match = argv[argIndex++];
     std::string source_trace_filename = argv[argIndex++];
     ParseInterface inputFile;
+    // Only the shader objects are looked at, so all other calls are skipped undecoded
+    inputFile.select_calls({ "glCreateShader", "glShaderSource", "glDeleteShader" });
     if (!inputFile.open(source_trace_filename))
     {
         std::cerr << "Failed to open for reading: " << source_trace_filename << std::endl;
@@ -0,0 +1,695 @@
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "tool/parse_interface.h"
+
+#include "common/memory.hpp"
+#include "common/os.hpp"
+#include "tool/config.hpp"
+
+// An index of the shaders of many traces. The shaders are stored once per
+// distinct source, by MD5 sum, and an inverted index maps every word of the
+// sources to the shaders that contain it, so that a query only has to look
+// at the sources that can match. The index directory holds:
+//
+//   traces.txt   <size> <mtime> <path>, one line per trace
+//   shaders.txt  <md5> <type> <md5 of the source without comments and whitespace>
+//   uses.txt     <shader> <trace> <context> <program> <call of glShaderSource>
+//   tokens.txt   <word> <shader> <shader> ..., sorted by word
+//   shaders/     <md5>.<ext>, the sources
+//
+// Shaders and traces are referred to by their line number, from 0. Program 0
+// stands for shaders that were never linked.
+
+static void printHelp()
+{
+    std::cout <<
+        "Usage : shader_index [OPTIONS] add <index dir> <trace_file.pat>...\n"
+        "        shader_index [OPTIONS] query <index dir> <keyword>\n"
+        "        shader_index [OPTIONS] stats <index dir>\n"
+        "add: index the shaders of the traces. Traces already in the index are skipped unless they changed.\n"
+        "query: print the lines of the indexed shaders that contain keyword, with the traces that use them.\n"
+        "Options:\n"
+        "  -e            Treat the keyword as a regular expression\n"
+        "  -l            Only list the traces with matching shaders\n"
+        "  -t TYPE       Restrict search to shader type [VERT|FRAG|COMP|GEOM|TESE|TESC]\n"
+        "  -h            Print help\n"
+        "  -v            Print version\n"
+        ;
+}
+
+static void printVersion()
+{
+    std::cout << PATRACE_VERSION << std::endl;
+}
+
+static const char* typeName(GLenum type)
+{
+    switch (type)
+    {
+    case GL_FRAGMENT_SHADER: return "FRAG";
+    case GL_VERTEX_SHADER: return "VERT";
+    case GL_GEOMETRY_SHADER: return "GEOM";
+    case GL_TESS_EVALUATION_SHADER: return "TESE";
+    case GL_TESS_CONTROL_SHADER: return "TESC";
+    case GL_COMPUTE_SHADER: return "COMP";
+    default: return "NONE";
+    }
+}
+
+static bool isWordChar(char c)
+{
+    return isalnum((unsigned char)c) || c == '_';
+}
+
+// The words of a shader source, which are the keys of the inverted index
+static std::set<std::string> tokenize(const std::string& source)
+{
+    std::set<std::string> words;
+    size_t i = 0;
+    while (i < source.size())
+    {
+        if (!isWordChar(source[i]))
+        {
+            i++;
+            continue;
+        }
+        const size_t start = i;
+        while (i < source.size() && isWordChar(source[i]))
+        {
+            i++;
+        }
+        words.insert(source.substr(start, i - start));
+    }
+    return words;
+}
+
+struct TraceEntry
+{
+    std::string path;
+    long long size;
+    long long mtime;
+};
+
+struct ShaderEntry
+{
+    std::string md5;
+    std::string type;
+    std::string normalized;
+};
+
+struct ShaderUse
+{
+    unsigned shader, trace, context, program, call;
+
+    bool operator<(const ShaderUse& other) const
+    {
+        return std::tie(shader, trace, context, program, call) < std::tie(other.shader, other.trace, other.context, other.program, other.call);
+    }
+};
+
+struct Index
+{
+    std::string dir;
+    std::vector<TraceEntry> traces;
+    std::vector<ShaderEntry> shaders;
+    std::unordered_map<std::string, unsigned> shaderByMd5;
+    std::vector<ShaderUse> uses;
+    std::map<std::string, std::set<unsigned>> tokens;
+
+    std::string sourceFilename(const ShaderEntry& shader) const
+    {
+        return dir + "/shaders/" + shader.md5 + "." + shader.type;
+    }
+
+    bool load();
+    bool save() const;
+    unsigned addShader(const std::string& source, const std::string& compressed, GLenum type);
+    bool addTrace(const std::string& path, const struct stat& st);
+};
+
+static bool loadTraces(const std::string& dir, std::vector<TraceEntry>& traces)
+{
+    std::ifstream in(dir + "/traces.txt");
+    TraceEntry entry;
+    while (in >> entry.size >> entry.mtime && in.get() == ' ' && std::getline(in, entry.path))
+    {
+        traces.push_back(entry);
+    }
+    return !in.bad();
+}
+
+static bool loadShaders(const std::string& dir, std::vector<ShaderEntry>& shaders)
+{
+    std::ifstream in(dir + "/shaders.txt");
+    ShaderEntry entry;
+    while (in >> entry.md5 >> entry.type >> entry.normalized)
+    {
+        shaders.push_back(entry);
+    }
+    return !in.bad();
+}
+
+// Calls func with every use in the index, in the order they were added
+template<typename Func>
+static void forEachUse(const std::string& dir, Func func)
+{
+    std::ifstream in(dir + "/uses.txt");
+    ShaderUse use;
+    while (in >> use.shader >> use.trace >> use.context >> use.program >> use.call)
+    {
+        func(use);
+    }
+}
+
+// Calls func with every word of the inverted index and the line that lists its shaders
+template<typename Func>
+static void forEachToken(const std::string& dir, Func func)
+{
+    std::ifstream in(dir + "/tokens.txt");
+    std::string line;
+    while (std::getline(in, line))
+    {
+        const size_t space = line.find(' ');
+        if (space != std::string::npos)
+        {
+            func(line.substr(0, space), line.c_str() + space + 1);
+        }
+    }
+}
+
+static void parseShaderList(const char* list, std::set<unsigned>& shaders)
+{
+    char* end = NULL;
+    for (unsigned long n = strtoul(list, &end, 10); end != list; n = strtoul(list, &end, 10))
+    {
+        shaders.insert(n);
+        list = end;
+    }
+}
+
+bool Index::load()
+{
+    if (!loadTraces(dir, traces) || !loadShaders(dir, shaders))
+    {
+        return false;
+    }
+    for (unsigned i = 0; i < shaders.size(); ++i)
+    {
+        shaderByMd5[shaders[i].md5] = i;
+    }
+    forEachUse(dir, [&](const ShaderUse& use) { uses.push_back(use); });
+    forEachToken(dir, [&](const std::string& token, const char* list) { parseShaderList(list, tokens[token]); });
+    return true;
+}
+
+// Files are replaced whole, so that an interrupted update leaves the previous index
+static bool replaceFile(const std::string& filename, const std::string& content)
+{
+    const std::string tmp = filename + ".tmp";
+    FILE* fp = fopen(tmp.c_str(), "wb");
+    if (!fp)
+    {
+        DBG_LOG("Failed to open for writing: %s\n", tmp.c_str());
+        return false;
+    }
+    const bool written = fwrite(content.data(), 1, content.size(), fp) == content.size();
+    if (fclose(fp) != 0 || !written || rename(tmp.c_str(), filename.c_str()) != 0)
+    {
+        DBG_LOG("Failed to write %s: %s\n", filename.c_str(), strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+bool Index::save() const
+{
+    // The shader sources are already written, write the tables that refer to them last
+    std::ostringstream tokenStream;
+    for (const auto& pair : tokens)
+    {
+        tokenStream << pair.first;
+        for (unsigned shader : pair.second)
+        {
+            tokenStream << ' ' << shader;
+        }
+        tokenStream << '\n';
+    }
+    std::ostringstream useStream;
+    for (const ShaderUse& use : uses)
+    {
+        useStream << use.shader << ' ' << use.trace << ' ' << use.context << ' ' << use.program << ' ' << use.call << '\n';
+    }
+    std::ostringstream shaderStream;
+    for (const ShaderEntry& shader : shaders)
+    {
+        shaderStream << shader.md5 << ' ' << shader.type << ' ' << shader.normalized << '\n';
+    }
+    std::ostringstream traceStream;
+    for (const TraceEntry& trace : traces)
+    {
+        traceStream << trace.size << ' ' << trace.mtime << ' ' << trace.path << '\n';
+    }
+    return replaceFile(dir + "/tokens.txt", tokenStream.str())
+        && replaceFile(dir + "/uses.txt", useStream.str())
+        && replaceFile(dir + "/shaders.txt", shaderStream.str())
+        && replaceFile(dir + "/traces.txt", traceStream.str());
+}
+
+unsigned Index::addShader(const std::string& source, const std::string& compressed, GLenum type)
+{
+    const std::string md5 = common::MD5Digest(source).text_lower();
+    const auto found = shaderByMd5.find(md5);
+    if (found != shaderByMd5.end())
+    {
+        return found->second;
+    }
+
+    const unsigned shader = shaders.size();
+    ShaderEntry entry;
+    entry.md5 = md5;
+    entry.type = typeName(type);
+    entry.normalized = common::MD5Digest(compressed).text_lower();
+    shaders.push_back(entry);
+    shaderByMd5[md5] = shader;
+
+    const std::string filename = sourceFilename(entry);
+    FILE* fp = fopen(filename.c_str(), "wb");
+    if (!fp || fwrite(source.data(), 1, source.size(), fp) != source.size())
+    {
+        DBG_LOG("Failed to write %s\n", filename.c_str());
+    }
+    if (fp)
+    {
+        fclose(fp);
+    }
+    for (const std::string& token : tokenize(source))
+    {
+        tokens[token].insert(shader);
+    }
+    return shader;
+}
+
+bool Index::addTrace(const std::string& path, const struct stat& st)
+{
+    unsigned trace = traces.size();
+    for (unsigned i = 0; i < traces.size(); ++i)
+    {
+        if (traces[i].path == path)
+        {
+            if (traces[i].size == (long long)st.st_size && traces[i].mtime == (long long)st.st_mtime)
+            {
+                DBG_LOG("Already indexed: %s\n", path.c_str());
+                return true;
+            }
+            trace = i; // changed since, index it again
+        }
+    }
+
+    // The source uploaded last to each shader object, with the call that uploaded it
+    struct Upload
+    {
+        unsigned shader;
+        unsigned call;
+        bool linked;
+    };
+    std::map<std::pair<const void*, int>, Upload> uploads; // by shader store and shader index
+    std::set<ShaderUse> found;
+
+    ParseInterface input;
+    input.addCallHook("glShaderSource", [&](common::CallTM* call)
+    {
+        if (input.context_index == UNBOUND)
+        {
+            return;
+        }
+        const StateTracker::Context& context = input.contexts.at(input.context_index);
+        const int shader_index = context.shaders.remap(call->mArgs[0]->GetAsUInt());
+        const StateTracker::Shader& shader = context.shaders.at(shader_index);
+        const Upload upload = { addShader(shader.source_code, shader.source_compressed, shader.shader_type), call->mCallNo, false };
+        uploads[std::make_pair((const void*)&context.shaders.all(), shader_index)] = upload;
+    });
+    input.addCallHook("glLinkProgram", [&](common::CallTM* call)
+    {
+        if (input.context_index == UNBOUND)
+        {
+            return;
+        }
+        const StateTracker::Context& context = input.contexts.at(input.context_index);
+        const GLuint program = call->mArgs[0]->GetAsUInt();
+        for (const auto& pair : context.programs.at(context.programs.remap(program)).shaders)
+        {
+            auto it = uploads.find(std::make_pair((const void*)&context.shaders.all(), pair.second));
+            if (it != uploads.end())
+            {
+                found.insert(ShaderUse{ it->second.shader, trace, (unsigned)input.context_index, program, it->second.call });
+                it->second.linked = true;
+            }
+        }
+    });
+    input.select_calls({ "glCreateShader", "glDeleteShader", "glCreateProgram", "glDeleteProgram", "glAttachShader" });
+    if (!input.open(path))
+    {
+        return false;
+    }
+    while (input.next_call()) {}
+    input.close();
+
+    for (const auto& pair : uploads)
+    {
+        if (!pair.second.linked)
+        {
+            // The context is not kept with the upload, find it from the shader store
+            for (const StateTracker::Context& context : input.contexts)
+            {
+                if ((const void*)&context.shaders.all() == pair.first.first)
+                {
+                    found.insert(ShaderUse{ pair.second.shader, trace, (unsigned)context.index, 0, pair.second.call });
+                    break;
+                }
+            }
+        }
+    }
+
+    if (trace == traces.size())
+    {
+        traces.push_back(TraceEntry());
+    }
+    else
+    {
+        uses.erase(std::remove_if(uses.begin(), uses.end(), [&](const ShaderUse& use) { return use.trace == trace; }), uses.end());
+    }
+    traces[trace].path = path;
+    traces[trace].size = st.st_size;
+    traces[trace].mtime = st.st_mtime;
+    uses.insert(uses.end(), found.begin(), found.end());
+    DBG_LOG("Indexed %s: %u shader uses, %u distinct shaders in the index\n", path.c_str(), (unsigned)found.size(), (unsigned)shaders.size());
+    return true;
+}
+
+static int addTraces(const std::string& dir, const std::vector<std::string>& filenames)
+{
+    mkdir(dir.c_str(), 0755);
+    mkdir((dir + "/shaders").c_str(), 0755);
+    Index index;
+    index.dir = dir;
+    if (!index.load())
+    {
+        DBG_LOG("Failed to read the index in %s\n", dir.c_str());
+        return 1;
+    }
+
+    int ret = 0;
+    for (const std::string& filename : filenames)
+    {
+        char path[PATH_MAX];
+        struct stat st;
+        if (!realpath(filename.c_str(), path) || stat(path, &st) != 0)
+        {
+            DBG_LOG("Failed to open for reading: %s\n", filename.c_str());
+            ret = 1;
+            continue;
+        }
+        if (!index.addTrace(path, st))
+        {
+            ret = 1;
+        }
+    }
+    return index.save() ? ret : 1;
+}
+
+struct QueryOptions
+{
+    bool regex = false;
+    bool listTraces = false;
+    std::string type;
+};
+
+// The shaders that can contain keyword, from the inverted index. Every run of
+// word characters of the keyword must be part of a word of the shader: the
+// whole word if the keyword goes on at both sides of it, otherwise the start
+// or the end of one, or any part of one if the keyword is a single word.
+static std::set<unsigned> candidateShaders(const std::string& dir, const std::string& keyword, unsigned shaderCount)
+{
+    struct Fragment
+    {
+        std::string text;
+        bool openLeft;
+        bool openRight;
+        std::set<unsigned> shaders;
+
+        bool matches(const std::string& word) const
+        {
+            if (openLeft && openRight)
+                return word.find(text) != std::string::npos;
+            if (word.size() < text.size())
+                return false;
+            if (openLeft)
+                return word.compare(word.size() - text.size(), text.size(), text) == 0;
+            if (openRight)
+                return word.compare(0, text.size(), text) == 0;
+            return word == text;
+        }
+    };
+    std::vector<Fragment> fragments;
+    for (size_t i = 0; i < keyword.size();)
+    {
+        if (!isWordChar(keyword[i]))
+        {
+            i++;
+            continue;
+        }
+        const size_t start = i;
+        while (i < keyword.size() && isWordChar(keyword[i]))
+        {
+            i++;
+        }
+        fragments.push_back(Fragment{ keyword.substr(start, i - start), start == 0, i == keyword.size(), {} });
+    }
+
+    std::set<unsigned> candidates;
+    if (fragments.empty())
+    {
+        for (unsigned i = 0; i < shaderCount; ++i)
+        {
+            candidates.insert(i);
+        }
+        return candidates;
+    }
+
+    forEachToken(dir, [&](const std::string& word, const char* list)
+    {
+        for (Fragment& fragment : fragments)
+        {
+            if (fragment.matches(word))
+            {
+                parseShaderList(list, fragment.shaders);
+            }
+        }
+    });
+    candidates = fragments[0].shaders;
+    for (size_t i = 1; i < fragments.size(); ++i)
+    {
+        std::set<unsigned> both;
+        std::set_intersection(candidates.begin(), candidates.end(), fragments[i].shaders.begin(), fragments[i].shaders.end(),
+                              std::inserter(both, both.begin()));
+        candidates.swap(both);
+    }
+    return candidates;
+}
+
+static int query(const std::string& dir, const std::string& keyword, const QueryOptions& options)
+{
+    Index index;
+    index.dir = dir;
+    if (!loadTraces(dir, index.traces) || !loadShaders(dir, index.shaders) || index.traces.empty())
+    {
+        DBG_LOG("No index in %s\n", dir.c_str());
+        return 1;
+    }
+
+    std::regex pattern;
+    if (options.regex)
+    {
+        try
+        {
+            pattern = std::regex(keyword);
+        }
+        catch (const std::regex_error& e)
+        {
+            std::cerr << "Bad regular expression \"" << keyword << "\": " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    // A regular expression can match anything, the sources are few since they are stored once
+    std::set<unsigned> candidates;
+    if (options.regex)
+    {
+        for (unsigned i = 0; i < index.shaders.size(); ++i)
+        {
+            candidates.insert(i);
+        }
+    }
+    else
+    {
+        candidates = candidateShaders(dir, keyword, index.shaders.size());
+    }
+
+    std::map<unsigned, std::vector<std::string>> matches; // matching lines, by shader
+    for (unsigned shader : candidates)
+    {
+        if (shader >= index.shaders.size() || (!options.type.empty() && index.shaders[shader].type != options.type))
+        {
+            continue;
+        }
+        std::ifstream in(index.sourceFilename(index.shaders[shader]));
+        std::string line;
+        std::vector<std::string> lines;
+        while (std::getline(in, line))
+        {
+            if (options.regex ? std::regex_search(line, pattern) : line.find(keyword) != std::string::npos)
+            {
+                lines.push_back(line);
+            }
+        }
+        if (!lines.empty())
+        {
+            matches[shader].swap(lines);
+        }
+    }
+
+    std::set<unsigned> listed;
+    forEachUse(dir, [&](const ShaderUse& use)
+    {
+        const auto found = matches.find(use.shader);
+        if (found == matches.end() || use.trace >= index.traces.size())
+        {
+            return;
+        }
+        const std::string& trace = index.traces[use.trace].path;
+        if (options.listTraces)
+        {
+            if (listed.insert(use.trace).second)
+            {
+                fprintf(stdout, "%s\n", trace.c_str());
+            }
+            return;
+        }
+        for (const std::string& line : found->second)
+        {
+            fprintf(stdout, "%s : %s : c%u : p%u : %u : %s\n", trace.c_str(), index.shaders[use.shader].type.c_str(),
+                    use.context, use.program, use.call, line.c_str());
+        }
+    });
+    return 0;
+}
+
+static int stats(const std::string& dir)
+{
+    Index index;
+    index.dir = dir;
+    if (!index.load() || index.traces.empty())
+    {
+        DBG_LOG("No index in %s\n", dir.c_str());
+        return 1;
+    }
+    std::set<std::string> normalized;
+    for (const ShaderEntry& shader : index.shaders)
+    {
+        normalized.insert(shader.normalized);
+    }
+    std::cout << "Traces: " << index.traces.size() << std::endl;
+    std::cout << "Shader uses: " << index.uses.size() << std::endl;
+    std::cout << "Distinct shaders: " << index.shaders.size() << std::endl;
+    std::cout << "Distinct shaders without comments and whitespace: " << normalized.size() << std::endl;
+    std::cout << "Distinct words: " << index.tokens.size() << std::endl;
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    QueryOptions options;
+    int argIndex = 1;
+    for (; argIndex < argc; ++argIndex)
+    {
+        std::string arg = argv[argIndex];
+
+        if (arg[0] != '-')
+        {
+            break;
+        }
+        else if (arg == "-h")
+        {
+            printHelp();
+            return 1;
+        }
+        else if (arg == "-v")
+        {
+            printVersion();
+            return 1;
+        }
+        else if (arg == "-e")
+        {
+            options.regex = true;
+        }
+        else if (arg == "-l")
+        {
+            options.listTraces = true;
+        }
+        else if (arg == "-t" && argIndex + 1 < argc)
+        {
+            options.type = argv[++argIndex];
+            if (options.type != "VERT" && options.type != "FRAG" && options.type != "COMP"
+                && options.type != "GEOM" && options.type != "TESE" && options.type != "TESC")
+            {
+                std::cerr << "Unknown shader type: " << options.type << std::endl;
+                return 1;
+            }
+        }
+        else
+        {
+            std::cerr << "Error: Unknown option " << arg << std::endl;
+            printHelp();
+            return 1;
+        }
+    }
+
+    if (argIndex + 2 > argc)
+    {
+        printHelp();
+        return 1;
+    }
+    const std::string command = argv[argIndex++];
+    const std::string dir = argv[argIndex++];
+    if (command == "add" && argIndex < argc)
+    {
+        return addTraces(dir, std::vector<std::string>(argv + argIndex, argv + argc));
+    }
+    else if (command == "query" && argIndex + 1 == argc)
+    {
+        return query(dir, argv[argIndex], options);
+    }
+    else if (command == "stats" && argIndex == argc)
+    {
+        return stats(dir);
+    }
+    printHelp();
+    return 1;
+}
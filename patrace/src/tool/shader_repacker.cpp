@@ -159,6 +159,11 @@ int main(int argc, char **argv)
     std::string keyword = argv[argIndex++];
     std::string source_trace_filename = argv[argIndex++];
     ParseInterface inputFile;
+    if (split)
+    {
+        // Repacking writes out every call, but splitting only needs the shader objects
+        inputFile.select_calls({ "glCreateShader", "glShaderSource", "glDeleteShader" });
+    }
     if (!inputFile.open(source_trace_filename))
     {
         std::cerr << "Failed to open for reading: " << source_trace_filename << std::endl;
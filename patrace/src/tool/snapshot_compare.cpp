@@ -0,0 +1,299 @@
+#include <dirent.h>
+#include <math.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/image.hpp"
+#include "common/image_compare.hpp"
+#include "common/os.hpp"
+#include "jsoncpp/include/json/writer.h"
+#include "tool/config.hpp"
+
+static void printHelp()
+{
+    std::cout <<
+        "Usage : snapshot_compare [OPTIONS] <reference dir> <result dir>\n"
+        "Compares the PNG snapshots with the same name in two directories, and writes a JSON report.\n"
+        "Exits with 1 if any snapshot differs, cannot be compared, or is missing from the result dir.\n"
+        "Options:\n"
+        "  -o <file>         write the report to file instead of stdout\n"
+        "  -j <threads>      number of threads (default: one per core)\n"
+        "  -ssim             also compute the SSIM of the color channels on 8x8 tiles\n"
+        "  -heatmap <dir>    write a heat map of the differences of every differing pair to dir\n"
+        "  -amplify <n>      multiply the differences in heat maps by n (default 8)\n"
+        "  -h                print help\n"
+        "  -v                print version\n"
+        ;
+}
+
+static void printVersion()
+{
+    std::cout << PATRACE_VERSION << std::endl;
+}
+
+static bool endsWith(const std::string &s, const char *suffix)
+{
+    const size_t len = strlen(suffix);
+    return s.size() >= len && s.compare(s.size() - len, len, suffix) == 0;
+}
+
+// Names of the PNG files in dir, sorted
+static bool listSnapshots(const std::string &dir, std::vector<std::string> &names)
+{
+    DIR *d = opendir(dir.c_str());
+    if (d == NULL)
+    {
+        return false;
+    }
+    struct dirent *ent;
+    while ((ent = readdir(d)) != NULL)
+    {
+        if (ent->d_name[0] != '.' && endsWith(ent->d_name, ".png"))
+        {
+            names.push_back(ent->d_name);
+        }
+    }
+    closedir(d);
+    std::sort(names.begin(), names.end());
+    return true;
+}
+
+struct Options
+{
+    unsigned ssimTile = 0;
+    std::string heatmapDir;
+    unsigned amplify = 8;
+};
+
+// Compare one pair of snapshots, runs on any thread
+static Json::Value compareSnapshots(const std::string &refDir, const std::string &resultDir, const std::string &name, const Options &options)
+{
+    Json::Value result;
+    result["name"] = name;
+
+    std::unique_ptr<image::Image> ref(image::readPNG((refDir + "/" + name).c_str()));
+    std::unique_ptr<image::Image> img(image::readPNG((resultDir + "/" + name).c_str()));
+    if (!ref || !img)
+    {
+        result["error"] = !ref ? "cannot read reference" : "cannot read result";
+        return result;
+    }
+    result["width"] = img->width;
+    result["height"] = img->height;
+
+    image::ImageDiff diff;
+    if (!image::compareImages(*img, *ref, diff, options.ssimTile))
+    {
+        result["error"] = "size mismatch";
+        result["reference_width"] = ref->width;
+        result["reference_height"] = ref->height;
+        return result;
+    }
+
+    result["identical"] = diff.identical();
+    result["differing_pixels"] = (Json::Value::UInt64)diff.differingPixels;
+    result["mse"] = diff.mse;
+    if (!diff.identical())
+    {
+        result["psnr"] = diff.psnr; // infinite otherwise, which JSON cannot hold
+    }
+    result["max_abs_diff"] = diff.maxAbsDiff;
+    if (options.ssimTile)
+    {
+        result["ssim"] = diff.ssim;
+    }
+    static const char *channelNames[image::ImageDiff::MAX_CHANNELS] = { "r", "g", "b", "a" };
+    for (unsigned c = 0; c < diff.channels; ++c)
+    {
+        Json::Value &channel = result["channels"][channelNames[c]];
+        channel["mse"] = diff.channel[c].mse;
+        channel["mean_abs_diff"] = diff.channel[c].meanAbsDiff;
+        channel["max_abs_diff"] = diff.channel[c].maxAbsDiff;
+    }
+
+    if (!options.heatmapDir.empty() && !diff.identical())
+    {
+        std::unique_ptr<image::Image> heatmap(image::diffHeatmap(*img, *ref, options.amplify));
+        const std::string filename = options.heatmapDir + "/" + name;
+        if (heatmap && heatmap->writePNG(filename.c_str()))
+        {
+            result["heatmap"] = filename;
+        }
+        else
+        {
+            DBG_LOG("Failed to write heat map %s\n", filename.c_str());
+        }
+    }
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    std::string reportFilename;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+    int argIndex = 1;
+    for (; argIndex < argc; ++argIndex)
+    {
+        const char *arg = argv[argIndex];
+
+        if (arg[0] != '-')
+            break;
+
+        if (!strcmp(arg, "-h"))
+        {
+            printHelp();
+            return 1;
+        }
+        else if (!strcmp(arg, "-v"))
+        {
+            printVersion();
+            return 1;
+        }
+        else if (!strcmp(arg, "-o") && argIndex + 1 < argc)
+        {
+            reportFilename = argv[++argIndex];
+        }
+        else if (!strcmp(arg, "-j") && argIndex + 1 < argc)
+        {
+            threads = std::max(1, atoi(argv[++argIndex]));
+        }
+        else if (!strcmp(arg, "-ssim"))
+        {
+            options.ssimTile = 8;
+        }
+        else if (!strcmp(arg, "-heatmap") && argIndex + 1 < argc)
+        {
+            options.heatmapDir = argv[++argIndex];
+        }
+        else if (!strcmp(arg, "-amplify") && argIndex + 1 < argc)
+        {
+            options.amplify = std::max(1, atoi(argv[++argIndex]));
+        }
+        else
+        {
+            printf("Error: Unknow option %s\n", arg);
+            printHelp();
+            return 1;
+        }
+    }
+
+    if (argIndex + 2 > argc)
+    {
+        printHelp();
+        return 1;
+    }
+    const std::string refDir = argv[argIndex++];
+    const std::string resultDir = argv[argIndex++];
+
+    std::vector<std::string> refNames, resultNames;
+    if (!listSnapshots(refDir, refNames))
+    {
+        DBG_LOG("Failed to open directory: %s\n", refDir.c_str());
+        return 1;
+    }
+    if (!listSnapshots(resultDir, resultNames))
+    {
+        DBG_LOG("Failed to open directory: %s\n", resultDir.c_str());
+        return 1;
+    }
+    if (!options.heatmapDir.empty())
+    {
+        mkdir(options.heatmapDir.c_str(), 0755);
+    }
+
+    std::vector<std::string> names;
+    Json::Value report;
+    report["reference"] = refDir;
+    report["result"] = resultDir;
+    report["missing"] = Json::arrayValue; // in the reference only
+    report["extra"] = Json::arrayValue; // in the result only
+    std::set_intersection(refNames.begin(), refNames.end(), resultNames.begin(), resultNames.end(), std::back_inserter(names));
+    for (const std::string &name : refNames)
+    {
+        if (!std::binary_search(resultNames.begin(), resultNames.end(), name))
+            report["missing"].append(name);
+    }
+    for (const std::string &name : resultNames)
+    {
+        if (!std::binary_search(refNames.begin(), refNames.end(), name))
+            report["extra"].append(name);
+    }
+
+    // Every pair is decoded and compared on its own, so the pairs are shared out between threads
+    std::vector<Json::Value> results(names.size());
+    std::atomic<size_t> next(0);
+    auto work = [&]()
+    {
+        for (size_t i = next++; i < names.size(); i = next++)
+        {
+            results[i] = compareSnapshots(refDir, resultDir, names[i], options);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (unsigned i = 0; i < std::min<size_t>(threads, names.size()); ++i)
+    {
+        pool.emplace_back(work);
+    }
+    for (std::thread &thread : pool)
+    {
+        thread.join();
+    }
+
+    unsigned identical = 0, differing = 0, failed = 0;
+    double worstPsnr = INFINITY;
+    report["snapshots"] = Json::arrayValue;
+    for (Json::Value &result : results)
+    {
+        if (result.isMember("error"))
+            failed++;
+        else if (result["identical"].asBool())
+            identical++;
+        else
+        {
+            differing++;
+            worstPsnr = std::min(worstPsnr, result["psnr"].asDouble());
+        }
+        report["snapshots"].append(result);
+    }
+    report["summary"]["compared"] = (Json::Value::UInt)names.size();
+    report["summary"]["identical"] = identical;
+    report["summary"]["differing"] = differing;
+    report["summary"]["failed"] = failed;
+    report["summary"]["missing"] = report["missing"].size();
+    report["summary"]["extra"] = report["extra"].size();
+    if (differing)
+    {
+        report["summary"]["worst_psnr"] = worstPsnr;
+    }
+
+    const std::string text = report.toStyledString();
+    if (reportFilename.empty())
+    {
+        std::cout << text;
+    }
+    else
+    {
+        std::ofstream fs(reportFilename.c_str(), std::ofstream::out | std::ofstream::trunc);
+        if (!fs)
+        {
+            DBG_LOG("Failed to open for writing: %s\n", reportFilename.c_str());
+            return 1;
+        }
+        fs << text;
+    }
+    DBG_LOG("%u identical, %u differing, %u failed, %u missing, %u extra\n", identical, differing, failed,
+            report["missing"].size(), report["extra"].size());
+    return (differing || failed || report["missing"].size()) ? 1 : 0;
+}
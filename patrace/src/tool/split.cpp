@@ -0,0 +1,325 @@
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/in_file.hpp"
+#include "common/file_format.hpp"
+#include "common/out_file.hpp"
+#include "common/os.hpp"
+#include "tool/config.hpp"
+#include "tool/upload_tracker.hpp"
+#include "tool/utils.hpp"
+
+static void printHelp()
+{
+    std::cout <<
+        "Usage : split [OPTIONS] <source trace> <output prefix>\n"
+        "Cuts a trace at frame boundaries into segments of about the same size,\n"
+        "named <output prefix>_0.pat, <output prefix>_1.pat, ..., that can be\n"
+        "processed in parallel and joined again with concat.\n"
+        "Without -s, every segment but the first only continues the previous one and\n"
+        "cannot be replayed on its own.\n"
+        "Options:\n"
+        "  -n <count>    number of segments (default 2)\n"
+        "  -s            start every segment with the state changing calls of the frames\n"
+        "                before it (all calls but draws, clears, blits, reads and swaps),\n"
+        "                so that it can be replayed on its own. concat drops them again.\n"
+        "                Texture and buffer uploads that a later upload to the same level\n"
+        "                or buffer replaces are left out, but all other state calls are\n"
+        "                repeated in every later segment, so the segments together are up\n"
+        "                to <count> times the size of a trace with a lot of other state.\n"
+        "  -t <tid>      thread whose eglSwapBuffers calls end frames (default: the default thread of the trace)\n"
+        "  -h            print help\n"
+        "  -v            print version\n"
+        ;
+}
+
+static void printVersion()
+{
+    std::cout << PATRACE_VERSION << std::endl;
+}
+
+// Calls that render or present something, and are left out of the state prefix
+static bool isFrameWork(const std::string& name)
+{
+    static const char* const prefixes[] = {
+        "glDraw", "glMultiDraw", "glDispatchCompute", "glClearBuffer", "glBlitFramebuffer",
+        "glReadPixels", "glReadnPixels", "eglSwapBuffers",
+    };
+    for (const char* prefix : prefixes)
+    {
+        if (name.compare(0, strlen(prefix), prefix) == 0)
+            return true;
+    }
+    return name == "glClear";
+}
+
+static bool isSwap(const common::BCall_vlen& call, int tid, unsigned short swapId, unsigned short swapWithDamageId)
+{
+    return (int)call.tid == tid && (call.funcId == swapId || call.funcId == swapWithDamageId);
+}
+
+static bool openTrace(common::InFile& file, const char* name)
+{
+    file.prepareChunks();
+    if (!file.Open(name))
+    {
+        DBG_LOG("Failed to open for reading: %s\n", name);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int segmentCount = 2;
+    bool statePrefix = false;
+    int tid = -1;
+
+    int argIndex = 1;
+    for (; argIndex < argc; ++argIndex)
+    {
+        const char *arg = argv[argIndex];
+
+        if (arg[0] != '-')
+            break;
+
+        if (!strcmp(arg, "-h"))
+        {
+            printHelp();
+            return 1;
+        }
+        else if (!strcmp(arg, "-v"))
+        {
+            printVersion();
+            return 1;
+        }
+        else if (!strcmp(arg, "-n") && argIndex + 1 < argc)
+        {
+            segmentCount = atoi(argv[++argIndex]);
+            if (segmentCount == 0)
+            {
+                printf("Error: Invalid segment count %s\n", argv[argIndex]);
+                return 1;
+            }
+        }
+        else if (!strcmp(arg, "-s"))
+        {
+            statePrefix = true;
+        }
+        else if (!strcmp(arg, "-t") && argIndex + 1 < argc)
+        {
+            tid = atoi(argv[++argIndex]);
+        }
+        else
+        {
+            printf("Error: Unknow option %s\n", arg);
+            printHelp();
+            return 1;
+        }
+    }
+
+    if (argIndex + 2 > argc)
+    {
+        printHelp();
+        return 1;
+    }
+    const char* source_trace_filename = argv[argIndex++];
+    const std::string output_prefix = argv[argIndex++];
+
+    // First pass: the size of every frame, to balance the segments by bytes rather than frames
+    std::vector<unsigned long long> frameBytes(1, 0);
+    std::vector<unsigned long long> frameFirstCall(1, 0);
+    std::unique_ptr<UploadTracker> uploads;
+    {
+        common::InFile inputFile;
+        if (!openTrace(inputFile, source_trace_filename))
+        {
+            return 1;
+        }
+        if (tid < 0)
+        {
+            tid = inputFile.getDefaultThreadID();
+        }
+        const unsigned short swapId = inputFile.NameToExId("eglSwapBuffers");
+        const unsigned short swapWithDamageId = inputFile.NameToExId("eglSwapBuffersWithDamageKHR");
+        if (statePrefix)
+        {
+            std::vector<std::string> names(inputFile.GetMaxSigId() + 1);
+            for (unsigned int id = 1; id < names.size(); ++id)
+            {
+                names[id] = inputFile.ExIdToName(id);
+            }
+            uploads.reset(new UploadTracker(names));
+        }
+
+        void *fptr = NULL;
+        char *src = NULL;
+        common::BCall_vlen call;
+        unsigned long long callNo = 0;
+        while (inputFile.GetNextCall(fptr, call, src))
+        {
+            const int fixedLen = inputFile.ExIdToLen(call.funcId);
+            frameBytes.back() += fixedLen == 0 ? call.toNext : fixedLen;
+            if (uploads)
+            {
+                uploads->Add(call, src, callNo);
+            }
+            callNo++;
+            if (isSwap(call, tid, swapId, swapWithDamageId))
+            {
+                frameBytes.push_back(0);
+                frameFirstCall.push_back(callNo);
+            }
+        }
+        inputFile.Close();
+    }
+    // Calls after the last swap form no frame of their own, they go with the last one
+    if (frameBytes.size() > 1)
+    {
+        frameBytes[frameBytes.size() - 2] += frameBytes.back();
+        frameBytes.pop_back();
+        frameFirstCall.pop_back();
+    }
+
+    // Cut where the running size passes the next multiple of total / count
+    const unsigned int frameCount = frameBytes.size();
+    segmentCount = std::min(segmentCount, frameCount);
+    unsigned long long totalBytes = 0;
+    for (unsigned long long bytes : frameBytes)
+    {
+        totalBytes += bytes;
+    }
+    std::vector<unsigned int> firstFrame(1, 0);
+    unsigned long long bytesSoFar = 0;
+    for (unsigned int frame = 0; frame < frameCount && firstFrame.size() < segmentCount; ++frame)
+    {
+        bytesSoFar += frameBytes[frame];
+        const unsigned int framesLeft = frameCount - frame - 1;
+        const unsigned int segmentsLeft = segmentCount - firstFrame.size();
+        if (bytesSoFar * segmentCount >= totalBytes * firstFrame.size() || framesLeft == segmentsLeft)
+        {
+            firstFrame.push_back(frame + 1);
+        }
+    }
+    firstFrame.push_back(frameCount);
+    std::vector<unsigned long long> firstCall(segmentCount, 0);
+    for (unsigned int segment = 0; segment < segmentCount; ++segment)
+    {
+        firstCall[segment] = frameFirstCall[firstFrame[segment]];
+    }
+
+    // Second pass: copy the calls as they are into their segment
+    common::InFile inputFile;
+    if (!openTrace(inputFile, source_trace_filename))
+    {
+        return 1;
+    }
+    std::vector<std::string> sigbook(inputFile.GetMaxSigId() + 1);
+    std::vector<bool> isStateCall(sigbook.size(), false);
+    for (unsigned int id = 1; id < sigbook.size(); ++id)
+    {
+        sigbook[id] = inputFile.ExIdToName(id);
+        isStateCall[id] = !isFrameWork(sigbook[id]);
+    }
+
+    std::vector<std::unique_ptr<common::OutFile>> outputFiles;
+    std::vector<std::string> outputNames;
+    for (unsigned int segment = 0; segment < segmentCount; ++segment)
+    {
+        std::ostringstream name;
+        name << output_prefix << "_" << segment << ".pat";
+        outputNames.push_back(name.str());
+        outputFiles.emplace_back(new common::OutFile());
+        if (!outputFiles.back()->Open(outputNames.back().c_str(), true, &sigbook))
+        {
+            DBG_LOG("Failed to open for writing: %s\n", outputNames.back().c_str());
+            return 1;
+        }
+    }
+
+    const unsigned short swapId = inputFile.NameToExId("eglSwapBuffers");
+    const unsigned short swapWithDamageId = inputFile.NameToExId("eglSwapBuffersWithDamageKHR");
+    std::vector<unsigned long long> callCounts(segmentCount, 0);
+    std::vector<unsigned long long> prefixCalls(segmentCount, 0);
+    unsigned int segment = 0;
+    unsigned int frame = 0;
+    unsigned long long callNo = 0;
+
+    void *fptr = NULL;
+    char *src = NULL;
+    common::BCall_vlen call;
+    while (inputFile.GetNextCall(fptr, call, src))
+    {
+        const int fixedLen = inputFile.ExIdToLen(call.funcId);
+        const char* data = fixedLen == 0 ? src - sizeof(common::BCall_vlen) : src - sizeof(common::BCall);
+        const unsigned int len = fixedLen == 0 ? call.toNext : fixedLen;
+
+        // The prefix of a segment are the state calls of all segments before it,
+        // but for uploads that are replaced before the segment starts
+        const unsigned int last = statePrefix && isStateCall[call.funcId] ? segmentCount - 1 : segment;
+        const unsigned long long replacedBy = uploads ? uploads->ReplacedBy(callNo) : std::numeric_limits<unsigned long long>::max();
+        for (unsigned int target = segment; target <= last; ++target)
+        {
+            if (target != segment && replacedBy < firstCall[target])
+            {
+                continue;
+            }
+            common::OutFile& outputFile = *outputFiles[target];
+            outputFile.WriteRaw(data, len);
+            callCounts[target]++;
+            if (target != segment)
+            {
+                prefixCalls[target]++;
+            }
+        }
+        callNo++;
+
+        if (isSwap(call, tid, swapId, swapWithDamageId))
+        {
+            outputFiles[segment]->EndFrame(tid);
+            frame++;
+            if (frame == firstFrame[segment + 1] && segment + 1 < segmentCount)
+            {
+                segment++;
+            }
+        }
+    }
+    const Json::Value sourceHeader = inputFile.getJSONHeader();
+    inputFile.Close();
+
+    for (segment = 0; segment < segmentCount; ++segment)
+    {
+        Json::Value header = sourceHeader;
+        header["callCnt"] = (Json::Value::UInt64)callCounts[segment];
+        header["frameCnt"] = firstFrame[segment + 1] - firstFrame[segment];
+
+        Json::Value info;
+        info["index"] = segment;
+        info["count"] = segmentCount;
+        info["firstFrame"] = firstFrame[segment];
+        info["firstCall"] = (Json::Value::UInt64)firstCall[segment];
+        info["prefixCalls"] = (Json::Value::UInt64)prefixCalls[segment];
+        info["frameThread"] = tid;
+        // Only the first segment, or one with a state prefix, can be replayed on its own
+        info["continuation"] = segment > 0 && !statePrefix;
+        header["segment"] = info;
+        addConversionEntry(header, "split", source_trace_filename, info);
+
+        common::OutFile& outputFile = *outputFiles[segment];
+        Json::FastWriter writer;
+        const std::string json_header = writer.write(header);
+        outputFile.mHeader.jsonLength = json_header.size();
+        outputFile.WriteHeader(json_header.c_str(), json_header.size());
+        outputFile.Close();
+
+        DBG_LOG("%s: frames %u to %u, %llu calls (%llu in the state prefix)\n", outputNames[segment].c_str(),
+                firstFrame[segment], firstFrame[segment + 1], callCounts[segment], prefixCalls[segment]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,493 @@
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/in_file.hpp"
+#include "common/api_info.hpp"
+#include "common/parse_api.hpp"
+#include "common/trace_model.hpp"
+#include "common/os.hpp"
+#include "jsoncpp/include/json/writer.h"
+#include "tool/config.hpp"
+
+static void printHelp()
+{
+    std::cout <<
+        "Usage : trace_diff [OPTIONS] <trace A> <trace B>\n"
+        "Finds where two traces diverge, and writes a JSON report.\n"
+        "Every call is hashed from its function and its serialized arguments, and the frames\n"
+        "are aligned by their hashes. Only the calls that differ inside frames that do not\n"
+        "match are decoded. Blobs stored in a blob table are compared by their digest, so\n"
+        "compare traces that both use one, or neither (see dedup -u).\n"
+        "Like diff, exits with 1 if any difference was found.\n"
+        "Options:\n"
+        "  -o <file>    write the report to file instead of stdout\n"
+        "  -f <n>       list the differing calls of at most n frames (default 20)\n"
+        "  -l <n>       list at most n calls of each trace per difference (default 50)\n"
+        "  -h           print help\n"
+        "  -v           print version\n"
+        ;
+}
+
+static void printVersion()
+{
+    std::cout << PATRACE_VERSION << std::endl;
+}
+
+// 64-bit hash of a byte range, 8 bytes at a time (from MurmurHash64A)
+static uint64_t hashBytes(const char *data, size_t len, uint64_t h)
+{
+    const uint64_t m = 0xc6a4a7935bd1e995ULL;
+    const int r = 47;
+    h ^= len * m;
+    const char *end = data + (len & ~size_t(7));
+    for (; data != end; data += 8)
+    {
+        uint64_t k;
+        memcpy(&k, data, sizeof(k));
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+        h ^= k;
+        h *= m;
+    }
+    uint64_t tail = 0;
+    memcpy(&tail, data, len & 7);
+    h ^= tail;
+    h *= m;
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+    return h;
+}
+
+struct FrameHash
+{
+    unsigned int firstCall;
+    unsigned int callCount;
+    uint64_t hash;
+};
+
+struct TraceHashes
+{
+    std::string filename;
+    std::vector<uint64_t> calls;
+    std::vector<FrameHash> frames;
+    bool ok = false;
+};
+
+// Pass one: hash every call and frame of a trace, without decoding the calls
+static void hashTrace(TraceHashes &trace)
+{
+    common::InFile file;
+    file.prepareChunks();
+    if (!file.Open(trace.filename.c_str()))
+    {
+        DBG_LOG("Failed to open for reading: %s\n", trace.filename.c_str());
+        return;
+    }
+
+    // Trace file ids depend on the sigbook, so functions are hashed by name
+    std::vector<uint64_t> funcHashes(file.GetMaxSigId() + 1, 0);
+    for (unsigned short id = 1; id <= file.GetMaxSigId(); ++id)
+    {
+        funcHashes[id] = hashBytes(file.ExIdToName(id), strlen(file.ExIdToName(id)), 0);
+    }
+    const int tid = file.getDefaultThreadID();
+    const unsigned short swapId = file.NameToExId("eglSwapBuffers");
+    const unsigned short swapWithDamageId = file.NameToExId("eglSwapBuffersWithDamageKHR");
+
+    FrameHash frame = { 0, 0, 0 };
+    void *fptr = NULL;
+    char *src = NULL;
+    common::BCall_vlen call;
+    while (file.GetNextCall(fptr, call, src))
+    {
+        const int fixedLen = file.ExIdToLen(call.funcId);
+        const size_t len = fixedLen ? fixedLen - sizeof(common::BCall) : call.toNext - sizeof(common::BCall_vlen);
+        const uint64_t hash = hashBytes(src, len, funcHashes[call.funcId]);
+        trace.calls.push_back(hash);
+        frame.hash = hashBytes(reinterpret_cast<const char*>(&hash), sizeof(hash), frame.hash);
+        frame.callCount++;
+
+        if ((int)call.tid == tid && (call.funcId == swapId || call.funcId == swapWithDamageId))
+        {
+            trace.frames.push_back(frame);
+            frame.firstCall = trace.calls.size();
+            frame.callCount = 0;
+            frame.hash = 0;
+        }
+    }
+    if (frame.callCount > 0)
+    {
+        trace.frames.push_back(frame);
+    }
+    file.Close();
+    trace.ok = true;
+}
+
+// Index pairs of a longest common subsequence of a and b, found with
+// Myers' O((N+M)D) algorithm. If there are more than maxEdits insertions
+// and deletions, only the common start and end are matched and false is
+// returned.
+static bool commonSubsequence(const std::vector<uint64_t> &a, const std::vector<uint64_t> &b, size_t maxEdits, std::vector<std::pair<size_t, size_t> > &matches)
+{
+    const long n = a.size();
+    const long m = b.size();
+    const long max = std::min<long>(n + m, maxEdits);
+    std::vector<int> v(2 * max + 3, 0); // v[offset + k] is the furthest x on diagonal k
+    const long offset = max + 1;
+    std::vector<std::vector<int> > trace; // v[-d-1 .. d+1] at the start of each step d
+    matches.clear();
+
+    for (long d = 0; d <= max; ++d)
+    {
+        trace.push_back(std::vector<int>(v.begin() + offset - d - 1, v.begin() + offset + d + 2));
+        for (long k = -d; k <= d; k += 2)
+        {
+            long x = (k == -d || (k != d && v[offset + k - 1] < v[offset + k + 1])) ? v[offset + k + 1] : v[offset + k - 1] + 1;
+            long y = x - k;
+            while (x < n && y < m && a[x] == b[y])
+            {
+                x++;
+                y++;
+            }
+            v[offset + k] = x;
+            if (x >= n && y >= m)
+            {
+                // Walk back through the steps to collect the diagonals
+                x = n;
+                y = m;
+                for (long e = d; e >= 0; --e)
+                {
+                    const std::vector<int> &w = trace[e];
+                    const long k2 = x - y;
+                    const long prevK = (k2 == -e || (k2 != e && w[k2 - 1 + e + 1] < w[k2 + 1 + e + 1])) ? k2 + 1 : k2 - 1;
+                    const long prevX = (e == 0) ? 0 : w[prevK + e + 1];
+                    const long prevY = (e == 0) ? 0 : prevX - prevK;
+                    while (x > prevX && y > prevY)
+                    {
+                        matches.push_back(std::make_pair(x - 1, y - 1));
+                        x--;
+                        y--;
+                    }
+                    x = prevX;
+                    y = prevY;
+                }
+                std::reverse(matches.begin(), matches.end());
+                return true;
+            }
+        }
+    }
+
+    size_t head = 0;
+    while (head < a.size() && head < b.size() && a[head] == b[head])
+    {
+        matches.push_back(std::make_pair(head, head));
+        head++;
+    }
+    size_t tail = 0;
+    while (tail < a.size() - head && tail < b.size() - head && a[a.size() - tail - 1] == b[b.size() - tail - 1])
+    {
+        tail++;
+    }
+    for (size_t i = tail; i > 0; --i)
+    {
+        matches.push_back(std::make_pair(a.size() - i, b.size() - i));
+    }
+    return false;
+}
+
+// A run of calls that differ, [aBegin, aEnd) in A against [bBegin, bEnd) in B
+struct Hunk
+{
+    unsigned int aBegin, aEnd, bBegin, bEnd;
+};
+
+// The differing runs of calls of two frames
+static std::vector<Hunk> diffFrames(const TraceHashes &a, const FrameHash &fa, const TraceHashes &b, const FrameHash &fb)
+{
+    const std::vector<uint64_t> ca(a.calls.begin() + fa.firstCall, a.calls.begin() + fa.firstCall + fa.callCount);
+    const std::vector<uint64_t> cb(b.calls.begin() + fb.firstCall, b.calls.begin() + fb.firstCall + fb.callCount);
+    std::vector<std::pair<size_t, size_t> > matches;
+    commonSubsequence(ca, cb, 2000, matches);
+    matches.push_back(std::make_pair(ca.size(), cb.size())); // sentinel
+
+    std::vector<Hunk> hunks;
+    size_t i = 0, j = 0;
+    for (const auto &match : matches)
+    {
+        if (match.first > i || match.second > j)
+        {
+            Hunk hunk = { unsigned(fa.firstCall + i), unsigned(fa.firstCall + match.first),
+                          unsigned(fb.firstCall + j), unsigned(fb.firstCall + match.second) };
+            hunks.push_back(hunk);
+        }
+        i = match.first + 1;
+        j = match.second + 1;
+    }
+    return hunks;
+}
+
+// Pass two: decode the given calls, sorted by number, into text
+static void decodeCalls(const std::string &filename, const std::vector<unsigned int> &callNos, std::map<unsigned int, std::string> &texts)
+{
+    if (callNos.empty())
+    {
+        return;
+    }
+    common::InFile file;
+    file.prepareChunks();
+    if (!file.Open(filename.c_str()))
+    {
+        DBG_LOG("Failed to open for reading: %s\n", filename.c_str());
+        return;
+    }
+    auto next = callNos.begin();
+    unsigned int callNo = 0;
+    void *fptr = NULL;
+    char *src = NULL;
+    common::BCall_vlen call;
+    while (next != callNos.end() && file.GetNextCall(fptr, call, src))
+    {
+        if (callNo == *next)
+        {
+            if (fptr)
+            {
+                common::CallTM callTM(file, callNo, call);
+                texts[callNo] = callTM.ToStr(false);
+            }
+            else
+            {
+                texts[callNo] = file.ExIdToName(call.funcId);
+            }
+            ++next;
+        }
+        callNo++;
+    }
+    file.Close();
+}
+
+// The calls of a hunk on one side, listed up to a limit
+static Json::Value listCalls(unsigned int begin, unsigned int end, unsigned int limit, const std::map<unsigned int, std::string> &texts)
+{
+    Json::Value list = Json::arrayValue;
+    for (unsigned int callNo = begin; callNo < end && callNo < begin + limit; ++callNo)
+    {
+        Json::Value entry;
+        entry["call"] = callNo;
+        const auto it = texts.find(callNo);
+        if (it != texts.end())
+        {
+            entry["text"] = it->second;
+        }
+        list.append(entry);
+    }
+    return list;
+}
+
+int main(int argc, char **argv)
+{
+    std::string reportFilename;
+    unsigned int maxFrames = 20;
+    unsigned int maxCalls = 50;
+
+    int argIndex = 1;
+    for (; argIndex < argc; ++argIndex)
+    {
+        const char *arg = argv[argIndex];
+
+        if (arg[0] != '-')
+            break;
+
+        if (!strcmp(arg, "-h"))
+        {
+            printHelp();
+            return 1;
+        }
+        else if (!strcmp(arg, "-v"))
+        {
+            printVersion();
+            return 1;
+        }
+        else if (!strcmp(arg, "-o") && argIndex + 1 < argc)
+        {
+            reportFilename = argv[++argIndex];
+        }
+        else if (!strcmp(arg, "-f") && argIndex + 1 < argc)
+        {
+            maxFrames = atoi(argv[++argIndex]);
+        }
+        else if (!strcmp(arg, "-l") && argIndex + 1 < argc)
+        {
+            maxCalls = atoi(argv[++argIndex]);
+        }
+        else
+        {
+            printf("Error: Unknow option %s\n", arg);
+            printHelp();
+            return 1;
+        }
+    }
+
+    if (argIndex + 2 > argc)
+    {
+        printHelp();
+        return 1;
+    }
+    TraceHashes a, b;
+    a.filename = argv[argIndex++];
+    b.filename = argv[argIndex++];
+
+    common::gApiInfo.RegisterEntries(common::parse_callbacks);
+
+    // The traces are read and hashed at the same time
+    std::thread hashA(hashTrace, std::ref(a));
+    hashTrace(b);
+    hashA.join();
+    if (!a.ok || !b.ok)
+    {
+        return 1;
+    }
+
+    // Align the frames by their hashes. Frames between two matches that
+    // cannot be aligned are paired up in order, the rest are added or removed.
+    std::vector<uint64_t> fa, fb;
+    for (const FrameHash &frame : a.frames) fa.push_back(frame.hash);
+    for (const FrameHash &frame : b.frames) fb.push_back(frame.hash);
+    std::vector<std::pair<size_t, size_t> > matches;
+    commonSubsequence(fa, fb, 4000, matches);
+    matches.push_back(std::make_pair(fa.size(), fb.size())); // sentinel
+
+    struct FrameDiff
+    {
+        int frameA, frameB; // -1 if the frame is missing from that trace
+        std::vector<Hunk> hunks;
+    };
+    std::vector<FrameDiff> diffs;
+    unsigned int equalFrames = 0;
+    size_t i = 0, j = 0;
+    for (const auto &match : matches)
+    {
+        const size_t gapA = match.first - i;
+        const size_t gapB = match.second - j;
+        for (size_t p = 0; p < std::max(gapA, gapB); ++p)
+        {
+            FrameDiff diff;
+            diff.frameA = (p < gapA) ? int(i + p) : -1;
+            diff.frameB = (p < gapB) ? int(j + p) : -1;
+            if (diff.frameA >= 0 && diff.frameB >= 0 && diffs.size() < maxFrames)
+            {
+                diff.hunks = diffFrames(a, a.frames[i + p], b, b.frames[j + p]);
+            }
+            diffs.push_back(diff);
+        }
+        if (match.first < fa.size())
+        {
+            equalFrames++;
+        }
+        i = match.first + 1;
+        j = match.second + 1;
+    }
+
+    // Decode only the listed calls of the differing frames
+    std::vector<unsigned int> callsA, callsB;
+    for (const FrameDiff &diff : diffs)
+    {
+        for (const Hunk &hunk : diff.hunks)
+        {
+            for (unsigned int c = hunk.aBegin; c < hunk.aEnd && c < hunk.aBegin + maxCalls; ++c) callsA.push_back(c);
+            for (unsigned int c = hunk.bBegin; c < hunk.bEnd && c < hunk.bBegin + maxCalls; ++c) callsB.push_back(c);
+        }
+    }
+    std::map<unsigned int, std::string> textsA, textsB;
+    std::thread decodeA(decodeCalls, std::cref(a.filename), std::cref(callsA), std::ref(textsA));
+    decodeCalls(b.filename, callsB, textsB);
+    decodeA.join();
+
+    Json::Value report;
+    const TraceHashes *traces[2] = { &a, &b };
+    const char *names[2] = { "a", "b" };
+    for (int t = 0; t < 2; ++t)
+    {
+        report[names[t]]["file"] = traces[t]->filename;
+        report[names[t]]["calls"] = (Json::Value::UInt)traces[t]->calls.size();
+        report[names[t]]["frames"] = (Json::Value::UInt)traces[t]->frames.size();
+    }
+    unsigned int changed = 0, removed = 0, added = 0;
+    report["frames"] = Json::arrayValue;
+    for (const FrameDiff &diff : diffs)
+    {
+        Json::Value frame;
+        if (diff.frameA >= 0 && diff.frameB >= 0)
+        {
+            frame["status"] = "changed";
+            changed++;
+        }
+        else if (diff.frameA >= 0)
+        {
+            frame["status"] = "removed";
+            removed++;
+        }
+        else
+        {
+            frame["status"] = "added";
+            added++;
+        }
+        if (diff.frameA >= 0)
+        {
+            frame["frame_a"] = diff.frameA;
+            frame["first_call_a"] = a.frames[diff.frameA].firstCall;
+        }
+        if (diff.frameB >= 0)
+        {
+            frame["frame_b"] = diff.frameB;
+            frame["first_call_b"] = b.frames[diff.frameB].firstCall;
+        }
+        for (const Hunk &hunk : diff.hunks)
+        {
+            Json::Value h;
+            h["a_calls"] = hunk.aEnd - hunk.aBegin;
+            h["b_calls"] = hunk.bEnd - hunk.bBegin;
+            h["a"] = listCalls(hunk.aBegin, hunk.aEnd, maxCalls, textsA);
+            h["b"] = listCalls(hunk.bBegin, hunk.bEnd, maxCalls, textsB);
+            frame["hunks"].append(h);
+        }
+        report["frames"].append(frame);
+    }
+    report["summary"]["identical"] = diffs.empty();
+    report["summary"]["equal_frames"] = equalFrames;
+    report["summary"]["changed_frames"] = changed;
+    report["summary"]["removed_frames"] = removed;
+    report["summary"]["added_frames"] = added;
+    if (!diffs.empty())
+    {
+        report["summary"]["first_difference"] = report["frames"][0];
+        report["summary"]["first_difference"].removeMember("hunks");
+    }
+
+    const std::string text = report.toStyledString();
+    if (reportFilename.empty())
+    {
+        std::cout << text;
+    }
+    else
+    {
+        std::ofstream fs(reportFilename.c_str(), std::ofstream::out | std::ofstream::trunc);
+        if (!fs)
+        {
+            DBG_LOG("Failed to open for writing: %s\n", reportFilename.c_str());
+            return 1;
+        }
+        fs << text;
+    }
+    DBG_LOG("%u equal, %u changed, %u removed, %u added frames\n", equalFrames, changed, removed, added);
+    return (changed || removed || added) ? 1 : 0;
+}
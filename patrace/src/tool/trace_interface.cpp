@@ -8,6 +8,7 @@
 #include "common/out_file.hpp"
 #include "common/api_info.hpp"
 #include "common/parse_api.hpp"
+#include "common/selective_reader.hpp"
 #include "common/trace_model.hpp"
 
 using namespace common;
@@ -222,7 +223,7 @@ class PATInputFile : public InputFileInterface
 {
 public:
     PATInputFile()
-    : _fileTM(new TraceFileTM),
+    : _fileTM(new TraceFileTM), _selective(NULL),
       _filepath(NULL), _curFrame(NULL),
       _curFrameIndex(0), _curCallIndexInFrame(0)
     {
@@ -230,13 +231,27 @@ public:
     ~PATInputFile()
     {
         close();
+        delete _selective;
         delete _fileTM;
     }
 
+    virtual void select_calls(const std::vector<std::string> &names)
+    {
+        delete _selective;
+        _selective = new common::SelectiveReader;
+        for (const std::string &name : names)
+        {
+            _selective->Select(name.c_str());
+        }
+    }
+
     virtual bool open(const char *filepath)
     {
         common::gApiInfo.RegisterEntries(common::parse_callbacks);
         _filepath = filepath;
+        // Stream the trace and skip the other calls, instead of unpacking it for random access
+        if (_selective)
+            return _selective->Open(_filepath);
         if(!_fileTM->Open(_filepath, false))
             return false;
         _curFrame = _fileTM->mFrames[_curFrameIndex];
@@ -251,6 +266,11 @@ public:
 
     virtual bool reset()
     {
+        if (_selective)
+        {
+            _selective->Close();
+            return _selective->Open(_filepath);
+        }
         _curFrameIndex = 0;
         if (_curFrame) _curFrame->UnloadCalls();
         _curFrame = _fileTM->mFrames[_curFrameIndex];
@@ -261,6 +281,12 @@ public:
 
     virtual CallInterface * next_call() const
     {
+        if (_selective)
+        {
+            // Owned by the reader, valid until the next call is read
+            common::CallTM *call = _selective->NextCall();
+            return call ? new PATCall(call) : NULL;
+        }
         if (_curCallIndexInFrame >= _curFrame->GetLoadedCallCount())
         {
             _curFrameIndex++;
@@ -281,16 +307,21 @@ public:
 
     virtual unsigned int header_version() const
     {
+        if (_selective)
+            return _selective->File().getHeaderVersion() - common::HEADER_VERSION_1 + 1;
         return _fileTM->mpInFileRA->getHeaderVersion() - common::HEADER_VERSION_1 + 1;
     }
 
     virtual const std::string json_header() const
     {
+        if (_selective)
+            return _selective->File().getJSONHeaderAsString();
         return _fileTM->mpInFileRA->getJSONHeaderAsString();
     }
 
 private:
     common::TraceFileTM *_fileTM;
+    common::SelectiveReader *_selective; // set when only some calls are read
     const char *_filepath;
     mutable common::FrameTM *_curFrame;
     mutable UInt32 _curFrameIndex;
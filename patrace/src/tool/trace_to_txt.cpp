@@ -1,12 +1,30 @@
 #include <errno.h>
 #include <stdio.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <common/api_info.hpp>
 #include <common/parse_api.hpp>
 #include <common/trace_model.hpp>
 #include <tool/config.hpp>
 
 const unsigned int MAX_CYCLE = 1000000;
+const size_t BATCH_CALLS = 4096; // calls formatted by a thread at a time
+const size_t MAX_BATCHES_AHEAD = 4; // per thread, formatted but not written yet
+
+// A call to print, with what the prefix of its line needs
+struct Line
+{
+    common::CallTM* call;
+    int frame;
+    int drawCallNum; // -1 if not printed
+};
 
 bool fileExists(const char* filename) {
     std::ifstream file(filename);
@@ -25,6 +43,7 @@ void usage(const char *argv0)
         "  -r Print frame number\n"
         "  -f <f> <l> Define frame interval, inclusive\n"
         "  -tid <thread_id> The function calls invoked by thread <thread_id> will be printed\n"
+        "  -j <threads> Format the calls on <threads> threads, the output is the same (default 1)\n"
         "\n"
         , argv0);
 }
@@ -59,6 +78,93 @@ bool isDrawCall(const std::string &funcName)
         return false;
 }
 
+static void formatLines(std::string& text, const std::vector<Line>& lines, size_t first, size_t last, bool printFrameNum)
+{
+    char prefix[64];
+    for (size_t i = first; i < last; ++i)
+    {
+        const Line& line = lines[i];
+        int len = snprintf(prefix, sizeof(prefix), "[%d]", line.call->mTid);
+        if (printFrameNum)
+        {
+            len += snprintf(prefix + len, sizeof(prefix) - len, " [f:%d]", line.frame);
+        }
+        if (line.drawCallNum >= 0)
+        {
+            len += snprintf(prefix + len, sizeof(prefix) - len, " [d:%d]", line.drawCallNum);
+        }
+        snprintf(prefix + len, sizeof(prefix) - len, " %d : ", line.call->mCallNo);
+        text += prefix;
+        text += line.call->ToStr(false);
+        text += '\n';
+    }
+}
+
+// Format the lines in batches on a pool of threads. Each batch is written
+// as soon as it and all batches before it are done, so the output is in
+// call order.
+static void writeLines(FILE* fp, const std::vector<Line>& lines, unsigned int threads, bool printFrameNum)
+{
+    const size_t batches = (lines.size() + BATCH_CALLS - 1) / BATCH_CALLS;
+    if (threads <= 1 || batches <= 1)
+    {
+        std::string text;
+        formatLines(text, lines, 0, lines.size(), printFrameNum);
+        fwrite(text.data(), 1, text.size(), fp);
+        return;
+    }
+
+    std::vector<std::string> texts(batches);
+    std::vector<bool> done(batches, false);
+    size_t written = 0;
+    std::atomic<size_t> next(0);
+    std::mutex mutex;
+    std::condition_variable cond;
+
+    auto work = [&]()
+    {
+        for (size_t batch = next++; batch < batches; batch = next++)
+        {
+            {
+                // Do not get too far ahead of the writer
+                std::unique_lock<std::mutex> lock(mutex);
+                cond.wait(lock, [&]() { return batch < written + threads * MAX_BATCHES_AHEAD; });
+            }
+            std::string text;
+            const size_t first = batch * BATCH_CALLS;
+            formatLines(text, lines, first, std::min(first + BATCH_CALLS, lines.size()), printFrameNum);
+            std::lock_guard<std::mutex> lock(mutex);
+            texts[batch].swap(text);
+            done[batch] = true;
+            cond.notify_all();
+        }
+    };
+    std::vector<std::thread> pool;
+    for (unsigned int i = 0; i < threads; ++i)
+    {
+        pool.emplace_back(work);
+    }
+
+    for (size_t batch = 0; batch < batches; ++batch)
+    {
+        std::string text;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cond.wait(lock, [&]() { return done[batch]; });
+            text.swap(texts[batch]);
+        }
+        fwrite(text.data(), 1, text.size(), fp);
+        std::lock_guard<std::mutex> lock(mutex);
+        written++;
+        cond.notify_all();
+    }
+
+    for (std::thread& thread : pool)
+    {
+        thread.join();
+    }
+}
+
 int main(int argc, const char* argv[])
 {
     if (argc < 2)
@@ -73,6 +179,7 @@ int main(int argc, const char* argv[])
     bool printDrawCallNum = false;
     bool printFrameNum = false;
     int tid = -1;
+    unsigned int threads = 1;
     for (int i = 1; i < argc; ++i)
     {
         const char *arg = argv[i];
@@ -116,6 +223,16 @@ int main(int argc, const char* argv[])
                 return -1;
             }
         }
+        else if (!strcmp(arg, "-j"))
+        {
+            const int value = readValidValue(argv[++i]);
+            if (value < 1)
+            {
+                DBG_LOG("Error: number of threads must be at least one.\n");
+                return -1;
+            }
+            threads = value;
+        }
         else
         {
             DBG_LOG("Error: Unknown option %s\n", arg);
@@ -143,7 +260,21 @@ int main(int argc, const char* argv[])
     int beginFrame = 0;
     int endFrame = inputFile.mFrames.size();
     int drawCallNum = 0;
-
+    std::vector<Line> lines; // of the loaded calls
+    std::vector<common::FrameTM*> loadedFrames;
+    unsigned int loadedCalls = 0;
+    // Write the lines of the loaded calls, then unload them
+    auto flush = [&]()
+    {
+        writeLines(fp, lines, threads, printFrameNum);
+        lines.clear();
+        for (common::FrameTM* frame : loadedFrames)
+        {
+            frame->UnloadCalls();
+        }
+        loadedFrames.clear();
+        loadedCalls = 0;
+    };
 
     for (int fr = beginFrame; fr != endFrame; ++fr)
     {
@@ -163,7 +294,7 @@ int main(int argc, const char* argv[])
             {
                 if(ca != 0)
                 {
-                    curFrame.UnloadCalls();
+                    flush();
                 }
 
                 if(frameCallNum - ca > MAX_CYCLE)
@@ -175,23 +306,26 @@ int main(int argc, const char* argv[])
                 {
                     curFrame.LoadCallsForTraceToTxt(inputFile.mpInFileRA, frameCallNum - ca, cycleNum, MAX_CYCLE);
                 }
+                loadedFrames.push_back(&curFrame);
+                loadedCalls += curFrame.mCalls.size();
             }
 
             common::CallTM& curCall = *curFrame.mCalls[ca % MAX_CYCLE];
             if (tid >= 0 && (int)curCall.mTid != tid)
                 continue;
-            fprintf(fp, "[%d]", curCall.mTid);
-            if (printFrameNum)
-            {
-                fprintf(fp, " [f:%d]", fr);
-            }
+            int lineDrawCallNum = -1;
             if (printDrawCallNum && isDrawCall(curCall.Name()))
             {
-                fprintf(fp, " [d:%d]", drawCallNum++);
+                lineDrawCallNum = drawCallNum++;
             }
-            fprintf(fp, " %d : %s\n", curCall.mCallNo, curCall.ToStr(false).c_str());
+            lines.push_back({ &curCall, fr, lineDrawCallNum });
+        }
+        // Small frames are formatted together, so that there are enough calls for all threads
+        if (loadedCalls >= MAX_CYCLE)
+        {
+            flush();
         }
-        curFrame.UnloadCalls();
     }
+    flush();
     fclose(fp);
 }
@@ -5,6 +5,7 @@
 
 enum {
     FrameCallTree_id = wxID_HIGHEST+1,
+    CallLoader_id,
     ToolBar_id,
     CallDetail_id,
 };
@@ -0,0 +1,104 @@
+#include "call_loader.h"
+
+CallLoader::CallLoader(TraceFileTM &traceFile, const std::function<void()> &notify)
+: mTraceFile(traceFile),
+  mNotify(notify),
+  mQuit(false),
+  mGeneration(0)
+{
+    mThread = std::thread(&CallLoader::Run, this);
+}
+
+CallLoader::~CallLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mQuit = true;
+        mGeneration++;
+    }
+    mWakeUp.notify_one();
+    mThread.join();
+    Cancel();
+}
+
+void CallLoader::Request(const std::vector<CallIndexEntry> &calls)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mGeneration++;
+        mPending = calls;
+    }
+    mWakeUp.notify_one();
+}
+
+void CallLoader::Cancel()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mGeneration++;
+    mPending.clear();
+    for (unsigned int i = 0; i < mLoaded.size(); ++i)
+        delete mLoaded[i].mpCallTM;
+    mLoaded.clear();
+}
+
+void CallLoader::TakeLoaded(std::vector<LoadedCall> &calls)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    calls.insert(calls.end(), mLoaded.begin(), mLoaded.end());
+    mLoaded.clear();
+}
+
+void CallLoader::Run()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (!mQuit)
+    {
+        if (mPending.empty())
+        {
+            mWakeUp.wait(lock);
+            continue;
+        }
+
+        std::vector<CallIndexEntry> calls;
+        calls.swap(mPending);
+        const unsigned int generation = mGeneration;
+
+        for (unsigned int i = 0; i < calls.size() && generation == mGeneration; ++i)
+        {
+            lock.unlock();
+
+            LoadedCall loaded;
+            loaded.mpCallTM = new CallTM;
+            bool ok = false;
+            {
+                std::lock_guard<std::mutex> fileLock(mFileMutex);
+                // The view cancels before it opens another file, which may
+                // have happened while waiting for the file, then the read
+                // position is from the old file
+                if (generation == mGeneration)
+                {
+                    mTraceFile.mpInFileRA->SetReadPos(calls[i].mReadPos);
+                    ok = loaded.mpCallTM->Load(mTraceFile.mpInFileRA);
+                }
+            }
+            if (ok)
+            {
+                loaded.mpCallTM->mCallNo = calls[i].mCallNo;
+                loaded.mText = loaded.mpCallTM->ToStr();
+            }
+
+            lock.lock();
+            // A newer request may have come in while decoding, the view does not want this call anymore
+            if (!ok || generation != mGeneration)
+            {
+                delete loaded.mpCallTM;
+                continue;
+            }
+
+            // The view takes all calls at once, so one notification per batch it has not taken yet is enough
+            mLoaded.push_back(loaded);
+            if (mLoaded.size() == 1)
+                mNotify();
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#ifndef _TRACEVIEW_CALL_LOADER_H_
+#define _TRACEVIEW_CALL_LOADER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <common/trace_model.hpp>
+
+using namespace common;
+
+struct LoadedCall
+{
+    CallTM*         mpCallTM;
+    std::string     mText;
+};
+
+// Decodes calls of the trace file on a background thread, so that the view
+// only has to decode the calls it shows, and never waits for them.
+//
+// The random access file has a single read position, so everybody else who
+// reads from TraceFileTM::mpInFileRA must hold FileMutex() while doing so.
+class CallLoader
+{
+public:
+    // notify is called on the loader thread whenever there are new calls to take
+    CallLoader(TraceFileTM &traceFile, const std::function<void()> &notify);
+    ~CallLoader();
+
+    // Replaces the calls still waiting from the previous request, which is how
+    // loading is cancelled when the view moves on
+    void Request(const std::vector<CallIndexEntry> &calls);
+    // Also drops the calls decoded but not taken yet
+    void Cancel();
+    // The caller owns the calls it takes
+    void TakeLoaded(std::vector<LoadedCall> &calls);
+
+    std::mutex& FileMutex() { return mFileMutex; }
+
+private:
+    void Run();
+
+    TraceFileTM&                    mTraceFile;
+    std::function<void()>           mNotify;
+    std::mutex                      mFileMutex;
+
+    // Guarded by mMutex
+    std::mutex                      mMutex;
+    std::condition_variable         mWakeUp;
+    std::vector<CallIndexEntry>     mPending;
+    std::vector<LoadedCall>         mLoaded;
+    bool                            mQuit;
+
+    // Changed under mMutex, but also read while holding just mFileMutex
+    std::atomic<unsigned int>       mGeneration;
+
+    std::thread                     mThread;
+};
+
+#endif
@@ -1,255 +1,502 @@
 #include <GLES2/gl2.h>
 
+#include <algorithm>
+
 #include <ui/frame_call_tree.h>
 #include <ui/texture_frame.hpp>
 
+// How many pages of calls above and below the visible ones are decoded ahead
+static const long PREFETCH_PAGES = 2;
+
 // Order of event procession:
 // 1. When single click of left button happens:
-//     Only EVT_TREE_SEL_CHANGED event is emitted;
+//     Only EVT_LIST_ITEM_SELECTED event is emitted;
 // 2. When double clicks of left button happens:
-//     EVT_TREE_SEL_CHANGED is emitted before EVT_LEFT_DCLICK
-BEGIN_EVENT_TABLE(FrameCallTree, wxTreeCtrl)
-    EVT_TREE_ITEM_EXPANDING(FrameCallTree_id, FrameCallTree::OnItemExpanding)
-    EVT_TREE_ITEM_COLLAPSING(FrameCallTree_id, FrameCallTree::OnItemCollapsing)
-    EVT_TREE_SEL_CHANGED(FrameCallTree_id, FrameCallTree::OnSelChanged)
-    EVT_LEFT_DCLICK(FrameCallTree::OnLeftDoubleClick)
+//     EVT_LIST_ITEM_SELECTED is emitted before EVT_LIST_ITEM_ACTIVATED
+BEGIN_EVENT_TABLE(FrameCallTree, wxListCtrl)
+    EVT_LIST_ITEM_SELECTED(FrameCallTree_id, FrameCallTree::OnItemSelected)
+    EVT_LIST_ITEM_ACTIVATED(FrameCallTree_id, FrameCallTree::OnItemActivated)
+    EVT_LIST_KEY_DOWN(FrameCallTree_id, FrameCallTree::OnKeyDown)
+    EVT_SIZE(FrameCallTree::OnSize)
+    EVT_IDLE(FrameCallTree::OnIdle)
+    EVT_THREAD(CallLoader_id, FrameCallTree::OnCallsLoaded)
 END_EVENT_TABLE()
 
-
+static bool CallNoLess(const CallIndexEntry& entry, unsigned int callNo)
+{
+    return entry.mCallNo < callNo;
+}
 
 FrameCallTree::FrameCallTree(MainFrame* mainFrame, wxWindow *parent, const wxWindowID id,
     const wxPoint& pos, const wxSize& size,
     long style)
-    : wxTreeCtrl(parent, id, pos, size, style),
-      mpCurSel(NULL),
-      mpMainFrame(mainFrame)
+    : wxListCtrl(parent, id, pos, size, style),
+      mpMainFrame(mainFrame),
+      mpLoader(NULL),
+      mRowCount(0),
+      mWindowBegin(0),
+      mWindowEnd(0),
+      mRequestedTop(-1),
+      mRequestedCount(-1),
+      mRequestedCalls(0),
+      mArrivedCalls(0),
+      mCurFrame(-1),
+      mCurCall(-1)
 {
+    InsertColumn(0, wxT(""));
 
+    // Called on the loader thread, wxQueueEvent is the thread safe way to get back to the UI thread
+    mpLoader = new CallLoader(mpMainFrame->mTraceFile, [this]() {
+        wxQueueEvent(this, new wxThreadEvent(wxEVT_THREAD, CallLoader_id));
+    });
 }
 
 FrameCallTree::~FrameCallTree()
 {
-
+    delete mpLoader;
+    ClearLoadedCalls();
 }
 
 bool FrameCallTree::LoadFrames(const wxString &filepath)
 {
-    if (mpMainFrame->mTraceFile.Open(filepath.ToAscii()) == false)
-        return false;
+    mpLoader->Cancel();
+    ClearLoadedCalls();
+    mCurFrame = -1;
+    mCurCall = -1;
 
-    mpCurSel = new FrameCallItemData(RootItem);
-    wxTreeItemId rootId = AddRoot(wxT(""), -1, -1, mpCurSel);
-    SetItemText(rootId, filepath);
+    bool opened = false;
+    {
+        std::lock_guard<std::mutex> lock(mpLoader->FileMutex());
+        opened = mpMainFrame->mTraceFile.Open(filepath.ToAscii());
+    }
+    UpdateRows();
+    return opened;
+}
 
-    wxString wsStr;
-    wxTreeItemId frameId;
+unsigned int FrameCallTree::GetCurrentCallNo()
+{
+    if (mCurFrame < 0)
+        return 0;
+    if (mCurCall >= 0)
+        return mCurCall;
+    return mpMainFrame->mTraceFile.mFrames[mCurFrame]->mFirstCallOfThisFrame;
+}
+
+void FrameCallTree::SelectCall(unsigned int callNo)
+{
+    int frIdx = mpMainFrame->mTraceFile.GetFrameIdx(callNo);
+    if (frIdx == -1)
+        return;
 
+    if (!mpMainFrame->mTraceFile.mFrames[frIdx]->IsIndexed())
+        ExpandFrame(frIdx);
 
+    // Calls hidden by the display filters cannot be selected
+    const long row = CallRow(frIdx, callNo);
+    if (row != -1)
+        SelectRow(row);
+}
+
+unsigned int FrameCallTree::FindNext(unsigned int callNo, const char* pattern)
+{
+    std::lock_guard<std::mutex> lock(mpLoader->FileMutex());
+    return mpMainFrame->mTraceFile.FindNext(callNo, pattern);
+}
+
+unsigned int FrameCallTree::FindPrevious(unsigned int callNo, const char* pattern)
+{
+    std::lock_guard<std::mutex> lock(mpLoader->FileMutex());
+    return mpMainFrame->mTraceFile.FindPrevious(callNo, pattern);
+}
+
+void FrameCallTree::ReloadLoadedFrames()
+{
+    mpLoader->Cancel();
+    ClearLoadedCalls();
 
-    for (unsigned int fNo = 0;
-        fNo < mpMainFrame->mTraceFile.mFrames.size();
-        ++fNo)
     {
-        wsStr.Printf(wxT("Frame %d (call num: %d) (size: %dk)"), fNo,
-            mpMainFrame->mTraceFile.mFrames[fNo]->GetCallCount(), mpMainFrame->mTraceFile.mFrames[fNo]->mBytes/1024+1);
-        FrameCallItemData* newFrameData = new FrameCallItemData(FrameItem);
-        newFrameData->mpFrameTM = mpMainFrame->mTraceFile.mFrames[fNo];
-        frameId = AppendItem(rootId, wxT(""), -1, -1, newFrameData);
-        SetItemHasChildren(frameId, true);
-        SetItemText(frameId, wsStr);        
+        std::lock_guard<std::mutex> lock(mpLoader->FileMutex());
+        TraceFileTM& traceFile = mpMainFrame->mTraceFile;
+        for (unsigned int fNo = 0; fNo < traceFile.mFrames.size(); ++fNo)
+        {
+            if (traceFile.mFrames[fNo]->IsIndexed())
+            {
+                traceFile.mFrames[fNo]->IndexCalls(
+                    traceFile.mpInFileRA,
+                    traceFile.GetLoadQueryCalls(),
+                    traceFile.GetLoadFilter());
+            }
+        }
     }
 
-    return true;
+    UpdateRows();
 }
 
-unsigned int FrameCallTree::GetCurrentCallNo()
+wxString FrameCallTree::OnGetItemText(long item, long column) const
 {
-    if (!mpCurSel)
-        return 0;
+    int call = -1;
+    const unsigned int frame = RowFrame(item, call);
+    const FrameTM* frameTM = mpMainFrame->mTraceFile.mFrames[frame];
 
-    switch (mpCurSel->mType) {
-    case FrameItem:
-        return mpCurSel->mpFrameTM->mFirstCallOfThisFrame;
-    case CallItem:
-        return mpCurSel->mpCallTM->mCallNo;
-    default:
-        return 0;
+    wxString wsStr;
+    if (call < 0)
+    {
+        wsStr.Printf(wxT("%s Frame %d (call num: %d) (size: %dk)"), frameTM->IsIndexed() ? wxT("-") : wxT("+"),
+            frame, frameTM->GetCallCount(), frameTM->mBytes/1024+1);
+        return wsStr;
+    }
+
+    // use sprintf instead of wxString.Printf because it doesnt support %s for c_str or std::string
+    const size_t bufSize = 512;
+    char buffer[bufSize];
+    const CallIndexEntry& entry = frameTM->mCallIndex[call];
+    std::map<unsigned int, LoadedCall>::const_iterator it = mLoadedCalls.find(entry.mCallNo);
+    if (it != mLoadedCalls.end())
+    {
+        snprintf(buffer, bufSize, "    [%d][%d] %s", entry.mTid, entry.mCallNo, it->second.mText.c_str());
     }
+    else
+    {
+        // Not decoded yet, but the index knows the name
+        snprintf(buffer, bufSize, "    [%d][%d] %s(...)", entry.mTid, entry.mCallNo,
+            mpMainFrame->mTraceFile.mpInFileRA->ExIdToName(entry.mFuncId));
+    }
+    wsStr = wxString::FromAscii(buffer);
+    return wsStr;
 }
 
-void FrameCallTree::SelectCall(unsigned int callNo)
+wxListItemAttr* FrameCallTree::OnGetItemAttr(long item) const
 {
-    int frIdx = mpMainFrame->mTraceFile.GetFrameIdx(callNo);
-    if (frIdx == -1)
+    int call = -1;
+    const unsigned int frame = RowFrame(item, call);
+    if (call < 0)
+        return NULL;
+
+    const CallIndexEntry& entry = mpMainFrame->mTraceFile.mFrames[frame]->mCallIndex[call];
+    std::map<unsigned int, LoadedCall>::const_iterator it = mLoadedCalls.find(entry.mCallNo);
+    if (it == mLoadedCalls.end())
+    {
+        mAttr.SetBackgroundColour(*wxWHITE);
+        mAttr.SetTextColour(*wxLIGHT_GREY);
+        return &mAttr;
+    }
+
+    unsigned int bkc = it->second.mpCallTM->mBkColor;
+    unsigned int tc = it->second.mpCallTM->mTxtColor;
+    mAttr.SetBackgroundColour(wxColour(RED_COM(bkc), GREEN_COM(bkc), BLUE_COM(bkc)));
+    mAttr.SetTextColour(wxColour(RED_COM(tc), GREEN_COM(tc), BLUE_COM(tc)));
+    return &mAttr;
+}
+
+void FrameCallTree::OnItemSelected(wxListEvent& event)
+{
+    UpdateSelection(event.GetIndex());
+}
+
+void FrameCallTree::OnItemActivated(wxListEvent& event)
+{
+    int call = -1;
+    const unsigned int frame = RowFrame(event.GetIndex(), call);
+    FrameTM* frameTM = mpMainFrame->mTraceFile.mFrames[frame];
+
+    if (call < 0)
+    {
+        if (frameTM->IsIndexed())
+            CollapseFrame(frame);
+        else
+            ExpandFrame(frame);
         return;
+    }
 
-    wxTreeItemId rootId = GetRootItem();
+    const CallTM *callTM = GetCall(frameTM->mCallIndex[call]);
+    if (callTM && callTM->Name() == "glTexImage2D")
+    {
+        // Create a dummy image
+        const pat::Image image(640, 480, GL_RGB, GL_UNSIGNED_BYTE, 640 * 480 * 3, NULL);
 
-    wxTreeItemIdValue cockie;
-    wxTreeItemId frId = GetFirstChild(rootId, cockie);
-    for (int i = 0; i < frIdx; ++i)
-        frId = GetNextSibling(frId);
+        // Create a window to display the texture
+        TextureFrame *viewer = new TextureFrame(this, image);
+        viewer->Show(true);
+    }
+}
 
-    Expand(frId);
-    FrameCallItemData* pData = static_cast<FrameCallItemData*>(GetItemData(frId));
-    FrameTM* frameTM = pData->mpFrameTM;
+void FrameCallTree::OnKeyDown(wxListEvent& event)
+{
+    const long row = GetNextItem(-1, wxLIST_NEXT_ALL, wxLIST_STATE_SELECTED);
+    if (row == -1)
+    {
+        event.Skip();
+        return;
+    }
 
-    wxTreeItemId callId = GetFirstChild(frId, cockie);
-    for (unsigned int i = 0; i < frameTM->GetLoadedCallCount(); ++i) {
-        CallTM& callTM = *frameTM->mCalls[i];
-        if (callTM.mCallNo == callNo) {
-            SelectItem(callId, true);
-            break;
-        }
-        callId = GetNextSibling(callId);
+    int call = -1;
+    const unsigned int frame = RowFrame(row, call);
+    const bool expanded = mpMainFrame->mTraceFile.mFrames[frame]->IsIndexed();
+    switch (event.GetKeyCode())
+    {
+    case WXK_RIGHT:
+        if (!expanded)
+            ExpandFrame(frame);
+        break;
+    case WXK_LEFT:
+        if (expanded)
+            CollapseFrame(frame);
+        break;
+    default:
+        event.Skip();
+        break;
     }
+}
 
+void FrameCallTree::OnSize(wxSizeEvent& event)
+{
+    SetColumnWidth(0, GetClientSize().x);
+    event.Skip();
 }
 
-void FrameCallTree::OnItemExpanding(wxTreeEvent& event)
+void FrameCallTree::OnIdle(wxIdleEvent& event)
 {
-    const wxTreeItemId item = event.GetItem();
-    FrameCallItemData* pData = dynamic_cast<FrameCallItemData*>(GetItemData(item));
-    if (pData && pData->IsValid() && pData->mType == FrameItem) {
-        LoadFrame(item, pData->mpFrameTM);
+    // Scrolling and resizing only repaint, so check here whether other rows came into view
+    RequestVisibleCalls();
+    event.Skip();
+}
+
+void FrameCallTree::OnCallsLoaded(wxThreadEvent& event)
+{
+    std::vector<LoadedCall> calls;
+    mpLoader->TakeLoaded(calls);
+
+    for (unsigned int i = 0; i < calls.size(); ++i)
+    {
+        const unsigned int callNo = calls[i].mpCallTM->mCallNo;
+        if (callNo < mWindowBegin || callNo > mWindowEnd || mLoadedCalls.count(callNo))
+            delete calls[i].mpCallTM;
+        else
+            mLoadedCalls[callNo] = calls[i];
     }
+
+    mArrivedCalls += calls.size();
+    if (mRequestedCalls > 0)
+        mpMainFrame->loadProgressUpdate(std::min(mArrivedCalls, mRequestedCalls));
+
+    // Only the visible rows have to be drawn again
+    const long top = GetTopItem();
+    const long last = std::min(mRowCount, top + GetCountPerPage() + 1) - 1;
+    if (top >= 0 && last >= top)
+        RefreshItems(top, last);
+}
+
+unsigned int FrameCallTree::RowFrame(long row, int& call) const
+{
+    std::vector<long>::const_iterator it = std::upper_bound(mFrameRows.begin(), mFrameRows.end(), row);
+    const unsigned int frame = (it - mFrameRows.begin()) - 1;
+    call = row - mFrameRows[frame] - 1;
+    return frame;
+}
+
+unsigned int FrameCallTree::RowCallNo(long row) const
+{
+    int call = -1;
+    const FrameTM* frameTM = mpMainFrame->mTraceFile.mFrames[RowFrame(row, call)];
+    return call < 0 ? frameTM->mFirstCallOfThisFrame : frameTM->mCallIndex[call].mCallNo;
 }
 
-void FrameCallTree::OnItemCollapsing(wxTreeEvent& event)
+long FrameCallTree::CallRow(unsigned int frame, unsigned int callNo) const
 {
-    wxTreeItemId item = event.GetItem();
-    FrameCallItemData* pData = dynamic_cast<FrameCallItemData*>(GetItemData(item));
-    if (pData && pData->IsValid() && pData->mType == FrameItem) {
-        FrameTM* frameTM = pData->mpFrameTM;
-        frameTM->UnloadCalls();
+    const std::vector<CallIndexEntry>& index = mpMainFrame->mTraceFile.mFrames[frame]->mCallIndex;
+    std::vector<CallIndexEntry>::const_iterator it = std::lower_bound(index.begin(), index.end(), callNo, CallNoLess);
+    if (it == index.end() || it->mCallNo != callNo)
+        return -1;
+    return FrameRow(frame) + 1 + (it - index.begin());
+}
 
-        DeleteChildren(item);
+void FrameCallTree::ExpandFrame(unsigned int frame)
+{
+    TraceFileTM& traceFile = mpMainFrame->mTraceFile;
+    {
+        std::lock_guard<std::mutex> lock(mpLoader->FileMutex());
+        traceFile.mFrames[frame]->IndexCalls(
+            traceFile.mpInFileRA,
+            traceFile.GetLoadQueryCalls(),
+            traceFile.GetLoadFilter());
     }
-    
-    mpMainFrame->loadProgressUpdate(0); // reset loading bar
+    UpdateRows();
 }
 
-void FrameCallTree::OnSelChanged(wxTreeEvent& event)
+void FrameCallTree::CollapseFrame(unsigned int frame)
 {
-    wxTreeItemId item = event.GetItem();
-    FrameCallItemData* pData = static_cast<FrameCallItemData*>(GetItemData(item));
-    mpCurSel = pData;
+    FrameTM* frameTM = mpMainFrame->mTraceFile.mFrames[frame];
+    frameTM->ClearCallIndex();
 
-    assert(wxGetApp().mpMainFrame);
+    std::map<unsigned int, LoadedCall>::iterator it = mLoadedCalls.lower_bound(frameTM->mFirstCallOfThisFrame);
+    while (it != mLoadedCalls.end() && it->first < frameTM->mFirstCallOfThisFrame + frameTM->GetCallCount())
+    {
+        delete it->second.mpCallTM;
+        mLoadedCalls.erase(it++);
+    }
 
-    if (mpCurSel->mType != CallItem)
-        wxGetApp().mpMainFrame->UpdateCallDetail(NULL);
-    else
-        wxGetApp().mpMainFrame->UpdateCallDetail(mpCurSel->mpCallTM);
+    // A call of the frame cannot stay selected, select the frame instead
+    if (mCurFrame == int(frame))
+        mCurCall = -1;
+
+    UpdateRows();
+    mpMainFrame->loadProgressUpdate(0); // reset loading bar
 }
 
-void FrameCallTree::ReloadLoadedFrames()
+void FrameCallTree::UpdateRows()
 {
-    wxTreeItemIdValue treeItemId;
-    const wxTreeItemId rootId = GetRootItem();
-    wxTreeItemId childId = GetFirstChild(rootId, treeItemId);
-    while (childId.IsOk())
+    const long oldRow = GetNextItem(-1, wxLIST_NEXT_ALL, wxLIST_STATE_SELECTED);
+    if (oldRow != -1)
+        SetItemState(oldRow, 0, wxLIST_STATE_SELECTED | wxLIST_STATE_FOCUSED);
+
+    const std::vector<FrameTM*>& frames = mpMainFrame->mTraceFile.mFrames;
+    mFrameRows.resize(frames.size());
+    mRowCount = 0;
+    for (unsigned int fNo = 0; fNo < frames.size(); ++fNo)
     {
-        if (IsExpanded(childId))
-        {
-            FrameCallItemData* pData = dynamic_cast<FrameCallItemData*>(GetItemData(childId));
-            if (pData && pData->mType == FrameItem) {
-                FrameTM* frameTM = pData->mpFrameTM;
-                if (frameTM)
-                {
-                    frameTM->UnloadCalls();
-                }
-                DeleteChildren(childId);
-
-                LoadFrame(childId, frameTM);
-            }
-        }
+        mFrameRows[fNo] = mRowCount;
+        mRowCount += 1 + frames[fNo]->mCallIndex.size();
+    }
+    SetItemCount(mRowCount);
+    Refresh();
 
-        childId = GetNextChild(rootId, treeItemId);
+    // The rows have moved, ask for the visible calls again on the next idle event
+    mRequestedTop = -1;
+
+    if (mCurFrame >= int(frames.size()))
+        mCurFrame = -1;
+    if (mCurFrame >= 0)
+    {
+        const long row = mCurCall >= 0 ? CallRow(mCurFrame, mCurCall) : FrameRow(mCurFrame);
+        SelectRow(row != -1 ? row : FrameRow(mCurFrame));
     }
 }
 
-void FrameCallTree::LoadFrame(wxTreeItemId item, FrameTM *frame)
+void FrameCallTree::SelectRow(long row)
 {
-    if (!item.IsOk() || !frame)
-        return;
+    const long oldRow = GetNextItem(-1, wxLIST_NEXT_ALL, wxLIST_STATE_SELECTED);
+    if (oldRow != -1 && oldRow != row)
+        SetItemState(oldRow, 0, wxLIST_STATE_SELECTED | wxLIST_STATE_FOCUSED);
+    SetItemState(row, wxLIST_STATE_SELECTED | wxLIST_STATE_FOCUSED, wxLIST_STATE_SELECTED | wxLIST_STATE_FOCUSED);
+    EnsureVisible(row);
+
+    // Not every port sends EVT_LIST_ITEM_SELECTED when the selection is set by the program
+    UpdateSelection(row);
+}
 
-    frame->LoadCalls(
-        mpMainFrame->mTraceFile.mpInFileRA,
-        mpMainFrame->mTraceFile.GetLoadQueryCalls(),
-        mpMainFrame->mTraceFile.GetLoadFilter());
+void FrameCallTree::UpdateSelection(long row)
+{
+    int call = -1;
+    const unsigned int frame = RowFrame(row, call);
+    mCurFrame = frame;
 
-    wxString wsStr;
-    const unsigned int loadedCallCnt = frame->mCalls.size();
-    mpMainFrame->loadProgressStart( loadedCallCnt );
-    unsigned int oldProgressCnt = 0;
-    
-    for (unsigned int i = 0; i < loadedCallCnt; ++i){
-        CallTM *callTM = frame->mCalls[i];
-
-        // use sprintf instead of wxString.Printf because it doesnt support %s for c_str or std::string
-        const size_t bufSize = 512;
-        char buffer[bufSize];
-        snprintf(buffer, bufSize, "[%d][%d] %s", callTM->mTid, callTM->mCallNo, callTM->ToStr().c_str());
-        wsStr = wxString::FromAscii(buffer);    
-        
-        FrameCallItemData* newCallData = new FrameCallItemData(CallItem);
-        newCallData->mpCallTM = callTM;
-        wxTreeItemId cId = AppendItem(item, wsStr, -1, -1, newCallData);
-
-        unsigned int bkc = callTM->mBkColor;
-        unsigned int tc = callTM->mTxtColor;
-        wxColour bk(RED_COM(bkc), GREEN_COM(bkc), BLUE_COM(bkc));
-        wxColour t(RED_COM(tc), GREEN_COM(tc), BLUE_COM(tc));
-        SetItemBackgroundColour(cId, bk);
-        SetItemTextColour(cId, t);
-
-        if ( loadedCallCnt > 0 ) {
-            const int progress_interval = (loadedCallCnt) / 10; // update progress 10 times
-            if (i > oldProgressCnt) {
-                oldProgressCnt += progress_interval;
-                mpMainFrame->loadProgressUpdate(i);
-            }
-        }
-        
+    assert(wxGetApp().mpMainFrame);
+
+    if (call < 0)
+    {
+        mCurCall = -1;
+        wxGetApp().mpMainFrame->UpdateCallDetail(NULL);
+        return;
     }
-    
-    mpMainFrame->loadProgressUpdate(loadedCallCnt); // finish!
-    
+
+    const CallIndexEntry& entry = mpMainFrame->mTraceFile.mFrames[frame]->mCallIndex[call];
+    mCurCall = entry.mCallNo;
+    wxGetApp().mpMainFrame->UpdateCallDetail(GetCall(entry));
 }
 
-void FrameCallTree::OnLeftDoubleClick(wxMouseEvent& event)
+CallTM* FrameCallTree::GetCall(const CallIndexEntry& entry)
 {
-    // Get the tree item from the mouse position
-    const wxPoint pos = event.GetPosition();
-    int flags = 0;
-    const wxTreeItemId item = HitTest(pos, flags);
+    std::map<unsigned int, LoadedCall>::iterator it = mLoadedCalls.find(entry.mCallNo);
+    if (it != mLoadedCalls.end())
+        return it->second.mpCallTM;
 
-    FrameCallItemData* pData = dynamic_cast<FrameCallItemData*>(GetItemData(item));
-    if (pData && pData->IsValid())
+    // Decoding a single call is quick, and a selected call should not wait for the loader
+    LoadedCall loaded;
+    loaded.mpCallTM = new CallTM;
     {
-        if (pData->mType == CallItem)
+        std::lock_guard<std::mutex> lock(mpLoader->FileMutex());
+        mpMainFrame->mTraceFile.mpInFileRA->SetReadPos(entry.mReadPos);
+        if (!loaded.mpCallTM->Load(mpMainFrame->mTraceFile.mpInFileRA))
         {
-            const CallTM *call = pData->mpCallTM;
-            const std::string callName = call->Name();
+            delete loaded.mpCallTM;
+            return NULL;
+        }
+    }
+    loaded.mpCallTM->mCallNo = entry.mCallNo;
+    loaded.mText = loaded.mpCallTM->ToStr();
 
-            if (callName == "glTexImage2D")
-            {
-                // Create a dummy image
-                const pat::Image image(640, 480, GL_RGB, GL_UNSIGNED_BYTE, 640 * 480 * 3, NULL);
+    // Dropped again by RequestVisibleCalls() if it is outside of the window
+    mLoadedCalls[entry.mCallNo] = loaded;
+    return loaded.mpCallTM;
+}
 
-                // Create a window to display the texture
-                TextureFrame *viewer = new TextureFrame(this, image);
-                viewer->Show(true);
-            }
+void FrameCallTree::AddMissingCalls(long begin, long end, std::vector<CallIndexEntry>& calls) const
+{
+    for (long row = begin; row < end; ++row)
+    {
+        int call = -1;
+        const unsigned int frame = RowFrame(row, call);
+        if (call < 0)
+            continue;
+
+        const CallIndexEntry& entry = mpMainFrame->mTraceFile.mFrames[frame]->mCallIndex[call];
+        if (mLoadedCalls.count(entry.mCallNo) == 0)
+            calls.push_back(entry);
+    }
+}
+
+void FrameCallTree::RequestVisibleCalls()
+{
+    if (mRowCount == 0)
+        return;
+
+    const long top = std::max(GetTopItem(), 0L);
+    const long count = std::max(GetCountPerPage(), 1);
+    if (top == mRequestedTop && count == mRequestedCount)
+        return;
+    mRequestedTop = top;
+    mRequestedCount = count;
+
+    const long prefetch = PREFETCH_PAGES * count;
+    const long first = std::max(top - prefetch, 0L);
+    const long visibleEnd = std::min(top + count, mRowCount);
+    const long end = std::min(top + count + prefetch, mRowCount);
+
+    // Rows are sorted by call number, so the window is a range of call numbers
+    mWindowBegin = RowCallNo(first);
+    mWindowEnd = RowCallNo(end - 1);
+    std::map<unsigned int, LoadedCall>::iterator it = mLoadedCalls.begin();
+    while (it != mLoadedCalls.end())
+    {
+        if (it->first < mWindowBegin || it->first > mWindowEnd)
+        {
+            delete it->second.mpCallTM;
+            mLoadedCalls.erase(it++);
         }
-        else if (pData->mType == FrameItem)
+        else
         {
-            if (pData->mpFrameTM->IsLoaded())
-                Collapse(item);
-            else
-                Expand(item);
+            ++it;
         }
     }
+
+    // The visible rows first, then the ones below, where the user is most likely to scroll to
+    std::vector<CallIndexEntry> calls;
+    AddMissingCalls(top, visibleEnd, calls);
+    AddMissingCalls(visibleEnd, end, calls);
+    AddMissingCalls(first, top, calls);
+
+    // This also cancels what is left of the previous request
+    mpLoader->Request(calls);
+    mRequestedCalls = calls.size();
+    mArrivedCalls = 0;
+    if (mRequestedCalls > 0)
+        mpMainFrame->loadProgressStart(mRequestedCalls);
 }
 
+void FrameCallTree::ClearLoadedCalls()
+{
+    std::map<unsigned int, LoadedCall>::iterator it = mLoadedCalls.begin();
+    for (; it != mLoadedCalls.end(); ++it)
+        delete it->second.mpCallTM;
+    mLoadedCalls.clear();
+}
@@ -2,10 +2,13 @@
 #define _TRACEVIEW_FRAME_CALL_TREE_H_
 
 #include "app.h"
+#include "call_loader.h"
 
 #include <wx/wx.h>
-#include <wx/treectrl.h>
+#include <wx/listctrl.h>
 
+#include <map>
+#include <vector>
 
 #include <ui/main_frame.h>
 
@@ -16,36 +19,16 @@
 
 using namespace common;
 
-enum FrameCallType
-{
-    RootItem = 1,
-    FrameItem,
-    CallItem,
-};
-
-
-class FrameCallItemData : public wxTreeItemData
+// The frames of the trace, each followed by its calls while it is expanded.
+//
+// The list is virtual: expanding a frame only indexes its calls, and just the
+// rows in view, plus a few pages around them, are decoded by a CallLoader in
+// the background. Decoded calls that scroll out of that window are deleted
+// again, so neither large frames nor visiting many frames use up memory.
+class FrameCallTree : public wxListCtrl
 {
 public:
-    FrameCallItemData(FrameCallType typeVal)
-    : mType(typeVal), mpFrameTM(NULL)
-    {
-    }
-
-    bool IsValid() const { return mpFrameTM != NULL; }
-
-    FrameCallType       mType;
-    union {
-        FrameTM*            mpFrameTM;
-        CallTM*             mpCallTM;
-    };
-};
-
-
-class FrameCallTree : public wxTreeCtrl
-{
-public:
-    FrameCallTree(MainFrame* mainFrame, 
+    FrameCallTree(MainFrame* mainFrame,
 				  wxWindow *parent, const wxWindowID id,
         const wxPoint& pos, const wxSize& size,
         long style);
@@ -55,18 +38,67 @@ public:
     unsigned int GetCurrentCallNo();
     void SelectCall(unsigned int callNo);
 
+    // Search the string representation of the calls, see TraceFileTM::FindNext
+    unsigned int FindNext(unsigned int callNo, const char* pattern);
+    unsigned int FindPrevious(unsigned int callNo, const char* pattern);
+
     // Reload all loaded frames with new display filter settings
     void ReloadLoadedFrames();
 
+protected:
+    virtual wxString OnGetItemText(long item, long column) const;
+    virtual wxListItemAttr* OnGetItemAttr(long item) const;
+
 private:
-    void OnItemExpanding(wxTreeEvent& event);
-    void OnItemCollapsing(wxTreeEvent& event);
-    void OnSelChanged(wxTreeEvent& event);
-    void OnLeftDoubleClick(wxMouseEvent& event);
-    void LoadFrame(wxTreeItemId item, FrameTM *frame);
-
-    FrameCallItemData*      mpCurSel;
-	MainFrame				*mpMainFrame;
+    void OnItemSelected(wxListEvent& event);
+    void OnItemActivated(wxListEvent& event);
+    void OnKeyDown(wxListEvent& event);
+    void OnSize(wxSizeEvent& event);
+    void OnIdle(wxIdleEvent& event);
+    void OnCallsLoaded(wxThreadEvent& event);
+
+    // The frame of a row, and the index of its call in FrameTM::mCallIndex,
+    // or -1 for the row of the frame itself
+    unsigned int RowFrame(long row, int& call) const;
+    unsigned int RowCallNo(long row) const;
+    long FrameRow(unsigned int frame) const { return mFrameRows[frame]; }
+    // -1 if the call is not in the index of the frame
+    long CallRow(unsigned int frame, unsigned int callNo) const;
+
+    void ExpandFrame(unsigned int frame);
+    void CollapseFrame(unsigned int frame);
+    void UpdateRows();
+    void SelectRow(long row);
+    void UpdateSelection(long row);
+
+    // The decoded call, decoding it right away if the loader has not got to it yet
+    CallTM* GetCall(const CallIndexEntry& entry);
+    void AddMissingCalls(long begin, long end, std::vector<CallIndexEntry>& calls) const;
+    // Asks the loader for the calls near the visible rows, and drops the others
+    void RequestVisibleCalls();
+    void ClearLoadedCalls();
+
+    MainFrame               *mpMainFrame;
+    CallLoader*             mpLoader;
+
+    // The row of each frame, which depends on the frames before it that are expanded
+    std::vector<long>       mFrameRows;
+    long                    mRowCount;
+
+    // By call number, only the calls between mWindowBegin and mWindowEnd are kept
+    std::map<unsigned int, LoadedCall> mLoadedCalls;
+    unsigned int            mWindowBegin;
+    unsigned int            mWindowEnd;
+    long                    mRequestedTop;
+    long                    mRequestedCount;
+    unsigned int            mRequestedCalls;
+    unsigned int            mArrivedCalls;
+
+    // Selection, mCurCall is the call number or -1 when a frame is selected
+    int                     mCurFrame;
+    int                     mCurCall;
+
+    mutable wxListItemAttr  mAttr;
     DECLARE_EVENT_TABLE()
 };
 
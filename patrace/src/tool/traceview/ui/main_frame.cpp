@@ -202,7 +202,7 @@ bool MainFrame::OpenFile(const wxString &filepath)
     {
         mpFrameCallTree = new FrameCallTree(this, mpSplitter, FrameCallTree_id,
             wxDefaultPosition, wxDefaultSize,
-            wxTR_ROW_LINES|wxTR_HIDE_ROOT|wxTR_HAS_BUTTONS|wxTR_SINGLE|wxTR_HAS_VARIABLE_ROW_HEIGHT);
+            wxLC_REPORT|wxLC_VIRTUAL|wxLC_NO_HEADER|wxLC_SINGLE_SEL|wxLC_HRULES);
         wxSize size = GetClientSize();
         mpFrameCallTree->SetSize(0, 0, size.x, size.y);
 
@@ -258,7 +258,7 @@ void MainFrame::OnSearchNextCall(wxCommandEvent& event)
         wxString strPattern = mpSearchCallCtrl->GetLineText(0);
 
         unsigned int curCall = mpFrameCallTree->GetCurrentCallNo();
-        unsigned int selCall = mTraceFile.FindNext(curCall, strPattern.ToAscii());
+        unsigned int selCall = mpFrameCallTree->FindNext(curCall, strPattern.ToAscii());
         mpFrameCallTree->SelectCall(selCall);
 
         if (curCall == selCall)
@@ -273,7 +273,7 @@ void MainFrame::OnSearchPreCall(wxCommandEvent& event)
         wxString strPattern = mpSearchCallCtrl->GetLineText(0);
 
         unsigned int curCall = mpFrameCallTree->GetCurrentCallNo();
-        unsigned int selCall = mTraceFile.FindPrevious(curCall, strPattern.ToAscii());
+        unsigned int selCall = mpFrameCallTree->FindPrevious(curCall, strPattern.ToAscii());
         mpFrameCallTree->SelectCall(selCall);
 
         if (curCall == selCall)
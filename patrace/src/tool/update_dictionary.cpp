@@ -2,9 +2,11 @@
 // Emergency trace version downgrader
 //
 // Makes trace files look like they have been created with a very old tracer by optimizing their sigbooks.
+// With -i the file is patched in place instead: the ids of the calls are kept and only the names of
+// unused functions are dropped from the sigbook, so that usually just the first chunk is rewritten.
 //
 // To compile:
-// gcc -o update_dictionary patrace/src/tool/update_dictionary.cpp patrace/src/common/out_file.cpp -Wall -g -O3 -I thirdparty/snappy -std=c++11 builds/patrace/x11_x64/debug/snappy/libsnappy_bundled.a -lstdc++ -I patrace/src
+// gcc -o update_dictionary patrace/src/tool/update_dictionary.cpp patrace/src/common/out_file.cpp patrace/src/common/blob_table.cpp patrace/src/common/chunk_codec.cpp patrace/src/common/trace_patcher.cpp thirdparty/md5/md5.c thirdparty/jsoncpp/src/lib_json/*.cpp -Wall -g -O3 -I thirdparty/snappy -I thirdparty -I thirdparty/jsoncpp/include -std=c++11 builds/patrace/x11_x64/debug/snappy/libsnappy_bundled.a -lstdc++ -lz -I patrace/src
 //
 
 #include <assert.h>
@@ -16,14 +18,12 @@
 #include <map>
 #include <stdbool.h>
 
-#include <snappy.h>
-
+#include "common/chunk_codec.hpp"
 #include "common/out_file.hpp"
+#include "common/trace_patcher.hpp"
 
 #include "common/api_info_auto.cpp"
 
-#define SNAPPY_CHUNK_SIZE (1*1024*1024)
-
 /// Set this to true to write out an .ra file of the data. This can be used to verify this code by comparing to the .ra file
 /// output of eg trace_to_txt -- it should be bit perfect identical.
 #define WRITE_RA_FILE false
@@ -72,14 +72,45 @@ bool read_compressed_length(unsigned *length, FILE *in)
 	return true;
 }
 
+// Reads the length word of the next chunk, and the full length following it for long chunks
+bool read_chunk_length(unsigned *length, const common::ChunkCodec **codec, uint32_t version, FILE *in)
+{
+	unsigned length_word = 0;
+	if (!read_compressed_length(&length_word, in))
+	{
+		return false;
+	}
+	const common::HeaderVersion header_version = static_cast<common::HeaderVersion>(version);
+	*codec = common::GetChunkCodec(common::ChunkLengthWordCodec(length_word, header_version));
+	if (!*codec)
+	{
+		printf("Error: Unknown chunk codec %u\n", common::ChunkLengthWordCodec(length_word, header_version));
+		exit(1);
+	}
+	*length = common::ChunkLengthWordLength(length_word, header_version);
+	if (common::ChunkLengthWordIsLong(length_word, header_version) && !read_compressed_length(length, in))
+	{
+		printf("Error: Truncated chunk length\n");
+		exit(1);
+	}
+	return true;
+}
+
 int main(int argc, char **argv)
 {
 	if (argc != 3)
 	{
 		printf("Usage: %s <in-file> <out-file>\n", argv[0]);
+		printf("       %s -i <file>\n", argv[0]);
+		exit(1);
+	}
+	const bool in_place = strcmp(argv[1], "-i") == 0;
+	FILE *in = fopen(argv[in_place ? 2 : 1], "rb");
+	if (!in)
+	{
+		printf("Error: Failed to open %s\n", argv[in_place ? 2 : 1]);
 		exit(1);
 	}
-	FILE *in = fopen(argv[1], "rb");
 	FILE *ra = nullptr;
 
 	if (WRITE_RA_FILE)
@@ -139,13 +170,14 @@ int main(int argc, char **argv)
 	for (;;)
 	{
 		// Read chunk length
-		if (!read_compressed_length(&compressed_length, in))
+		const common::ChunkCodec *codec = NULL;
+		if (!read_chunk_length(&compressed_length, &codec, version, in))
 		{
 			break;
 		}
 		buffer_compressed.resize(compressed_length);
 		myread(buffer_compressed.data(), compressed_length, in, "reading chunk pass 1");
-		if (snappy::GetUncompressedLength(buffer_compressed.data(), buffer_compressed.size(), &size) == false)
+		if (codec->GetUncompressedLength(buffer_compressed.data(), buffer_compressed.size(), &size) == false)
 		{
 			printf("Error checking chunk size (pass 1)\n");
 		}
@@ -161,18 +193,19 @@ int main(int argc, char **argv)
 	for (;;)
 	{
 		// Read chunk length
-		if (!read_compressed_length(&compressed_length, in))
+		const common::ChunkCodec *codec = NULL;
+		if (!read_chunk_length(&compressed_length, &codec, version, in))
 		{
 			break;
 		}
 		buffer_compressed.resize(compressed_length);
 		myread(buffer_compressed.data(), compressed_length, in, "reading chunk pass 2");
-		if (snappy::GetUncompressedLength(buffer_compressed.data(), buffer_compressed.size(), &size) == false)
+		if (codec->GetUncompressedLength(buffer_compressed.data(), buffer_compressed.size(), &size) == false)
 		{
 			printf("Error checking chunk size (pass 2)\n");
 			exit(1);
 		}
-		if (snappy::RawUncompress(buffer_compressed.data(), buffer_compressed.size(), &big_buffer.data()[big_counter]) == false)
+		if (codec->Uncompress(buffer_compressed.data(), buffer_compressed.size(), &big_buffer.data()[big_counter]) == false)
 		{
 			printf("Error decompressing chunk (pass 2)\n");
 			exit(1);
@@ -193,7 +226,7 @@ int main(int argc, char **argv)
 	std::map<int, int> map_new_to_old; // maps optimized Id to file Id
 	std::map<int, int> map_old_to_internal; // maps file Id to code Ids, which may be different
 	char *src = big_buffer.data();
-	src = common::ReadFixed(src, sigbookToNext); // should be zero -- looks unimplemented
+	src = common::ReadFixed(src, sigbookToNext); // zero in old files, patched files may pad the block
 	src = common::ReadFixed(src, mMaxSigId);
 	for (unsigned id = 1; id <= mMaxSigId; ++id)
 	{
@@ -207,6 +240,11 @@ int main(int argc, char **argv)
 		}
 	}
 
+	if (sigbookToNext > 0)
+	{
+		src = big_buffer.data() + sigbookToNext;
+	}
+
 	// Create file Id to code Id mapping (should usually be identity)
 	for (const auto pair : stored_sigbook)
 	{
@@ -222,9 +260,16 @@ int main(int argc, char **argv)
 
 	// Parse file contents, figure out what's actually used
 	char *calls_start = src;
+	bool has_blob_definitions = false;
 	while ((size_t)(src - big_buffer.data()) < uncompressed_length)
 	{
 		common::BCall *call = (common::BCall*)src;
+		if (call->funcId == common::BLOB_DEFINITION_FUNC_ID) // not a call, and not in the sigbook
+		{
+			src += ((common::BCall_vlen*)src)->toNext;
+			has_blob_definitions = true;
+			continue;
+		}
 		assert(call->funcId > 0);
 		assert(call->funcId <= mMaxSigId);
 		unsigned internalId = map_old_to_internal[call->funcId];
@@ -250,8 +295,42 @@ int main(int argc, char **argv)
 		}
 	}
 
+	if (in_place)
+	{
+		fclose(in);
+		common::TracePatcher patcher;
+		if (!patcher.Open(argv[2]))
+		{
+			exit(1);
+		}
+		std::vector<std::string> sigbook = patcher.GetSigBook();
+		for (unsigned id = 1; id < sigbook.size(); id++)
+		{
+			if (map_old_to_new.count(id) == 0)
+			{
+				sigbook[id].clear();
+			}
+		}
+		while (sigbook.size() > 1 && sigbook.back().empty())
+		{
+			sigbook.pop_back();
+		}
+		printf("Keeping %u of %u functions\n", (unsigned)map_old_to_new.size(), mMaxSigId);
+		patcher.SetSigBook(sigbook);
+		if (!patcher.Commit())
+		{
+			exit(1);
+		}
+		printf("%s\n", patcher.Rewritten() ? "Rewrote the file" : "Patched the file in place");
+		return 0;
+	}
+
 	// Now finally - write everything out again!
 	common::OutFile out;
+	if (has_blob_definitions)
+	{
+		out.EnableBlobTable(); // the definitions are copied as they are, this only marks the file
+	}
 	out.Open(argv[2], false);
 	out.WriteHeader(jsondata.data(), jsonLength, true);
 
@@ -281,6 +360,13 @@ int main(int argc, char **argv)
 	{
 		dest = scratch.data();
 		common::BCall *call = (common::BCall*)src;
+		if (call->funcId == common::BLOB_DEFINITION_FUNC_ID) // keeps its id
+		{
+			const uint32_t block_size = ((common::BCall_vlen*)src)->toNext;
+			out.Write(src, block_size);
+			src += block_size;
+			continue;
+		}
 		unsigned internalId = map_old_to_internal[call->funcId];
 		unsigned newId = map_old_to_new[call->funcId];
 		uint32_t call_size = common::ApiInfo::IdToLenArr[internalId];
@@ -0,0 +1,165 @@
+#include "tool/upload_tracker.hpp"
+
+#include "dispatch/eglimports.hpp"
+
+#include <limits>
+
+UploadTracker::UploadTracker(const std::vector<std::string>& sigbook)
+    : mKinds(sigbook.size(), NONE)
+{
+    static const std::map<std::string, Kind> kinds = {
+        { "eglMakeCurrent", MAKE_CURRENT },
+        { "glActiveTexture", ACTIVE_TEXTURE },
+        { "glBindTexture", BIND_TEXTURE },
+        { "glBindBuffer", BIND_BUFFER },
+        { "glBindBufferBase", BIND_BUFFER_INDEXED },
+        { "glBindBufferRange", BIND_BUFFER_INDEXED },
+        { "glBindVertexArray", BIND_VERTEX_ARRAY },
+        { "glBindVertexArrayOES", BIND_VERTEX_ARRAY },
+        { "glDeleteVertexArrays", BIND_VERTEX_ARRAY },
+        { "glDeleteVertexArraysOES", BIND_VERTEX_ARRAY },
+        { "glTexImage2D", TEX_IMAGE },
+        { "glTexImage3D", TEX_IMAGE },
+        { "glCompressedTexImage2D", TEX_IMAGE },
+        { "glCompressedTexImage3D", TEX_IMAGE },
+        { "glTexSubImage2D", TEX_SUB_IMAGE },
+        { "glTexSubImage3D", TEX_SUB_IMAGE },
+        { "glCompressedTexSubImage2D", TEX_SUB_IMAGE },
+        { "glCompressedTexSubImage3D", TEX_SUB_IMAGE },
+        { "glBufferData", BUFFER_DATA },
+        { "glBufferSubData", BUFFER_SUB_DATA },
+        { "glGenerateMipmap", READ_TEXTURE },
+        { "glMapBufferRange", READ_BUFFER },
+        { "glMapBufferOES", READ_BUFFER },
+        { "glCopyBufferSubData", READ_ALL },
+        { "glCopyTexImage2D", READ_ALL },
+        { "glCopyTexSubImage2D", READ_ALL },
+        { "glCopyTexSubImage3D", READ_ALL },
+        { "glCopyImageSubData", READ_ALL },
+        { "glCopyImageSubDataEXT", READ_ALL },
+        { "eglCreateImageKHR", READ_ALL },
+        { "eglCreateImage", READ_ALL },
+    };
+    for (unsigned int id = 1; id < sigbook.size(); ++id)
+    {
+        const auto it = kinds.find(sigbook[id]);
+        if (it != kinds.end())
+            mKinds[id] = it->second;
+    }
+}
+
+void UploadTracker::Add(const common::BCall_vlen& call, char* src, unsigned long long callNo)
+{
+    if (call.funcId >= mKinds.size() || mKinds[call.funcId] == NONE)
+        return;
+
+    unsigned int arg0 = 0, arg1 = 0, arg2 = 0;
+    src = common::ReadFixed(src, arg0);
+    unsigned long long& context = mContexts[call.tid];
+    switch (mKinds[call.funcId])
+    {
+    case MAKE_CURRENT:
+        // eglMakeCurrent(dpy, draw, read, ctx)
+        src = common::ReadFixed(src, arg1);
+        src = common::ReadFixed(src, arg1);
+        common::ReadFixed(src, arg1);
+        context = arg1;
+        break;
+    case ACTIVE_TEXTURE:
+        mActiveTexture[context] = arg0 - GL_TEXTURE0;
+        break;
+    case BIND_TEXTURE:
+        common::ReadFixed(src, arg1);
+        mTextures[std::make_tuple(context, mActiveTexture[context], arg0)] = arg1;
+        break;
+    case BIND_BUFFER:
+        common::ReadFixed(src, arg1);
+        mBuffers[std::make_pair(context, arg0)] = arg1;
+        break;
+    case BIND_BUFFER_INDEXED:
+        // Also binds the buffer to the generic binding point
+        src = common::ReadFixed(src, arg1);
+        common::ReadFixed(src, arg2);
+        mBuffers[std::make_pair(context, arg0)] = arg2;
+        break;
+    case BIND_VERTEX_ARRAY:
+        // The element array buffer binding belongs to the vertex array object,
+        // which one is bound after this is not known
+        mBuffers[std::make_pair(context, (unsigned int)GL_ELEMENT_ARRAY_BUFFER)] = 0;
+        break;
+    case TEX_IMAGE:
+    case TEX_SUB_IMAGE:
+    {
+        common::ReadFixed(src, arg1);
+        const unsigned int unpackBuffer = mBuffers[std::make_pair(context, (unsigned int)GL_PIXEL_UNPACK_BUFFER)];
+        if (unpackBuffer != 0)
+            Pin(Key(context, true, unpackBuffer, 0, 0));
+        const Key key(context, false, BoundTexture(context, arg0), arg0, arg1);
+        Upload(key, callNo, mKinds[call.funcId] == TEX_IMAGE);
+        break;
+    }
+    case BUFFER_DATA:
+    case BUFFER_SUB_DATA:
+    {
+        // Uploads to an unknown buffer are kept, and replace nothing
+        const unsigned int buffer = mBuffers[std::make_pair(context, arg0)];
+        if (buffer != 0)
+            Upload(Key(context, true, buffer, 0, 0), callNo, mKinds[call.funcId] == BUFFER_DATA);
+        break;
+    }
+    case READ_TEXTURE:
+        Pin(Key(context, false, BoundTexture(context, arg0), 0, 0));
+        break;
+    case READ_BUFFER:
+    {
+        const unsigned int buffer = mBuffers[std::make_pair(context, arg0)];
+        if (buffer != 0)
+            Pin(Key(context, true, buffer, 0, 0));
+        else
+            mPending.clear();
+        break;
+    }
+    case READ_ALL:
+        mPending.clear();
+        break;
+    case NONE:
+        break;
+    }
+}
+
+unsigned long long UploadTracker::ReplacedBy(unsigned long long callNo) const
+{
+    const auto it = mReplacedBy.find(callNo);
+    return it == mReplacedBy.end() ? std::numeric_limits<unsigned long long>::max() : it->second;
+}
+
+unsigned int UploadTracker::BoundTexture(unsigned long long context, unsigned int target)
+{
+    if (target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z)
+        target = GL_TEXTURE_CUBE_MAP;
+    return mTextures[std::make_tuple(context, mActiveTexture[context], target)];
+}
+
+// A full upload replaces the earlier uploads to the key, a partial one adds to them
+void UploadTracker::Upload(const Key& key, unsigned long long callNo, bool full)
+{
+    std::vector<unsigned long long>& pending = mPending[key];
+    if (full)
+    {
+        for (unsigned long long earlier : pending)
+            mReplacedBy[earlier] = callNo;
+        pending.clear();
+    }
+    pending.push_back(callNo);
+}
+
+// Keeps the uploads to all targets and levels of the object of the key
+void UploadTracker::Pin(const Key& key)
+{
+    auto it = mPending.lower_bound(Key(std::get<0>(key), std::get<1>(key), std::get<2>(key), 0, 0));
+    while (it != mPending.end() && std::get<0>(it->first) == std::get<0>(key)
+           && std::get<1>(it->first) == std::get<1>(key) && std::get<2>(it->first) == std::get<2>(key))
+    {
+        it = mPending.erase(it);
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "common/file_format.hpp"
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Finds the texture and buffer uploads whose data a later upload replaces, so
+// that the state prefix of split can leave them out. Bindings are followed per
+// context, which is conservative for objects shared between contexts. An
+// upload is only replaced by one to the same buffer, or the same face and
+// level of a texture, and never once something may have read the data: a
+// mapping, mipmap generation, an unpack buffer upload, or any copy.
+class UploadTracker
+{
+public:
+    // The names of the calls by their id in the trace
+    explicit UploadTracker(const std::vector<std::string>& sigbook);
+
+    // Looks at a call, src being its arguments as returned by InFile::GetNextCall()
+    void Add(const common::BCall_vlen& call, char* src, unsigned long long callNo);
+
+    // The call that replaces the data uploaded by a call, or ULLONG_MAX
+    unsigned long long ReplacedBy(unsigned long long callNo) const;
+
+private:
+    enum Kind
+    {
+        NONE, MAKE_CURRENT, ACTIVE_TEXTURE, BIND_TEXTURE, BIND_BUFFER, BIND_BUFFER_INDEXED, BIND_VERTEX_ARRAY,
+        TEX_IMAGE, TEX_SUB_IMAGE, BUFFER_DATA, BUFFER_SUB_DATA, READ_TEXTURE, READ_BUFFER, READ_ALL,
+    };
+    // Context, buffer or texture, object, target or cube map face, level
+    typedef std::tuple<unsigned long long, bool, unsigned int, unsigned int, unsigned int> Key;
+
+    unsigned int BoundTexture(unsigned long long context, unsigned int target);
+    void Upload(const Key& key, unsigned long long callNo, bool full);
+    void Pin(const Key& key);
+
+    std::vector<Kind> mKinds; // by call id in the trace
+    std::unordered_map<unsigned int, unsigned long long> mContexts; // current context by thread
+    std::map<unsigned long long, unsigned int> mActiveTexture; // by context
+    std::map<std::tuple<unsigned long long, unsigned int, unsigned int>, unsigned int> mTextures; // by context, unit and target
+    std::map<std::pair<unsigned long long, unsigned int>, unsigned int> mBuffers; // by context and target, 0 if unknown
+    std::map<Key, std::vector<unsigned long long>> mPending; // uploads that may still be replaced
+    std::unordered_map<unsigned long long, unsigned long long> mReplacedBy;
+};
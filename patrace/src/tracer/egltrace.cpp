@@ -138,6 +138,10 @@ BinAndMeta::BinAndMeta()
     free(bn);
 
     traceFile = new OutFile;
+    if (tracerParams.EnableBlobTable)
+    {
+        traceFile->EnableBlobTable(tracerParams.BlobTableMinSize);
+    }
     traceFile->Open(binName.str());
 
     // Reset per thread counters
@@ -37,6 +37,11 @@ public:
         traceFile->Write(buf, len);
     }
 
+    inline char* writeBlob(char* dest, unsigned int len, const char* data)
+    {
+        return traceFile->WriteBlob(dest, data, len);
+    }
+
     void saveExtensions();
     void saveAllEGLConfigs(EGLDisplay dpy);
     void updateWinSurfSize(EGLint width, EGLint height);
@@ -88,12 +93,13 @@ public:
 
     inline void Write(const void* buf, unsigned int len)
     {
-        if (mpBinAndMeta == NULL)
-        {
-            mpBinAndMeta = new BinAndMeta();
-            mStateLogger.open(mpBinAndMeta->getFileName() + ".tracelog");
-        }
-        mpBinAndMeta->write(buf, len);
+        getBinAndMeta()->write(buf, len);
+    }
+
+    // Same as Write1DArray<char>, but goes through the blob table if enabled
+    inline char* WriteBlob(char* dest, unsigned int len, const char* data)
+    {
+        return getBinAndMeta()->writeBlob(dest, len, data);
     }
 
     inline void WriteBuf(const char *endPointer)
@@ -125,6 +131,16 @@ public:
     StateLogger& getStateLogger() { return mStateLogger; }
 
 private:
+    inline BinAndMeta* getBinAndMeta()
+    {
+        if (mpBinAndMeta == NULL)
+        {
+            mpBinAndMeta = new BinAndMeta();
+            mStateLogger.open(mpBinAndMeta->getFileName() + ".tracelog");
+        }
+        return mpBinAndMeta;
+    }
+
     Path mPath;
     StateLogger mStateLogger;
 };
@@ -167,7 +167,7 @@ class SerializeVisitor(stdapi.Visitor):
             print '        dest = Write1DArray<char>(dest, 0, (const char*)%s); // blob size is 0' % (name)
             print '    }'
         else:
-            print '    dest = Write1DArray<char>(dest, (unsigned int)%s, (const char*)%s); // blob' % (blob.size, name)
+            print '    dest = gTraceOut->WriteBlob(dest, (unsigned int)%s, (const char*)%s); // blob' % (blob.size, name)
     def visitEnum(self, enum, name, func):
         print '    dest = WriteFixed<int>(dest, %s); // enum' % (name)
     def visitBitmask(self, bitmask, name, func):
@@ -219,7 +219,7 @@ class SerializeVisitor(stdapi.Visitor):
             print '        if (!_unpack_buffer)'
             print '        {'
             print '            dest = WriteFixed<unsigned int>(dest, BlobType);'
-            print '            dest = Write1DArray<char>(dest, (unsigned int)%s, (const char*)%s);' % (opaque.size, name)
+            print '            dest = gTraceOut->WriteBlob(dest, (unsigned int)%s, (const char*)%s);' % (opaque.size, name)
             print '        }'
             print '        else'
             print '        {'
@@ -230,7 +230,7 @@ class SerializeVisitor(stdapi.Visitor):
             print '    else'
             print '    {'
             print '        dest = WriteFixed<unsigned int>(dest, BlobType);'
-            print '        dest = Write1DArray<char>(dest, (unsigned int)%s, (const char*)%s);' % (opaque.size, name)
+            print '        dest = gTraceOut->WriteBlob(dest, (unsigned int)%s, (const char*)%s);' % (opaque.size, name)
             print '    }'
         elif func.name == "glReadPixels" or func.name == 'glReadnPixels' or func.name == 'glReadnPixelsEXT':
             print '    if (isUsingPBO)'
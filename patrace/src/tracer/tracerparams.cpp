@@ -2,9 +2,12 @@
 #include "helper/states.h"
 
 #include <common/os.hpp>
+#include <common/file_format.hpp>
 
 #include <string>
 #include <algorithm>
+#include <climits>
+#include <cstdlib>
 
 TracerParams::TracerParams()
 {
@@ -28,6 +31,9 @@ TracerParams::TracerParams()
         DBG_LOG("EnableActiveAttribCheck: %s\n", EnableActiveAttribCheck ? "true" : "false");
         DBG_LOG("InteractiveIntercept: %s\n", InteractiveIntercept ? "true" : "false");
         DBG_LOG("FlushTraceFileEveryFrame: %s\n", FlushTraceFileEveryFrame ? "true" : "false");
+        if (EnableBlobTable) {
+            DBG_LOG("EnableBlobTable: true (blobs >= %u bytes)\n", BlobTableMinSize);
+        }
         if (StateDumpAfterSnapshot) {
             DBG_LOG("StateDumpAfterSnapshot: true\n");
         }
@@ -122,6 +128,20 @@ void TracerParams::LoadParams()
         } else if (strParamName.compare("StateDumpAfterDrawCall") == 0) {
             StateDumpAfterDrawCall = (strParamValue.compare("true") == 0);
             stateLoggingEnabled = StateDumpAfterDrawCall;
+        } else if (strParamName.compare("EnableBlobTable") == 0) {
+            EnableBlobTable = (strParamValue.compare("true") == 0);
+        } else if (strParamName.compare("BlobTableMinSize") == 0) {
+            // A smaller blob would take less space than the reference to it
+            char* end = NULL;
+            const unsigned long size = strtoul(strParamValue.c_str(), &end, 10);
+            if (strParamValue.empty() || strParamValue[0] == '-' || *end != '\0') {
+                DBG_LOG("BlobTableMinSize %s is not a size in bytes, keeping %u\n", strParamValue.c_str(), BlobTableMinSize);
+            } else if (size < common::BLOB_REFERENCE_LEN) {
+                DBG_LOG("BlobTableMinSize %lu is smaller than a blob reference, using %u\n", size, common::BLOB_REFERENCE_LEN);
+                BlobTableMinSize = common::BLOB_REFERENCE_LEN;
+            } else {
+                BlobTableMinSize = std::min<unsigned long>(size, UINT_MAX);
+            }
         } else if (strParamName.compare("SupportedExtension") == 0) {
             SupportedExtensions.push_back(strParamValue);
             if (SupportedExtensionsString.length() != 0)
@@ -21,6 +21,8 @@ public:
     int ShaderStorageBufferOffsetAlignment = 256;   // As above
     int MaximumAnisotropicFiltering = 0;            // Anisotropic support. Must also add GL_EXT_texture_filter_anisotropic to SupportedExtensions
     bool ErrorOutOnBinaryShaders = true;            // Return an error if a program attempts to upload a binary shader
+    bool EnableBlobTable = false;                   // Store repeated blobs only once in the trace file (needs a newer retracer)
+    unsigned int BlobTableMinSize = 4096;           // Smallest blob, in bytes, that is stored in the blob table
 
 public:
     TracerParams();
@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+#include "blob_table_test.hpp"
+#include "trace_test_util.hpp"
+#include "common/api_info.hpp"
+#include "common/blob_table.hpp"
+#include "common/in_file.hpp"
+#include "common/out_file.hpp"
+
+using namespace common;
+using namespace trace_test;
+
+namespace {
+
+const char* TRACE_FILE = "blob_table_test.pat";
+const char* OTHER_TRACE_FILE = "blob_table_test_other.pat";
+const unsigned int BLOB_SIZE = 4096;
+const unsigned int MIN_BLOB_SIZE = 64;
+
+// Blob contents that differ for every seed
+std::vector<char> MakeBlob(unsigned int seed, unsigned int size = BLOB_SIZE)
+{
+    std::vector<char> blob(size);
+    for (unsigned int i = 0; i < size; ++i)
+        blob[i] = (char)(seed * 31 + i * 7 + i / 251);
+    return blob;
+}
+
+// A glBufferData call whose only argument is the blob, written through the blob table
+void WriteBlobCall(OutFile& out, const std::vector<char>& blob)
+{
+    std::vector<char> data(sizeof(BCall_vlen) + blob.size() + 64);
+    char* dest = out.WriteBlob(data.data() + sizeof(BCall_vlen), blob.data(), blob.size());
+    BCall_vlen call;
+    call.funcId = gApiInfo.NameToId("glBufferData");
+    call.toNext = dest - data.data();
+    memcpy(data.data(), &call, sizeof(call));
+    out.Write(data.data(), call.toNext);
+}
+
+// Writes count calls that cycle through the blobs of the given seeds
+void WriteTrace(const char* name, const std::vector<unsigned int>& seeds, unsigned int count, OutFile& out)
+{
+    out.EnableBlobTable(MIN_BLOB_SIZE);
+    CPPUNIT_ASSERT(out.Open(name));
+    for (unsigned int i = 0; i < count; ++i)
+        WriteBlobCall(out, MakeBlob(seeds[i % seeds.size()]));
+    CloseTrace(out);
+}
+
+// Reads all calls back with both readers, checking that every blob resolves
+// to its content
+void CheckTrace(const char* name, const std::vector<unsigned int>& seeds, unsigned int count)
+{
+    CheckReaders(name, count,
+        [&](InFileBase&, unsigned short, char* src, unsigned int index) {
+            Array<char> blob;
+            Read1DArray(src, blob);
+            const std::vector<char> expected = MakeBlob(seeds[index % seeds.size()]);
+            CPPUNIT_ASSERT(blob.cnt == expected.size());
+            CPPUNIT_ASSERT(memcmp(blob.v, expected.data(), expected.size()) == 0);
+        },
+        [](InFileBase& in, unsigned int) {
+            CPPUNIT_ASSERT(in.getHeaderVersion() >= HEADER_VERSION_5);
+        });
+    CPPUNIT_ASSERT(gBlobTable.Count() == seeds.size());
+}
+
+}
+
+BlobTableTest::BlobTableTest()
+{
+}
+
+void BlobTableTest::setUp()
+{
+}
+
+void BlobTableTest::tearDown()
+{
+    remove(TRACE_FILE);
+    remove(OTHER_TRACE_FILE);
+}
+
+void BlobTableTest::testDefine()
+{
+    BlobTable table;
+    const std::vector<char> blob = MakeBlob(1);
+    const MD5Digest digest(blob.data(), blob.size());
+    CPPUNIT_ASSERT(!table.Contains(digest));
+    CPPUNIT_ASSERT(table.Define(digest, blob.data(), blob.size()));
+    CPPUNIT_ASSERT(!table.Define(digest, blob.data(), blob.size()));
+    CPPUNIT_ASSERT(table.Count() == 1);
+    CPPUNIT_ASSERT(table.Bytes() == blob.size());
+
+    unsigned int len = 0;
+    const char* data = table.Lookup(digest, len);
+    CPPUNIT_ASSERT(data != NULL && len == blob.size());
+    CPPUNIT_ASSERT(memcmp(data, blob.data(), len) == 0);
+
+    // The first file opened starts with an empty table, others share it
+    table.OpenFile();
+    CPPUNIT_ASSERT(table.Count() == 0 && table.Bytes() == 0);
+    CPPUNIT_ASSERT(table.Define(digest, blob.data(), blob.size()));
+    table.OpenFile();
+    CPPUNIT_ASSERT(table.Count() == 1);
+    table.CloseFile();
+    table.CloseFile();
+    CPPUNIT_ASSERT(table.Count() == 1);
+    table.OpenFile();
+    CPPUNIT_ASSERT(!table.Contains(digest));
+    table.CloseFile();
+}
+
+void BlobTableTest::testRoundTrip()
+{
+    const std::vector<unsigned int> seeds = { 1, 2, 3 };
+    const unsigned int count = 30;
+    OutFile out;
+    WriteTrace(TRACE_FILE, seeds, count, out);
+    CPPUNIT_ASSERT(out.BlobTableHits() == count - seeds.size());
+    CPPUNIT_ASSERT(out.BlobTableSavedBytes() == (unsigned long long)(count - seeds.size()) * BLOB_SIZE);
+
+    CheckTrace(TRACE_FILE, seeds, count);
+
+    // Blobs below the minimum size are written inline
+    OutFile small;
+    small.EnableBlobTable(MIN_BLOB_SIZE);
+    CPPUNIT_ASSERT(small.Open(OTHER_TRACE_FILE));
+    for (unsigned int i = 0; i < 4; ++i)
+        WriteBlobCall(small, MakeBlob(1, MIN_BLOB_SIZE - 1));
+    CPPUNIT_ASSERT(small.BlobTableHits() == 0);
+    CloseTrace(small);
+}
+
+void BlobTableTest::testClearedBetweenFiles()
+{
+    const std::vector<unsigned int> seeds = { 1, 2, 3, 4 };
+    const std::vector<unsigned int> otherSeeds = { 5, 6 };
+    OutFile out;
+    WriteTrace(TRACE_FILE, seeds, 20, out);
+    OutFile other;
+    WriteTrace(OTHER_TRACE_FILE, otherSeeds, 10, other);
+
+    CheckTrace(TRACE_FILE, seeds, 20);
+    const std::vector<char> blob = MakeBlob(seeds[0]);
+    CPPUNIT_ASSERT(gBlobTable.Contains(MD5Digest(blob.data(), blob.size())));
+
+    // Nothing of the first file is kept once the second one is opened
+    CheckTrace(OTHER_TRACE_FILE, otherSeeds, 10);
+    CPPUNIT_ASSERT(!gBlobTable.Contains(MD5Digest(blob.data(), blob.size())));
+}
+
+void BlobTableTest::testSharedWhileOpen()
+{
+    const std::vector<unsigned int> seeds = { 7, 8 };
+    OutFile out;
+    WriteTrace(TRACE_FILE, seeds, 8, out);
+
+    // Opening an output file while reading keeps the blobs read so far,
+    // so that they can be written out again
+    InFile in;
+    in.prepareChunks();
+    CPPUNIT_ASSERT(in.Open(TRACE_FILE));
+    void* fptr = NULL;
+    BCall_vlen call;
+    char* src = NULL;
+    CPPUNIT_ASSERT(in.GetNextCall(fptr, call, src));
+    CPPUNIT_ASSERT(gBlobTable.Count() == 1);
+
+    OutFile copy;
+    CPPUNIT_ASSERT(copy.Open(OTHER_TRACE_FILE));
+    CPPUNIT_ASSERT(gBlobTable.Count() == 1);
+    copy.WriteKnownBlobDefinitions();
+    copy.Write(src - sizeof(BCall_vlen), call.toNext);
+    while (in.GetNextCall(fptr, call, src))
+    {
+        copy.WriteKnownBlobDefinitions();
+        copy.Write(src - sizeof(BCall_vlen), call.toNext);
+    }
+    CPPUNIT_ASSERT(gBlobTable.Count() == seeds.size());
+    CloseTrace(copy);
+    in.Close();
+
+    CheckTrace(OTHER_TRACE_FILE, seeds, 8);
+}
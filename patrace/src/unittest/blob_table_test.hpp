@@ -0,0 +1,29 @@
+#ifndef _INCLUDE_BLOB_TABLE_TEST_
+#define _INCLUDE_BLOB_TABLE_TEST_
+
+#include <cppunit/extensions/HelperMacros.h>
+
+class BlobTableTest : public CPPUNIT_NS::TestFixture
+{
+	CPPUNIT_TEST_SUITE(BlobTableTest);
+
+    CPPUNIT_TEST(testDefine);
+    CPPUNIT_TEST(testRoundTrip);
+    CPPUNIT_TEST(testClearedBetweenFiles);
+    CPPUNIT_TEST(testSharedWhileOpen);
+
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+    BlobTableTest();
+
+    virtual void setUp();
+    virtual void tearDown();
+
+    void testDefine();
+    void testRoundTrip();
+    void testClearedBetweenFiles();
+    void testSharedWhileOpen();
+};
+
+#endif
@@ -0,0 +1,197 @@
+#include <stdlib.h>
+
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "callnoset_test.hpp"
+#include "newfastforwarder/callnoset.hpp"
+
+namespace {
+
+// Same members in the same order as the reference
+bool Same(const CallNoSet& set, const std::set<unsigned int>& reference)
+{
+    if (set.size() != reference.size())
+        return false;
+    std::vector<unsigned int> members(set.begin(), set.end());
+    return members == std::vector<unsigned int>(reference.begin(), reference.end());
+}
+
+}
+
+CallNoSetTest::CallNoSetTest()
+{
+}
+
+void CallNoSetTest::setUp()
+{
+}
+
+void CallNoSetTest::tearDown()
+{
+}
+
+void CallNoSetTest::testInsertErase()
+{
+    CallNoSet set;
+    CPPUNIT_ASSERT(set.empty());
+    CPPUNIT_ASSERT(set.begin() == set.end());
+
+    CPPUNIT_ASSERT(set.insert(5) == true);
+    CPPUNIT_ASSERT(set.insert(5) == false);
+    CPPUNIT_ASSERT(set.insert(3) == true);
+    CPPUNIT_ASSERT(set.insert(CallNoSet::PAGE_SIZE * 3 + 1) == true);
+    CPPUNIT_ASSERT(set.size() == 3);
+    CPPUNIT_ASSERT(set.count(3) == 1);
+    CPPUNIT_ASSERT(set.count(4) == 0);
+    CPPUNIT_ASSERT(set.count(CallNoSet::PAGE_SIZE * 3 + 1) == 1);
+    CPPUNIT_ASSERT(set.find(4) == set.end());
+    CPPUNIT_ASSERT(*set.find(5) == 5);
+
+    CPPUNIT_ASSERT(set.erase(4) == 0);
+    CPPUNIT_ASSERT(set.erase(CallNoSet::PAGE_SIZE * 2) == 0);
+    CPPUNIT_ASSERT(set.erase(3) == 1);
+    CPPUNIT_ASSERT(set.erase(3) == 0);
+    CPPUNIT_ASSERT(set.size() == 2);
+    CPPUNIT_ASSERT(*set.begin() == 5);
+
+    // Erasing the last member of a page drops the page
+    CPPUNIT_ASSERT(set.erase(CallNoSet::PAGE_SIZE * 3 + 1) == 1);
+    CPPUNIT_ASSERT(set.size() == 1);
+    CPPUNIT_ASSERT(++set.begin() == set.end());
+
+    set.clear();
+    CPPUNIT_ASSERT(set.empty());
+    CPPUNIT_ASSERT(set.count(5) == 0);
+}
+
+void CallNoSetTest::testBitmap()
+{
+    // Fill a page past MAX_ARRAY_SIZE, out of order, so that it becomes a bitmap
+    const unsigned int base = CallNoSet::PAGE_SIZE * 7;
+    CallNoSet set;
+    std::set<unsigned int> reference;
+    for (unsigned int i = 0; i < CallNoSet::MAX_ARRAY_SIZE * 2; ++i)
+    {
+        const unsigned int callNo = base + (i * 37) % CallNoSet::PAGE_SIZE;
+        CPPUNIT_ASSERT(set.insert(callNo) == reference.insert(callNo).second);
+    }
+    CPPUNIT_ASSERT(Same(set, reference));
+    CPPUNIT_ASSERT(set.count(base + 37) == 1);
+    CPPUNIT_ASSERT(set.count(base + 38) == 0);
+    CPPUNIT_ASSERT(*set.find(base + 74) == base + 74);
+
+    // Both ends of the bitmap
+    CPPUNIT_ASSERT(set.insert(base) == reference.insert(base).second);
+    CPPUNIT_ASSERT(set.insert(base + CallNoSet::PAGE_SIZE - 1) == reference.insert(base + CallNoSet::PAGE_SIZE - 1).second);
+    CPPUNIT_ASSERT(Same(set, reference));
+
+    for (unsigned int i = 0; i < CallNoSet::PAGE_SIZE; i += 3)
+    {
+        CPPUNIT_ASSERT(set.erase(base + i) == reference.erase(base + i));
+    }
+    CPPUNIT_ASSERT(Same(set, reference));
+}
+
+void CallNoSetTest::testUnion()
+{
+    // Pages only in one set, array with array, array with bitmap and bitmap with bitmap
+    CallNoSet a, b;
+    std::set<unsigned int> reference;
+    const unsigned int P = CallNoSet::PAGE_SIZE;
+    for (unsigned int i = 0; i < 10; ++i)
+    {
+        a.insert(i * 2); reference.insert(i * 2);
+        b.insert(i * 3); reference.insert(i * 3);
+        a.insert(P + i); reference.insert(P + i);
+        b.insert(P * 2 + i); reference.insert(P * 2 + i);
+    }
+    for (unsigned int i = 0; i < P; i += 2)
+    {
+        a.insert(P * 3 + i); reference.insert(P * 3 + i);
+        b.insert(P * 4 + i); reference.insert(P * 4 + i);
+        b.insert(P * 5 + i + 1); reference.insert(P * 5 + i + 1);
+    }
+    for (unsigned int i = 0; i < 10; ++i)
+    {
+        b.insert(P * 3 + i * 5); reference.insert(P * 3 + i * 5);
+        a.insert(P * 4 + i * 5); reference.insert(P * 4 + i * 5);
+        a.insert(P * 5 + i * 2); reference.insert(P * 5 + i * 2);
+    }
+
+    CallNoSet c(a);
+    c.insert(b);
+    CPPUNIT_ASSERT(Same(c, reference));
+
+    // Through iterators, as std::set does it
+    CallNoSet d(b);
+    d.insert(a.begin(), a.end());
+    CPPUNIT_ASSERT(Same(d, reference));
+
+    // A partial range is added member by member
+    CallNoSet e;
+    e.insert(a.find(P * 3), a.end());
+    std::set<unsigned int> partial;
+    for (CallNoSet::const_iterator it = a.find(P * 3); it != a.end(); ++it)
+        partial.insert(*it);
+    CPPUNIT_ASSERT(Same(e, partial));
+
+    c.insert(c);
+    CPPUNIT_ASSERT(Same(c, reference));
+}
+
+void CallNoSetTest::testIteration()
+{
+    CallNoSet set;
+    std::set<unsigned int> reference;
+    srand(1);
+    for (unsigned int i = 0; i < 20000; ++i)
+    {
+        // Mostly nearby calls, some far away
+        const unsigned int callNo = (rand() % 8 == 0) ? rand() : rand() % (CallNoSet::PAGE_SIZE * 4);
+        CPPUNIT_ASSERT(set.insert(callNo) == reference.insert(callNo).second);
+    }
+    CPPUNIT_ASSERT(Same(set, reference));
+
+    unsigned int previous = 0;
+    bool first = true;
+    for (CallNoSet::const_iterator it = set.begin(); it != set.end(); it++)
+    {
+        CPPUNIT_ASSERT(first || *it > previous);
+        previous = *it;
+        first = false;
+    }
+}
+
+void CallNoSetTest::testRuns()
+{
+    const unsigned int P = CallNoSet::PAGE_SIZE;
+    CallNoSet set;
+    std::vector<std::pair<unsigned int, unsigned int> > expected;
+    // A single call, a run across a page boundary, and a run through a bitmap page
+    set.insert(0);
+    expected.push_back(std::make_pair(0u, 0u));
+    for (unsigned int i = P - 5; i < P + 5; ++i)
+        set.insert(i);
+    expected.push_back(std::make_pair(P - 5, P + 4));
+    for (unsigned int i = 2 * P; i < 3 * P; ++i)
+        set.insert(i);
+    set.insert(3 * P + 1);
+    expected.push_back(std::make_pair(2 * P, 3 * P - 1));
+    expected.push_back(std::make_pair(3 * P + 1, 3 * P + 1));
+
+    std::vector<std::pair<unsigned int, unsigned int> > runs;
+    set.forEachRun([&runs](unsigned int first, unsigned int last)
+    {
+        runs.push_back(std::make_pair(first, last));
+    });
+    CPPUNIT_ASSERT(runs == expected);
+
+    runs.clear();
+    CallNoSet().forEachRun([&runs](unsigned int first, unsigned int last)
+    {
+        runs.push_back(std::make_pair(first, last));
+    });
+    CPPUNIT_ASSERT(runs.empty());
+}
@@ -0,0 +1,31 @@
+#ifndef _INCLUDE_CALLNOSET_TEST_
+#define _INCLUDE_CALLNOSET_TEST_
+
+#include <cppunit/extensions/HelperMacros.h>
+
+class CallNoSetTest : public CPPUNIT_NS::TestFixture
+{
+	CPPUNIT_TEST_SUITE(CallNoSetTest);
+
+    CPPUNIT_TEST(testInsertErase);
+    CPPUNIT_TEST(testBitmap);
+    CPPUNIT_TEST(testUnion);
+    CPPUNIT_TEST(testIteration);
+    CPPUNIT_TEST(testRuns);
+
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+    CallNoSetTest();
+
+    virtual void setUp();
+    virtual void tearDown();
+
+    void testInsertErase();
+    void testBitmap();
+    void testUnion();
+    void testIteration();
+    void testRuns();
+};
+
+#endif
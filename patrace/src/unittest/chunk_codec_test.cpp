@@ -0,0 +1,148 @@
+#include <stdio.h>
+
+#include <vector>
+
+#include "chunk_codec_test.hpp"
+#include "trace_test_util.hpp"
+#include "common/chunk_codec.hpp"
+#include "common/out_file.hpp"
+
+using namespace common;
+using namespace trace_test;
+
+namespace {
+
+const char* TRACE_FILE = "chunk_codec_test.pat";
+
+}
+
+ChunkCodecTest::ChunkCodecTest()
+{
+}
+
+void ChunkCodecTest::setUp()
+{
+}
+
+void ChunkCodecTest::tearDown()
+{
+    remove(TRACE_FILE);
+}
+
+void ChunkCodecTest::testLengthWord()
+{
+    const unsigned int word = ChunkLengthWord(CHUNK_CODEC_ZLIB, 12345);
+    CPPUNIT_ASSERT(ChunkLengthWordCodec(word, HEADER_VERSION_6) == CHUNK_CODEC_ZLIB);
+    CPPUNIT_ASSERT(ChunkLengthWordLength(word, HEADER_VERSION_6) == 12345);
+    CPPUNIT_ASSERT(!ChunkLengthWordIsLong(word, HEADER_VERSION_6));
+
+    // Chunks too long for 28 bits have their length in the next word
+    const unsigned int longWord = ChunkLengthWord(CHUNK_CODEC_STORE, CHUNK_LENGTH_MASK + 1);
+    CPPUNIT_ASSERT(ChunkLengthWordCodec(longWord, HEADER_VERSION_6) == CHUNK_CODEC_STORE);
+    CPPUNIT_ASSERT(ChunkLengthWordIsLong(longWord, HEADER_VERSION_6));
+    CPPUNIT_ASSERT(ChunkLengthWordIsLong(ChunkLengthWord(CHUNK_CODEC_SNAPPY, CHUNK_LENGTH_MASK), HEADER_VERSION_6));
+}
+
+void ChunkCodecTest::testLegacyLengthWord()
+{
+    // Before HEADER_VERSION_6 all 32 bits are the length of a snappy chunk
+    const unsigned int word = 0xF0000010;
+    for (int version = HEADER_VERSION_1; version < HEADER_VERSION_6; ++version)
+    {
+        CPPUNIT_ASSERT(ChunkLengthWordCodec(word, (HeaderVersion)version) == CHUNK_CODEC_SNAPPY);
+        CPPUNIT_ASSERT(ChunkLengthWordLength(word, (HeaderVersion)version) == word);
+        CPPUNIT_ASSERT(!ChunkLengthWordIsLong(word, (HeaderVersion)version));
+        CPPUNIT_ASSERT(!ChunkLengthWordIsLong(CHUNK_LENGTH_MASK, (HeaderVersion)version));
+    }
+    CPPUNIT_ASSERT(ChunkLengthWordCodec(word, HEADER_VERSION_6) == 0xF);
+    CPPUNIT_ASSERT(ChunkLengthWordLength(word, HEADER_VERSION_6) == 0x10);
+}
+
+void ChunkCodecTest::testCodecs()
+{
+    std::vector<char> data(100000);
+    for (unsigned int i = 0; i < data.size(); ++i)
+        data[i] = (char)(i % 251 < 100 ? i : i * 7919 >> 3);
+
+    for (unsigned int id = 0; id < CHUNK_CODEC_COUNT; ++id)
+    {
+        const ChunkCodec* codec = GetChunkCodec(id);
+        CPPUNIT_ASSERT(codec != NULL);
+        CPPUNIT_ASSERT(codec->Id() == (ChunkCodecId)id);
+        CPPUNIT_ASSERT(GetChunkCodec(codec->Name()) == codec);
+
+        std::vector<char> compressed(codec->MaxCompressedLength(data.size()));
+        size_t compressedLength = 0;
+        CPPUNIT_ASSERT(codec->Compress(data.data(), data.size(), compressed.data(), &compressedLength));
+        CPPUNIT_ASSERT(compressedLength <= compressed.size());
+
+        size_t length = 0;
+        CPPUNIT_ASSERT(codec->GetUncompressedLength(compressed.data(), compressedLength, &length));
+        CPPUNIT_ASSERT(length == data.size());
+        std::vector<char> uncompressed(length);
+        CPPUNIT_ASSERT(codec->Uncompress(compressed.data(), compressedLength, uncompressed.data()));
+        CPPUNIT_ASSERT(uncompressed == data);
+    }
+    CPPUNIT_ASSERT(GetChunkCodec(CHUNK_CODEC_COUNT) == NULL);
+    CPPUNIT_ASSERT(GetChunkCodec("lz77") == NULL);
+}
+
+void ChunkCodecTest::testTightAndStretch()
+{
+    std::vector<char> data(100000);
+    for (unsigned int i = 0; i < data.size(); ++i)
+        data[i] = (char)(i % 251 < 100 ? i : i * 7919 >> 3);
+
+    for (unsigned int id = 0; id < CHUNK_CODEC_COUNT; ++id)
+    {
+        const ChunkCodec* codec = GetChunkCodec(id);
+        std::vector<char> compressed(codec->MaxCompressedLength(data.size()));
+        size_t compressedLength = 0;
+        CPPUNIT_ASSERT(codec->Compress(data.data(), data.size(), compressed.data(), &compressedLength));
+        size_t tightLength = 0;
+        CPPUNIT_ASSERT(codec->CompressTight(data.data(), data.size(), compressed.data(), &tightLength));
+        CPPUNIT_ASSERT(tightLength <= compressedLength);
+
+        // Every codec can keep the length, only some can grow it
+        for (size_t extra = 0; extra < 8; ++extra)
+        {
+            std::vector<char> stretched(tightLength + extra);
+            if (!codec->Stretch(compressed.data(), tightLength, stretched.data(), stretched.size()))
+            {
+                CPPUNIT_ASSERT(extra > 0 && id == CHUNK_CODEC_STORE);
+                continue;
+            }
+            size_t length = 0;
+            CPPUNIT_ASSERT(codec->GetUncompressedLength(stretched.data(), stretched.size(), &length));
+            CPPUNIT_ASSERT(length == data.size());
+            std::vector<char> uncompressed(length);
+            CPPUNIT_ASSERT(codec->Uncompress(stretched.data(), stretched.size(), uncompressed.data()));
+            CPPUNIT_ASSERT(uncompressed == data);
+        }
+        std::vector<char> shorter(tightLength - 1);
+        CPPUNIT_ASSERT(!codec->Stretch(compressed.data(), tightLength, shorter.data(), shorter.size()));
+    }
+}
+
+void ChunkCodecTest::testTraceRoundTrip()
+{
+    const unsigned int callCount = 20000;
+    for (unsigned int id = 0; id < CHUNK_CODEC_COUNT; ++id)
+    {
+        OutFile out;
+        out.SetChunkSize(64 * 1024);
+        out.SetChunkCodec((ChunkCodecId)id);
+        CPPUNIT_ASSERT(out.Open(TRACE_FILE));
+        WriteCalls(out, callCount);
+        CloseTrace(out);
+
+        const HeaderVersion version = id == CHUNK_CODEC_SNAPPY ? HEADER_VERSION_4 : HEADER_VERSION_6;
+        CheckReaders(TRACE_FILE, callCount,
+            [](InFileBase&, unsigned short, char* src, unsigned int index) {
+                CPPUNIT_ASSERT(IsCall(src, index));
+            },
+            [&](InFileBase& in, unsigned int) {
+                CPPUNIT_ASSERT(in.getHeaderVersion() == version);
+            });
+    }
+}
@@ -0,0 +1,31 @@
+#ifndef _INCLUDE_CHUNK_CODEC_TEST_
+#define _INCLUDE_CHUNK_CODEC_TEST_
+
+#include <cppunit/extensions/HelperMacros.h>
+
+class ChunkCodecTest : public CPPUNIT_NS::TestFixture
+{
+	CPPUNIT_TEST_SUITE(ChunkCodecTest);
+
+    CPPUNIT_TEST(testLengthWord);
+    CPPUNIT_TEST(testLegacyLengthWord);
+    CPPUNIT_TEST(testCodecs);
+    CPPUNIT_TEST(testTightAndStretch);
+    CPPUNIT_TEST(testTraceRoundTrip);
+
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+    ChunkCodecTest();
+
+    virtual void setUp();
+    virtual void tearDown();
+
+    void testLengthWord();
+    void testLegacyLengthWord();
+    void testCodecs();
+    void testTightAndStretch();
+    void testTraceRoundTrip();
+};
+
+#endif
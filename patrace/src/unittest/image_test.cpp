@@ -1,12 +1,17 @@
 #include <GLES2/gl2.h>
 #include <GLES2/gl2ext.h>
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 #include "image_test.hpp"
 #include "eglstate/common.hpp"
 #include "system/environment_variable.hpp"
 #include "image/image_compression.hpp"
 #include "image/image.hpp"
 #include "image/image_io.hpp"
+#include "common/image_compare.hpp"
 
 using namespace pat;
 
@@ -167,6 +172,53 @@ void ImageTest::testETC1()
     CPPUNIT_ASSERT(input.DataSize() == 24);
 }
 
+void ImageTest::testETC1Fast()
+{
+    CPPUNIT_ASSERT(IsValidCompressionOption("ETC1_FAST"));
+    CPPUNIT_ASSERT(CheckCompressionOptionSupport("ETC1_FAST"));
+    CPPUNIT_ASSERT(CanCompressAs(GL_RGB, GL_UNSIGNED_BYTE, "ETC1_FAST"));
+    CPPUNIT_ASSERT(CanCompressAs(GL_RGBA, GL_UNSIGNED_BYTE, "ETC1_FAST") == false);
+
+    // A gradient with partial blocks on the right and bottom edges
+    const UInt32 width = 70, height = 37;
+    std::vector<UInt8> raw_data(width * height * 3);
+    for (UInt32 y = 0; y < height; ++y)
+    {
+        for (UInt32 x = 0; x < width; ++x)
+        {
+            UInt8 *p = &raw_data[(y * width + x) * 3];
+            p[0] = x * 3;
+            p[1] = y * 6;
+            p[2] = 255 - x - y;
+        }
+    }
+    Image input(width, height, GL_RGB, GL_UNSIGNED_BYTE, raw_data.size(), raw_data.data(), false, false);
+    Image output, threaded, uncompressed;
+    SetCompressionThreads(1);
+    CPPUNIT_ASSERT(Compress(input, output, "ETC1_FAST"));
+    CPPUNIT_ASSERT(output.Width() == width);
+    CPPUNIT_ASSERT(output.Height() == height);
+    CPPUNIT_ASSERT(output.Format() == GL_ETC1_RGB8_OES);
+    CPPUNIT_ASSERT(output.Type() == GL_NONE);
+    CPPUNIT_ASSERT(output.DataSize() == 18 * 10 * 8);
+
+    // The blocks do not depend on each other, so neither does the result on the threads
+    SetCompressionThreads(3);
+    CPPUNIT_ASSERT(Compress(input, threaded, "ETC1_FAST"));
+    SetCompressionThreads(0);
+    CPPUNIT_ASSERT(threaded.DataSize() == output.DataSize());
+    CPPUNIT_ASSERT(memcmp(threaded.Data(), output.Data(), output.DataSize()) == 0);
+
+    CPPUNIT_ASSERT(Uncompress(output, uncompressed));
+    CPPUNIT_ASSERT(uncompressed.DataSize() == raw_data.size());
+    int maxDiff = 0;
+    for (UInt32 i = 0; i < raw_data.size(); ++i)
+    {
+        maxDiff = std::max(maxDiff, abs(uncompressed.Data()[i] - raw_data[i]));
+    }
+    CPPUNIT_ASSERT(maxDiff <= 16);
+}
+
 void ImageTest::testETC2()
 {
     CPPUNIT_ASSERT(IsValidCompressionOption("ETC2_A1"));
@@ -325,3 +377,34 @@ void ImageTest::testMipmap()
     //CPPUNIT_ASSERT(first_level.Type() == GL_UNSIGNED_BYTE);
     //CPPUNIT_ASSERT(memcmp(first_level.Data(), first_level_data, first_level.DataSize()) == 0);
 }
+
+void ImageTest::testCompareImages()
+{
+    image::Image ref(4, 2, 4), same(4, 2, 4), other(4, 2, 4), small(2, 2, 4);
+    for (unsigned i = 0; i < ref.size(); ++i)
+    {
+        ref.pixels[i] = same.pixels[i] = other.pixels[i] = i * 7;
+    }
+    memset(small.pixels, 0, small.size());
+
+    image::ImageDiff diff;
+    CPPUNIT_ASSERT(image::compareImages(same, ref, diff));
+    CPPUNIT_ASSERT(diff.identical());
+    CPPUNIT_ASSERT(diff.pixels == 8);
+    CPPUNIT_ASSERT(diff.differingPixels == 0);
+    CPPUNIT_ASSERT(diff.maxAbsDiff == 0);
+
+    // Change the red channel of one pixel by 10
+    other.pixels[4] += 10;
+    image::ImageDiff diff2;
+    CPPUNIT_ASSERT(image::compareImages(other, ref, diff2));
+    CPPUNIT_ASSERT(!diff2.identical());
+    CPPUNIT_ASSERT(diff2.differingPixels == 1);
+    CPPUNIT_ASSERT(diff2.maxAbsDiff == 10);
+    CPPUNIT_ASSERT(diff2.channel[0].maxAbsDiff == 10);
+    CPPUNIT_ASSERT(diff2.channel[1].maxAbsDiff == 0);
+    CPPUNIT_ASSERT(diff2.mse > 0.0);
+
+    image::ImageDiff diff3;
+    CPPUNIT_ASSERT(!image::compareImages(small, ref, diff3));
+}
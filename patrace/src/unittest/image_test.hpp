@@ -12,9 +12,11 @@ class ImageTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST(testCompressionCommon);
     CPPUNIT_TEST(testBTC);
     CPPUNIT_TEST(testETC1);
+    CPPUNIT_TEST(testETC1Fast);
     CPPUNIT_TEST(testETC2);
     CPPUNIT_TEST(testASTC);
     CPPUNIT_TEST(testMipmap);
+    CPPUNIT_TEST(testCompareImages);
 
 	CPPUNIT_TEST_SUITE_END();
 
@@ -29,9 +31,11 @@ public:
     void testCompressionCommon();
     void testBTC();
     void testETC1();
+    void testETC1Fast();
     void testETC2();
     void testASTC();
     void testMipmap();
+    void testCompareImages();
 
     void testFormatTypeTraits();
     void testGenerateImageViewFromRawPixels();
@@ -0,0 +1,243 @@
+#include <stdlib.h>
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <list>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "index_buffer_stats_test.hpp"
+#include "tool/index_buffer_stats.hpp"
+
+namespace {
+
+// The straightforward analysis with a map and a set per draw, which the flat arrays replaced
+template<class T>
+IndexBufferStats ReferenceStats(const std::vector<T>& elements, bool primitive_restart)
+{
+    IndexBufferStats stats;
+    const int count = elements.size();
+    std::map<T, long> cache;
+    long timestamp = 0;
+    std::set<T> seen;
+    int sum_age = 0;
+    std::deque<T> fifo;
+    std::list<T> lru;
+    int accesses = 0;
+    int fifo_hits = 0;
+    int lru_hits = 0;
+    for (int idx = 0; idx < count; idx++)
+    {
+        const T element = elements[idx];
+        const long age = cache.count(element) ? std::min<long>(timestamp - cache[element], cache_size) : cache_size;
+        seen.insert(element);
+        cache[element] = timestamp++;
+        sum_age += age;
+        if (primitive_restart && element == std::numeric_limits<T>::max())
+        {
+            stats.restarts++;
+            continue;
+        }
+        accesses++;
+
+        if (std::find(fifo.begin(), fifo.end(), element) != fifo.end())
+        {
+            fifo_hits++;
+        }
+        else
+        {
+            fifo.push_back(element);
+            if ((int)fifo.size() > vertex_cache_entries)
+                fifo.pop_front();
+        }
+
+        typename std::list<T>::iterator it = std::find(lru.begin(), lru.end(), element);
+        if (it != lru.end())
+        {
+            lru_hits++;
+            lru.erase(it);
+        }
+        lru.push_back(element);
+        if ((int)lru.size() > vertex_cache_entries)
+            lru.pop_front();
+    }
+    stats.temporal_locality = 1.0 - (double)(sum_age / count) / (double)cache_size;
+    stats.fifo_hit_rate = accesses ? (double)fifo_hits / (double)accesses : 0.0;
+    stats.lru_hit_rate = accesses ? (double)lru_hits / (double)accesses : 0.0;
+    stats.unique_vertices = seen.size();
+    stats.min_value = *seen.begin();
+    stats.max_value = *seen.rbegin();
+    T prev = *seen.begin();
+    int shaded_verts = 4;
+    for (const T v : seen)
+    {
+        if (v - (prev / 4) * 4 >= 4)
+        {
+            shaded_verts += 4;
+        }
+        T distance = std::max<T>(1, v - prev);
+        stats.max_sparseness = std::max<T>(distance, stats.max_sparseness);
+        stats.avg_sparseness += distance;
+        prev = v;
+    }
+    stats.vec4_locality = (double)seen.size() / (double)shaded_verts;
+    stats.avg_sparseness /= seen.size();
+    stats.spatial_locality = 1.0 / stats.avg_sparseness;
+    return stats;
+}
+
+bool Same(const IndexBufferStats& a, const IndexBufferStats& b)
+{
+    return a.restarts == b.restarts && a.unique_vertices == b.unique_vertices
+        && a.max_sparseness == b.max_sparseness && a.avg_sparseness == b.avg_sparseness
+        && a.max_value == b.max_value && a.min_value == b.min_value
+        && a.vec4_locality == b.vec4_locality && a.temporal_locality == b.temporal_locality
+        && a.spatial_locality == b.spatial_locality
+        && a.fifo_hit_rate == b.fifo_hit_rate && a.lru_hit_rate == b.lru_hit_rate;
+}
+
+template<class T>
+bool MatchesReference(const std::vector<T>& elements, GLenum type, bool primitive_restart)
+{
+    IndexBufferStats stats;
+    if (!analyzeIndexBuffer(elements.data(), type, elements.size(), primitive_restart, stats))
+        return false;
+    return Same(stats, ReferenceStats(elements, primitive_restart));
+}
+
+// Indices near each other, as in a mesh, drawn from count / spread values above low
+template<class T>
+std::vector<T> RandomIndices(int count, unsigned low, unsigned spread, unsigned seed)
+{
+    srand(seed);
+    std::vector<T> elements;
+    unsigned base = 0;
+    for (int idx = 0; idx < count; idx++)
+    {
+        if (rand() % 8 == 0)
+            base = rand() % spread;
+        elements.push_back(low + (base + rand() % 16) % spread);
+    }
+    return elements;
+}
+
+}
+
+IndexBufferStatsTest::IndexBufferStatsTest()
+{
+}
+
+void IndexBufferStatsTest::setUp()
+{
+}
+
+void IndexBufferStatsTest::tearDown()
+{
+}
+
+void IndexBufferStatsTest::testDense()
+{
+    for (unsigned seed = 1; seed <= 10; ++seed)
+    {
+        CPPUNIT_ASSERT(MatchesReference(RandomIndices<GLubyte>(300, 10, 200, seed), GL_UNSIGNED_BYTE, false));
+        CPPUNIT_ASSERT(MatchesReference(RandomIndices<GLushort>(3000, 1000, 2000, seed), GL_UNSIGNED_SHORT, false));
+        CPPUNIT_ASSERT(MatchesReference(RandomIndices<GLuint>(5000, 100000, 4000, seed), GL_UNSIGNED_INT, false));
+    }
+
+    // A single index
+    CPPUNIT_ASSERT(MatchesReference(std::vector<GLushort>(1, 7), GL_UNSIGNED_SHORT, false));
+}
+
+void IndexBufferStatsTest::testSparse()
+{
+    // The range of values is much larger than the number of indices, so they are ranked
+    for (unsigned seed = 1; seed <= 10; ++seed)
+    {
+        std::vector<GLuint> elements = RandomIndices<GLuint>(2000, 0, 200, seed);
+        for (unsigned idx = 0; idx < elements.size(); ++idx)
+            elements[idx] = elements[idx] * 100003u + (idx % 3 ? 0 : 1u << 30);
+        CPPUNIT_ASSERT(MatchesReference(elements, GL_UNSIGNED_INT, false));
+
+        std::vector<GLushort> shorts = RandomIndices<GLushort>(100, 0, 60, seed);
+        for (unsigned idx = 0; idx < shorts.size(); ++idx)
+            shorts[idx] *= 1000;
+        CPPUNIT_ASSERT(MatchesReference(shorts, GL_UNSIGNED_SHORT, false));
+    }
+}
+
+void IndexBufferStatsTest::testPrimitiveRestart()
+{
+    for (unsigned seed = 1; seed <= 10; ++seed)
+    {
+        std::vector<GLubyte> bytes = RandomIndices<GLubyte>(400, 0, 250, seed);
+        std::vector<GLushort> shorts = RandomIndices<GLushort>(400, 0, 300, seed);
+        std::vector<GLuint> ints = RandomIndices<GLuint>(400, 0, 300, seed);
+        for (unsigned idx = 0; idx < 400; idx += 7 + seed)
+        {
+            bytes[idx] = std::numeric_limits<GLubyte>::max();
+            shorts[idx] = std::numeric_limits<GLushort>::max();
+            ints[idx] = std::numeric_limits<GLuint>::max();
+        }
+        CPPUNIT_ASSERT(MatchesReference(bytes, GL_UNSIGNED_BYTE, true));
+        CPPUNIT_ASSERT(MatchesReference(shorts, GL_UNSIGNED_SHORT, true));
+        CPPUNIT_ASSERT(MatchesReference(ints, GL_UNSIGNED_INT, true));
+        // Without primitive restart the restart index is an ordinary vertex
+        CPPUNIT_ASSERT(MatchesReference(bytes, GL_UNSIGNED_BYTE, false));
+        CPPUNIT_ASSERT(MatchesReference(shorts, GL_UNSIGNED_SHORT, false));
+    }
+
+    std::vector<GLushort> strips;
+    for (int strip = 0; strip < 4; ++strip)
+    {
+        for (int idx = 0; idx < 6; ++idx)
+            strips.push_back(strip * 6 + idx);
+        strips.push_back(0xffff);
+    }
+    IndexBufferStats stats;
+    CPPUNIT_ASSERT(analyzeIndexBuffer(strips.data(), GL_UNSIGNED_SHORT, strips.size(), true, stats));
+    CPPUNIT_ASSERT(stats.restarts == 4);
+    CPPUNIT_ASSERT(stats.fifo_hit_rate == 0.0);
+}
+
+void IndexBufferStatsTest::testVertexCache()
+{
+    // Cycling through exactly as many vertices as the caches hold hits after the first round
+    std::vector<GLushort> elements;
+    for (int round = 0; round < 4; ++round)
+        for (int idx = 0; idx < vertex_cache_entries; ++idx)
+            elements.push_back(idx);
+    IndexBufferStats stats;
+    CPPUNIT_ASSERT(analyzeIndexBuffer(elements.data(), GL_UNSIGNED_SHORT, elements.size(), false, stats));
+    CPPUNIT_ASSERT(stats.fifo_hit_rate == 0.75);
+    CPPUNIT_ASSERT(stats.lru_hit_rate == 0.75);
+    CPPUNIT_ASSERT(stats.unique_vertices == vertex_cache_entries);
+
+    // One vertex more and both caches always evict the vertex about to be used
+    elements.clear();
+    for (int round = 0; round < 4; ++round)
+        for (int idx = 0; idx <= vertex_cache_entries; ++idx)
+            elements.push_back(idx);
+    CPPUNIT_ASSERT(analyzeIndexBuffer(elements.data(), GL_UNSIGNED_SHORT, elements.size(), false, stats));
+    CPPUNIT_ASSERT(stats.fifo_hit_rate == 0.0);
+    CPPUNIT_ASSERT(stats.lru_hit_rate == 0.0);
+
+    // Reusing vertex 0 keeps it in the LRU cache but not in the FIFO cache
+    elements.clear();
+    for (int idx = 1; idx <= 4 * vertex_cache_entries; ++idx)
+    {
+        elements.push_back(0);
+        elements.push_back(idx);
+    }
+    CPPUNIT_ASSERT(MatchesReference(elements, GL_UNSIGNED_SHORT, false));
+    CPPUNIT_ASSERT(analyzeIndexBuffer(elements.data(), GL_UNSIGNED_SHORT, elements.size(), false, stats));
+    CPPUNIT_ASSERT(stats.lru_hit_rate > stats.fifo_hit_rate);
+}
+
+void IndexBufferStatsTest::testUnknownType()
+{
+    const GLfloat elements[] = { 0.0f, 1.0f, 2.0f };
+    IndexBufferStats stats;
+    CPPUNIT_ASSERT(!analyzeIndexBuffer(elements, GL_FLOAT, 3, false, stats));
+}
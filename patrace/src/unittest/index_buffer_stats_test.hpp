@@ -0,0 +1,31 @@
+#ifndef _INCLUDE_INDEX_BUFFER_STATS_TEST_
+#define _INCLUDE_INDEX_BUFFER_STATS_TEST_
+
+#include <cppunit/extensions/HelperMacros.h>
+
+class IndexBufferStatsTest : public CPPUNIT_NS::TestFixture
+{
+	CPPUNIT_TEST_SUITE(IndexBufferStatsTest);
+
+    CPPUNIT_TEST(testDense);
+    CPPUNIT_TEST(testSparse);
+    CPPUNIT_TEST(testPrimitiveRestart);
+    CPPUNIT_TEST(testVertexCache);
+    CPPUNIT_TEST(testUnknownType);
+
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+    IndexBufferStatsTest();
+
+    virtual void setUp();
+    virtual void tearDown();
+
+    void testDense();
+    void testSparse();
+    void testPrimitiveRestart();
+    void testVertexCache();
+    void testUnknownType();
+};
+
+#endif
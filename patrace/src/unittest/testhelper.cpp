@@ -4,6 +4,13 @@
 #include "context_test.hpp"
 #include "system_test.hpp"
 #include "image_test.hpp"
+#include "yuv_test.hpp"
+#include "chunk_codec_test.hpp"
+#include "callnoset_test.hpp"
+#include "trace_patcher_test.hpp"
+#include "index_buffer_stats_test.hpp"
+#include "blob_table_test.hpp"
+#include "upload_tracker_test.hpp"
 
 #define TEST(name) \
 /* Registers the fixture into the "all tests" registry */ \
@@ -17,3 +24,10 @@ TEST(MemoryTest)
 TEST(ContextTest)
 TEST(SystemTest)
 TEST(ImageTest)
+TEST(YUVTest)
+TEST(ChunkCodecTest)
+TEST(CallNoSetTest)
+TEST(TracePatcherTest)
+TEST(IndexBufferStatsTest)
+TEST(BlobTableTest)
+TEST(UploadTrackerTest)
@@ -0,0 +1,166 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "trace_patcher_test.hpp"
+#include "trace_test_util.hpp"
+#include "common/api_info.hpp"
+#include "common/in_file.hpp"
+#include "common/out_file.hpp"
+#include "common/trace_patcher.hpp"
+
+using namespace common;
+using namespace trace_test;
+
+namespace {
+
+const char* TRACE_FILE = "trace_patcher_test.pat";
+const unsigned int CALL_COUNT = 5000;
+
+// The names of the functions up to and including glClear, which is the only
+// function the calls use, so that the sigbook can grow and shrink
+std::vector<std::string> InitialSigBook()
+{
+    std::vector<std::string> sigbook(1);
+    for (unsigned short id = 1; id <= gApiInfo.NameToId("glClear"); ++id)
+        sigbook.push_back(ApiInfo::IdToNameArr[id] ? ApiInfo::IdToNameArr[id] : "");
+    return sigbook;
+}
+
+// Every function the reader knows, as a recorded trace has them
+std::vector<std::string> FullSigBook()
+{
+    std::vector<std::string> sigbook = InitialSigBook();
+    for (unsigned short id = sigbook.size(); id <= ApiInfo::MaxSigId; ++id)
+        sigbook.push_back(ApiInfo::IdToNameArr[id] ? ApiInfo::IdToNameArr[id] : "");
+    return sigbook;
+}
+
+void WriteTrace(ChunkCodecId codec, const std::vector<std::string>& sigbook = InitialSigBook())
+{
+    OutFile out;
+    out.SetChunkSize(16 * 1024);
+    out.SetChunkCodec(codec);
+    CPPUNIT_ASSERT(out.Open(TRACE_FILE, true, &sigbook));
+    WriteCalls(out, CALL_COUNT);
+    CloseTrace(out);
+}
+
+// The file has the sigbook and all the calls, as read by both readers
+void CheckTrace(const std::vector<std::string>& sigbook)
+{
+    const unsigned short clearId = gApiInfo.NameToId("glClear");
+    CheckReaders(TRACE_FILE, CALL_COUNT,
+        [&](InFileBase&, unsigned short funcId, char* src, unsigned int index) {
+            CPPUNIT_ASSERT(funcId == clearId);
+            CPPUNIT_ASSERT(IsCall(src, index));
+        },
+        [&](InFileBase& in, unsigned int maxSigId) {
+            CPPUNIT_ASSERT(maxSigId == sigbook.size() - 1);
+            for (unsigned short id = 1; id < sigbook.size(); ++id)
+                CPPUNIT_ASSERT(sigbook[id] == in.ExIdToName(id));
+        });
+}
+
+// Patches the sigbook of a trace written with every codec, HEADER_VERSION_6
+// for all but snappy, and checks whether the file had to be rewritten
+void PatchSigBook(const std::vector<std::string>& initial, const std::vector<std::string>& sigbook, bool rewritten)
+{
+    for (unsigned int codec = 0; codec < CHUNK_CODEC_COUNT; ++codec)
+    {
+        WriteTrace((ChunkCodecId)codec, initial);
+
+        TracePatcher patcher;
+        CPPUNIT_ASSERT(patcher.Open(TRACE_FILE));
+        CPPUNIT_ASSERT(patcher.GetSigBook() == initial);
+        patcher.SetSigBook(sigbook);
+        CPPUNIT_ASSERT(patcher.Commit());
+        CPPUNIT_ASSERT(patcher.Rewritten() == rewritten);
+        CheckTrace(sigbook);
+
+        TracePatcher reopened;
+        CPPUNIT_ASSERT(reopened.Open(TRACE_FILE));
+        CPPUNIT_ASSERT(reopened.GetSigBook() == sigbook);
+    }
+}
+
+}
+
+TracePatcherTest::TracePatcherTest()
+{
+}
+
+void TracePatcherTest::setUp()
+{
+}
+
+void TracePatcherTest::tearDown()
+{
+    remove(TRACE_FILE);
+}
+
+void TracePatcherTest::testSameSizeSigBook()
+{
+    // The same names
+    PatchSigBook(InitialSigBook(), InitialSigBook(), false);
+
+    // Two names of the same length in a recorded trace trade places
+    std::vector<std::string> sigbook = FullSigBook();
+    unsigned int id = sigbook.size() - 2;
+    while (id > 1 && (sigbook[id].size() != sigbook[id - 1].size() || sigbook[id] == sigbook[id - 1]))
+        --id;
+    CPPUNIT_ASSERT(id > 1);
+    std::swap(sigbook[id], sigbook[id - 1]);
+    PatchSigBook(FullSigBook(), sigbook, false);
+}
+
+void TracePatcherTest::testSmallerSigBook()
+{
+    std::vector<std::string> sigbook = InitialSigBook();
+    for (unsigned int id = 1; id + 1 < sigbook.size(); ++id)
+        sigbook[id].clear();
+    PatchSigBook(InitialSigBook(), sigbook, false);
+
+    // Only the functions the calls use, as update_dictionary -i keeps them
+    sigbook = InitialSigBook();
+    PatchSigBook(FullSigBook(), sigbook, false);
+    for (unsigned int id = 1; id + 1 < sigbook.size(); ++id)
+        sigbook[id].clear();
+    PatchSigBook(FullSigBook(), sigbook, false);
+}
+
+void TracePatcherTest::testLargerSigBook()
+{
+    // All the functions the reader knows
+    const std::vector<std::string> sigbook = FullSigBook();
+    CPPUNIT_ASSERT(sigbook.size() > InitialSigBook().size());
+    PatchSigBook(InitialSigBook(), sigbook, true);
+}
+
+void TracePatcherTest::testJSONHeader()
+{
+    WriteTrace(CHUNK_CODEC_ZLIB);
+    TracePatcher patcher;
+    CPPUNIT_ASSERT(patcher.Open(TRACE_FILE));
+    Json::Value header = patcher.GetJSONHeader();
+    header["comment"] = "patched";
+    patcher.SetJSONHeader(header);
+    CPPUNIT_ASSERT(patcher.Commit());
+    CPPUNIT_ASSERT(patcher.Rewritten() == false);
+
+    // Too large for the space reserved for it
+    header["comment"] = std::string(1024 * 1024, 'x');
+    patcher.SetJSONHeader(header);
+    CPPUNIT_ASSERT(patcher.Commit());
+    CPPUNIT_ASSERT(patcher.Rewritten() == true);
+    CheckTrace(InitialSigBook());
+
+    InFile in;
+    in.prepareChunks();
+    CPPUNIT_ASSERT(in.Open(TRACE_FILE));
+    CPPUNIT_ASSERT(in.getJSONHeader()["comment"].asString().size() == 1024 * 1024);
+    in.Close();
+}
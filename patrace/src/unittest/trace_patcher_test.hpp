@@ -0,0 +1,29 @@
+#ifndef _INCLUDE_TRACE_PATCHER_TEST_
+#define _INCLUDE_TRACE_PATCHER_TEST_
+
+#include <cppunit/extensions/HelperMacros.h>
+
+class TracePatcherTest : public CPPUNIT_NS::TestFixture
+{
+	CPPUNIT_TEST_SUITE(TracePatcherTest);
+
+    CPPUNIT_TEST(testSameSizeSigBook);
+    CPPUNIT_TEST(testSmallerSigBook);
+    CPPUNIT_TEST(testLargerSigBook);
+    CPPUNIT_TEST(testJSONHeader);
+
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+    TracePatcherTest();
+
+    virtual void setUp();
+    virtual void tearDown();
+
+    void testSameSizeSigBook();
+    void testSmallerSigBook();
+    void testLargerSigBook();
+    void testJSONHeader();
+};
+
+#endif
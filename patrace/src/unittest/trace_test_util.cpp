@@ -0,0 +1,113 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "trace_test_util.hpp"
+#include "common/api_info.hpp"
+#include "common/in_file_ra.hpp"
+
+using namespace common;
+
+namespace trace_test {
+
+const char* const JSON_HEADER = "{\"defaultTid\":0,\"threads\":[]}";
+
+namespace {
+
+// The length of the call header in front of the arguments of MakeCall()
+unsigned int CallHeaderLength()
+{
+    return gApiInfo.NameToLen("glClear") <= (int)sizeof(BCall) ? sizeof(BCall_vlen) : sizeof(BCall);
+}
+
+}
+
+std::vector<char> MakeCall(unsigned int index)
+{
+    BCall_vlen call;
+    call.funcId = gApiInfo.NameToId("glClear");
+    int len = gApiInfo.NameToLen("glClear");
+    const unsigned int header = CallHeaderLength();
+    if (header == sizeof(BCall_vlen))
+    {
+        len = header + sizeof(index);
+        call.toNext = len;
+    }
+    std::vector<char> data(len, 0);
+    memcpy(data.data(), &call, header);
+    memcpy(data.data() + header, &index, std::min(sizeof(index), data.size() - header));
+    return data;
+}
+
+bool IsCall(const char* src, unsigned int index)
+{
+    const std::vector<char> expected = MakeCall(index);
+    const unsigned int header = CallHeaderLength();
+    return memcmp(src, expected.data() + header, expected.size() - header) == 0;
+}
+
+void WriteCalls(OutFile& out, unsigned int count)
+{
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        const std::vector<char> call = MakeCall(i);
+        out.Write(call.data(), call.size());
+    }
+}
+
+void CloseTrace(OutFile& out)
+{
+    out.WriteHeader(JSON_HEADER, strlen(JSON_HEADER));
+    out.Close();
+}
+
+void CheckReaders(const char* name, unsigned int count, const CallCheck& checkCall, const OpenedCheck& checkOpened)
+{
+    void* fptr = NULL;
+    char* src = NULL;
+    unsigned int calls = 0;
+
+    InFile in;
+    in.prepareChunks();
+    CPPUNIT_ASSERT(in.Open(name));
+    if (checkOpened)
+        checkOpened(in, in.GetMaxSigId());
+    BCall_vlen call;
+    while (in.GetNextCall(fptr, call, src))
+        checkCall(in, call.funcId, src, calls++);
+    CPPUNIT_ASSERT(calls == count);
+    in.Close();
+
+    InFileRA inRA;
+    CPPUNIT_ASSERT(inRA.Open(name));
+    if (checkOpened)
+        checkOpened(inRA, inRA.GetMaxSigId());
+    const std::streamoff start = inRA.GetReadPos();
+    std::vector<unsigned short> funcIds;
+    BCall callRA;
+    calls = 0;
+    while (inRA.GetNextCall(fptr, callRA, src))
+    {
+        funcIds.push_back(callRA.funcId);
+        checkCall(inRA, callRA.funcId, src, calls++);
+    }
+    CPPUNIT_ASSERT(calls == count);
+
+    // Skipping the arguments finds the same calls
+    inRA.SetReadPos(start);
+    calls = 0;
+    while (inRA.SkipNextCall(callRA))
+    {
+        CPPUNIT_ASSERT(calls < funcIds.size() && callRA.funcId == funcIds[calls]);
+        calls++;
+    }
+    CPPUNIT_ASSERT(calls == count);
+    inRA.Close();
+    remove((std::string(name) + ".ra").c_str());
+}
+
+}
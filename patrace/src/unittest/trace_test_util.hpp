@@ -0,0 +1,38 @@
+#ifndef _INCLUDE_TRACE_TEST_UTIL_
+#define _INCLUDE_TRACE_TEST_UTIL_
+
+#include <functional>
+#include <vector>
+
+#include "common/in_file.hpp"
+#include "common/out_file.hpp"
+
+// Helpers for the tests that write a trace and read it back
+namespace trace_test {
+
+// The smallest JSON header the readers accept
+extern const char* const JSON_HEADER;
+
+// A glClear call that carries its index, as a variable length call if
+// glClear is not known to be of fixed length
+std::vector<char> MakeCall(unsigned int index);
+// Whether the arguments of a call read back are those of MakeCall(index)
+bool IsCall(const char* src, unsigned int index);
+
+// Writes MakeCall(0) to MakeCall(count - 1)
+void WriteCalls(common::OutFile& out, unsigned int count);
+// Writes the JSON header and closes the file
+void CloseTrace(common::OutFile& out);
+
+typedef std::function<void (common::InFileBase& in, unsigned int maxSigId)> OpenedCheck;
+typedef std::function<void (common::InFileBase& in, unsigned short funcId, char* src, unsigned int index)> CallCheck;
+
+// Reads a trace with InFile and then with InFileRA, which load chunks and
+// blob definitions each in their own way, runs the checks on what both of
+// them read, and asserts that both read count calls. InFileRA also has to
+// find the same calls when it skips their arguments.
+void CheckReaders(const char* name, unsigned int count, const CallCheck& checkCall, const OpenedCheck& checkOpened = OpenedCheck());
+
+}
+
+#endif
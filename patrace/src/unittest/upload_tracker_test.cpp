@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "upload_tracker_test.hpp"
+#include "dispatch/eglimports.hpp"
+#include "tool/upload_tracker.hpp"
+
+namespace {
+
+const unsigned long long KEPT = std::numeric_limits<unsigned long long>::max();
+
+// Feeds calls, by name and with their leading fixed size arguments, to an UploadTracker
+class Calls
+{
+public:
+    Calls()
+        : mSigBook({ "", "eglMakeCurrent", "glActiveTexture", "glBindTexture", "glBindBuffer",
+                     "glBindVertexArray", "glTexImage2D", "glTexSubImage2D", "glBufferData",
+                     "glBufferSubData", "glGenerateMipmap", "glMapBufferRange", "glCopyBufferSubData" })
+        , mTracker(mSigBook)
+        , mCallNo(0)
+    {
+    }
+
+    // Returns the number of the call
+    unsigned long long Add(const char* name, std::vector<unsigned int> args)
+    {
+        common::BCall_vlen call;
+        call.funcId = std::find(mSigBook.begin(), mSigBook.end(), name) - mSigBook.begin();
+        args.resize(8, 0);
+        mTracker.Add(call, (char*)args.data(), mCallNo);
+        return mCallNo++;
+    }
+
+    unsigned long long ReplacedBy(unsigned long long callNo) const { return mTracker.ReplacedBy(callNo); }
+
+private:
+    std::vector<std::string> mSigBook;
+    UploadTracker mTracker;
+    unsigned long long mCallNo;
+};
+
+}
+
+UploadTrackerTest::UploadTrackerTest()
+{
+}
+
+void UploadTrackerTest::setUp()
+{
+}
+
+void UploadTrackerTest::tearDown()
+{
+}
+
+void UploadTrackerTest::testBufferReplaced()
+{
+    Calls calls;
+    calls.Add("glBindBuffer", { GL_ARRAY_BUFFER, 1 });
+    const unsigned long long first = calls.Add("glBufferData", { GL_ARRAY_BUFFER });
+    const unsigned long long partial = calls.Add("glBufferSubData", { GL_ARRAY_BUFFER });
+    calls.Add("glBindBuffer", { GL_ARRAY_BUFFER, 2 });
+    const unsigned long long other = calls.Add("glBufferData", { GL_ARRAY_BUFFER });
+    calls.Add("glBindBuffer", { GL_ARRAY_BUFFER, 1 });
+    const unsigned long long second = calls.Add("glBufferData", { GL_ARRAY_BUFFER });
+
+    CPPUNIT_ASSERT(calls.ReplacedBy(first) == second);
+    CPPUNIT_ASSERT(calls.ReplacedBy(partial) == second);
+    CPPUNIT_ASSERT(calls.ReplacedBy(other) == KEPT);
+    CPPUNIT_ASSERT(calls.ReplacedBy(second) == KEPT);
+
+    // The same buffer name in another context is another buffer
+    calls.Add("eglMakeCurrent", { 1, 2, 2, 7 });
+    calls.Add("glBindBuffer", { GL_ARRAY_BUFFER, 1 });
+    calls.Add("glBufferData", { GL_ARRAY_BUFFER });
+    CPPUNIT_ASSERT(calls.ReplacedBy(second) == KEPT);
+}
+
+void UploadTrackerTest::testTextureReplaced()
+{
+    Calls calls;
+    calls.Add("glBindTexture", { GL_TEXTURE_CUBE_MAP, 3 });
+    const unsigned long long face = calls.Add("glTexImage2D", { GL_TEXTURE_CUBE_MAP_POSITIVE_X, 0 });
+    const unsigned long long otherFace = calls.Add("glTexImage2D", { GL_TEXTURE_CUBE_MAP_NEGATIVE_X, 0 });
+    const unsigned long long level = calls.Add("glTexImage2D", { GL_TEXTURE_CUBE_MAP_POSITIVE_X, 1 });
+
+    // Another unit has another binding
+    calls.Add("glActiveTexture", { GL_TEXTURE1 });
+    calls.Add("glBindTexture", { GL_TEXTURE_CUBE_MAP, 4 });
+    calls.Add("glTexImage2D", { GL_TEXTURE_CUBE_MAP_POSITIVE_X, 0 });
+    CPPUNIT_ASSERT(calls.ReplacedBy(face) == KEPT);
+
+    calls.Add("glActiveTexture", { GL_TEXTURE0 });
+    const unsigned long long replacement = calls.Add("glTexImage2D", { GL_TEXTURE_CUBE_MAP_POSITIVE_X, 0 });
+    CPPUNIT_ASSERT(calls.ReplacedBy(face) == replacement);
+    CPPUNIT_ASSERT(calls.ReplacedBy(otherFace) == KEPT);
+    CPPUNIT_ASSERT(calls.ReplacedBy(level) == KEPT);
+}
+
+void UploadTrackerTest::testVertexArrays()
+{
+    // Each vertex array object has its own element array buffer
+    Calls calls;
+    calls.Add("glBindVertexArray", { 1 });
+    calls.Add("glBindBuffer", { GL_ELEMENT_ARRAY_BUFFER, 5 });
+    const unsigned long long indices = calls.Add("glBufferData", { GL_ELEMENT_ARRAY_BUFFER });
+    calls.Add("glBindVertexArray", { 2 });
+    calls.Add("glBindBuffer", { GL_ELEMENT_ARRAY_BUFFER, 6 });
+    const unsigned long long otherIndices = calls.Add("glBufferData", { GL_ELEMENT_ARRAY_BUFFER });
+
+    // Rebinding the first one restores its element array buffer, which the tracker does not know
+    calls.Add("glBindVertexArray", { 1 });
+    const unsigned long long upload = calls.Add("glBufferData", { GL_ELEMENT_ARRAY_BUFFER });
+    calls.Add("glBindVertexArray", { 2 });
+    calls.Add("glBufferData", { GL_ELEMENT_ARRAY_BUFFER });
+    CPPUNIT_ASSERT(calls.ReplacedBy(indices) == KEPT);
+    CPPUNIT_ASSERT(calls.ReplacedBy(otherIndices) == KEPT);
+    CPPUNIT_ASSERT(calls.ReplacedBy(upload) == KEPT);
+
+    // Until the element array buffer is bound again
+    calls.Add("glBindBuffer", { GL_ELEMENT_ARRAY_BUFFER, 6 });
+    const unsigned long long replacement = calls.Add("glBufferData", { GL_ELEMENT_ARRAY_BUFFER });
+    CPPUNIT_ASSERT(calls.ReplacedBy(otherIndices) == replacement);
+}
+
+void UploadTrackerTest::testPinned()
+{
+    Calls calls;
+    calls.Add("glBindBuffer", { GL_ARRAY_BUFFER, 1 });
+    const unsigned long long mapped = calls.Add("glBufferData", { GL_ARRAY_BUFFER });
+    calls.Add("glMapBufferRange", { GL_ARRAY_BUFFER });
+    calls.Add("glBufferData", { GL_ARRAY_BUFFER });
+    CPPUNIT_ASSERT(calls.ReplacedBy(mapped) == KEPT);
+
+    calls.Add("glBindTexture", { GL_TEXTURE_2D, 2 });
+    const unsigned long long mipmapped = calls.Add("glTexImage2D", { GL_TEXTURE_2D, 0 });
+    calls.Add("glGenerateMipmap", { GL_TEXTURE_2D });
+    calls.Add("glTexImage2D", { GL_TEXTURE_2D, 0 });
+    CPPUNIT_ASSERT(calls.ReplacedBy(mipmapped) == KEPT);
+
+    const unsigned long long copied = calls.Add("glBufferData", { GL_ARRAY_BUFFER });
+    calls.Add("glCopyBufferSubData", { GL_ARRAY_BUFFER, GL_COPY_WRITE_BUFFER });
+    calls.Add("glBufferData", { GL_ARRAY_BUFFER });
+    CPPUNIT_ASSERT(calls.ReplacedBy(copied) == KEPT);
+
+    // Mapping a buffer of an unknown element array binding keeps everything
+    const unsigned long long pending = calls.Add("glBufferData", { GL_ARRAY_BUFFER });
+    calls.Add("glBindVertexArray", { 3 });
+    calls.Add("glMapBufferRange", { GL_ELEMENT_ARRAY_BUFFER });
+    calls.Add("glBufferData", { GL_ARRAY_BUFFER });
+    CPPUNIT_ASSERT(calls.ReplacedBy(pending) == KEPT);
+}
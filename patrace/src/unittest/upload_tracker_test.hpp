@@ -0,0 +1,29 @@
+#ifndef _INCLUDE_UPLOAD_TRACKER_TEST_
+#define _INCLUDE_UPLOAD_TRACKER_TEST_
+
+#include <cppunit/extensions/HelperMacros.h>
+
+class UploadTrackerTest : public CPPUNIT_NS::TestFixture
+{
+	CPPUNIT_TEST_SUITE(UploadTrackerTest);
+
+    CPPUNIT_TEST(testBufferReplaced);
+    CPPUNIT_TEST(testTextureReplaced);
+    CPPUNIT_TEST(testVertexArrays);
+    CPPUNIT_TEST(testPinned);
+
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+    UploadTrackerTest();
+
+    virtual void setUp();
+    virtual void tearDown();
+
+    void testBufferReplaced();
+    void testTextureReplaced();
+    void testVertexArrays();
+    void testPinned();
+};
+
+#endif
@@ -0,0 +1,167 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include "yuv_test.hpp"
+#include "common/yuv_convert.hpp"
+
+// Same rounding as the code under test
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+namespace {
+
+// The pixel by pixel conversion that rgba_to_yuv used before the vector
+// kernels, which they must match byte for byte
+
+int truncate(int num, int min = 0, int max = 255)
+{
+    if (num < min)
+        return min;
+    else if (num > max)
+        return max;
+    return num;
+}
+
+int referenceYV12(unsigned char *rgba, unsigned char *yv12, int width, int height)
+{
+    int y_stride = (width + 15) / 16 * 16;
+    int y_height= height;
+    int y_size = y_stride * y_height;
+    int c_stride = (y_stride / 2 + 15) / 16 * 16;
+    int c_size = c_stride * y_height / 2;
+    int yuv_size = y_size + c_size * 2;
+
+    for (int i = 0; i < y_stride * y_height; ++i) {
+        int y_x = i % y_stride;
+        if (y_x >= width)
+            continue;
+        int y_y = i / y_stride;
+
+        int r = rgba[(y_y * width + y_x) * 4];
+        int g = rgba[(y_y * width + y_x) * 4 + 1];
+        int b = rgba[(y_y * width + y_x) * 4 + 2];
+        int y = 0.299 * r + 0.587 * g + 0.114 * b;
+        yv12[y_y * y_stride + y_x] = truncate(y);
+        if (((y_x & 0x1) == 0) && ((y_y & 0x1) == 0)) {
+            int u = -0.169 * r - 0.331 * g + 0.500 * b + 128;
+            int v =  0.500 * r - 0.419 * g - 0.081 * b + 128;
+            int u_x = y_x / 2;
+            int u_y = y_y / 2;
+            yv12[y_size + u_y * c_stride + u_x] = truncate(v);
+            yv12[y_size + c_size + u_y * c_stride + u_x] = truncate(u);
+        }
+    }
+
+    return yuv_size;
+}
+
+int referenceNV12(unsigned char *rgba, unsigned char *nv12, int width, int height)
+{
+    int y_stride = (width + 15) / 16 * 16;
+    int y_height= height;
+    int y_size = y_stride * y_height;
+    int c_stride = y_stride;
+    int c_size = c_stride * y_height / 2;
+    int yuv_size = y_size + c_size;
+
+    for (int i = 0; i < y_stride * y_height; ++i) {
+        int y_x = i % y_stride;
+        if (y_x >= width)
+            continue;
+        int y_y = i / y_stride;
+
+        int r = rgba[(y_y * width + y_x) * 4];
+        int g = rgba[(y_y * width + y_x) * 4 + 1];
+        int b = rgba[(y_y * width + y_x) * 4 + 2];
+        int y = 0.299 * r + 0.587 * g + 0.114 * b;
+        nv12[y_y * y_stride + y_x] = truncate(y);
+        if (((y_x & 0x1) == 0) && ((y_y & 0x1) == 0)) {
+            int u = -0.169 * r - 0.331 * g + 0.500 * b + 128;
+            int v =  0.500 * r - 0.419 * g - 0.081 * b + 128;
+            int u_x = y_x / 2;
+            int u_y = y_y / 2;
+            nv12[y_size + u_y * c_stride + u_x * 2] = truncate(u);
+            nv12[y_size + u_y * c_stride + u_x * 2 + 1] = truncate(v);
+        }
+    }
+
+    return yuv_size;
+}
+
+// Convert rgba both ways into buffers with the same garbage, large enough
+// for the chroma rows that odd heights write past the end
+bool matchesReference(std::vector<unsigned char> &rgba, int width, int height, unsigned threads)
+{
+    const size_t bufferSize = ((width + 15) / 16 * 16 + 32) * (height + 2) * 2;
+    std::vector<unsigned char> expected(bufferSize), actual(bufferSize);
+    for (size_t i = 0; i < bufferSize; ++i)
+    {
+        expected[i] = actual[i] = i * 7;
+    }
+    if (referenceYV12(rgba.data(), expected.data(), width, height) != image::RGBAtoYV12(rgba.data(), actual.data(), width, height, threads)
+        || expected != actual)
+    {
+        return false;
+    }
+    return referenceNV12(rgba.data(), expected.data(), width, height) == image::RGBAtoNV12(rgba.data(), actual.data(), width, height, threads)
+        && expected == actual;
+}
+
+}
+
+YUVTest::YUVTest()
+{
+}
+
+void YUVTest::setUp()
+{
+}
+
+void YUVTest::tearDown()
+{
+}
+
+void YUVTest::testSizes()
+{
+    // Widths and heights around the vector and band sizes, odd heights included
+    const int sizes[][2] = { { 1, 1 }, { 2, 2 }, { 3, 3 }, { 7, 5 }, { 8, 8 }, { 17, 33 }, { 31, 64 }, { 33, 65 }, { 1280, 720 }, { 1283, 719 } };
+    srand(1);
+    for (const auto &size : sizes)
+    {
+        std::vector<unsigned char> rgba(size[0] * size[1] * 4);
+        for (unsigned char &c : rgba)
+        {
+            c = rand();
+        }
+        CPPUNIT_ASSERT(matchesReference(rgba, size[0], size[1], 1));
+        CPPUNIT_ASSERT(matchesReference(rgba, size[0], size[1], 3));
+    }
+}
+
+void YUVTest::testAllColors()
+{
+    // Every color at an even row and column, so that it goes through both
+    // the luma and the chroma kernels
+    const int width = 512, height = 512;
+    std::vector<unsigned char> rgba(width * height * 4);
+    for (int r = 0; r < 256; ++r)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                unsigned char *p = &rgba[(y * width + x) * 4];
+                p[0] = r;
+                p[1] = x / 2;
+                p[2] = y / 2;
+                p[3] = 255 - r;
+            }
+        }
+        CPPUNIT_ASSERT(matchesReference(rgba, width, height, 0));
+    }
+}
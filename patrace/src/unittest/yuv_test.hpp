@@ -0,0 +1,25 @@
+#ifndef _INCLUDE_YUV_TEST_
+#define _INCLUDE_YUV_TEST_
+
+#include <cppunit/extensions/HelperMacros.h>
+
+class YUVTest : public CPPUNIT_NS::TestFixture
+{
+	CPPUNIT_TEST_SUITE(YUVTest);
+
+    CPPUNIT_TEST(testSizes);
+    CPPUNIT_TEST(testAllColors);
+
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+    YUVTest();
+
+    virtual void setUp();
+    virtual void tearDown();
+
+    void testSizes();
+    void testAllColors();
+};
+
+#endif